@@ -3,32 +3,357 @@
 #include <sys/socket.h> 
 #include <arpa/inet.h> 
 #include <stdlib.h> 
+#include <limits.h>
 #include <netinet/in.h> 
+#include <netinet/tcp.h>
 #include <string.h> 
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <set>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <atomic>
 #include <queue> 
 #include <iostream>
 #include <stdarg.h>
 #include <pthread.h>
 #include <sys/types.h>
 #include <sys/syscall.h>
+#include <sys/epoll.h>
+#include <sys/uio.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
 #include "mensaje.pb.h"
 
 using namespace std;
 using namespace chat;
+using google::protobuf::Arena;
 
 #ifndef MESSAGE_SIZE
 #define MESSAGE_SIZE 8192
 #endif
 
+/* Default accept backlog, the kernel caps it at net.core.somaxconn */
 #ifndef MAX_QUEUE
-#define MAX_QUEUE 20
+#define MAX_QUEUE 4096
 #endif
 
+/* Time a connection has to send its sync and ACK before it is closed */
+#ifndef HANDSHAKE_TIMEOUT_MS
+#define HANDSHAKE_TIMEOUT_MS 10000
+#endif
+
+/* How often the event loops look for handshakes that timed out */
+#ifndef HANDSHAKE_SWEEP_MS
+#define HANDSHAKE_SWEEP_MS 250
+#endif
+
+/* Longest channel name */
+#ifndef CHANNEL_NAME_SIZE
+#define CHANNEL_NAME_SIZE 64
+#endif
+
+/* Most users in a connected users page, a page is also cut before it reaches MESSAGE_SIZE */
+#ifndef USERS_PAGE_SIZE
+#define USERS_PAGE_SIZE 100
+#endif
+
+#define LOG_LEVEL_ERROR 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_DEBUG 2
+
+/* Records above this level are removed at compile time */
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL LOG_LEVEL_INFO
+#endif
+
+#ifndef LOG_RING_SIZE
+#define LOG_RING_SIZE 128
+#endif
+
+#ifndef LOG_RECORD_SIZE
+#define LOG_RECORD_SIZE 248
+#endif
+
+#ifndef LOG_BATCH_SIZE
+#define LOG_BATCH_SIZE 65536
+#endif
+
+void log_init( FILE *sink );
+void log_set_level( int level );
+int log_enabled( int level );
+void log_write( int level, const char *fmt, ... ) __attribute__(( format( printf, 2, 3 ) ));
+void log_flush();
+void log_close();
+unsigned long log_dropped();
+
+#define LOG_ERROR( ... ) log_write( LOG_LEVEL_ERROR, __VA_ARGS__ )
+
+/* Compiled out levels keep their arguments checked and used, the call is never made */
+#if LOG_COMPILE_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO( ... ) log_write( LOG_LEVEL_INFO, __VA_ARGS__ )
+#else
+#define LOG_INFO( ... ) do { if( 0 ) log_write( LOG_LEVEL_INFO, __VA_ARGS__ ); } while( 0 )
+#endif
+
+#if LOG_COMPILE_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG( ... ) log_write( LOG_LEVEL_DEBUG, __VA_ARGS__ )
+#else
+#define LOG_DEBUG( ... ) do { if( 0 ) log_write( LOG_LEVEL_DEBUG, __VA_ARGS__ ); } while( 0 )
+#endif
+
+#ifndef FRAME_HEADER_SIZE
+#define FRAME_HEADER_SIZE 4
+#endif
+
+#ifndef MAX_FRAME_SIZE
+#define MAX_FRAME_SIZE ( 16 * 1024 * 1024 )
+#endif
+
+#ifndef IOV_BATCH
+#define IOV_BATCH 64
+#endif
+
+/* How long deliveries to a batching client wait to be coalesced, in microseconds */
+#ifndef BATCH_WINDOW_US
+#define BATCH_WINDOW_US 1000
+#endif
+
+/* Held deliveries are sent as soon as they reach this many bytes */
+#ifndef BATCH_MAX_BYTES
+#define BATCH_MAX_BYTES ( 16 * 1024 )
+#endif
+
+#ifndef OUT_MAX_BYTES
+#define OUT_MAX_BYTES ( 4 * 1024 * 1024 )
+#endif
+
+#ifndef OUT_MAX_FRAMES
+#define OUT_MAX_FRAMES 4096
+#endif
+
+#ifndef MAX_EVENTS
+#define MAX_EVENTS 256
+#endif
+
+#ifndef URING_ENTRIES
+#define URING_ENTRIES 4096
+#endif
+
+/* Provided receive buffers of every io_uring worker, must be a power of two */
+#ifndef URING_BUFFERS
+#define URING_BUFFERS 1024
+#endif
+
+#ifndef URING_BUFFER_SIZE
+#define URING_BUFFER_SIZE 4096
+#endif
+
+/* Requests handled by an io_uring worker between two send submissions */
+#ifndef URING_FRAME_BUDGET
+#define URING_FRAME_BUDGET 256
+#endif
+
+/* Frames gathered by one io_uring send, up to UIO_MAXIOV */
+#ifndef URING_IOV_BATCH
+#define URING_IOV_BATCH 1024
+#endif
+
+/* Unhandled input bytes buffered on a connection before the server stops reading it */
+#ifndef URING_MAX_PENDING
+#define URING_MAX_PENDING ( 64 * 1024 )
+#endif
+
+/* Slots of every worker to worker mailbox, must be a power of two */
+#ifndef MAILBOX_SIZE
+#define MAILBOX_SIZE 4096
+#endif
+
+/* Received messages of each type the client listener holds for its consumer, must be a power of two */
+#ifndef NOTIFY_RING_SIZE
+#define NOTIFY_RING_SIZE 8192
+#endif
+
+/* Bytes of requests a client holds while it is not logged in, the ones after them fail */
+#ifndef CLIENT_HELD_BYTES
+#define CLIENT_HELD_BYTES 4194304
+#endif
+
+/* Messages of each type the command line interface keeps to show again */
+#ifndef SHOWN_MESSAGES
+#define SHOWN_MESSAGES 50
+#endif
+
+/* First block of a request arena, kept across resets */
+#ifndef ARENA_BLOCK_SIZE
+#define ARENA_BLOCK_SIZE 8192
+#endif
+
+/* Size of every message log segment file */
+#ifndef MSG_LOG_SEGMENT_SIZE
+#define MSG_LOG_SEGMENT_SIZE ( 64 * 1024 * 1024 )
+#endif
+
+/* Direct messages kept for one offline user before new ones are refused */
+#ifndef MSG_LOG_MAX_PENDING
+#define MSG_LOG_MAX_PENDING 10000
+#endif
+
+/* Bytes of direct messages kept for all offline users before new ones are refused */
+#ifndef MSG_LOG_MAX_BYTES
+#define MSG_LOG_MAX_BYTES ( 1024L * 1024 * 1024 )
+#endif
+
+/* Recent broadcasts and direct messages kept in memory for reconnecting clients, power of two */
+#ifndef HISTORY_SIZE
+#define HISTORY_SIZE ( 128 * 1024 )
+#endif
+
+/* Message bytes of one history page */
+#ifndef HISTORY_PAGE_BYTES
+#define HISTORY_PAGE_BYTES ( 64 * 1024 )
+#endif
+
+/* Messages looked at for one history page, most of them can be for other users */
+#ifndef HISTORY_SCAN
+#define HISTORY_SCAN ( 64 * 1024 )
+#endif
+
+/* Messages of the history ring looked at while holding its lock */
+#ifndef HISTORY_LOCK_SCAN
+#define HISTORY_LOCK_SCAN 256
+#endif
+
+/* Messages of every history file on disk and how many files are kept */
+#ifndef HISTORY_FILE_ENTRIES
+#define HISTORY_FILE_ENTRIES ( 1024 * 1024 )
+#endif
+
+#ifndef HISTORY_FILES
+#define HISTORY_FILES 8
+#endif
+
+/* Metric shards, every thread updates the one it was given so hot paths rarely share a line */
+#ifndef METRIC_SHARDS
+#define METRIC_SHARDS 16
+#endif
+
+/* Counter slots of one shard, a histogram takes METRIC_HIST_BUCKETS + 2 of them */
+#ifndef METRIC_SLOTS
+#define METRIC_SLOTS 8192
+#endif
+
+/* Histogram buckets: values under 2 * METRIC_HIST_SUB are exact, then METRIC_HIST_SUB per power of two */
+#ifndef METRIC_HIST_SUB
+#define METRIC_HIST_SUB 8
+#endif
+
+#ifndef METRIC_HIST_SHIFTS
+#define METRIC_HIST_SHIFTS 32
+#endif
+
+#define METRIC_HIST_BUCKETS ( METRIC_HIST_SUB * ( METRIC_HIST_SHIFTS + 2 ) )
+
+/* Client message options counted by the server metrics, 0 is any invalid option */
+#define CLIENT_OPTIONS 12
+
 #ifndef gettid
 #define gettid() syscall(SYS_gettid)
 #endif
 
+#ifndef FrameBuffer
+class FrameBuffer {
+    public:
+        FrameBuffer();
+        void append( const char *data, size_t len );
+        int read_from( int fd );
+        int next_frame( string *frame );
+        size_t pending();
+    private:
+        string _buf;
+        size_t _start;
+        void compact();
+};
+#endif
+
+/* Encoded frames are immutable and shared by every recipient of a message */
+typedef shared_ptr<const string> frame_ptr;
+
+/* What to do when a connection outbound queue is over its limits */
+#ifndef overflow_policy
+enum overflow_policy {
+    DROP_OLDEST_BROADCAST,
+    DROP_NEWEST,
+    DISCONNECT
+};
+#endif
+
+#ifndef queued_frame
+struct queued_frame {
+    frame_ptr frame;
+    int broadcast;
+    int delivery;
+};
+#endif
+
+#ifndef send_queue
+struct send_queue {
+    int fd;
+    int wake_fd;
+    pthread_mutex_t mutex;
+    deque<queued_frame> frames;
+    size_t offset;
+    size_t bytes;
+    size_t max_bytes;
+    size_t max_frames;
+    overflow_policy policy;
+    int overflowed;
+    size_t in_flight;
+    long batch_window_us;
+    size_t batch_max_bytes;
+    size_t held;
+    size_t held_bytes;
+    long held_since;
+    /* Written by the owner under mutex, read without it by the threads that fan out */
+    atomic<int> presence;
+    atomic<unsigned long> since;
+    unsigned long dropped;
+    unsigned long disconnects;
+};
+#endif
+
+/* Protobuf arena for the messages of one request, reset once its responses are sent */
+#ifndef request_arena
+struct request_arena {
+    char block[ ARENA_BLOCK_SIZE ];
+    Arena arena;
+    request_arena();
+};
+#endif
+
+void encode_frame( const string &payload, string *out );
+frame_ptr encode_message( const google::protobuf::Message &msg );
+frame_ptr encode_batch( const vector<frame_ptr> &frames );
+int write_all( int fd, const char *data, size_t len );
+shared_ptr<send_queue> new_send_queue( int fd, int with_wakeup, size_t max_bytes, size_t max_frames, overflow_policy policy );
+long monotonic_us();
+long monotonic_ns();
+int enqueue_frame( send_queue *q, frame_ptr frame, int broadcast, int delivery = 0 );
+long release_batch( send_queue *q );
+int gather_frames( send_queue *q, struct iovec *iov, int max_iov );
+void consume_sent( send_queue *q, size_t sent );
+int flush_send_queue( send_queue *q );
+int wait_readable( send_queue *q, long deadline_us = 0 );
+void close_send_queue( send_queue *q );
+
 #ifndef connected_user
 struct connected_user {
     int id;
@@ -38,10 +363,45 @@ struct connected_user {
 };
 #endif
 
+/* Entry of the client user cache, generation tells apart the users a full listing still has */
+#ifndef cached_user
+struct cached_user {
+    connected_user user;
+    unsigned long generation;
+};
+#endif
+
+/*
+* Client side copy of the connected users, keyed by id with an index by username. Presence
+* deltas and listings update the entries in place, a full listing or snapshot is applied between
+* begin_refresh and end_refresh and removes the users it did not have. Not locked, the Client
+* guards it with its connected users mutex.
+*/
+#ifndef UserCache
+class UserCache {
+    public:
+        UserCache();
+        const connected_user * find( int id ) const;
+        const connected_user * find( const string &name ) const;
+        int put( const ConnectedUser &usr );
+        int remove( const string &name );
+        void begin_refresh();
+        void end_refresh();
+        void clear();
+        size_t size() const;
+        void list( map <string, connected_user> *out ) const;
+    private:
+        unordered_map<int, cached_user> _users;
+        unordered_map<string, int> _by_name;
+        unsigned long _generation;
+};
+#endif
+
 #ifndef message_type
 enum message_type {
     BROADCAST,
-    DIRECT
+    DIRECT,
+    CHANNEL
 };
 #endif
 
@@ -54,7 +414,12 @@ enum server_message_options {
     CONNECTEDUSERRESPONSE = 5,
     CHANGESTATUSRESPONSE = 6,
     BROADCASTRESPONSE = 7,
-    DIRECTMESSAGERESPONSE = 8
+    DIRECTMESSAGERESPONSE = 8,
+    BATCH = 9,
+    PRESENCEUPDATE = 10,
+    CHANNELRESPONSE = 11,
+    CHANNELMESSAGES = 12,
+    HISTORYRESPONSE = 13
 };
 #endif
 
@@ -66,7 +431,20 @@ enum client_message_options {
     CHANGESTATUS = 3,
     BROADCASTC = 4,
     DIRECTMESSAGE = 5,
-    ACKNOWLEDGE = 6
+    ACKNOWLEDGE = 6,
+    PRESENCEREQUEST = 7,
+    JOINCHANNEL = 8,
+    LEAVECHANNEL = 9,
+    CHANNELMESSAGE = 10,
+    HISTORYREQUEST = 11
+};
+#endif
+
+#ifndef presence_kind
+enum presence_kind {
+    PRESENCE_JOIN = 1,
+    PRESENCE_LEAVE = 2,
+    PRESENCE_STATUS = 3
 };
 #endif
 
@@ -74,11 +452,46 @@ enum client_message_options {
 struct message_received {
     int from_id;
     string from_username;
+    string channel;
     message_type type;
     string message;
 };
 #endif
 
+/* Lock free single producer single consumer ring from the client listener to its consumer */
+#ifndef message_ring
+struct message_ring {
+    message_received items[ NOTIFY_RING_SIZE ];
+    atomic<unsigned long> head;
+    atomic<unsigned long> tail;
+};
+#endif
+
+/* Completion of a client request, runs on the listener thread */
+typedef void ( *request_cb )( void *context, const ServerMessage &res );
+
+#ifndef pending_call
+struct pending_call {
+    request_cb cb;
+    void *context;
+};
+#endif
+
+/* Where a client connection is, CONNECTING and SYNCING only happen on non-blocking clients */
+#ifndef client_state
+enum client_state {
+    CLIENT_DISCONNECTED,
+    CLIENT_CONNECTING,
+    CLIENT_SYNCING,
+    CLIENT_ESTABLISHED,
+    CLIENT_RECONNECTING,
+    CLIENT_CLOSED
+};
+#endif
+
+/* Received message handed to an embedding program instead of the rings */
+typedef void ( *message_cb )( void *context, const message_received &msg );
+
 #ifndef Client
 class Client {
     public:
@@ -87,44 +500,119 @@ class Client {
         int _user_id;
         char * _username;
         Client( char * username, FILE *log_level = stdout );
+        ~Client();
         int connect_server(char *server_address, int server_port);
         int log_in();
-        int send_request(ClientMessage req);
-        int read_message( void * buff );
-        ServerMessage parse_response( char *res );
+        int connect_async( const struct sockaddr_in *serv, const struct sockaddr_in *local = NULL );
+        int fd();
+        client_state state();
+        short poll_events();
+        int on_readable();
+        int on_writable();
+        void set_message_handler( message_cb cb, void *context );
+        void set_presence( int enabled );
+        void set_reconnect( long base_ms, long max_ms );
+        long next_timeout();
+        int on_timeout();
+        int send_request( const ClientMessage &req );
+        int read_message( string *res );
+        ServerMessage parse_response( const string &res );
         int get_connected_request();
-        int change_status( string n_st );
-        int broadcast_message( string msg );
-        int direct_message( string msg, int dest_id = -1, string dest_nm = "" );
-        int process_response( ServerMessage res );
+        int change_status( string n_st, request_cb cb = NULL, void *context = NULL );
+        int broadcast_message( string msg, request_cb cb = NULL, void *context = NULL );
+        int direct_message( string msg, int dest_id = -1, string dest_nm = "", request_cb cb = NULL, void *context = NULL );
+        int channel_request( int option, string channel, request_cb cb = NULL, void *context = NULL );
+        int channel_message( string msg, string channel, request_cb cb = NULL, void *context = NULL );
+        size_t pending_requests();
         string get_last_error();
-        void start_session();
+        int pop_error_message( string * buf );
+        map <string, connected_user> get_connected_users();
+        connected_user get_connected_user( string name );
+        connected_user get_connected_user( int id );
+        unsigned long users_updates();
+        int start_listener();
         void stop_session();
         void handle_error( ErrorResponse err );
+        void push_res( const ServerMessage &el );
+        int pop_to_buffer( message_type mtype, message_received * buf );
+        int pop_batch( message_type mtype, vector<message_received> *out, size_t max );
+        int notify_fd();
+        unsigned long dropped_messages();
         static void * bg_listener( void * context );
     private:
-        FILE *_log_level;
-        pthread_mutex_t _noti_queue_mutex;
-        queue <message_received> _dm_queue;
-        queue <message_received> _br_queue;
+        FrameBuffer _in_frames;
+        int _nonblocking;
+        client_state _state;
+        string _out;
+        size_t _out_off;
+        string _held;
+        int _resuming;
+        unsigned long _resume_cursor;
+        struct sockaddr_in _local_addr;
+        int _has_local;
+        long _reconnect_base_ms;
+        long _reconnect_max_ms;
+        int _backoff_attempt;
+        long _retry_us;
+        unsigned _jitter_seed;
+        unordered_set<unsigned> _held_ids;
+        string _status;
+        set<string> _channels;
+        int start_connect();
+        void lose_connection();
+        long backoff_us();
+        int reconnect_blocking();
+        void restore_frames( string *out );
+        void track_session( const ServerMessage &res );
+        void build_sync( ClientMessage *msg );
+        int accept_login( const ServerMessage &res );
+        int send_frame( const string &frame, int handshake, unsigned id = 0 );
+        int flush_output();
+        int handle_frame( const string &frame );
+        void dispatch_response( const ServerMessage &res );
+        void close_connection();
+        pthread_mutex_t _cursor_mutex;
+        atomic<message_ring *> _rings;
+        message_ring * get_ring( message_type mtype );
+        int queue_res( const ServerMessage &el, unsigned long *sequence );
+        message_cb _on_message;
+        void *_on_message_context;
+        atomic<int> _noti_fd;
+        atomic<unsigned long> _dropped;
+        atomic<unsigned long> _users_updates;
+        void notify();
+        pthread_t _listener;
+        int _listening;
+        pthread_mutex_t _pending_mutex;
+        unordered_map<unsigned, pending_call> _pending;
+        unsigned _next_request;
+        int send_tracked( ClientMessage &req, request_cb cb, void *context );
+        void complete_request( const ServerMessage &res );
+        void fail_requests( const char *reason, int keep_held );
         pthread_mutex_t _connected_users_mutex;
-        map <string, connected_user> _connected_users;
-        map <string, connected_user> get_connected_users();
-        void set_connected_users( map <string, connected_user> cn_u );
-        connected_user get_connected_user( string name );
-        connected_user get_connected_user( int id );
+        UserCache _connected_users;
+        int _users_paging;
+        int _presence;
+        unsigned long _presence_version;
+        int _presence_stale;
+        unsigned long _last_sequence;
+        unsigned long _history_after;
+        unsigned long _history_until;
+        string _resume_token;
         pthread_mutex_t _error_queue_mutex;
         queue <ErrorResponse> _error_queue;
         void add_error( ErrorResponse err );
-        int pop_error_message( string * buf );
         int _close_issued;
+        pthread_mutex_t _send_mutex;
         pthread_mutex_t _stop_mutex;
         int get_stopped_status();
         void send_stop();
-        message_received pop_res( message_type mtype );
-        int pop_to_buffer( message_type mtype, message_received * buf );
-        void push_res( ServerMessage el );
-        map <string, connected_user> parse_connected_users( ConnectedUserResponse c_usr );
+        void parse_connected_users( const ConnectedUserResponse &c_usr );
+        void load_connected_users( const ConnectedUserResponse &c_usr );
+        void resolve_sender( message_received *msg );
+        int request_users_page( const string &cursor );
+        void apply_presence( const PresenceUpdate &up );
+        void next_history_page( const HistoryResponse &page );
 };
 #endif
 
@@ -138,6 +626,428 @@ struct client_info {
     string name;
     string ip;
     string status;
+    shared_ptr<send_queue> out;
+    int worker;
+    string token;
+};
+#endif
+
+#ifndef server_mode
+enum server_mode {
+    THREADED,
+    EVENT_LOOP,
+    WORKERS
+};
+#endif
+
+#ifndef io_backend
+enum io_backend {
+    EPOLL_BACKEND,
+    URING_BACKEND
+};
+#endif
+
+/* Submission and completion rings of an io_uring instance plus its provided receive buffers */
+#ifndef uring
+struct uring {
+    int fd;
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_array;
+    unsigned sq_mask;
+    unsigned sq_entries;
+    unsigned sq_local_tail;
+    struct io_uring_sqe *sqes;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned cq_mask;
+    struct io_uring_cqe *cqes;
+    void *sq_map;
+    size_t sq_map_size;
+    size_t sqes_size;
+    struct io_uring_buf_ring *buf_ring;
+    char *buffers;
+    unsigned buf_count;
+    unsigned buf_size;
+    unsigned short buf_tail;
+    unsigned long enters;
+};
+#endif
+
+int uring_init( uring *r, unsigned entries );
+int uring_setup_buffers( uring *r, unsigned count, unsigned size );
+struct io_uring_sqe * uring_get_sqe( uring *r );
+int uring_submit( uring *r, unsigned wait_nr, int timeout_ms );
+unsigned uring_cq_ready( uring *r );
+struct io_uring_cqe * uring_peek_cqe( uring *r );
+void uring_cqe_seen( uring *r );
+char * uring_buffer( uring *r, int bid );
+void uring_recycle_buffer( uring *r, int bid );
+void uring_exit( uring *r );
+
+/* Async send of a connection on the io_uring backend, stays untouched until it completes */
+#ifndef uring_send
+struct uring_send {
+    struct msghdr msg;
+    struct iovec iov[ URING_IOV_BATCH ];
+    vector<frame_ptr> frames;
+};
+#endif
+
+#ifndef mail_kind
+enum mail_kind {
+    MAIL_DELIVER,
+    MAIL_BROADCAST
+};
+#endif
+
+/* Work handed from one worker to the owner of the recipient connections */
+#ifndef mail_item
+struct mail_item {
+    mail_kind kind;
+    shared_ptr<send_queue> out;
+    frame_ptr frame;
+    int broadcast;
+    int delivery;
+    int presence;
+    unsigned long sequence;
+    string exclude;
+};
+#endif
+
+/* Lock free single producer single consumer ring, one per pair of workers */
+#ifndef mailbox
+struct mailbox {
+    mail_item items[ MAILBOX_SIZE ];
+    atomic<unsigned long> head;
+    atomic<unsigned long> tail;
+};
+#endif
+
+mailbox * new_mailbox();
+int mailbox_push( mailbox *mb, const mail_item &item );
+int mailbox_pop( mailbox *mb, mail_item *item );
+
+#ifndef conn_phase
+enum conn_phase {
+    AWAITING_SYNC,
+    REGISTERING,
+    AWAITING_ACK,
+    ESTABLISHED
+};
+#endif
+
+struct event_worker;
+
+#ifndef connection
+struct connection {
+    int fd;
+    conn_phase phase;
+    client_info info;
+    FrameBuffer in_buf;
+    event_worker *worker;
+    uring_send *send;
+    int sending;
+    int dirty;
+    int ops;
+    int recv_armed;
+    int resume;
+    int batching;
+    int closing;
+    MyInfoSynchronize sync;
+    long handshake_deadline;
+};
+#endif
+
+typedef unordered_map<int, client_info> user_map;
+
+#ifndef user_table
+struct user_table {
+    unsigned long version;
+    user_map users;
+    unordered_map<string, int> by_name;
+    unordered_map<string, int> by_ip;
+    map<string, int> ordered_names;
+    const client_info * find( int id ) const;
+    const client_info * find( const string &name ) const;
+    const client_info * find_ip( const string &ip ) const;
+    int list( const connectedUserRequest &req, ConnectedUserResponse *out ) const;
+};
+#endif
+
+typedef shared_ptr<const user_table> user_snapshot;
+
+class Server;
+
+/* One event loop thread: owns its listening socket, epoll instance and connections */
+#ifndef event_worker
+struct event_worker {
+    int id;
+    int epoll_fd;
+    int listen_fd;
+    int wake_fd;
+    int cpu;
+    pthread_t thread;
+    Server *server;
+    uring *ring;
+    map<int, connection *> conns;
+    vector<connection *> closed_conns;
+    vector<connection *> dirty;
+    vector<connection *> resume;
+    vector<connection *> batching;
+    vector<connection *> joining;
+    vector<connection *> closing;
+    vector<client_info> leaving;
+    int handshaking;
+    long next_sweep;
+    vector<mailbox *> inbox;
+    vector< deque<mail_item> > backlog;
+    vector<int> notify;
+    request_arena *arena;
+};
+#endif
+
+#ifndef UserRegistry
+class UserRegistry {
+    public:
+        UserRegistry();
+        user_snapshot snapshot() const;
+        unsigned long version() const;
+        int add( const client_info &el, unsigned long *version = NULL );
+        int add_all( const vector<client_info> &els, vector<int> *results = NULL, unsigned long *version = NULL );
+        int remove( const string &name, client_info *out = NULL, unsigned long *version = NULL, int id = 0 );
+        int remove_all( const vector<client_info> &els, vector<client_info> *removed = NULL, unsigned long *version = NULL );
+        int set_status( const string &name, const string &status, client_info *out, unsigned long *version = NULL );
+    private:
+        pthread_mutex_t _write_mutex;
+        user_snapshot _current;
+        atomic<unsigned long> _version;
+        static int can_add( const user_table &table, const client_info &el );
+        static void insert( user_table *table, const client_info &el );
+        unsigned long publish( shared_ptr<user_table> next );
+};
+#endif
+
+/* Members of a channel, never changed once published so a fan-out can walk it without locks */
+typedef vector<client_info> channel_members;
+typedef shared_ptr<const channel_members> member_list;
+
+/* A channel keeps its place in the table, joins and leaves only swap its member list */
+#ifndef channel
+struct channel {
+    member_list members;
+};
+#endif
+
+#ifndef channel_table
+struct channel_table {
+    unordered_map<string, shared_ptr<channel> > channels;
+    member_list find( const string &name ) const;
+};
+#endif
+
+typedef shared_ptr<const channel_table> channel_snapshot;
+
+#ifndef ChannelRegistry
+class ChannelRegistry {
+    public:
+        ChannelRegistry();
+        member_list members( const string &channel ) const;
+        int join( const string &channel, const client_info &cl );
+        int leave( const string &channel, int id );
+        void leave_all( int id );
+    private:
+        pthread_mutex_t _write_mutex;
+        channel_snapshot _current;
+        unordered_map<int, vector<string> > _by_user;
+        void remove_member( const string &channel, int id, shared_ptr<channel_table> *next );
+};
+#endif
+
+/* One fixed size file of the message log, mapped for its whole size */
+#ifndef log_segment
+struct log_segment {
+    long base;
+    int fd;
+    char *map;
+    size_t size;
+    size_t used;
+    long pending;
+    int dirty;
+    string path;
+    ~log_segment();
+};
+#endif
+
+/*
+* Append only log of the direct messages to offline users, see MessageLog.cpp.
+* Offsets are global: segment base plus position in the segment.
+*/
+#ifndef MessageLog
+class MessageLog {
+    public:
+        MessageLog();
+        ~MessageLog();
+        int initiate( const string &dir, size_t segment_size = MSG_LOG_SEGMENT_SIZE );
+        long append( const string &recipient, const string &message );
+        int wait_durable( long offset );
+        size_t take( const string &recipient, size_t max_bytes, size_t max_count, vector<string> *messages );
+        size_t pending( const string &recipient );
+        size_t pending_total();
+        size_t pending_bytes();
+        long syncs();
+    private:
+        pthread_mutex_t _mutex;
+        pthread_cond_t _work;
+        pthread_cond_t _synced;
+        pthread_t _flusher;
+        int _running;
+        string _dir;
+        size_t _segment_size;
+        map<long, shared_ptr<log_segment> > _segments;
+        unordered_map<string, deque<long> > _pending;
+        size_t _pending_total;
+        size_t _pending_bytes;
+        vector< shared_ptr<log_segment> > _dirty;
+        long _written;
+        long _durable;
+        long _syncs;
+        static void * flusher_h( void * context );
+        void flush_loop();
+        int open_segment( long base, int create );
+        int recover( log_segment *seg );
+        long write_record( int kind, const string &name, const char *data, size_t size );
+        log_segment * segment_for( long offset );
+        size_t record_size( long offset );
+        void drop_segments();
+};
+#endif
+
+/* A sequenced broadcast (to is empty) or direct message and its encoded frame */
+#ifndef history_entry
+struct history_entry {
+    unsigned long seq;
+    string from;
+    string to;
+    frame_ptr frame;
+};
+#endif
+
+/* File of messages that left the history ring, index has the offset of every 1024th one */
+#ifndef history_file
+struct history_file {
+    unsigned long base;
+    int fd;
+    size_t size;
+    vector<size_t> index;
+    string path;
+    ~history_file();
+};
+#endif
+
+/*
+* Sequence numbers and recent history of the broadcasts and direct messages, see History.cpp
+*/
+#ifndef History
+class History {
+    public:
+        History();
+        int initiate( size_t entries, const string &dir );
+        unsigned long sequence();
+        frame_ptr add( ServerMessage *msg, const string &from, const string &to );
+        int read( unsigned long after, unsigned long until, const string &name, size_t max_bytes, vector<frame_ptr> *out, unsigned long *last, int *truncated );
+    private:
+        pthread_mutex_t _mutex;
+        vector<history_entry> _ring;
+        size_t _size;
+        unsigned long _sequence;
+        string _dir;
+        map<unsigned long, shared_ptr<history_file> > _files;
+        string _spill;
+        void spill( const history_entry &entry );
+        void write_spill();
+        unsigned long read_file( shared_ptr<history_file> file, size_t size, unsigned long after, unsigned long end, const string &name, size_t max_bytes, vector<frame_ptr> *out );
+};
+#endif
+
+#ifndef metric_kind
+enum metric_kind {
+    METRIC_COUNTER,
+    METRIC_GAUGE,
+    METRIC_HISTOGRAM
+};
+#endif
+
+/* Value of a gauge, computed when the metrics are scraped */
+typedef long ( *metric_fn )( void *context );
+
+#ifndef metric_info
+struct metric_info {
+    string name;
+    string labels;
+    string help;
+    metric_kind kind;
+    int slot;
+    double scale;
+    metric_fn fn;
+    void *context;
+};
+#endif
+
+#ifndef metric_shard
+struct metric_shard {
+    atomic<long> slots[ METRIC_SLOTS ];
+};
+#endif
+
+/*
+* Counters, gauges and log linear histograms exposed in the Prometheus text format, see Metrics.cpp
+*/
+#ifndef Metrics
+class Metrics {
+    public:
+        Metrics();
+        ~Metrics();
+        int counter( const string &name, const string &help, const string &labels = "" );
+        int gauge( const string &name, const string &help, metric_fn fn, void *context, const string &labels = "" );
+        int histogram( const string &name, const string &help, double scale, const string &labels = "" );
+        void add( int id, long value = 1 );
+        void observe( int id, long value );
+        long total( int id );
+        string scrape();
+        int serve( const char *address );
+    private:
+        pthread_mutex_t _mutex;
+        vector<metric_info> _metrics;
+        int _next_slot;
+        atomic<metric_shard *> _shards[ METRIC_SHARDS ];
+        int _admin_fd;
+        string _admin_path;
+        pthread_t _admin;
+        atomic<int> _running;
+        metric_shard * shard();
+        int reserve( const metric_info &info, int slots );
+        void write_histogram( const metric_info &info, string *out, string *quantiles );
+        static void * admin_h( void * context );
+        void admin_loop();
+};
+#endif
+
+/* Ids of the server metrics */
+#ifndef server_metrics
+struct server_metrics {
+    int accepted;
+    int closed;
+    int logins;
+    int login_failures;
+    int requests[ CLIENT_OPTIONS ];
+    int latency[ CLIENT_OPTIONS ];
+    int bytes_in;
+    int bytes_out;
+    int fanout;
+    int dropped;
+    int send_errors;
+    int handshake_timeouts;
 };
 #endif
 
@@ -146,37 +1056,122 @@ class Server {
     public:
         struct sockaddr_in _serv_addr, _cl_addr;
         int _sock;
-        int _user_count;
+        atomic<int> _user_count;
         int _port;
-        Server( int port, FILE *log_level = stdout );
+        server_mode _mode;
+        Server( int port, FILE *log_level = stdout, server_mode mode = THREADED );
         int initiate();
         void start();
+        void start_event_loop();
+        void start_workers();
+        void set_workers( int n_workers );
+        void set_backend( io_backend backend );
+        void set_backlog( int backlog );
+        void set_handshake_timeout( long timeout_ms );
         int listen_connections();
-        int read_request( int fd, void *buf );
-        int send_response( int sock_fd, struct sockaddr_in *dest, ServerMessage res );
-        ServerMessage process_request( ClientMessage cl_msg, client_info cl = {} );
-        ServerMessage broadcast_message( BroadcastRequest req, client_info sender );
-        ServerMessage send_to_all( string msg );
-        ServerMessage direct_message( DirectMessageRequest req, client_info sender );
-        ServerMessage error_response( string msg );
-        string register_user( MyInfoSynchronize req, client_info cl );
-        ServerMessage get_connected_users();
-        ServerMessage change_user_status( ChangeStatusRequest req, string name );
-        ClientMessage parse_request( char *req );
-        void send_all( ServerMessage res, string sender );
+        int accept_connections( event_worker *w );
+        int read_request( const client_info &cl, FrameBuffer *in, string *req, long deadline_us = 0 );
+        client_info new_client( int fd, struct sockaddr_in addr );
+        int send_response( const client_info &cl, const ServerMessage &res );
+        int send_frame( const client_info &cl, frame_ptr frame, int broadcast = 0, int delivery = 0 );
+        void set_outbound_limits( size_t max_bytes, size_t max_frames, overflow_policy policy );
+        void set_batching( long window_us, size_t max_bytes );
+        ServerMessage * process_request( const ClientMessage &cl_msg, const client_info &cl, Arena *arena );
+        ServerMessage * broadcast_message( const BroadcastRequest &req, const client_info &sender, Arena *arena );
+        ServerMessage * direct_message( const DirectMessageRequest &req, const client_info &sender, Arena *arena );
+        ServerMessage * error_response( const char *msg, Arena *arena );
+        string register_user( const MyInfoSynchronize &req, const client_info &cl, FrameBuffer *in, Arena *arena, long deadline_us = 0 );
+        string begin_registration( const MyInfoSynchronize &req, const client_info &cl, Arena *arena );
+        int prepare_user( const MyInfoSynchronize &req, const client_info &cl, client_info *out, Arena *arena );
+        void finish_registration( const MyInfoSynchronize &req, const client_info &usr, Arena *arena );
+        ServerMessage * get_connected_users( const connectedUserRequest &req, Arena *arena );
+        ServerMessage * presence_snapshot( const client_info &cl, Arena *arena );
+        ServerMessage * change_user_status( const ChangeStatusRequest &req, const string &name, Arena *arena );
+        ServerMessage * join_channel( const ChannelRequest &req, const client_info &cl, Arena *arena );
+        ServerMessage * leave_channel( const ChannelRequest &req, const client_info &cl, Arena *arena );
+        ServerMessage * channel_message( const ChannelMessageRequest &req, const client_info &sender, Arena *arena );
+        ClientMessage * parse_request( const string &req, Arena *arena );
+        void send_all( const ServerMessage &res, const string &sender, int presence = 0 );
+        int add_user( client_info el );
+        void delete_user( string key, int id = 0 );
+        int set_message_log( const char *dir );
+        void deliver_offline( const client_info &cl );
+        int set_history( size_t entries, const char *dir );
+        ServerMessage * history_page( unsigned long after, unsigned long until, const client_info &cl, Arena *arena );
+        int set_admin( const char *address );
         static void * new_conn_h( void * context );
+        static void * worker_h( void * context );
     private:
         pthread_mutex_t _req_queue_mutex;
         queue <client_info> _req_queue;
-        pthread_mutex_t _user_list_mutex;
-        map<std::string, client_info> _user_list;
-        FILE *_log_level;
+        UserRegistry _users;
+        ChannelRegistry _channels;
+        MessageLog *_log;
+        History _history;
+        Metrics _metrics;
+        server_metrics _m;
+        size_t _out_max_bytes;
+        size_t _out_max_frames;
+        overflow_policy _out_policy;
+        long _batch_window_us;
+        size_t _batch_max_bytes;
+        int _n_workers;
+        int _backlog;
+        long _handshake_timeout_ms;
+        io_backend _backend;
+        vector<event_worker *> _workers;
+        static thread_local event_worker *_self;
+        int open_listener( int reuse_port );
+        void register_metrics();
+        void release_client( const client_info &cl );
+        void count_request( int option, long start_ns );
+        static long open_connections( void *context );
+        static long connected_users( void *context );
+        static long queued_bytes( void *context );
+        static long queued_frames( void *context );
+        static long max_queued_bytes( void *context );
+        int set_non_blocking( int fd );
+        event_worker * new_worker( int id, int listen_fd );
+        void free_worker( event_worker *w );
+        void run_worker( event_worker *w );
+        void run_uring_worker( event_worker *w );
+        event_worker * current_worker();
+        connection * add_connection( event_worker *w, int fd, struct sockaddr_in addr );
+        void dispatch_frames( connection *conn, int *budget = NULL );
+        void defer_input( connection *conn );
+        void register_joining( event_worker *w );
+        void remove_leaving( event_worker *w );
+        void end_handshake( connection *conn );
+        int expire_handshakes( event_worker *w, int timeout );
+        void resume_uring_input( event_worker *w, int *budget );
+        int queue_frame( send_queue *q, frame_ptr frame, int broadcast, int delivery, connection *conn = NULL );
+        void mark_dirty( event_worker *w, connection *conn );
+        long flush_batches( event_worker *w );
+        void arm_uring_accept( event_worker *w );
+        void arm_uring_wake( event_worker *w );
+        void arm_uring_recv( event_worker *w, connection *conn );
+        void submit_uring_send( event_worker *w, connection *conn );
+        void submit_uring_sends( event_worker *w );
+        void handle_uring_recv( event_worker *w, connection *conn, int res, unsigned flags, int *budget );
+        void handle_uring_send( event_worker *w, connection *conn, int res );
+        void cancel_uring_recv( event_worker *w, connection *conn );
+        void post_mail( event_worker *from, int to, const mail_item &item );
+        size_t flush_mail( event_worker *w );
+        void read_mail( event_worker *w );
+        void local_broadcast( event_worker *w, frame_ptr frame, const string &sender, int presence, unsigned long sequence );
+        void fan_out( frame_ptr frame, const string &sender, int presence, unsigned long sequence = 0 );
+        int take_over( const MyInfoSynchronize &req );
+        void publish_presence( int kind, const client_info &usr, unsigned long version );
+        void publish_presence( int kind, const vector<client_info> &users, unsigned long version );
+        void handle_readable( connection *conn );
+        void handle_message( connection *conn, const string &req );
+        void close_connection( connection *conn );
+        void close_after_send( connection *conn );
+        void close_drained( event_worker *w );
         client_info req_pop();
         void req_push( client_info el );
-        client_info get_user( string key );
-        client_info get_user( int id );
-        void add_user( client_info el );
-        void delete_user( string key );
-        map<std::string, client_info> get_all_users();
+        int get_user( const string &key, client_info *out );
+        int get_user( int id, client_info *out );
+        user_snapshot get_all_users();
 };
 #endif
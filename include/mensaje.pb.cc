@@ -0,0 +1,9946 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: mensaje.proto
+
+#include "mensaje.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace chat {
+PROTOBUF_CONSTEXPR MyInfoSynchronize::MyInfoSynchronize(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.resumetoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.lastsequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.batch_)*/false
+  , /*decltype(_impl_.presence_)*/false} {}
+struct MyInfoSynchronizeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MyInfoSynchronizeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MyInfoSynchronizeDefaultTypeInternal() {}
+  union {
+    MyInfoSynchronize _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MyInfoSynchronizeDefaultTypeInternal _MyInfoSynchronize_default_instance_;
+PROTOBUF_CONSTEXPR MyInfoResponse::MyInfoResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.resumetoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.userid_)*/0} {}
+struct MyInfoResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MyInfoResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MyInfoResponseDefaultTypeInternal() {}
+  union {
+    MyInfoResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MyInfoResponseDefaultTypeInternal _MyInfoResponse_default_instance_;
+PROTOBUF_CONSTEXPR MyInfoAcknowledge::MyInfoAcknowledge(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.userid_)*/0} {}
+struct MyInfoAcknowledgeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MyInfoAcknowledgeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MyInfoAcknowledgeDefaultTypeInternal() {}
+  union {
+    MyInfoAcknowledge _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MyInfoAcknowledgeDefaultTypeInternal _MyInfoAcknowledge_default_instance_;
+PROTOBUF_CONSTEXPR connectedUserRequest::connectedUserRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.userid_)*/0
+  , /*decltype(_impl_.limit_)*/0} {}
+struct connectedUserRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR connectedUserRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~connectedUserRequestDefaultTypeInternal() {}
+  union {
+    connectedUserRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 connectedUserRequestDefaultTypeInternal _connectedUserRequest_default_instance_;
+PROTOBUF_CONSTEXPR ConnectedUser::ConnectedUser(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.userid_)*/0} {}
+struct ConnectedUserDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConnectedUserDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConnectedUserDefaultTypeInternal() {}
+  union {
+    ConnectedUser _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConnectedUserDefaultTypeInternal _ConnectedUser_default_instance_;
+PROTOBUF_CONSTEXPR ConnectedUserResponse::ConnectedUserResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.connectedusers_)*/{}
+  , /*decltype(_impl_.nextcursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ConnectedUserResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConnectedUserResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConnectedUserResponseDefaultTypeInternal() {}
+  union {
+    ConnectedUserResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConnectedUserResponseDefaultTypeInternal _ConnectedUserResponse_default_instance_;
+PROTOBUF_CONSTEXPR ChangeStatusRequest::ChangeStatusRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.status_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ChangeStatusRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChangeStatusRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChangeStatusRequestDefaultTypeInternal() {}
+  union {
+    ChangeStatusRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChangeStatusRequestDefaultTypeInternal _ChangeStatusRequest_default_instance_;
+PROTOBUF_CONSTEXPR ChangeStatusResponse::ChangeStatusResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.status_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.userid_)*/0} {}
+struct ChangeStatusResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChangeStatusResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChangeStatusResponseDefaultTypeInternal() {}
+  union {
+    ChangeStatusResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChangeStatusResponseDefaultTypeInternal _ChangeStatusResponse_default_instance_;
+PROTOBUF_CONSTEXPR BroadcastRequest::BroadcastRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct BroadcastRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BroadcastRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BroadcastRequestDefaultTypeInternal() {}
+  union {
+    BroadcastRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BroadcastRequestDefaultTypeInternal _BroadcastRequest_default_instance_;
+PROTOBUF_CONSTEXPR BroadcastResponse::BroadcastResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.messagestatus_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct BroadcastResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BroadcastResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BroadcastResponseDefaultTypeInternal() {}
+  union {
+    BroadcastResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BroadcastResponseDefaultTypeInternal _BroadcastResponse_default_instance_;
+PROTOBUF_CONSTEXPR BroadcastMessage::BroadcastMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.userid_)*/0} {}
+struct BroadcastMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BroadcastMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BroadcastMessageDefaultTypeInternal() {}
+  union {
+    BroadcastMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BroadcastMessageDefaultTypeInternal _BroadcastMessage_default_instance_;
+PROTOBUF_CONSTEXPR DirectMessageRequest::DirectMessageRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.userid_)*/0} {}
+struct DirectMessageRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DirectMessageRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DirectMessageRequestDefaultTypeInternal() {}
+  union {
+    DirectMessageRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DirectMessageRequestDefaultTypeInternal _DirectMessageRequest_default_instance_;
+PROTOBUF_CONSTEXPR DirectMessageResponse::DirectMessageResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.messagestatus_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct DirectMessageResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DirectMessageResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DirectMessageResponseDefaultTypeInternal() {}
+  union {
+    DirectMessageResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DirectMessageResponseDefaultTypeInternal _DirectMessageResponse_default_instance_;
+PROTOBUF_CONSTEXPR DirectMessage::DirectMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.userid_)*/0} {}
+struct DirectMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DirectMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DirectMessageDefaultTypeInternal() {}
+  union {
+    DirectMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DirectMessageDefaultTypeInternal _DirectMessage_default_instance_;
+PROTOBUF_CONSTEXPR PresenceRequest::PresenceRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}} {}
+struct PresenceRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresenceRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PresenceRequestDefaultTypeInternal() {}
+  union {
+    PresenceRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresenceRequestDefaultTypeInternal _PresenceRequest_default_instance_;
+PROTOBUF_CONSTEXPR PresenceDelta::PresenceDelta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.user_)*/nullptr
+  , /*decltype(_impl_.kind_)*/0} {}
+struct PresenceDeltaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresenceDeltaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PresenceDeltaDefaultTypeInternal() {}
+  union {
+    PresenceDelta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresenceDeltaDefaultTypeInternal _PresenceDelta_default_instance_;
+PROTOBUF_CONSTEXPR PresenceUpdate::PresenceUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.deltas_)*/{}
+  , /*decltype(_impl_.snapshot_)*/nullptr
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.baseversion_)*/uint64_t{0u}} {}
+struct PresenceUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresenceUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PresenceUpdateDefaultTypeInternal() {}
+  union {
+    PresenceUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresenceUpdateDefaultTypeInternal _PresenceUpdate_default_instance_;
+PROTOBUF_CONSTEXPR ChannelRequest::ChannelRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.channel_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ChannelRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChannelRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChannelRequestDefaultTypeInternal() {}
+  union {
+    ChannelRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChannelRequestDefaultTypeInternal _ChannelRequest_default_instance_;
+PROTOBUF_CONSTEXPR ChannelMessageRequest::ChannelMessageRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.channel_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ChannelMessageRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChannelMessageRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChannelMessageRequestDefaultTypeInternal() {}
+  union {
+    ChannelMessageRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChannelMessageRequestDefaultTypeInternal _ChannelMessageRequest_default_instance_;
+PROTOBUF_CONSTEXPR ChannelResponse::ChannelResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.channel_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.members_)*/0} {}
+struct ChannelResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChannelResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChannelResponseDefaultTypeInternal() {}
+  union {
+    ChannelResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChannelResponseDefaultTypeInternal _ChannelResponse_default_instance_;
+PROTOBUF_CONSTEXPR ChannelMessage::ChannelMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.channel_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.userid_)*/0} {}
+struct ChannelMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChannelMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChannelMessageDefaultTypeInternal() {}
+  union {
+    ChannelMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChannelMessageDefaultTypeInternal _ChannelMessage_default_instance_;
+PROTOBUF_CONSTEXPR ServerMessageBatch::ServerMessageBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerMessageBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerMessageBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerMessageBatchDefaultTypeInternal() {}
+  union {
+    ServerMessageBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerMessageBatchDefaultTypeInternal _ServerMessageBatch_default_instance_;
+PROTOBUF_CONSTEXPR HistoryRequest::HistoryRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.after_)*/uint64_t{0u}
+  , /*decltype(_impl_.until_)*/uint64_t{0u}} {}
+struct HistoryRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HistoryRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HistoryRequestDefaultTypeInternal() {}
+  union {
+    HistoryRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HistoryRequestDefaultTypeInternal _HistoryRequest_default_instance_;
+PROTOBUF_CONSTEXPR HistoryResponse::HistoryResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.last_)*/uint64_t{0u}
+  , /*decltype(_impl_.more_)*/false
+  , /*decltype(_impl_.truncated_)*/false
+  , /*decltype(_impl_.messages_)*/0} {}
+struct HistoryResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HistoryResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HistoryResponseDefaultTypeInternal() {}
+  union {
+    HistoryResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HistoryResponseDefaultTypeInternal _HistoryResponse_default_instance_;
+PROTOBUF_CONSTEXPR ErrorResponse::ErrorResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.errormessage_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ErrorResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ErrorResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ErrorResponseDefaultTypeInternal() {}
+  union {
+    ErrorResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ErrorResponseDefaultTypeInternal _ErrorResponse_default_instance_;
+PROTOBUF_CONSTEXPR ClientMessage::ClientMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.synchronize_)*/nullptr
+  , /*decltype(_impl_.connectedusers_)*/nullptr
+  , /*decltype(_impl_.changestatus_)*/nullptr
+  , /*decltype(_impl_.broadcast_)*/nullptr
+  , /*decltype(_impl_.directmessage_)*/nullptr
+  , /*decltype(_impl_.acknowledge_)*/nullptr
+  , /*decltype(_impl_.presence_)*/nullptr
+  , /*decltype(_impl_.channel_)*/nullptr
+  , /*decltype(_impl_.channelmessage_)*/nullptr
+  , /*decltype(_impl_.history_)*/nullptr
+  , /*decltype(_impl_.option_)*/0
+  , /*decltype(_impl_.userid_)*/0
+  , /*decltype(_impl_.requestid_)*/0u} {}
+struct ClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClientMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClientMessageDefaultTypeInternal() {}
+  union {
+    ClientMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientMessageDefaultTypeInternal _ClientMessage_default_instance_;
+PROTOBUF_CONSTEXPR ServerMessage::ServerMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.broadcast_)*/nullptr
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.error_)*/nullptr
+  , /*decltype(_impl_.myinforesponse_)*/nullptr
+  , /*decltype(_impl_.connecteduserresponse_)*/nullptr
+  , /*decltype(_impl_.changestatusresponse_)*/nullptr
+  , /*decltype(_impl_.broadcastresponse_)*/nullptr
+  , /*decltype(_impl_.directmessageresponse_)*/nullptr
+  , /*decltype(_impl_.batch_)*/nullptr
+  , /*decltype(_impl_.presence_)*/nullptr
+  , /*decltype(_impl_.channelresponse_)*/nullptr
+  , /*decltype(_impl_.channelmessage_)*/nullptr
+  , /*decltype(_impl_.history_)*/nullptr
+  , /*decltype(_impl_.option_)*/0
+  , /*decltype(_impl_.requestid_)*/0u} {}
+struct ServerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerMessageDefaultTypeInternal() {}
+  union {
+    ServerMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerMessageDefaultTypeInternal _ServerMessage_default_instance_;
+}  // namespace chat
+static ::_pb::Metadata file_level_metadata_mensaje_2eproto[27];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_mensaje_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_mensaje_2eproto = nullptr;
+
+const uint32_t TableStruct_mensaje_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoSynchronize, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoSynchronize, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoSynchronize, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoSynchronize, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoSynchronize, _impl_.batch_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoSynchronize, _impl_.presence_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoSynchronize, _impl_.lastsequence_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoSynchronize, _impl_.resumetoken_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoSynchronize, _impl_.status_),
+  0,
+  1,
+  5,
+  6,
+  4,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoResponse, _impl_.userid_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoResponse, _impl_.resumetoken_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoResponse, _impl_.sequence_),
+  2,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoAcknowledge, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoAcknowledge, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::MyInfoAcknowledge, _impl_.userid_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::connectedUserRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::connectedUserRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::connectedUserRequest, _impl_.userid_),
+  PROTOBUF_FIELD_OFFSET(::chat::connectedUserRequest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::connectedUserRequest, _impl_.prefix_),
+  PROTOBUF_FIELD_OFFSET(::chat::connectedUserRequest, _impl_.cursor_),
+  PROTOBUF_FIELD_OFFSET(::chat::connectedUserRequest, _impl_.limit_),
+  3,
+  0,
+  1,
+  2,
+  4,
+  PROTOBUF_FIELD_OFFSET(::chat::ConnectedUser, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ConnectedUser, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ConnectedUser, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::ConnectedUser, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::ConnectedUser, _impl_.userid_),
+  PROTOBUF_FIELD_OFFSET(::chat::ConnectedUser, _impl_.ip_),
+  0,
+  1,
+  3,
+  2,
+  PROTOBUF_FIELD_OFFSET(::chat::ConnectedUserResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ConnectedUserResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ConnectedUserResponse, _impl_.connectedusers_),
+  PROTOBUF_FIELD_OFFSET(::chat::ConnectedUserResponse, _impl_.nextcursor_),
+  ~0u,
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::ChangeStatusRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChangeStatusRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ChangeStatusRequest, _impl_.status_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::ChangeStatusResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChangeStatusResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ChangeStatusResponse, _impl_.userid_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChangeStatusResponse, _impl_.status_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastRequest, _impl_.message_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastResponse, _impl_.messagestatus_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastMessage, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastMessage, _impl_.userid_),
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastMessage, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::BroadcastMessage, _impl_.sequence_),
+  0,
+  3,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessageRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessageRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessageRequest, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessageRequest, _impl_.userid_),
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessageRequest, _impl_.username_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessageResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessageResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessageResponse, _impl_.messagestatus_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessage, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessage, _impl_.userid_),
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessage, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::DirectMessage, _impl_.sequence_),
+  0,
+  3,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceRequest, _impl_.version_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDelta, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDelta, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDelta, _impl_.kind_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDelta, _impl_.user_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.baseversion_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.snapshot_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.deltas_),
+  1,
+  2,
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelRequest, _impl_.channel_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelMessageRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelMessageRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelMessageRequest, _impl_.channel_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelMessageRequest, _impl_.message_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelResponse, _impl_.channel_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelResponse, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelResponse, _impl_.members_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelMessage, _impl_.channel_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelMessage, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelMessage, _impl_.userid_),
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelMessage, _impl_.username_),
+  0,
+  1,
+  3,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessageBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessageBatch, _impl_.messages_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryRequest, _impl_.until_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryResponse, _impl_.last_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryResponse, _impl_.more_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryResponse, _impl_.truncated_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryResponse, _impl_.messages_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::chat::ErrorResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ErrorResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ErrorResponse, _impl_.errormessage_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.option_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.userid_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.synchronize_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.connectedusers_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.changestatus_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.broadcast_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.directmessage_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.acknowledge_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.presence_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.channel_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.channelmessage_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.history_),
+  PROTOBUF_FIELD_OFFSET(::chat::ClientMessage, _impl_.requestid_),
+  10,
+  11,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  12,
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.option_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.broadcast_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.myinforesponse_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.connecteduserresponse_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.changestatusresponse_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.broadcastresponse_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.directmessageresponse_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.batch_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.presence_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.channelresponse_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.channelmessage_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.history_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerMessage, _impl_.requestid_),
+  13,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  14,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::chat::MyInfoSynchronize)},
+  { 20, 29, -1, sizeof(::chat::MyInfoResponse)},
+  { 32, 39, -1, sizeof(::chat::MyInfoAcknowledge)},
+  { 40, 51, -1, sizeof(::chat::connectedUserRequest)},
+  { 56, 66, -1, sizeof(::chat::ConnectedUser)},
+  { 70, 78, -1, sizeof(::chat::ConnectedUserResponse)},
+  { 80, 87, -1, sizeof(::chat::ChangeStatusRequest)},
+  { 88, 96, -1, sizeof(::chat::ChangeStatusResponse)},
+  { 98, 105, -1, sizeof(::chat::BroadcastRequest)},
+  { 106, 113, -1, sizeof(::chat::BroadcastResponse)},
+  { 114, 124, -1, sizeof(::chat::BroadcastMessage)},
+  { 128, 137, -1, sizeof(::chat::DirectMessageRequest)},
+  { 140, 147, -1, sizeof(::chat::DirectMessageResponse)},
+  { 148, 158, -1, sizeof(::chat::DirectMessage)},
+  { 162, 169, -1, sizeof(::chat::PresenceRequest)},
+  { 170, 178, -1, sizeof(::chat::PresenceDelta)},
+  { 180, 190, -1, sizeof(::chat::PresenceUpdate)},
+  { 194, 201, -1, sizeof(::chat::ChannelRequest)},
+  { 202, 210, -1, sizeof(::chat::ChannelMessageRequest)},
+  { 212, 221, -1, sizeof(::chat::ChannelResponse)},
+  { 224, 234, -1, sizeof(::chat::ChannelMessage)},
+  { 238, -1, -1, sizeof(::chat::ServerMessageBatch)},
+  { 245, 253, -1, sizeof(::chat::HistoryRequest)},
+  { 255, 265, -1, sizeof(::chat::HistoryResponse)},
+  { 269, 276, -1, sizeof(::chat::ErrorResponse)},
+  { 277, 296, -1, sizeof(::chat::ClientMessage)},
+  { 309, 330, -1, sizeof(::chat::ServerMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::chat::_MyInfoSynchronize_default_instance_._instance,
+  &::chat::_MyInfoResponse_default_instance_._instance,
+  &::chat::_MyInfoAcknowledge_default_instance_._instance,
+  &::chat::_connectedUserRequest_default_instance_._instance,
+  &::chat::_ConnectedUser_default_instance_._instance,
+  &::chat::_ConnectedUserResponse_default_instance_._instance,
+  &::chat::_ChangeStatusRequest_default_instance_._instance,
+  &::chat::_ChangeStatusResponse_default_instance_._instance,
+  &::chat::_BroadcastRequest_default_instance_._instance,
+  &::chat::_BroadcastResponse_default_instance_._instance,
+  &::chat::_BroadcastMessage_default_instance_._instance,
+  &::chat::_DirectMessageRequest_default_instance_._instance,
+  &::chat::_DirectMessageResponse_default_instance_._instance,
+  &::chat::_DirectMessage_default_instance_._instance,
+  &::chat::_PresenceRequest_default_instance_._instance,
+  &::chat::_PresenceDelta_default_instance_._instance,
+  &::chat::_PresenceUpdate_default_instance_._instance,
+  &::chat::_ChannelRequest_default_instance_._instance,
+  &::chat::_ChannelMessageRequest_default_instance_._instance,
+  &::chat::_ChannelResponse_default_instance_._instance,
+  &::chat::_ChannelMessage_default_instance_._instance,
+  &::chat::_ServerMessageBatch_default_instance_._instance,
+  &::chat::_HistoryRequest_default_instance_._instance,
+  &::chat::_HistoryResponse_default_instance_._instance,
+  &::chat::_ErrorResponse_default_instance_._instance,
+  &::chat::_ClientMessage_default_instance_._instance,
+  &::chat::_ServerMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_mensaje_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rmensaje.proto\022\004chat\"\215\001\n\021MyInfoSynchron"
+  "ize\022\020\n\010username\030\001 \002(\t\022\n\n\002ip\030\002 \001(\t\022\r\n\005bat"
+  "ch\030\003 \001(\010\022\020\n\010presence\030\004 \001(\010\022\024\n\014lastSequen"
+  "ce\030\005 \001(\004\022\023\n\013resumeToken\030\006 \001(\t\022\016\n\006status\030"
+  "\007 \001(\t\"G\n\016MyInfoResponse\022\016\n\006userId\030\001 \002(\005\022"
+  "\023\n\013resumeToken\030\002 \001(\t\022\020\n\010sequence\030\003 \001(\004\"#"
+  "\n\021MyInfoAcknowledge\022\016\n\006userId\030\001 \002(\005\"g\n\024c"
+  "onnectedUserRequest\022\016\n\006userId\030\001 \001(\005\022\020\n\010u"
+  "sername\030\002 \001(\t\022\016\n\006prefix\030\003 \001(\t\022\016\n\006cursor\030"
+  "\004 \001(\t\022\r\n\005limit\030\005 \001(\005\"M\n\rConnectedUser\022\020\n"
+  "\010username\030\001 \002(\t\022\016\n\006status\030\002 \001(\t\022\016\n\006userI"
+  "d\030\003 \001(\005\022\n\n\002ip\030\004 \001(\t\"X\n\025ConnectedUserResp"
+  "onse\022+\n\016connectedUsers\030\001 \003(\0132\023.chat.Conn"
+  "ectedUser\022\022\n\nnextCursor\030\002 \001(\t\"%\n\023ChangeS"
+  "tatusRequest\022\016\n\006status\030\001 \002(\t\"6\n\024ChangeSt"
+  "atusResponse\022\016\n\006userId\030\001 \002(\005\022\016\n\006status\030\002"
+  " \002(\t\"#\n\020BroadcastRequest\022\017\n\007message\030\001 \002("
+  "\t\"*\n\021BroadcastResponse\022\025\n\rmessageStatus\030"
+  "\001 \002(\t\"W\n\020BroadcastMessage\022\017\n\007message\030\001 \002"
+  "(\t\022\016\n\006userId\030\002 \002(\005\022\020\n\010username\030\003 \001(\t\022\020\n\010"
+  "sequence\030\004 \001(\004\"I\n\024DirectMessageRequest\022\017"
+  "\n\007message\030\001 \002(\t\022\016\n\006userId\030\002 \001(\005\022\020\n\010usern"
+  "ame\030\003 \001(\t\".\n\025DirectMessageResponse\022\025\n\rme"
+  "ssageStatus\030\001 \002(\t\"T\n\rDirectMessage\022\017\n\007me"
+  "ssage\030\001 \002(\t\022\016\n\006userId\030\002 \002(\005\022\020\n\010username\030"
+  "\003 \001(\t\022\020\n\010sequence\030\004 \001(\004\"\"\n\017PresenceReque"
+  "st\022\017\n\007version\030\001 \001(\004\"@\n\rPresenceDelta\022\014\n\004"
+  "kind\030\001 \002(\005\022!\n\004user\030\002 \002(\0132\023.chat.Connecte"
+  "dUser\"\212\001\n\016PresenceUpdate\022\017\n\007version\030\001 \002("
+  "\004\022\023\n\013baseVersion\030\002 \001(\004\022-\n\010snapshot\030\003 \001(\013"
+  "2\033.chat.ConnectedUserResponse\022#\n\006deltas\030"
+  "\004 \003(\0132\023.chat.PresenceDelta\"!\n\016ChannelReq"
+  "uest\022\017\n\007channel\030\001 \002(\t\"9\n\025ChannelMessageR"
+  "equest\022\017\n\007channel\030\001 \002(\t\022\017\n\007message\030\002 \002(\t"
+  "\"C\n\017ChannelResponse\022\017\n\007channel\030\001 \002(\t\022\016\n\006"
+  "status\030\002 \002(\t\022\017\n\007members\030\003 \001(\005\"T\n\016Channel"
+  "Message\022\017\n\007channel\030\001 \002(\t\022\017\n\007message\030\002 \002("
+  "\t\022\016\n\006userId\030\003 \002(\005\022\020\n\010username\030\004 \001(\t\";\n\022S"
+  "erverMessageBatch\022%\n\010messages\030\001 \003(\0132\023.ch"
+  "at.ServerMessage\".\n\016HistoryRequest\022\r\n\005af"
+  "ter\030\001 \002(\004\022\r\n\005until\030\002 \001(\004\"R\n\017HistoryRespo"
+  "nse\022\014\n\004last\030\001 \002(\004\022\014\n\004more\030\002 \001(\010\022\021\n\ttrunc"
+  "ated\030\003 \001(\010\022\020\n\010messages\030\004 \001(\005\"%\n\rErrorRes"
+  "ponse\022\024\n\014errorMessage\030\001 \002(\t\"\215\004\n\rClientMe"
+  "ssage\022\016\n\006option\030\001 \002(\005\022\016\n\006userId\030\002 \001(\005\022,\n"
+  "\013synchronize\030\003 \001(\0132\027.chat.MyInfoSynchron"
+  "ize\0222\n\016connectedUsers\030\004 \001(\0132\032.chat.conne"
+  "ctedUserRequest\022/\n\014changeStatus\030\005 \001(\0132\031."
+  "chat.ChangeStatusRequest\022)\n\tbroadcast\030\006 "
+  "\001(\0132\026.chat.BroadcastRequest\0221\n\rdirectMes"
+  "sage\030\007 \001(\0132\032.chat.DirectMessageRequest\022,"
+  "\n\013acknowledge\030\010 \001(\0132\027.chat.MyInfoAcknowl"
+  "edge\022\'\n\010presence\030\t \001(\0132\025.chat.PresenceRe"
+  "quest\022%\n\007channel\030\n \001(\0132\024.chat.ChannelReq"
+  "uest\0223\n\016channelMessage\030\013 \001(\0132\033.chat.Chan"
+  "nelMessageRequest\022%\n\007history\030\014 \001(\0132\024.cha"
+  "t.HistoryRequest\022\021\n\trequestId\030\r \001(\r\"\222\005\n\r"
+  "ServerMessage\022\016\n\006option\030\001 \002(\005\022)\n\tbroadca"
+  "st\030\002 \001(\0132\026.chat.BroadcastMessage\022$\n\007mess"
+  "age\030\003 \001(\0132\023.chat.DirectMessage\022\"\n\005error\030"
+  "\004 \001(\0132\023.chat.ErrorResponse\022,\n\016myInfoResp"
+  "onse\030\005 \001(\0132\024.chat.MyInfoResponse\022:\n\025conn"
+  "ectedUserResponse\030\006 \001(\0132\033.chat.Connected"
+  "UserResponse\0228\n\024changeStatusResponse\030\007 \001"
+  "(\0132\032.chat.ChangeStatusResponse\0222\n\021broadc"
+  "astResponse\030\010 \001(\0132\027.chat.BroadcastRespon"
+  "se\022:\n\025directMessageResponse\030\t \001(\0132\033.chat"
+  ".DirectMessageResponse\022\'\n\005batch\030\n \001(\0132\030."
+  "chat.ServerMessageBatch\022&\n\010presence\030\013 \001("
+  "\0132\024.chat.PresenceUpdate\022.\n\017channelRespon"
+  "se\030\014 \001(\0132\025.chat.ChannelResponse\022,\n\016chann"
+  "elMessage\030\r \001(\0132\024.chat.ChannelMessage\022&\n"
+  "\007history\030\016 \001(\0132\025.chat.HistoryResponse\022\021\n"
+  "\trequestId\030\017 \001(\r"
+  ;
+static ::_pbi::once_flag descriptor_table_mensaje_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_mensaje_2eproto = {
+    false, false, 2936, descriptor_table_protodef_mensaje_2eproto,
+    "mensaje.proto",
+    &descriptor_table_mensaje_2eproto_once, nullptr, 0, 27,
+    schemas, file_default_instances, TableStruct_mensaje_2eproto::offsets,
+    file_level_metadata_mensaje_2eproto, file_level_enum_descriptors_mensaje_2eproto,
+    file_level_service_descriptors_mensaje_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_mensaje_2eproto_getter() {
+  return &descriptor_table_mensaje_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_mensaje_2eproto(&descriptor_table_mensaje_2eproto);
+namespace chat {
+
+// ===================================================================
+
+class MyInfoSynchronize::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MyInfoSynchronize>()._impl_._has_bits_);
+  static void set_has_username(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_batch(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_presence(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_lastsequence(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_resumetoken(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+MyInfoSynchronize::MyInfoSynchronize(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.MyInfoSynchronize)
+}
+MyInfoSynchronize::MyInfoSynchronize(const MyInfoSynchronize& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MyInfoSynchronize* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.resumetoken_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.lastsequence_){}
+    , decltype(_impl_.batch_){}
+    , decltype(_impl_.presence_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_username()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ip()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.resumetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resumetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_resumetoken()) {
+    _this->_impl_.resumetoken_.Set(from._internal_resumetoken(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.status_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_status()) {
+    _this->_impl_.status_.Set(from._internal_status(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.lastsequence_, &from._impl_.lastsequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.presence_) -
+    reinterpret_cast<char*>(&_impl_.lastsequence_)) + sizeof(_impl_.presence_));
+  // @@protoc_insertion_point(copy_constructor:chat.MyInfoSynchronize)
+}
+
+inline void MyInfoSynchronize::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.resumetoken_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.lastsequence_){uint64_t{0u}}
+    , decltype(_impl_.batch_){false}
+    , decltype(_impl_.presence_){false}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.resumetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resumetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.status_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MyInfoSynchronize::~MyInfoSynchronize() {
+  // @@protoc_insertion_point(destructor:chat.MyInfoSynchronize)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MyInfoSynchronize::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.ip_.Destroy();
+  _impl_.resumetoken_.Destroy();
+  _impl_.status_.Destroy();
+}
+
+void MyInfoSynchronize::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MyInfoSynchronize::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.MyInfoSynchronize)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.username_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.ip_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.resumetoken_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.status_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x00000070u) {
+    ::memset(&_impl_.lastsequence_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.presence_) -
+        reinterpret_cast<char*>(&_impl_.lastsequence_)) + sizeof(_impl_.presence_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MyInfoSynchronize::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.MyInfoSynchronize.username");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string ip = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.MyInfoSynchronize.ip");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool batch = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_batch(&has_bits);
+          _impl_.batch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool presence = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_presence(&has_bits);
+          _impl_.presence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 lastSequence = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_lastsequence(&has_bits);
+          _impl_.lastsequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string resumeToken = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_resumetoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.MyInfoSynchronize.resumeToken");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string status = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_status();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.MyInfoSynchronize.status");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MyInfoSynchronize::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.MyInfoSynchronize)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string username = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.MyInfoSynchronize.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // optional string ip = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_ip().data(), static_cast<int>(this->_internal_ip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.MyInfoSynchronize.ip");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_ip(), target);
+  }
+
+  // optional bool batch = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_batch(), target);
+  }
+
+  // optional bool presence = 4;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_presence(), target);
+  }
+
+  // optional uint64 lastSequence = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_lastsequence(), target);
+  }
+
+  // optional string resumeToken = 6;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_resumetoken().data(), static_cast<int>(this->_internal_resumetoken().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.MyInfoSynchronize.resumeToken");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_resumetoken(), target);
+  }
+
+  // optional string status = 7;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_status().data(), static_cast<int>(this->_internal_status().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.MyInfoSynchronize.status");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_status(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.MyInfoSynchronize)
+  return target;
+}
+
+size_t MyInfoSynchronize::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.MyInfoSynchronize)
+  size_t total_size = 0;
+
+  // required string username = 1;
+  if (_internal_has_username()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007eu) {
+    // optional string ip = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_ip());
+    }
+
+    // optional string resumeToken = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_resumetoken());
+    }
+
+    // optional string status = 7;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_status());
+    }
+
+    // optional uint64 lastSequence = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastsequence());
+    }
+
+    // optional bool batch = 3;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool presence = 4;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MyInfoSynchronize::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MyInfoSynchronize::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MyInfoSynchronize::GetClassData() const { return &_class_data_; }
+
+
+void MyInfoSynchronize::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MyInfoSynchronize*>(&to_msg);
+  auto& from = static_cast<const MyInfoSynchronize&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.MyInfoSynchronize)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_username(from._internal_username());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_ip(from._internal_ip());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_resumetoken(from._internal_resumetoken());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_status(from._internal_status());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.lastsequence_ = from._impl_.lastsequence_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.batch_ = from._impl_.batch_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.presence_ = from._impl_.presence_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MyInfoSynchronize::CopyFrom(const MyInfoSynchronize& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.MyInfoSynchronize)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MyInfoSynchronize::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void MyInfoSynchronize::InternalSwap(MyInfoSynchronize* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.resumetoken_, lhs_arena,
+      &other->_impl_.resumetoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_, lhs_arena,
+      &other->_impl_.status_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MyInfoSynchronize, _impl_.presence_)
+      + sizeof(MyInfoSynchronize::_impl_.presence_)
+      - PROTOBUF_FIELD_OFFSET(MyInfoSynchronize, _impl_.lastsequence_)>(
+          reinterpret_cast<char*>(&_impl_.lastsequence_),
+          reinterpret_cast<char*>(&other->_impl_.lastsequence_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MyInfoSynchronize::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[0]);
+}
+
+// ===================================================================
+
+class MyInfoResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MyInfoResponse>()._impl_._has_bits_);
+  static void set_has_userid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_resumetoken(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sequence(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000004) ^ 0x00000004) != 0;
+  }
+};
+
+MyInfoResponse::MyInfoResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.MyInfoResponse)
+}
+MyInfoResponse::MyInfoResponse(const MyInfoResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MyInfoResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.resumetoken_){}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.userid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.resumetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resumetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_resumetoken()) {
+    _this->_impl_.resumetoken_.Set(from._internal_resumetoken(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sequence_, &from._impl_.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.userid_) -
+    reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.userid_));
+  // @@protoc_insertion_point(copy_constructor:chat.MyInfoResponse)
+}
+
+inline void MyInfoResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.resumetoken_){}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.userid_){0}
+  };
+  _impl_.resumetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resumetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MyInfoResponse::~MyInfoResponse() {
+  // @@protoc_insertion_point(destructor:chat.MyInfoResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MyInfoResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.resumetoken_.Destroy();
+}
+
+void MyInfoResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MyInfoResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.MyInfoResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.resumetoken_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.userid_) -
+        reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.userid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MyInfoResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 userId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_userid(&has_bits);
+          _impl_.userid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string resumeToken = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_resumetoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.MyInfoResponse.resumeToken");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 sequence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sequence(&has_bits);
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MyInfoResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.MyInfoResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 userId = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_userid(), target);
+  }
+
+  // optional string resumeToken = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_resumetoken().data(), static_cast<int>(this->_internal_resumetoken().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.MyInfoResponse.resumeToken");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_resumetoken(), target);
+  }
+
+  // optional uint64 sequence = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sequence(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.MyInfoResponse)
+  return target;
+}
+
+size_t MyInfoResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.MyInfoResponse)
+  size_t total_size = 0;
+
+  // required int32 userId = 1;
+  if (_internal_has_userid()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string resumeToken = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_resumetoken());
+    }
+
+    // optional uint64 sequence = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MyInfoResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MyInfoResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MyInfoResponse::GetClassData() const { return &_class_data_; }
+
+
+void MyInfoResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MyInfoResponse*>(&to_msg);
+  auto& from = static_cast<const MyInfoResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.MyInfoResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_resumetoken(from._internal_resumetoken());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.sequence_ = from._impl_.sequence_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.userid_ = from._impl_.userid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MyInfoResponse::CopyFrom(const MyInfoResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.MyInfoResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MyInfoResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void MyInfoResponse::InternalSwap(MyInfoResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.resumetoken_, lhs_arena,
+      &other->_impl_.resumetoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MyInfoResponse, _impl_.userid_)
+      + sizeof(MyInfoResponse::_impl_.userid_)
+      - PROTOBUF_FIELD_OFFSET(MyInfoResponse, _impl_.sequence_)>(
+          reinterpret_cast<char*>(&_impl_.sequence_),
+          reinterpret_cast<char*>(&other->_impl_.sequence_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MyInfoResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[1]);
+}
+
+// ===================================================================
+
+class MyInfoAcknowledge::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MyInfoAcknowledge>()._impl_._has_bits_);
+  static void set_has_userid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+MyInfoAcknowledge::MyInfoAcknowledge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.MyInfoAcknowledge)
+}
+MyInfoAcknowledge::MyInfoAcknowledge(const MyInfoAcknowledge& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MyInfoAcknowledge* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.userid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.userid_ = from._impl_.userid_;
+  // @@protoc_insertion_point(copy_constructor:chat.MyInfoAcknowledge)
+}
+
+inline void MyInfoAcknowledge::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.userid_){0}
+  };
+}
+
+MyInfoAcknowledge::~MyInfoAcknowledge() {
+  // @@protoc_insertion_point(destructor:chat.MyInfoAcknowledge)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MyInfoAcknowledge::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MyInfoAcknowledge::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MyInfoAcknowledge::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.MyInfoAcknowledge)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.userid_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MyInfoAcknowledge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 userId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_userid(&has_bits);
+          _impl_.userid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MyInfoAcknowledge::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.MyInfoAcknowledge)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 userId = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_userid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.MyInfoAcknowledge)
+  return target;
+}
+
+size_t MyInfoAcknowledge::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.MyInfoAcknowledge)
+  size_t total_size = 0;
+
+  // required int32 userId = 1;
+  if (_internal_has_userid()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MyInfoAcknowledge::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MyInfoAcknowledge::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MyInfoAcknowledge::GetClassData() const { return &_class_data_; }
+
+
+void MyInfoAcknowledge::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MyInfoAcknowledge*>(&to_msg);
+  auto& from = static_cast<const MyInfoAcknowledge&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.MyInfoAcknowledge)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_userid()) {
+    _this->_internal_set_userid(from._internal_userid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MyInfoAcknowledge::CopyFrom(const MyInfoAcknowledge& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.MyInfoAcknowledge)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MyInfoAcknowledge::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void MyInfoAcknowledge::InternalSwap(MyInfoAcknowledge* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.userid_, other->_impl_.userid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MyInfoAcknowledge::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[2]);
+}
+
+// ===================================================================
+
+class connectedUserRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<connectedUserRequest>()._impl_._has_bits_);
+  static void set_has_userid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_username(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_prefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_limit(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+connectedUserRequest::connectedUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.connectedUserRequest)
+}
+connectedUserRequest::connectedUserRequest(const connectedUserRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  connectedUserRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.userid_){}
+    , decltype(_impl_.limit_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_username()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_prefix()) {
+    _this->_impl_.prefix_.Set(from._internal_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cursor()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.userid_, &from._impl_.userid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.limit_) -
+    reinterpret_cast<char*>(&_impl_.userid_)) + sizeof(_impl_.limit_));
+  // @@protoc_insertion_point(copy_constructor:chat.connectedUserRequest)
+}
+
+inline void connectedUserRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.userid_){0}
+    , decltype(_impl_.limit_){0}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+connectedUserRequest::~connectedUserRequest() {
+  // @@protoc_insertion_point(destructor:chat.connectedUserRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void connectedUserRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.prefix_.Destroy();
+  _impl_.cursor_.Destroy();
+}
+
+void connectedUserRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void connectedUserRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.connectedUserRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.username_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.prefix_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.cursor_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x00000018u) {
+    ::memset(&_impl_.userid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.limit_) -
+        reinterpret_cast<char*>(&_impl_.userid_)) + sizeof(_impl_.limit_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* connectedUserRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 userId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_userid(&has_bits);
+          _impl_.userid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string username = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.connectedUserRequest.username");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string prefix = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.connectedUserRequest.prefix");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string cursor = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.connectedUserRequest.cursor");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 limit = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_limit(&has_bits);
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* connectedUserRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.connectedUserRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 userId = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_userid(), target);
+  }
+
+  // optional string username = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.connectedUserRequest.username");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_username(), target);
+  }
+
+  // optional string prefix = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_prefix().data(), static_cast<int>(this->_internal_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.connectedUserRequest.prefix");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_prefix(), target);
+  }
+
+  // optional string cursor = 4;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.connectedUserRequest.cursor");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_cursor(), target);
+  }
+
+  // optional int32 limit = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_limit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.connectedUserRequest)
+  return target;
+}
+
+size_t connectedUserRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.connectedUserRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional string username = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_username());
+    }
+
+    // optional string prefix = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_prefix());
+    }
+
+    // optional string cursor = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_cursor());
+    }
+
+    // optional int32 userId = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+    }
+
+    // optional int32 limit = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_limit());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData connectedUserRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    connectedUserRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*connectedUserRequest::GetClassData() const { return &_class_data_; }
+
+
+void connectedUserRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<connectedUserRequest*>(&to_msg);
+  auto& from = static_cast<const connectedUserRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.connectedUserRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_username(from._internal_username());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_prefix(from._internal_prefix());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_cursor(from._internal_cursor());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.userid_ = from._impl_.userid_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.limit_ = from._impl_.limit_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void connectedUserRequest::CopyFrom(const connectedUserRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.connectedUserRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool connectedUserRequest::IsInitialized() const {
+  return true;
+}
+
+void connectedUserRequest::InternalSwap(connectedUserRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prefix_, lhs_arena,
+      &other->_impl_.prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(connectedUserRequest, _impl_.limit_)
+      + sizeof(connectedUserRequest::_impl_.limit_)
+      - PROTOBUF_FIELD_OFFSET(connectedUserRequest, _impl_.userid_)>(
+          reinterpret_cast<char*>(&_impl_.userid_),
+          reinterpret_cast<char*>(&other->_impl_.userid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata connectedUserRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[3]);
+}
+
+// ===================================================================
+
+class ConnectedUser::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ConnectedUser>()._impl_._has_bits_);
+  static void set_has_username(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_userid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+ConnectedUser::ConnectedUser(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ConnectedUser)
+}
+ConnectedUser::ConnectedUser(const ConnectedUser& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConnectedUser* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.userid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_username()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.status_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_status()) {
+    _this->_impl_.status_.Set(from._internal_status(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ip()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.userid_ = from._impl_.userid_;
+  // @@protoc_insertion_point(copy_constructor:chat.ConnectedUser)
+}
+
+inline void ConnectedUser::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.userid_){0}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.status_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ConnectedUser::~ConnectedUser() {
+  // @@protoc_insertion_point(destructor:chat.ConnectedUser)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConnectedUser::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.status_.Destroy();
+  _impl_.ip_.Destroy();
+}
+
+void ConnectedUser::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConnectedUser::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ConnectedUser)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.username_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.status_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.ip_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.userid_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConnectedUser::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ConnectedUser.username");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_status();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ConnectedUser.status");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 userId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_userid(&has_bits);
+          _impl_.userid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string ip = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ConnectedUser.ip");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConnectedUser::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ConnectedUser)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string username = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ConnectedUser.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // optional string status = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_status().data(), static_cast<int>(this->_internal_status().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ConnectedUser.status");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_status(), target);
+  }
+
+  // optional int32 userId = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_userid(), target);
+  }
+
+  // optional string ip = 4;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_ip().data(), static_cast<int>(this->_internal_ip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ConnectedUser.ip");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_ip(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ConnectedUser)
+  return target;
+}
+
+size_t ConnectedUser::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ConnectedUser)
+  size_t total_size = 0;
+
+  // required string username = 1;
+  if (_internal_has_username()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000eu) {
+    // optional string status = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_status());
+    }
+
+    // optional string ip = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_ip());
+    }
+
+    // optional int32 userId = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConnectedUser::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConnectedUser::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConnectedUser::GetClassData() const { return &_class_data_; }
+
+
+void ConnectedUser::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConnectedUser*>(&to_msg);
+  auto& from = static_cast<const ConnectedUser&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ConnectedUser)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_username(from._internal_username());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_status(from._internal_status());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_ip(from._internal_ip());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.userid_ = from._impl_.userid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConnectedUser::CopyFrom(const ConnectedUser& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ConnectedUser)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConnectedUser::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ConnectedUser::InternalSwap(ConnectedUser* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_, lhs_arena,
+      &other->_impl_.status_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  swap(_impl_.userid_, other->_impl_.userid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConnectedUser::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[4]);
+}
+
+// ===================================================================
+
+class ConnectedUserResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ConnectedUserResponse>()._impl_._has_bits_);
+  static void set_has_nextcursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ConnectedUserResponse::ConnectedUserResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ConnectedUserResponse)
+}
+ConnectedUserResponse::ConnectedUserResponse(const ConnectedUserResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConnectedUserResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.connectedusers_){from._impl_.connectedusers_}
+    , decltype(_impl_.nextcursor_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.nextcursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nextcursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_nextcursor()) {
+    _this->_impl_.nextcursor_.Set(from._internal_nextcursor(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.ConnectedUserResponse)
+}
+
+inline void ConnectedUserResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.connectedusers_){arena}
+    , decltype(_impl_.nextcursor_){}
+  };
+  _impl_.nextcursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nextcursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ConnectedUserResponse::~ConnectedUserResponse() {
+  // @@protoc_insertion_point(destructor:chat.ConnectedUserResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConnectedUserResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.connectedusers_.~RepeatedPtrField();
+  _impl_.nextcursor_.Destroy();
+}
+
+void ConnectedUserResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConnectedUserResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ConnectedUserResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.connectedusers_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.nextcursor_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConnectedUserResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chat.ConnectedUser connectedUsers = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_connectedusers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string nextCursor = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_nextcursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ConnectedUserResponse.nextCursor");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConnectedUserResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ConnectedUserResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chat.ConnectedUser connectedUsers = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_connectedusers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_connectedusers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string nextCursor = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_nextcursor().data(), static_cast<int>(this->_internal_nextcursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ConnectedUserResponse.nextCursor");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_nextcursor(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ConnectedUserResponse)
+  return target;
+}
+
+size_t ConnectedUserResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ConnectedUserResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.ConnectedUser connectedUsers = 1;
+  total_size += 1UL * this->_internal_connectedusers_size();
+  for (const auto& msg : this->_impl_.connectedusers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string nextCursor = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_nextcursor());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConnectedUserResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConnectedUserResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConnectedUserResponse::GetClassData() const { return &_class_data_; }
+
+
+void ConnectedUserResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConnectedUserResponse*>(&to_msg);
+  auto& from = static_cast<const ConnectedUserResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ConnectedUserResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.connectedusers_.MergeFrom(from._impl_.connectedusers_);
+  if (from._internal_has_nextcursor()) {
+    _this->_internal_set_nextcursor(from._internal_nextcursor());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConnectedUserResponse::CopyFrom(const ConnectedUserResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ConnectedUserResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConnectedUserResponse::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.connectedusers_))
+    return false;
+  return true;
+}
+
+void ConnectedUserResponse::InternalSwap(ConnectedUserResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.connectedusers_.InternalSwap(&other->_impl_.connectedusers_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nextcursor_, lhs_arena,
+      &other->_impl_.nextcursor_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConnectedUserResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[5]);
+}
+
+// ===================================================================
+
+class ChangeStatusRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ChangeStatusRequest>()._impl_._has_bits_);
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+ChangeStatusRequest::ChangeStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ChangeStatusRequest)
+}
+ChangeStatusRequest::ChangeStatusRequest(const ChangeStatusRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChangeStatusRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.status_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_status()) {
+    _this->_impl_.status_.Set(from._internal_status(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.ChangeStatusRequest)
+}
+
+inline void ChangeStatusRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.status_){}
+  };
+  _impl_.status_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChangeStatusRequest::~ChangeStatusRequest() {
+  // @@protoc_insertion_point(destructor:chat.ChangeStatusRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChangeStatusRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.status_.Destroy();
+}
+
+void ChangeStatusRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChangeStatusRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ChangeStatusRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.status_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChangeStatusRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_status();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ChangeStatusRequest.status");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChangeStatusRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ChangeStatusRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string status = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_status().data(), static_cast<int>(this->_internal_status().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ChangeStatusRequest.status");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_status(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ChangeStatusRequest)
+  return target;
+}
+
+size_t ChangeStatusRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ChangeStatusRequest)
+  size_t total_size = 0;
+
+  // required string status = 1;
+  if (_internal_has_status()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChangeStatusRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChangeStatusRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChangeStatusRequest::GetClassData() const { return &_class_data_; }
+
+
+void ChangeStatusRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChangeStatusRequest*>(&to_msg);
+  auto& from = static_cast<const ChangeStatusRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ChangeStatusRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_status()) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChangeStatusRequest::CopyFrom(const ChangeStatusRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ChangeStatusRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChangeStatusRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ChangeStatusRequest::InternalSwap(ChangeStatusRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_, lhs_arena,
+      &other->_impl_.status_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChangeStatusRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[6]);
+}
+
+// ===================================================================
+
+class ChangeStatusResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ChangeStatusResponse>()._impl_._has_bits_);
+  static void set_has_userid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ChangeStatusResponse::ChangeStatusResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ChangeStatusResponse)
+}
+ChangeStatusResponse::ChangeStatusResponse(const ChangeStatusResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChangeStatusResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.userid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.status_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_status()) {
+    _this->_impl_.status_.Set(from._internal_status(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.userid_ = from._impl_.userid_;
+  // @@protoc_insertion_point(copy_constructor:chat.ChangeStatusResponse)
+}
+
+inline void ChangeStatusResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.userid_){0}
+  };
+  _impl_.status_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChangeStatusResponse::~ChangeStatusResponse() {
+  // @@protoc_insertion_point(destructor:chat.ChangeStatusResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChangeStatusResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.status_.Destroy();
+}
+
+void ChangeStatusResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChangeStatusResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ChangeStatusResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.status_.ClearNonDefaultToEmpty();
+  }
+  _impl_.userid_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChangeStatusResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 userId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_userid(&has_bits);
+          _impl_.userid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_status();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ChangeStatusResponse.status");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChangeStatusResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ChangeStatusResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 userId = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_userid(), target);
+  }
+
+  // required string status = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_status().data(), static_cast<int>(this->_internal_status().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ChangeStatusResponse.status");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_status(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ChangeStatusResponse)
+  return target;
+}
+
+size_t ChangeStatusResponse::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:chat.ChangeStatusResponse)
+  size_t total_size = 0;
+
+  if (_internal_has_status()) {
+    // required string status = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status());
+  }
+
+  if (_internal_has_userid()) {
+    // required int32 userId = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+  }
+
+  return total_size;
+}
+size_t ChangeStatusResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ChangeStatusResponse)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string status = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status());
+
+    // required int32 userId = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChangeStatusResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChangeStatusResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChangeStatusResponse::GetClassData() const { return &_class_data_; }
+
+
+void ChangeStatusResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChangeStatusResponse*>(&to_msg);
+  auto& from = static_cast<const ChangeStatusResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ChangeStatusResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_status(from._internal_status());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.userid_ = from._impl_.userid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChangeStatusResponse::CopyFrom(const ChangeStatusResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ChangeStatusResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChangeStatusResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ChangeStatusResponse::InternalSwap(ChangeStatusResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_, lhs_arena,
+      &other->_impl_.status_, rhs_arena
+  );
+  swap(_impl_.userid_, other->_impl_.userid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChangeStatusResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[7]);
+}
+
+// ===================================================================
+
+class BroadcastRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BroadcastRequest>()._impl_._has_bits_);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+BroadcastRequest::BroadcastRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.BroadcastRequest)
+}
+BroadcastRequest::BroadcastRequest(const BroadcastRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BroadcastRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.BroadcastRequest)
+}
+
+inline void BroadcastRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BroadcastRequest::~BroadcastRequest() {
+  // @@protoc_insertion_point(destructor:chat.BroadcastRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BroadcastRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+}
+
+void BroadcastRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BroadcastRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.BroadcastRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.message_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BroadcastRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.BroadcastRequest.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BroadcastRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.BroadcastRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.BroadcastRequest.message");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.BroadcastRequest)
+  return target;
+}
+
+size_t BroadcastRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.BroadcastRequest)
+  size_t total_size = 0;
+
+  // required string message = 1;
+  if (_internal_has_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BroadcastRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastRequest::GetClassData() const { return &_class_data_; }
+
+
+void BroadcastRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BroadcastRequest*>(&to_msg);
+  auto& from = static_cast<const BroadcastRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.BroadcastRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_message()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BroadcastRequest::CopyFrom(const BroadcastRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.BroadcastRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BroadcastRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void BroadcastRequest::InternalSwap(BroadcastRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[8]);
+}
+
+// ===================================================================
+
+class BroadcastResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BroadcastResponse>()._impl_._has_bits_);
+  static void set_has_messagestatus(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+BroadcastResponse::BroadcastResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.BroadcastResponse)
+}
+BroadcastResponse::BroadcastResponse(const BroadcastResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BroadcastResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.messagestatus_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.messagestatus_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.messagestatus_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_messagestatus()) {
+    _this->_impl_.messagestatus_.Set(from._internal_messagestatus(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.BroadcastResponse)
+}
+
+inline void BroadcastResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.messagestatus_){}
+  };
+  _impl_.messagestatus_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.messagestatus_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BroadcastResponse::~BroadcastResponse() {
+  // @@protoc_insertion_point(destructor:chat.BroadcastResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BroadcastResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messagestatus_.Destroy();
+}
+
+void BroadcastResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BroadcastResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.BroadcastResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.messagestatus_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BroadcastResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string messageStatus = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_messagestatus();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.BroadcastResponse.messageStatus");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BroadcastResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.BroadcastResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string messageStatus = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_messagestatus().data(), static_cast<int>(this->_internal_messagestatus().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.BroadcastResponse.messageStatus");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_messagestatus(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.BroadcastResponse)
+  return target;
+}
+
+size_t BroadcastResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.BroadcastResponse)
+  size_t total_size = 0;
+
+  // required string messageStatus = 1;
+  if (_internal_has_messagestatus()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_messagestatus());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BroadcastResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastResponse::GetClassData() const { return &_class_data_; }
+
+
+void BroadcastResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BroadcastResponse*>(&to_msg);
+  auto& from = static_cast<const BroadcastResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.BroadcastResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_messagestatus()) {
+    _this->_internal_set_messagestatus(from._internal_messagestatus());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BroadcastResponse::CopyFrom(const BroadcastResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.BroadcastResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BroadcastResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void BroadcastResponse::InternalSwap(BroadcastResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.messagestatus_, lhs_arena,
+      &other->_impl_.messagestatus_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[9]);
+}
+
+// ===================================================================
+
+class BroadcastMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BroadcastMessage>()._impl_._has_bits_);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_userid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_username(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sequence(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000009) ^ 0x00000009) != 0;
+  }
+};
+
+BroadcastMessage::BroadcastMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.BroadcastMessage)
+}
+BroadcastMessage::BroadcastMessage(const BroadcastMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BroadcastMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.userid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_username()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sequence_, &from._impl_.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.userid_) -
+    reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.userid_));
+  // @@protoc_insertion_point(copy_constructor:chat.BroadcastMessage)
+}
+
+inline void BroadcastMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.userid_){0}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BroadcastMessage::~BroadcastMessage() {
+  // @@protoc_insertion_point(destructor:chat.BroadcastMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BroadcastMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+  _impl_.username_.Destroy();
+}
+
+void BroadcastMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BroadcastMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.BroadcastMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.message_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.username_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.userid_) -
+        reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.userid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BroadcastMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.BroadcastMessage.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 userId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_userid(&has_bits);
+          _impl_.userid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string username = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.BroadcastMessage.username");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 sequence = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_sequence(&has_bits);
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BroadcastMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.BroadcastMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.BroadcastMessage.message");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_message(), target);
+  }
+
+  // required int32 userId = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_userid(), target);
+  }
+
+  // optional string username = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.BroadcastMessage.username");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_username(), target);
+  }
+
+  // optional uint64 sequence = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_sequence(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.BroadcastMessage)
+  return target;
+}
+
+size_t BroadcastMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:chat.BroadcastMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_message()) {
+    // required string message = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  if (_internal_has_userid()) {
+    // required int32 userId = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+  }
+
+  return total_size;
+}
+size_t BroadcastMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.BroadcastMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000009) ^ 0x00000009) == 0) {  // All required fields are present.
+    // required string message = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+
+    // required int32 userId = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional string username = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_username());
+    }
+
+    // optional uint64 sequence = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BroadcastMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastMessage::GetClassData() const { return &_class_data_; }
+
+
+void BroadcastMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BroadcastMessage*>(&to_msg);
+  auto& from = static_cast<const BroadcastMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.BroadcastMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_message(from._internal_message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_username(from._internal_username());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sequence_ = from._impl_.sequence_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.userid_ = from._impl_.userid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BroadcastMessage::CopyFrom(const BroadcastMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.BroadcastMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BroadcastMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void BroadcastMessage::InternalSwap(BroadcastMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BroadcastMessage, _impl_.userid_)
+      + sizeof(BroadcastMessage::_impl_.userid_)
+      - PROTOBUF_FIELD_OFFSET(BroadcastMessage, _impl_.sequence_)>(
+          reinterpret_cast<char*>(&_impl_.sequence_),
+          reinterpret_cast<char*>(&other->_impl_.sequence_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[10]);
+}
+
+// ===================================================================
+
+class DirectMessageRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DirectMessageRequest>()._impl_._has_bits_);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_userid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_username(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+DirectMessageRequest::DirectMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.DirectMessageRequest)
+}
+DirectMessageRequest::DirectMessageRequest(const DirectMessageRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DirectMessageRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.userid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_username()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.userid_ = from._impl_.userid_;
+  // @@protoc_insertion_point(copy_constructor:chat.DirectMessageRequest)
+}
+
+inline void DirectMessageRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.userid_){0}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DirectMessageRequest::~DirectMessageRequest() {
+  // @@protoc_insertion_point(destructor:chat.DirectMessageRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DirectMessageRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+  _impl_.username_.Destroy();
+}
+
+void DirectMessageRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DirectMessageRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.DirectMessageRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.message_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.username_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.userid_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DirectMessageRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.DirectMessageRequest.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 userId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_userid(&has_bits);
+          _impl_.userid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string username = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.DirectMessageRequest.username");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DirectMessageRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.DirectMessageRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.DirectMessageRequest.message");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_message(), target);
+  }
+
+  // optional int32 userId = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_userid(), target);
+  }
+
+  // optional string username = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.DirectMessageRequest.username");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_username(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.DirectMessageRequest)
+  return target;
+}
+
+size_t DirectMessageRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.DirectMessageRequest)
+  size_t total_size = 0;
+
+  // required string message = 1;
+  if (_internal_has_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional string username = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_username());
+    }
+
+    // optional int32 userId = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DirectMessageRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DirectMessageRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DirectMessageRequest::GetClassData() const { return &_class_data_; }
+
+
+void DirectMessageRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DirectMessageRequest*>(&to_msg);
+  auto& from = static_cast<const DirectMessageRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.DirectMessageRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_message(from._internal_message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_username(from._internal_username());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.userid_ = from._impl_.userid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DirectMessageRequest::CopyFrom(const DirectMessageRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.DirectMessageRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DirectMessageRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void DirectMessageRequest::InternalSwap(DirectMessageRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.userid_, other->_impl_.userid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DirectMessageRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[11]);
+}
+
+// ===================================================================
+
+class DirectMessageResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DirectMessageResponse>()._impl_._has_bits_);
+  static void set_has_messagestatus(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+DirectMessageResponse::DirectMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.DirectMessageResponse)
+}
+DirectMessageResponse::DirectMessageResponse(const DirectMessageResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DirectMessageResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.messagestatus_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.messagestatus_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.messagestatus_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_messagestatus()) {
+    _this->_impl_.messagestatus_.Set(from._internal_messagestatus(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.DirectMessageResponse)
+}
+
+inline void DirectMessageResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.messagestatus_){}
+  };
+  _impl_.messagestatus_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.messagestatus_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DirectMessageResponse::~DirectMessageResponse() {
+  // @@protoc_insertion_point(destructor:chat.DirectMessageResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DirectMessageResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messagestatus_.Destroy();
+}
+
+void DirectMessageResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DirectMessageResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.DirectMessageResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.messagestatus_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DirectMessageResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string messageStatus = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_messagestatus();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.DirectMessageResponse.messageStatus");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DirectMessageResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.DirectMessageResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string messageStatus = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_messagestatus().data(), static_cast<int>(this->_internal_messagestatus().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.DirectMessageResponse.messageStatus");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_messagestatus(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.DirectMessageResponse)
+  return target;
+}
+
+size_t DirectMessageResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.DirectMessageResponse)
+  size_t total_size = 0;
+
+  // required string messageStatus = 1;
+  if (_internal_has_messagestatus()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_messagestatus());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DirectMessageResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DirectMessageResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DirectMessageResponse::GetClassData() const { return &_class_data_; }
+
+
+void DirectMessageResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DirectMessageResponse*>(&to_msg);
+  auto& from = static_cast<const DirectMessageResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.DirectMessageResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_messagestatus()) {
+    _this->_internal_set_messagestatus(from._internal_messagestatus());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DirectMessageResponse::CopyFrom(const DirectMessageResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.DirectMessageResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DirectMessageResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void DirectMessageResponse::InternalSwap(DirectMessageResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.messagestatus_, lhs_arena,
+      &other->_impl_.messagestatus_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DirectMessageResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[12]);
+}
+
+// ===================================================================
+
+class DirectMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DirectMessage>()._impl_._has_bits_);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_userid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_username(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sequence(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000009) ^ 0x00000009) != 0;
+  }
+};
+
+DirectMessage::DirectMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.DirectMessage)
+}
+DirectMessage::DirectMessage(const DirectMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DirectMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.userid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_username()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sequence_, &from._impl_.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.userid_) -
+    reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.userid_));
+  // @@protoc_insertion_point(copy_constructor:chat.DirectMessage)
+}
+
+inline void DirectMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.userid_){0}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DirectMessage::~DirectMessage() {
+  // @@protoc_insertion_point(destructor:chat.DirectMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DirectMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+  _impl_.username_.Destroy();
+}
+
+void DirectMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DirectMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.DirectMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.message_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.username_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.userid_) -
+        reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.userid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DirectMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.DirectMessage.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 userId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_userid(&has_bits);
+          _impl_.userid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string username = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.DirectMessage.username");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 sequence = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_sequence(&has_bits);
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DirectMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.DirectMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.DirectMessage.message");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_message(), target);
+  }
+
+  // required int32 userId = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_userid(), target);
+  }
+
+  // optional string username = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.DirectMessage.username");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_username(), target);
+  }
+
+  // optional uint64 sequence = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_sequence(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.DirectMessage)
+  return target;
+}
+
+size_t DirectMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:chat.DirectMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_message()) {
+    // required string message = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  if (_internal_has_userid()) {
+    // required int32 userId = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+  }
+
+  return total_size;
+}
+size_t DirectMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.DirectMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000009) ^ 0x00000009) == 0) {  // All required fields are present.
+    // required string message = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+
+    // required int32 userId = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional string username = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_username());
+    }
+
+    // optional uint64 sequence = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DirectMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DirectMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DirectMessage::GetClassData() const { return &_class_data_; }
+
+
+void DirectMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DirectMessage*>(&to_msg);
+  auto& from = static_cast<const DirectMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.DirectMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_message(from._internal_message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_username(from._internal_username());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sequence_ = from._impl_.sequence_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.userid_ = from._impl_.userid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DirectMessage::CopyFrom(const DirectMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.DirectMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DirectMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void DirectMessage::InternalSwap(DirectMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DirectMessage, _impl_.userid_)
+      + sizeof(DirectMessage::_impl_.userid_)
+      - PROTOBUF_FIELD_OFFSET(DirectMessage, _impl_.sequence_)>(
+          reinterpret_cast<char*>(&_impl_.sequence_),
+          reinterpret_cast<char*>(&other->_impl_.sequence_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DirectMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[13]);
+}
+
+// ===================================================================
+
+class PresenceRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PresenceRequest>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+PresenceRequest::PresenceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PresenceRequest)
+}
+PresenceRequest::PresenceRequest(const PresenceRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PresenceRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:chat.PresenceRequest)
+}
+
+inline void PresenceRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){uint64_t{0u}}
+  };
+}
+
+PresenceRequest::~PresenceRequest() {
+  // @@protoc_insertion_point(destructor:chat.PresenceRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PresenceRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PresenceRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PresenceRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PresenceRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresenceRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint64 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PresenceRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PresenceRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint64 version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PresenceRequest)
+  return target;
+}
+
+size_t PresenceRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PresenceRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint64 version = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresenceRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PresenceRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresenceRequest::GetClassData() const { return &_class_data_; }
+
+
+void PresenceRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PresenceRequest*>(&to_msg);
+  auto& from = static_cast<const PresenceRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PresenceRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_version()) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PresenceRequest::CopyFrom(const PresenceRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PresenceRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresenceRequest::IsInitialized() const {
+  return true;
+}
+
+void PresenceRequest::InternalSwap(PresenceRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.version_, other->_impl_.version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresenceRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[14]);
+}
+
+// ===================================================================
+
+class PresenceDelta::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PresenceDelta>()._impl_._has_bits_);
+  static void set_has_kind(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::chat::ConnectedUser& user(const PresenceDelta* msg);
+  static void set_has_user(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::chat::ConnectedUser&
+PresenceDelta::_Internal::user(const PresenceDelta* msg) {
+  return *msg->_impl_.user_;
+}
+PresenceDelta::PresenceDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PresenceDelta)
+}
+PresenceDelta::PresenceDelta(const PresenceDelta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PresenceDelta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.kind_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_user()) {
+    _this->_impl_.user_ = new ::chat::ConnectedUser(*from._impl_.user_);
+  }
+  _this->_impl_.kind_ = from._impl_.kind_;
+  // @@protoc_insertion_point(copy_constructor:chat.PresenceDelta)
+}
+
+inline void PresenceDelta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.kind_){0}
+  };
+}
+
+PresenceDelta::~PresenceDelta() {
+  // @@protoc_insertion_point(destructor:chat.PresenceDelta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PresenceDelta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.user_;
+}
+
+void PresenceDelta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PresenceDelta::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PresenceDelta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.user_ != nullptr);
+    _impl_.user_->Clear();
+  }
+  _impl_.kind_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresenceDelta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 kind = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_kind(&has_bits);
+          _impl_.kind_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .chat.ConnectedUser user = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PresenceDelta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PresenceDelta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 kind = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_kind(), target);
+  }
+
+  // required .chat.ConnectedUser user = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::user(this),
+        _Internal::user(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PresenceDelta)
+  return target;
+}
+
+size_t PresenceDelta::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:chat.PresenceDelta)
+  size_t total_size = 0;
+
+  if (_internal_has_user()) {
+    // required .chat.ConnectedUser user = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.user_);
+  }
+
+  if (_internal_has_kind()) {
+    // required int32 kind = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_kind());
+  }
+
+  return total_size;
+}
+size_t PresenceDelta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PresenceDelta)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .chat.ConnectedUser user = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.user_);
+
+    // required int32 kind = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_kind());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresenceDelta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PresenceDelta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresenceDelta::GetClassData() const { return &_class_data_; }
+
+
+void PresenceDelta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PresenceDelta*>(&to_msg);
+  auto& from = static_cast<const PresenceDelta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PresenceDelta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_user()->::chat::ConnectedUser::MergeFrom(
+          from._internal_user());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.kind_ = from._impl_.kind_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PresenceDelta::CopyFrom(const PresenceDelta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PresenceDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresenceDelta::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_user()) {
+    if (!_impl_.user_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void PresenceDelta::InternalSwap(PresenceDelta* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PresenceDelta, _impl_.kind_)
+      + sizeof(PresenceDelta::_impl_.kind_)
+      - PROTOBUF_FIELD_OFFSET(PresenceDelta, _impl_.user_)>(
+          reinterpret_cast<char*>(&_impl_.user_),
+          reinterpret_cast<char*>(&other->_impl_.user_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresenceDelta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[15]);
+}
+
+// ===================================================================
+
+class PresenceUpdate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PresenceUpdate>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_baseversion(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::chat::ConnectedUserResponse& snapshot(const PresenceUpdate* msg);
+  static void set_has_snapshot(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+const ::chat::ConnectedUserResponse&
+PresenceUpdate::_Internal::snapshot(const PresenceUpdate* msg) {
+  return *msg->_impl_.snapshot_;
+}
+PresenceUpdate::PresenceUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PresenceUpdate)
+}
+PresenceUpdate::PresenceUpdate(const PresenceUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PresenceUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.deltas_){from._impl_.deltas_}
+    , decltype(_impl_.snapshot_){nullptr}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.baseversion_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_snapshot()) {
+    _this->_impl_.snapshot_ = new ::chat::ConnectedUserResponse(*from._impl_.snapshot_);
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.baseversion_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.baseversion_));
+  // @@protoc_insertion_point(copy_constructor:chat.PresenceUpdate)
+}
+
+inline void PresenceUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.deltas_){arena}
+    , decltype(_impl_.snapshot_){nullptr}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.baseversion_){uint64_t{0u}}
+  };
+}
+
+PresenceUpdate::~PresenceUpdate() {
+  // @@protoc_insertion_point(destructor:chat.PresenceUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PresenceUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.deltas_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.snapshot_;
+}
+
+void PresenceUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PresenceUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PresenceUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.deltas_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.snapshot_ != nullptr);
+    _impl_.snapshot_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.baseversion_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.baseversion_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresenceUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 baseVersion = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_baseversion(&has_bits);
+          _impl_.baseversion_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.ConnectedUserResponse snapshot = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_snapshot(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.PresenceDelta deltas = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_deltas(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PresenceUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PresenceUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 version = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_version(), target);
+  }
+
+  // optional uint64 baseVersion = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_baseversion(), target);
+  }
+
+  // optional .chat.ConnectedUserResponse snapshot = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::snapshot(this),
+        _Internal::snapshot(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .chat.PresenceDelta deltas = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_deltas_size()); i < n; i++) {
+    const auto& repfield = this->_internal_deltas(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PresenceUpdate)
+  return target;
+}
+
+size_t PresenceUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PresenceUpdate)
+  size_t total_size = 0;
+
+  // required uint64 version = 1;
+  if (_internal_has_version()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.PresenceDelta deltas = 4;
+  total_size += 1UL * this->_internal_deltas_size();
+  for (const auto& msg : this->_impl_.deltas_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional .chat.ConnectedUserResponse snapshot = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.snapshot_);
+  }
+
+  // optional uint64 baseVersion = 2;
+  if (cached_has_bits & 0x00000004u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_baseversion());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresenceUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PresenceUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresenceUpdate::GetClassData() const { return &_class_data_; }
+
+
+void PresenceUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PresenceUpdate*>(&to_msg);
+  auto& from = static_cast<const PresenceUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PresenceUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.deltas_.MergeFrom(from._impl_.deltas_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_snapshot()->::chat::ConnectedUserResponse::MergeFrom(
+          from._internal_snapshot());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.baseversion_ = from._impl_.baseversion_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PresenceUpdate::CopyFrom(const PresenceUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PresenceUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresenceUpdate::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.deltas_))
+    return false;
+  if (_internal_has_snapshot()) {
+    if (!_impl_.snapshot_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void PresenceUpdate::InternalSwap(PresenceUpdate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.deltas_.InternalSwap(&other->_impl_.deltas_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PresenceUpdate, _impl_.baseversion_)
+      + sizeof(PresenceUpdate::_impl_.baseversion_)
+      - PROTOBUF_FIELD_OFFSET(PresenceUpdate, _impl_.snapshot_)>(
+          reinterpret_cast<char*>(&_impl_.snapshot_),
+          reinterpret_cast<char*>(&other->_impl_.snapshot_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresenceUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[16]);
+}
+
+// ===================================================================
+
+class ChannelRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ChannelRequest>()._impl_._has_bits_);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+ChannelRequest::ChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ChannelRequest)
+}
+ChannelRequest::ChannelRequest(const ChannelRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChannelRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_.Set(from._internal_channel(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.ChannelRequest)
+}
+
+inline void ChannelRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}
+  };
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChannelRequest::~ChannelRequest() {
+  // @@protoc_insertion_point(destructor:chat.ChannelRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChannelRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channel_.Destroy();
+}
+
+void ChannelRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChannelRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ChannelRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.channel_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChannelRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string channel = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_channel();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ChannelRequest.channel");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChannelRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ChannelRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string channel = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_channel().data(), static_cast<int>(this->_internal_channel().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ChannelRequest.channel");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_channel(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ChannelRequest)
+  return target;
+}
+
+size_t ChannelRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ChannelRequest)
+  size_t total_size = 0;
+
+  // required string channel = 1;
+  if (_internal_has_channel()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChannelRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChannelRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChannelRequest::GetClassData() const { return &_class_data_; }
+
+
+void ChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChannelRequest*>(&to_msg);
+  auto& from = static_cast<const ChannelRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ChannelRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_channel()) {
+    _this->_internal_set_channel(from._internal_channel());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChannelRequest::CopyFrom(const ChannelRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ChannelRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChannelRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ChannelRequest::InternalSwap(ChannelRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_, lhs_arena,
+      &other->_impl_.channel_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChannelRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[17]);
+}
+
+// ===================================================================
+
+class ChannelMessageRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ChannelMessageRequest>()._impl_._has_bits_);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ChannelMessageRequest::ChannelMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ChannelMessageRequest)
+}
+ChannelMessageRequest::ChannelMessageRequest(const ChannelMessageRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChannelMessageRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.message_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_.Set(from._internal_channel(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.ChannelMessageRequest)
+}
+
+inline void ChannelMessageRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.message_){}
+  };
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChannelMessageRequest::~ChannelMessageRequest() {
+  // @@protoc_insertion_point(destructor:chat.ChannelMessageRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChannelMessageRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channel_.Destroy();
+  _impl_.message_.Destroy();
+}
+
+void ChannelMessageRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChannelMessageRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ChannelMessageRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.channel_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.message_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChannelMessageRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string channel = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_channel();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ChannelMessageRequest.channel");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ChannelMessageRequest.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChannelMessageRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ChannelMessageRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string channel = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_channel().data(), static_cast<int>(this->_internal_channel().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ChannelMessageRequest.channel");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_channel(), target);
+  }
+
+  // required string message = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ChannelMessageRequest.message");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ChannelMessageRequest)
+  return target;
+}
+
+size_t ChannelMessageRequest::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:chat.ChannelMessageRequest)
+  size_t total_size = 0;
+
+  if (_internal_has_channel()) {
+    // required string channel = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
+  }
+
+  if (_internal_has_message()) {
+    // required string message = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  return total_size;
+}
+size_t ChannelMessageRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ChannelMessageRequest)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string channel = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
+
+    // required string message = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChannelMessageRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChannelMessageRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChannelMessageRequest::GetClassData() const { return &_class_data_; }
+
+
+void ChannelMessageRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChannelMessageRequest*>(&to_msg);
+  auto& from = static_cast<const ChannelMessageRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ChannelMessageRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_channel(from._internal_channel());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_message(from._internal_message());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChannelMessageRequest::CopyFrom(const ChannelMessageRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ChannelMessageRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChannelMessageRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ChannelMessageRequest::InternalSwap(ChannelMessageRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_, lhs_arena,
+      &other->_impl_.channel_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChannelMessageRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[18]);
+}
+
+// ===================================================================
+
+class ChannelResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ChannelResponse>()._impl_._has_bits_);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_members(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ChannelResponse::ChannelResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ChannelResponse)
+}
+ChannelResponse::ChannelResponse(const ChannelResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChannelResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.members_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_.Set(from._internal_channel(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.status_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_status()) {
+    _this->_impl_.status_.Set(from._internal_status(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.members_ = from._impl_.members_;
+  // @@protoc_insertion_point(copy_constructor:chat.ChannelResponse)
+}
+
+inline void ChannelResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.members_){0}
+  };
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.status_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChannelResponse::~ChannelResponse() {
+  // @@protoc_insertion_point(destructor:chat.ChannelResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChannelResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channel_.Destroy();
+  _impl_.status_.Destroy();
+}
+
+void ChannelResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChannelResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ChannelResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.channel_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.status_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.members_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChannelResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string channel = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_channel();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ChannelResponse.channel");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_status();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ChannelResponse.status");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 members = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_members(&has_bits);
+          _impl_.members_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChannelResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ChannelResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string channel = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_channel().data(), static_cast<int>(this->_internal_channel().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ChannelResponse.channel");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_channel(), target);
+  }
+
+  // required string status = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_status().data(), static_cast<int>(this->_internal_status().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ChannelResponse.status");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_status(), target);
+  }
+
+  // optional int32 members = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_members(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ChannelResponse)
+  return target;
+}
+
+size_t ChannelResponse::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:chat.ChannelResponse)
+  size_t total_size = 0;
+
+  if (_internal_has_channel()) {
+    // required string channel = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
+  }
+
+  if (_internal_has_status()) {
+    // required string status = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status());
+  }
+
+  return total_size;
+}
+size_t ChannelResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ChannelResponse)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string channel = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
+
+    // required string status = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 members = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_members());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChannelResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChannelResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChannelResponse::GetClassData() const { return &_class_data_; }
+
+
+void ChannelResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChannelResponse*>(&to_msg);
+  auto& from = static_cast<const ChannelResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ChannelResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_channel(from._internal_channel());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_status(from._internal_status());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.members_ = from._impl_.members_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChannelResponse::CopyFrom(const ChannelResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ChannelResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChannelResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ChannelResponse::InternalSwap(ChannelResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_, lhs_arena,
+      &other->_impl_.channel_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_, lhs_arena,
+      &other->_impl_.status_, rhs_arena
+  );
+  swap(_impl_.members_, other->_impl_.members_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChannelResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[19]);
+}
+
+// ===================================================================
+
+class ChannelMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ChannelMessage>()._impl_._has_bits_);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_userid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_username(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000b) ^ 0x0000000b) != 0;
+  }
+};
+
+ChannelMessage::ChannelMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ChannelMessage)
+}
+ChannelMessage::ChannelMessage(const ChannelMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChannelMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.userid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_.Set(from._internal_channel(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_username()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.userid_ = from._impl_.userid_;
+  // @@protoc_insertion_point(copy_constructor:chat.ChannelMessage)
+}
+
+inline void ChannelMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.userid_){0}
+  };
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChannelMessage::~ChannelMessage() {
+  // @@protoc_insertion_point(destructor:chat.ChannelMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChannelMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channel_.Destroy();
+  _impl_.message_.Destroy();
+  _impl_.username_.Destroy();
+}
+
+void ChannelMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChannelMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ChannelMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.channel_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.message_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.username_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.userid_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChannelMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string channel = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_channel();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ChannelMessage.channel");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ChannelMessage.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 userId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_userid(&has_bits);
+          _impl_.userid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string username = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ChannelMessage.username");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChannelMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ChannelMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string channel = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_channel().data(), static_cast<int>(this->_internal_channel().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ChannelMessage.channel");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_channel(), target);
+  }
+
+  // required string message = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ChannelMessage.message");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_message(), target);
+  }
+
+  // required int32 userId = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_userid(), target);
+  }
+
+  // optional string username = 4;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ChannelMessage.username");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_username(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ChannelMessage)
+  return target;
+}
+
+size_t ChannelMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:chat.ChannelMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_channel()) {
+    // required string channel = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
+  }
+
+  if (_internal_has_message()) {
+    // required string message = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  if (_internal_has_userid()) {
+    // required int32 userId = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+  }
+
+  return total_size;
+}
+size_t ChannelMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ChannelMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000b) ^ 0x0000000b) == 0) {  // All required fields are present.
+    // required string channel = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
+
+    // required string message = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+
+    // required int32 userId = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string username = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChannelMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChannelMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChannelMessage::GetClassData() const { return &_class_data_; }
+
+
+void ChannelMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChannelMessage*>(&to_msg);
+  auto& from = static_cast<const ChannelMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ChannelMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_channel(from._internal_channel());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_message(from._internal_message());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_username(from._internal_username());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.userid_ = from._impl_.userid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChannelMessage::CopyFrom(const ChannelMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ChannelMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChannelMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ChannelMessage::InternalSwap(ChannelMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_, lhs_arena,
+      &other->_impl_.channel_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.userid_, other->_impl_.userid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChannelMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[20]);
+}
+
+// ===================================================================
+
+class ServerMessageBatch::_Internal {
+ public:
+};
+
+ServerMessageBatch::ServerMessageBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ServerMessageBatch)
+}
+ServerMessageBatch::ServerMessageBatch(const ServerMessageBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerMessageBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chat.ServerMessageBatch)
+}
+
+inline void ServerMessageBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ServerMessageBatch::~ServerMessageBatch() {
+  // @@protoc_insertion_point(destructor:chat.ServerMessageBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerMessageBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+}
+
+void ServerMessageBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerMessageBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ServerMessageBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.messages_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerMessageBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chat.ServerMessage messages = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerMessageBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ServerMessageBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chat.ServerMessage messages = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ServerMessageBatch)
+  return target;
+}
+
+size_t ServerMessageBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ServerMessageBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.ServerMessage messages = 1;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerMessageBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerMessageBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerMessageBatch::GetClassData() const { return &_class_data_; }
+
+
+void ServerMessageBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerMessageBatch*>(&to_msg);
+  auto& from = static_cast<const ServerMessageBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ServerMessageBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerMessageBatch::CopyFrom(const ServerMessageBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ServerMessageBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerMessageBatch::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.messages_))
+    return false;
+  return true;
+}
+
+void ServerMessageBatch::InternalSwap(ServerMessageBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerMessageBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[21]);
+}
+
+// ===================================================================
+
+class HistoryRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<HistoryRequest>()._impl_._has_bits_);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+HistoryRequest::HistoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.HistoryRequest)
+}
+HistoryRequest::HistoryRequest(const HistoryRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HistoryRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.after_){}
+    , decltype(_impl_.until_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.after_, &from._impl_.after_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.until_) -
+    reinterpret_cast<char*>(&_impl_.after_)) + sizeof(_impl_.until_));
+  // @@protoc_insertion_point(copy_constructor:chat.HistoryRequest)
+}
+
+inline void HistoryRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.after_){uint64_t{0u}}
+    , decltype(_impl_.until_){uint64_t{0u}}
+  };
+}
+
+HistoryRequest::~HistoryRequest() {
+  // @@protoc_insertion_point(destructor:chat.HistoryRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HistoryRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void HistoryRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HistoryRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.HistoryRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.after_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.until_) -
+        reinterpret_cast<char*>(&_impl_.after_)) + sizeof(_impl_.until_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HistoryRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 after = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_after(&has_bits);
+          _impl_.after_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 until = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_until(&has_bits);
+          _impl_.until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HistoryRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.HistoryRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 after = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_after(), target);
+  }
+
+  // optional uint64 until = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_until(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.HistoryRequest)
+  return target;
+}
+
+size_t HistoryRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.HistoryRequest)
+  size_t total_size = 0;
+
+  // required uint64 after = 1;
+  if (_internal_has_after()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_after());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint64 until = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_until());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HistoryRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HistoryRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HistoryRequest::GetClassData() const { return &_class_data_; }
+
+
+void HistoryRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HistoryRequest*>(&to_msg);
+  auto& from = static_cast<const HistoryRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.HistoryRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.after_ = from._impl_.after_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.until_ = from._impl_.until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HistoryRequest::CopyFrom(const HistoryRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.HistoryRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HistoryRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void HistoryRequest::InternalSwap(HistoryRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HistoryRequest, _impl_.until_)
+      + sizeof(HistoryRequest::_impl_.until_)
+      - PROTOBUF_FIELD_OFFSET(HistoryRequest, _impl_.after_)>(
+          reinterpret_cast<char*>(&_impl_.after_),
+          reinterpret_cast<char*>(&other->_impl_.after_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HistoryRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[22]);
+}
+
+// ===================================================================
+
+class HistoryResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<HistoryResponse>()._impl_._has_bits_);
+  static void set_has_last(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_more(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_truncated(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_messages(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+HistoryResponse::HistoryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.HistoryResponse)
+}
+HistoryResponse::HistoryResponse(const HistoryResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HistoryResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.last_){}
+    , decltype(_impl_.more_){}
+    , decltype(_impl_.truncated_){}
+    , decltype(_impl_.messages_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.last_, &from._impl_.last_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.messages_) -
+    reinterpret_cast<char*>(&_impl_.last_)) + sizeof(_impl_.messages_));
+  // @@protoc_insertion_point(copy_constructor:chat.HistoryResponse)
+}
+
+inline void HistoryResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.last_){uint64_t{0u}}
+    , decltype(_impl_.more_){false}
+    , decltype(_impl_.truncated_){false}
+    , decltype(_impl_.messages_){0}
+  };
+}
+
+HistoryResponse::~HistoryResponse() {
+  // @@protoc_insertion_point(destructor:chat.HistoryResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HistoryResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void HistoryResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HistoryResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.HistoryResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.last_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.messages_) -
+        reinterpret_cast<char*>(&_impl_.last_)) + sizeof(_impl_.messages_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HistoryResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 last = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_last(&has_bits);
+          _impl_.last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool more = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_more(&has_bits);
+          _impl_.more_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool truncated = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_truncated(&has_bits);
+          _impl_.truncated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 messages = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_messages(&has_bits);
+          _impl_.messages_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HistoryResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.HistoryResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 last = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_last(), target);
+  }
+
+  // optional bool more = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_more(), target);
+  }
+
+  // optional bool truncated = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_truncated(), target);
+  }
+
+  // optional int32 messages = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_messages(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.HistoryResponse)
+  return target;
+}
+
+size_t HistoryResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.HistoryResponse)
+  size_t total_size = 0;
+
+  // required uint64 last = 1;
+  if (_internal_has_last()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000eu) {
+    // optional bool more = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool truncated = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 messages = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_messages());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HistoryResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HistoryResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HistoryResponse::GetClassData() const { return &_class_data_; }
+
+
+void HistoryResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HistoryResponse*>(&to_msg);
+  auto& from = static_cast<const HistoryResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.HistoryResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.last_ = from._impl_.last_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.more_ = from._impl_.more_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.truncated_ = from._impl_.truncated_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.messages_ = from._impl_.messages_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HistoryResponse::CopyFrom(const HistoryResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.HistoryResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HistoryResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void HistoryResponse::InternalSwap(HistoryResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HistoryResponse, _impl_.messages_)
+      + sizeof(HistoryResponse::_impl_.messages_)
+      - PROTOBUF_FIELD_OFFSET(HistoryResponse, _impl_.last_)>(
+          reinterpret_cast<char*>(&_impl_.last_),
+          reinterpret_cast<char*>(&other->_impl_.last_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HistoryResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[23]);
+}
+
+// ===================================================================
+
+class ErrorResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ErrorResponse>()._impl_._has_bits_);
+  static void set_has_errormessage(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+ErrorResponse::ErrorResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ErrorResponse)
+}
+ErrorResponse::ErrorResponse(const ErrorResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ErrorResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.errormessage_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.errormessage_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.errormessage_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_errormessage()) {
+    _this->_impl_.errormessage_.Set(from._internal_errormessage(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.ErrorResponse)
+}
+
+inline void ErrorResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.errormessage_){}
+  };
+  _impl_.errormessage_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.errormessage_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ErrorResponse::~ErrorResponse() {
+  // @@protoc_insertion_point(destructor:chat.ErrorResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ErrorResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.errormessage_.Destroy();
+}
+
+void ErrorResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ErrorResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ErrorResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.errormessage_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ErrorResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string errorMessage = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_errormessage();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "chat.ErrorResponse.errorMessage");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ErrorResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ErrorResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string errorMessage = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_errormessage().data(), static_cast<int>(this->_internal_errormessage().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "chat.ErrorResponse.errorMessage");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_errormessage(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ErrorResponse)
+  return target;
+}
+
+size_t ErrorResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ErrorResponse)
+  size_t total_size = 0;
+
+  // required string errorMessage = 1;
+  if (_internal_has_errormessage()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_errormessage());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ErrorResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ErrorResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ErrorResponse::GetClassData() const { return &_class_data_; }
+
+
+void ErrorResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ErrorResponse*>(&to_msg);
+  auto& from = static_cast<const ErrorResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ErrorResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_errormessage()) {
+    _this->_internal_set_errormessage(from._internal_errormessage());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ErrorResponse::CopyFrom(const ErrorResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ErrorResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ErrorResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ErrorResponse::InternalSwap(ErrorResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.errormessage_, lhs_arena,
+      &other->_impl_.errormessage_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ErrorResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[24]);
+}
+
+// ===================================================================
+
+class ClientMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ClientMessage>()._impl_._has_bits_);
+  static void set_has_option(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_userid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static const ::chat::MyInfoSynchronize& synchronize(const ClientMessage* msg);
+  static void set_has_synchronize(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::chat::connectedUserRequest& connectedusers(const ClientMessage* msg);
+  static void set_has_connectedusers(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::chat::ChangeStatusRequest& changestatus(const ClientMessage* msg);
+  static void set_has_changestatus(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::chat::BroadcastRequest& broadcast(const ClientMessage* msg);
+  static void set_has_broadcast(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::chat::DirectMessageRequest& directmessage(const ClientMessage* msg);
+  static void set_has_directmessage(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::chat::MyInfoAcknowledge& acknowledge(const ClientMessage* msg);
+  static void set_has_acknowledge(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::chat::PresenceRequest& presence(const ClientMessage* msg);
+  static void set_has_presence(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::chat::ChannelRequest& channel(const ClientMessage* msg);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::chat::ChannelMessageRequest& channelmessage(const ClientMessage* msg);
+  static void set_has_channelmessage(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::chat::HistoryRequest& history(const ClientMessage* msg);
+  static void set_has_history(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_requestid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000400) ^ 0x00000400) != 0;
+  }
+};
+
+const ::chat::MyInfoSynchronize&
+ClientMessage::_Internal::synchronize(const ClientMessage* msg) {
+  return *msg->_impl_.synchronize_;
+}
+const ::chat::connectedUserRequest&
+ClientMessage::_Internal::connectedusers(const ClientMessage* msg) {
+  return *msg->_impl_.connectedusers_;
+}
+const ::chat::ChangeStatusRequest&
+ClientMessage::_Internal::changestatus(const ClientMessage* msg) {
+  return *msg->_impl_.changestatus_;
+}
+const ::chat::BroadcastRequest&
+ClientMessage::_Internal::broadcast(const ClientMessage* msg) {
+  return *msg->_impl_.broadcast_;
+}
+const ::chat::DirectMessageRequest&
+ClientMessage::_Internal::directmessage(const ClientMessage* msg) {
+  return *msg->_impl_.directmessage_;
+}
+const ::chat::MyInfoAcknowledge&
+ClientMessage::_Internal::acknowledge(const ClientMessage* msg) {
+  return *msg->_impl_.acknowledge_;
+}
+const ::chat::PresenceRequest&
+ClientMessage::_Internal::presence(const ClientMessage* msg) {
+  return *msg->_impl_.presence_;
+}
+const ::chat::ChannelRequest&
+ClientMessage::_Internal::channel(const ClientMessage* msg) {
+  return *msg->_impl_.channel_;
+}
+const ::chat::ChannelMessageRequest&
+ClientMessage::_Internal::channelmessage(const ClientMessage* msg) {
+  return *msg->_impl_.channelmessage_;
+}
+const ::chat::HistoryRequest&
+ClientMessage::_Internal::history(const ClientMessage* msg) {
+  return *msg->_impl_.history_;
+}
+ClientMessage::ClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ClientMessage)
+}
+ClientMessage::ClientMessage(const ClientMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClientMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.synchronize_){nullptr}
+    , decltype(_impl_.connectedusers_){nullptr}
+    , decltype(_impl_.changestatus_){nullptr}
+    , decltype(_impl_.broadcast_){nullptr}
+    , decltype(_impl_.directmessage_){nullptr}
+    , decltype(_impl_.acknowledge_){nullptr}
+    , decltype(_impl_.presence_){nullptr}
+    , decltype(_impl_.channel_){nullptr}
+    , decltype(_impl_.channelmessage_){nullptr}
+    , decltype(_impl_.history_){nullptr}
+    , decltype(_impl_.option_){}
+    , decltype(_impl_.userid_){}
+    , decltype(_impl_.requestid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_synchronize()) {
+    _this->_impl_.synchronize_ = new ::chat::MyInfoSynchronize(*from._impl_.synchronize_);
+  }
+  if (from._internal_has_connectedusers()) {
+    _this->_impl_.connectedusers_ = new ::chat::connectedUserRequest(*from._impl_.connectedusers_);
+  }
+  if (from._internal_has_changestatus()) {
+    _this->_impl_.changestatus_ = new ::chat::ChangeStatusRequest(*from._impl_.changestatus_);
+  }
+  if (from._internal_has_broadcast()) {
+    _this->_impl_.broadcast_ = new ::chat::BroadcastRequest(*from._impl_.broadcast_);
+  }
+  if (from._internal_has_directmessage()) {
+    _this->_impl_.directmessage_ = new ::chat::DirectMessageRequest(*from._impl_.directmessage_);
+  }
+  if (from._internal_has_acknowledge()) {
+    _this->_impl_.acknowledge_ = new ::chat::MyInfoAcknowledge(*from._impl_.acknowledge_);
+  }
+  if (from._internal_has_presence()) {
+    _this->_impl_.presence_ = new ::chat::PresenceRequest(*from._impl_.presence_);
+  }
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_ = new ::chat::ChannelRequest(*from._impl_.channel_);
+  }
+  if (from._internal_has_channelmessage()) {
+    _this->_impl_.channelmessage_ = new ::chat::ChannelMessageRequest(*from._impl_.channelmessage_);
+  }
+  if (from._internal_has_history()) {
+    _this->_impl_.history_ = new ::chat::HistoryRequest(*from._impl_.history_);
+  }
+  ::memcpy(&_impl_.option_, &from._impl_.option_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.requestid_) -
+    reinterpret_cast<char*>(&_impl_.option_)) + sizeof(_impl_.requestid_));
+  // @@protoc_insertion_point(copy_constructor:chat.ClientMessage)
+}
+
+inline void ClientMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.synchronize_){nullptr}
+    , decltype(_impl_.connectedusers_){nullptr}
+    , decltype(_impl_.changestatus_){nullptr}
+    , decltype(_impl_.broadcast_){nullptr}
+    , decltype(_impl_.directmessage_){nullptr}
+    , decltype(_impl_.acknowledge_){nullptr}
+    , decltype(_impl_.presence_){nullptr}
+    , decltype(_impl_.channel_){nullptr}
+    , decltype(_impl_.channelmessage_){nullptr}
+    , decltype(_impl_.history_){nullptr}
+    , decltype(_impl_.option_){0}
+    , decltype(_impl_.userid_){0}
+    , decltype(_impl_.requestid_){0u}
+  };
+}
+
+ClientMessage::~ClientMessage() {
+  // @@protoc_insertion_point(destructor:chat.ClientMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClientMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.synchronize_;
+  if (this != internal_default_instance()) delete _impl_.connectedusers_;
+  if (this != internal_default_instance()) delete _impl_.changestatus_;
+  if (this != internal_default_instance()) delete _impl_.broadcast_;
+  if (this != internal_default_instance()) delete _impl_.directmessage_;
+  if (this != internal_default_instance()) delete _impl_.acknowledge_;
+  if (this != internal_default_instance()) delete _impl_.presence_;
+  if (this != internal_default_instance()) delete _impl_.channel_;
+  if (this != internal_default_instance()) delete _impl_.channelmessage_;
+  if (this != internal_default_instance()) delete _impl_.history_;
+}
+
+void ClientMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClientMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ClientMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.synchronize_ != nullptr);
+      _impl_.synchronize_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.connectedusers_ != nullptr);
+      _impl_.connectedusers_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.changestatus_ != nullptr);
+      _impl_.changestatus_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.broadcast_ != nullptr);
+      _impl_.broadcast_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.directmessage_ != nullptr);
+      _impl_.directmessage_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.acknowledge_ != nullptr);
+      _impl_.acknowledge_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.presence_ != nullptr);
+      _impl_.presence_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.channel_ != nullptr);
+      _impl_.channel_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(_impl_.channelmessage_ != nullptr);
+      _impl_.channelmessage_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(_impl_.history_ != nullptr);
+      _impl_.history_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00001c00u) {
+    ::memset(&_impl_.option_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.requestid_) -
+        reinterpret_cast<char*>(&_impl_.option_)) + sizeof(_impl_.requestid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClientMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 option = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_option(&has_bits);
+          _impl_.option_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 userId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_userid(&has_bits);
+          _impl_.userid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.MyInfoSynchronize synchronize = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_synchronize(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.connectedUserRequest connectedUsers = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_connectedusers(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.ChangeStatusRequest changeStatus = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_changestatus(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.BroadcastRequest broadcast = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_broadcast(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.DirectMessageRequest directMessage = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_directmessage(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.MyInfoAcknowledge acknowledge = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_acknowledge(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.PresenceRequest presence = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_presence(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.ChannelRequest channel = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.ChannelMessageRequest channelMessage = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channelmessage(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.HistoryRequest history = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_history(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 requestId = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_requestid(&has_bits);
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClientMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ClientMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 option = 1;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_option(), target);
+  }
+
+  // optional int32 userId = 2;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_userid(), target);
+  }
+
+  // optional .chat.MyInfoSynchronize synchronize = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::synchronize(this),
+        _Internal::synchronize(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.connectedUserRequest connectedUsers = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::connectedusers(this),
+        _Internal::connectedusers(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.ChangeStatusRequest changeStatus = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::changestatus(this),
+        _Internal::changestatus(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.BroadcastRequest broadcast = 6;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::broadcast(this),
+        _Internal::broadcast(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.DirectMessageRequest directMessage = 7;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::directmessage(this),
+        _Internal::directmessage(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.MyInfoAcknowledge acknowledge = 8;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::acknowledge(this),
+        _Internal::acknowledge(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.PresenceRequest presence = 9;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::presence(this),
+        _Internal::presence(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.ChannelRequest channel = 10;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::channel(this),
+        _Internal::channel(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.ChannelMessageRequest channelMessage = 11;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::channelmessage(this),
+        _Internal::channelmessage(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.HistoryRequest history = 12;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::history(this),
+        _Internal::history(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 requestId = 13;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_requestid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ClientMessage)
+  return target;
+}
+
+size_t ClientMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ClientMessage)
+  size_t total_size = 0;
+
+  // required int32 option = 1;
+  if (_internal_has_option()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_option());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .chat.MyInfoSynchronize synchronize = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.synchronize_);
+    }
+
+    // optional .chat.connectedUserRequest connectedUsers = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.connectedusers_);
+    }
+
+    // optional .chat.ChangeStatusRequest changeStatus = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.changestatus_);
+    }
+
+    // optional .chat.BroadcastRequest broadcast = 6;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.broadcast_);
+    }
+
+    // optional .chat.DirectMessageRequest directMessage = 7;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.directmessage_);
+    }
+
+    // optional .chat.MyInfoAcknowledge acknowledge = 8;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.acknowledge_);
+    }
+
+    // optional .chat.PresenceRequest presence = 9;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.presence_);
+    }
+
+    // optional .chat.ChannelRequest channel = 10;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.channel_);
+    }
+
+  }
+  if (cached_has_bits & 0x00000300u) {
+    // optional .chat.ChannelMessageRequest channelMessage = 11;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.channelmessage_);
+    }
+
+    // optional .chat.HistoryRequest history = 12;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.history_);
+    }
+
+  }
+  if (cached_has_bits & 0x00001800u) {
+    // optional int32 userId = 2;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_userid());
+    }
+
+    // optional uint32 requestId = 13;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_requestid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClientMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientMessage::GetClassData() const { return &_class_data_; }
+
+
+void ClientMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClientMessage*>(&to_msg);
+  auto& from = static_cast<const ClientMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ClientMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_synchronize()->::chat::MyInfoSynchronize::MergeFrom(
+          from._internal_synchronize());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_connectedusers()->::chat::connectedUserRequest::MergeFrom(
+          from._internal_connectedusers());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_changestatus()->::chat::ChangeStatusRequest::MergeFrom(
+          from._internal_changestatus());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_broadcast()->::chat::BroadcastRequest::MergeFrom(
+          from._internal_broadcast());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_directmessage()->::chat::DirectMessageRequest::MergeFrom(
+          from._internal_directmessage());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_acknowledge()->::chat::MyInfoAcknowledge::MergeFrom(
+          from._internal_acknowledge());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_presence()->::chat::PresenceRequest::MergeFrom(
+          from._internal_presence());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_channel()->::chat::ChannelRequest::MergeFrom(
+          from._internal_channel());
+    }
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_channelmessage()->::chat::ChannelMessageRequest::MergeFrom(
+          from._internal_channelmessage());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_history()->::chat::HistoryRequest::MergeFrom(
+          from._internal_history());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.option_ = from._impl_.option_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.userid_ = from._impl_.userid_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.requestid_ = from._impl_.requestid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClientMessage::CopyFrom(const ClientMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ClientMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClientMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_synchronize()) {
+    if (!_impl_.synchronize_->IsInitialized()) return false;
+  }
+  if (_internal_has_changestatus()) {
+    if (!_impl_.changestatus_->IsInitialized()) return false;
+  }
+  if (_internal_has_broadcast()) {
+    if (!_impl_.broadcast_->IsInitialized()) return false;
+  }
+  if (_internal_has_directmessage()) {
+    if (!_impl_.directmessage_->IsInitialized()) return false;
+  }
+  if (_internal_has_acknowledge()) {
+    if (!_impl_.acknowledge_->IsInitialized()) return false;
+  }
+  if (_internal_has_channel()) {
+    if (!_impl_.channel_->IsInitialized()) return false;
+  }
+  if (_internal_has_channelmessage()) {
+    if (!_impl_.channelmessage_->IsInitialized()) return false;
+  }
+  if (_internal_has_history()) {
+    if (!_impl_.history_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ClientMessage::InternalSwap(ClientMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClientMessage, _impl_.requestid_)
+      + sizeof(ClientMessage::_impl_.requestid_)
+      - PROTOBUF_FIELD_OFFSET(ClientMessage, _impl_.synchronize_)>(
+          reinterpret_cast<char*>(&_impl_.synchronize_),
+          reinterpret_cast<char*>(&other->_impl_.synchronize_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClientMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[25]);
+}
+
+// ===================================================================
+
+class ServerMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerMessage>()._impl_._has_bits_);
+  static void set_has_option(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static const ::chat::BroadcastMessage& broadcast(const ServerMessage* msg);
+  static void set_has_broadcast(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::chat::DirectMessage& message(const ServerMessage* msg);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::chat::ErrorResponse& error(const ServerMessage* msg);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::chat::MyInfoResponse& myinforesponse(const ServerMessage* msg);
+  static void set_has_myinforesponse(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::chat::ConnectedUserResponse& connecteduserresponse(const ServerMessage* msg);
+  static void set_has_connecteduserresponse(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::chat::ChangeStatusResponse& changestatusresponse(const ServerMessage* msg);
+  static void set_has_changestatusresponse(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::chat::BroadcastResponse& broadcastresponse(const ServerMessage* msg);
+  static void set_has_broadcastresponse(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::chat::DirectMessageResponse& directmessageresponse(const ServerMessage* msg);
+  static void set_has_directmessageresponse(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::chat::ServerMessageBatch& batch(const ServerMessage* msg);
+  static void set_has_batch(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::chat::PresenceUpdate& presence(const ServerMessage* msg);
+  static void set_has_presence(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::chat::ChannelResponse& channelresponse(const ServerMessage* msg);
+  static void set_has_channelresponse(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::chat::ChannelMessage& channelmessage(const ServerMessage* msg);
+  static void set_has_channelmessage(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static const ::chat::HistoryResponse& history(const ServerMessage* msg);
+  static void set_has_history(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_requestid(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00002000) ^ 0x00002000) != 0;
+  }
+};
+
+const ::chat::BroadcastMessage&
+ServerMessage::_Internal::broadcast(const ServerMessage* msg) {
+  return *msg->_impl_.broadcast_;
+}
+const ::chat::DirectMessage&
+ServerMessage::_Internal::message(const ServerMessage* msg) {
+  return *msg->_impl_.message_;
+}
+const ::chat::ErrorResponse&
+ServerMessage::_Internal::error(const ServerMessage* msg) {
+  return *msg->_impl_.error_;
+}
+const ::chat::MyInfoResponse&
+ServerMessage::_Internal::myinforesponse(const ServerMessage* msg) {
+  return *msg->_impl_.myinforesponse_;
+}
+const ::chat::ConnectedUserResponse&
+ServerMessage::_Internal::connecteduserresponse(const ServerMessage* msg) {
+  return *msg->_impl_.connecteduserresponse_;
+}
+const ::chat::ChangeStatusResponse&
+ServerMessage::_Internal::changestatusresponse(const ServerMessage* msg) {
+  return *msg->_impl_.changestatusresponse_;
+}
+const ::chat::BroadcastResponse&
+ServerMessage::_Internal::broadcastresponse(const ServerMessage* msg) {
+  return *msg->_impl_.broadcastresponse_;
+}
+const ::chat::DirectMessageResponse&
+ServerMessage::_Internal::directmessageresponse(const ServerMessage* msg) {
+  return *msg->_impl_.directmessageresponse_;
+}
+const ::chat::ServerMessageBatch&
+ServerMessage::_Internal::batch(const ServerMessage* msg) {
+  return *msg->_impl_.batch_;
+}
+const ::chat::PresenceUpdate&
+ServerMessage::_Internal::presence(const ServerMessage* msg) {
+  return *msg->_impl_.presence_;
+}
+const ::chat::ChannelResponse&
+ServerMessage::_Internal::channelresponse(const ServerMessage* msg) {
+  return *msg->_impl_.channelresponse_;
+}
+const ::chat::ChannelMessage&
+ServerMessage::_Internal::channelmessage(const ServerMessage* msg) {
+  return *msg->_impl_.channelmessage_;
+}
+const ::chat::HistoryResponse&
+ServerMessage::_Internal::history(const ServerMessage* msg) {
+  return *msg->_impl_.history_;
+}
+ServerMessage::ServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ServerMessage)
+}
+ServerMessage::ServerMessage(const ServerMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.broadcast_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.error_){nullptr}
+    , decltype(_impl_.myinforesponse_){nullptr}
+    , decltype(_impl_.connecteduserresponse_){nullptr}
+    , decltype(_impl_.changestatusresponse_){nullptr}
+    , decltype(_impl_.broadcastresponse_){nullptr}
+    , decltype(_impl_.directmessageresponse_){nullptr}
+    , decltype(_impl_.batch_){nullptr}
+    , decltype(_impl_.presence_){nullptr}
+    , decltype(_impl_.channelresponse_){nullptr}
+    , decltype(_impl_.channelmessage_){nullptr}
+    , decltype(_impl_.history_){nullptr}
+    , decltype(_impl_.option_){}
+    , decltype(_impl_.requestid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_broadcast()) {
+    _this->_impl_.broadcast_ = new ::chat::BroadcastMessage(*from._impl_.broadcast_);
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::chat::DirectMessage(*from._impl_.message_);
+  }
+  if (from._internal_has_error()) {
+    _this->_impl_.error_ = new ::chat::ErrorResponse(*from._impl_.error_);
+  }
+  if (from._internal_has_myinforesponse()) {
+    _this->_impl_.myinforesponse_ = new ::chat::MyInfoResponse(*from._impl_.myinforesponse_);
+  }
+  if (from._internal_has_connecteduserresponse()) {
+    _this->_impl_.connecteduserresponse_ = new ::chat::ConnectedUserResponse(*from._impl_.connecteduserresponse_);
+  }
+  if (from._internal_has_changestatusresponse()) {
+    _this->_impl_.changestatusresponse_ = new ::chat::ChangeStatusResponse(*from._impl_.changestatusresponse_);
+  }
+  if (from._internal_has_broadcastresponse()) {
+    _this->_impl_.broadcastresponse_ = new ::chat::BroadcastResponse(*from._impl_.broadcastresponse_);
+  }
+  if (from._internal_has_directmessageresponse()) {
+    _this->_impl_.directmessageresponse_ = new ::chat::DirectMessageResponse(*from._impl_.directmessageresponse_);
+  }
+  if (from._internal_has_batch()) {
+    _this->_impl_.batch_ = new ::chat::ServerMessageBatch(*from._impl_.batch_);
+  }
+  if (from._internal_has_presence()) {
+    _this->_impl_.presence_ = new ::chat::PresenceUpdate(*from._impl_.presence_);
+  }
+  if (from._internal_has_channelresponse()) {
+    _this->_impl_.channelresponse_ = new ::chat::ChannelResponse(*from._impl_.channelresponse_);
+  }
+  if (from._internal_has_channelmessage()) {
+    _this->_impl_.channelmessage_ = new ::chat::ChannelMessage(*from._impl_.channelmessage_);
+  }
+  if (from._internal_has_history()) {
+    _this->_impl_.history_ = new ::chat::HistoryResponse(*from._impl_.history_);
+  }
+  ::memcpy(&_impl_.option_, &from._impl_.option_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.requestid_) -
+    reinterpret_cast<char*>(&_impl_.option_)) + sizeof(_impl_.requestid_));
+  // @@protoc_insertion_point(copy_constructor:chat.ServerMessage)
+}
+
+inline void ServerMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.broadcast_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.error_){nullptr}
+    , decltype(_impl_.myinforesponse_){nullptr}
+    , decltype(_impl_.connecteduserresponse_){nullptr}
+    , decltype(_impl_.changestatusresponse_){nullptr}
+    , decltype(_impl_.broadcastresponse_){nullptr}
+    , decltype(_impl_.directmessageresponse_){nullptr}
+    , decltype(_impl_.batch_){nullptr}
+    , decltype(_impl_.presence_){nullptr}
+    , decltype(_impl_.channelresponse_){nullptr}
+    , decltype(_impl_.channelmessage_){nullptr}
+    , decltype(_impl_.history_){nullptr}
+    , decltype(_impl_.option_){0}
+    , decltype(_impl_.requestid_){0u}
+  };
+}
+
+ServerMessage::~ServerMessage() {
+  // @@protoc_insertion_point(destructor:chat.ServerMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.broadcast_;
+  if (this != internal_default_instance()) delete _impl_.message_;
+  if (this != internal_default_instance()) delete _impl_.error_;
+  if (this != internal_default_instance()) delete _impl_.myinforesponse_;
+  if (this != internal_default_instance()) delete _impl_.connecteduserresponse_;
+  if (this != internal_default_instance()) delete _impl_.changestatusresponse_;
+  if (this != internal_default_instance()) delete _impl_.broadcastresponse_;
+  if (this != internal_default_instance()) delete _impl_.directmessageresponse_;
+  if (this != internal_default_instance()) delete _impl_.batch_;
+  if (this != internal_default_instance()) delete _impl_.presence_;
+  if (this != internal_default_instance()) delete _impl_.channelresponse_;
+  if (this != internal_default_instance()) delete _impl_.channelmessage_;
+  if (this != internal_default_instance()) delete _impl_.history_;
+}
+
+void ServerMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ServerMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.broadcast_ != nullptr);
+      _impl_.broadcast_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.message_ != nullptr);
+      _impl_.message_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.error_ != nullptr);
+      _impl_.error_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.myinforesponse_ != nullptr);
+      _impl_.myinforesponse_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.connecteduserresponse_ != nullptr);
+      _impl_.connecteduserresponse_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.changestatusresponse_ != nullptr);
+      _impl_.changestatusresponse_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.broadcastresponse_ != nullptr);
+      _impl_.broadcastresponse_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.directmessageresponse_ != nullptr);
+      _impl_.directmessageresponse_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(_impl_.batch_ != nullptr);
+      _impl_.batch_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(_impl_.presence_ != nullptr);
+      _impl_.presence_->Clear();
+    }
+    if (cached_has_bits & 0x00000400u) {
+      GOOGLE_DCHECK(_impl_.channelresponse_ != nullptr);
+      _impl_.channelresponse_->Clear();
+    }
+    if (cached_has_bits & 0x00000800u) {
+      GOOGLE_DCHECK(_impl_.channelmessage_ != nullptr);
+      _impl_.channelmessage_->Clear();
+    }
+    if (cached_has_bits & 0x00001000u) {
+      GOOGLE_DCHECK(_impl_.history_ != nullptr);
+      _impl_.history_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00006000u) {
+    ::memset(&_impl_.option_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.requestid_) -
+        reinterpret_cast<char*>(&_impl_.option_)) + sizeof(_impl_.requestid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 option = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_option(&has_bits);
+          _impl_.option_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.BroadcastMessage broadcast = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_broadcast(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.DirectMessage message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.ErrorResponse error = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.MyInfoResponse myInfoResponse = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_myinforesponse(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.ConnectedUserResponse connectedUserResponse = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_connecteduserresponse(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.ChangeStatusResponse changeStatusResponse = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_changestatusresponse(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.BroadcastResponse broadcastResponse = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_broadcastresponse(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.DirectMessageResponse directMessageResponse = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_directmessageresponse(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.ServerMessageBatch batch = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.PresenceUpdate presence = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_presence(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.ChannelResponse channelResponse = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channelresponse(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.ChannelMessage channelMessage = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channelmessage(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .chat.HistoryResponse history = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_history(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 requestId = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_requestid(&has_bits);
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ServerMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 option = 1;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_option(), target);
+  }
+
+  // optional .chat.BroadcastMessage broadcast = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::broadcast(this),
+        _Internal::broadcast(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.DirectMessage message = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.ErrorResponse error = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.MyInfoResponse myInfoResponse = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::myinforesponse(this),
+        _Internal::myinforesponse(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.ConnectedUserResponse connectedUserResponse = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::connecteduserresponse(this),
+        _Internal::connecteduserresponse(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.ChangeStatusResponse changeStatusResponse = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::changestatusresponse(this),
+        _Internal::changestatusresponse(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.BroadcastResponse broadcastResponse = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::broadcastresponse(this),
+        _Internal::broadcastresponse(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.DirectMessageResponse directMessageResponse = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::directmessageresponse(this),
+        _Internal::directmessageresponse(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.ServerMessageBatch batch = 10;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::batch(this),
+        _Internal::batch(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.PresenceUpdate presence = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::presence(this),
+        _Internal::presence(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.ChannelResponse channelResponse = 12;
+  if (cached_has_bits & 0x00000400u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::channelresponse(this),
+        _Internal::channelresponse(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.ChannelMessage channelMessage = 13;
+  if (cached_has_bits & 0x00000800u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::channelmessage(this),
+        _Internal::channelmessage(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .chat.HistoryResponse history = 14;
+  if (cached_has_bits & 0x00001000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, _Internal::history(this),
+        _Internal::history(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 requestId = 15;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(15, this->_internal_requestid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ServerMessage)
+  return target;
+}
+
+size_t ServerMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ServerMessage)
+  size_t total_size = 0;
+
+  // required int32 option = 1;
+  if (_internal_has_option()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_option());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .chat.BroadcastMessage broadcast = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.broadcast_);
+    }
+
+    // optional .chat.DirectMessage message = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_);
+    }
+
+    // optional .chat.ErrorResponse error = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.error_);
+    }
+
+    // optional .chat.MyInfoResponse myInfoResponse = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.myinforesponse_);
+    }
+
+    // optional .chat.ConnectedUserResponse connectedUserResponse = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.connecteduserresponse_);
+    }
+
+    // optional .chat.ChangeStatusResponse changeStatusResponse = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.changestatusresponse_);
+    }
+
+    // optional .chat.BroadcastResponse broadcastResponse = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.broadcastresponse_);
+    }
+
+    // optional .chat.DirectMessageResponse directMessageResponse = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.directmessageresponse_);
+    }
+
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    // optional .chat.ServerMessageBatch batch = 10;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.batch_);
+    }
+
+    // optional .chat.PresenceUpdate presence = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.presence_);
+    }
+
+    // optional .chat.ChannelResponse channelResponse = 12;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.channelresponse_);
+    }
+
+    // optional .chat.ChannelMessage channelMessage = 13;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.channelmessage_);
+    }
+
+    // optional .chat.HistoryResponse history = 14;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.history_);
+    }
+
+  }
+  // optional uint32 requestId = 15;
+  if (cached_has_bits & 0x00004000u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_requestid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerMessage::GetClassData() const { return &_class_data_; }
+
+
+void ServerMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerMessage*>(&to_msg);
+  auto& from = static_cast<const ServerMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ServerMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_broadcast()->::chat::BroadcastMessage::MergeFrom(
+          from._internal_broadcast());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_message()->::chat::DirectMessage::MergeFrom(
+          from._internal_message());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_error()->::chat::ErrorResponse::MergeFrom(
+          from._internal_error());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_myinforesponse()->::chat::MyInfoResponse::MergeFrom(
+          from._internal_myinforesponse());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_connecteduserresponse()->::chat::ConnectedUserResponse::MergeFrom(
+          from._internal_connecteduserresponse());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_changestatusresponse()->::chat::ChangeStatusResponse::MergeFrom(
+          from._internal_changestatusresponse());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_broadcastresponse()->::chat::BroadcastResponse::MergeFrom(
+          from._internal_broadcastresponse());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_directmessageresponse()->::chat::DirectMessageResponse::MergeFrom(
+          from._internal_directmessageresponse());
+    }
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_batch()->::chat::ServerMessageBatch::MergeFrom(
+          from._internal_batch());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_presence()->::chat::PresenceUpdate::MergeFrom(
+          from._internal_presence());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_internal_mutable_channelresponse()->::chat::ChannelResponse::MergeFrom(
+          from._internal_channelresponse());
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_internal_mutable_channelmessage()->::chat::ChannelMessage::MergeFrom(
+          from._internal_channelmessage());
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_internal_mutable_history()->::chat::HistoryResponse::MergeFrom(
+          from._internal_history());
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.option_ = from._impl_.option_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.requestid_ = from._impl_.requestid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerMessage::CopyFrom(const ServerMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ServerMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_broadcast()) {
+    if (!_impl_.broadcast_->IsInitialized()) return false;
+  }
+  if (_internal_has_message()) {
+    if (!_impl_.message_->IsInitialized()) return false;
+  }
+  if (_internal_has_error()) {
+    if (!_impl_.error_->IsInitialized()) return false;
+  }
+  if (_internal_has_myinforesponse()) {
+    if (!_impl_.myinforesponse_->IsInitialized()) return false;
+  }
+  if (_internal_has_connecteduserresponse()) {
+    if (!_impl_.connecteduserresponse_->IsInitialized()) return false;
+  }
+  if (_internal_has_changestatusresponse()) {
+    if (!_impl_.changestatusresponse_->IsInitialized()) return false;
+  }
+  if (_internal_has_broadcastresponse()) {
+    if (!_impl_.broadcastresponse_->IsInitialized()) return false;
+  }
+  if (_internal_has_directmessageresponse()) {
+    if (!_impl_.directmessageresponse_->IsInitialized()) return false;
+  }
+  if (_internal_has_batch()) {
+    if (!_impl_.batch_->IsInitialized()) return false;
+  }
+  if (_internal_has_presence()) {
+    if (!_impl_.presence_->IsInitialized()) return false;
+  }
+  if (_internal_has_channelresponse()) {
+    if (!_impl_.channelresponse_->IsInitialized()) return false;
+  }
+  if (_internal_has_channelmessage()) {
+    if (!_impl_.channelmessage_->IsInitialized()) return false;
+  }
+  if (_internal_has_history()) {
+    if (!_impl_.history_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ServerMessage::InternalSwap(ServerMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerMessage, _impl_.requestid_)
+      + sizeof(ServerMessage::_impl_.requestid_)
+      - PROTOBUF_FIELD_OFFSET(ServerMessage, _impl_.broadcast_)>(
+          reinterpret_cast<char*>(&_impl_.broadcast_),
+          reinterpret_cast<char*>(&other->_impl_.broadcast_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mensaje_2eproto_getter, &descriptor_table_mensaje_2eproto_once,
+      file_level_metadata_mensaje_2eproto[26]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace chat
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::chat::MyInfoSynchronize*
+Arena::CreateMaybeMessage< ::chat::MyInfoSynchronize >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::MyInfoSynchronize >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::MyInfoResponse*
+Arena::CreateMaybeMessage< ::chat::MyInfoResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::MyInfoResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::MyInfoAcknowledge*
+Arena::CreateMaybeMessage< ::chat::MyInfoAcknowledge >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::MyInfoAcknowledge >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::connectedUserRequest*
+Arena::CreateMaybeMessage< ::chat::connectedUserRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::connectedUserRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ConnectedUser*
+Arena::CreateMaybeMessage< ::chat::ConnectedUser >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ConnectedUser >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ConnectedUserResponse*
+Arena::CreateMaybeMessage< ::chat::ConnectedUserResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ConnectedUserResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ChangeStatusRequest*
+Arena::CreateMaybeMessage< ::chat::ChangeStatusRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ChangeStatusRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ChangeStatusResponse*
+Arena::CreateMaybeMessage< ::chat::ChangeStatusResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ChangeStatusResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::BroadcastRequest*
+Arena::CreateMaybeMessage< ::chat::BroadcastRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::BroadcastRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::BroadcastResponse*
+Arena::CreateMaybeMessage< ::chat::BroadcastResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::BroadcastResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::BroadcastMessage*
+Arena::CreateMaybeMessage< ::chat::BroadcastMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::BroadcastMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::DirectMessageRequest*
+Arena::CreateMaybeMessage< ::chat::DirectMessageRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::DirectMessageRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::DirectMessageResponse*
+Arena::CreateMaybeMessage< ::chat::DirectMessageResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::DirectMessageResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::DirectMessage*
+Arena::CreateMaybeMessage< ::chat::DirectMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::DirectMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PresenceRequest*
+Arena::CreateMaybeMessage< ::chat::PresenceRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PresenceRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PresenceDelta*
+Arena::CreateMaybeMessage< ::chat::PresenceDelta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PresenceDelta >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PresenceUpdate*
+Arena::CreateMaybeMessage< ::chat::PresenceUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PresenceUpdate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ChannelRequest*
+Arena::CreateMaybeMessage< ::chat::ChannelRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ChannelRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ChannelMessageRequest*
+Arena::CreateMaybeMessage< ::chat::ChannelMessageRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ChannelMessageRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ChannelResponse*
+Arena::CreateMaybeMessage< ::chat::ChannelResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ChannelResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ChannelMessage*
+Arena::CreateMaybeMessage< ::chat::ChannelMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ChannelMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ServerMessageBatch*
+Arena::CreateMaybeMessage< ::chat::ServerMessageBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ServerMessageBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::HistoryRequest*
+Arena::CreateMaybeMessage< ::chat::HistoryRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::HistoryRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::HistoryResponse*
+Arena::CreateMaybeMessage< ::chat::HistoryResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::HistoryResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ErrorResponse*
+Arena::CreateMaybeMessage< ::chat::ErrorResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ErrorResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ClientMessage*
+Arena::CreateMaybeMessage< ::chat::ClientMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ClientMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ServerMessage*
+Arena::CreateMaybeMessage< ::chat::ServerMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ServerMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
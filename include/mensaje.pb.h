@@ -0,0 +1,11396 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: mensaje.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_mensaje_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_mensaje_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_mensaje_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_mensaje_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_mensaje_2eproto;
+namespace chat {
+class BroadcastMessage;
+struct BroadcastMessageDefaultTypeInternal;
+extern BroadcastMessageDefaultTypeInternal _BroadcastMessage_default_instance_;
+class BroadcastRequest;
+struct BroadcastRequestDefaultTypeInternal;
+extern BroadcastRequestDefaultTypeInternal _BroadcastRequest_default_instance_;
+class BroadcastResponse;
+struct BroadcastResponseDefaultTypeInternal;
+extern BroadcastResponseDefaultTypeInternal _BroadcastResponse_default_instance_;
+class ChangeStatusRequest;
+struct ChangeStatusRequestDefaultTypeInternal;
+extern ChangeStatusRequestDefaultTypeInternal _ChangeStatusRequest_default_instance_;
+class ChangeStatusResponse;
+struct ChangeStatusResponseDefaultTypeInternal;
+extern ChangeStatusResponseDefaultTypeInternal _ChangeStatusResponse_default_instance_;
+class ChannelMessage;
+struct ChannelMessageDefaultTypeInternal;
+extern ChannelMessageDefaultTypeInternal _ChannelMessage_default_instance_;
+class ChannelMessageRequest;
+struct ChannelMessageRequestDefaultTypeInternal;
+extern ChannelMessageRequestDefaultTypeInternal _ChannelMessageRequest_default_instance_;
+class ChannelRequest;
+struct ChannelRequestDefaultTypeInternal;
+extern ChannelRequestDefaultTypeInternal _ChannelRequest_default_instance_;
+class ChannelResponse;
+struct ChannelResponseDefaultTypeInternal;
+extern ChannelResponseDefaultTypeInternal _ChannelResponse_default_instance_;
+class ClientMessage;
+struct ClientMessageDefaultTypeInternal;
+extern ClientMessageDefaultTypeInternal _ClientMessage_default_instance_;
+class ConnectedUser;
+struct ConnectedUserDefaultTypeInternal;
+extern ConnectedUserDefaultTypeInternal _ConnectedUser_default_instance_;
+class ConnectedUserResponse;
+struct ConnectedUserResponseDefaultTypeInternal;
+extern ConnectedUserResponseDefaultTypeInternal _ConnectedUserResponse_default_instance_;
+class DirectMessage;
+struct DirectMessageDefaultTypeInternal;
+extern DirectMessageDefaultTypeInternal _DirectMessage_default_instance_;
+class DirectMessageRequest;
+struct DirectMessageRequestDefaultTypeInternal;
+extern DirectMessageRequestDefaultTypeInternal _DirectMessageRequest_default_instance_;
+class DirectMessageResponse;
+struct DirectMessageResponseDefaultTypeInternal;
+extern DirectMessageResponseDefaultTypeInternal _DirectMessageResponse_default_instance_;
+class ErrorResponse;
+struct ErrorResponseDefaultTypeInternal;
+extern ErrorResponseDefaultTypeInternal _ErrorResponse_default_instance_;
+class HistoryRequest;
+struct HistoryRequestDefaultTypeInternal;
+extern HistoryRequestDefaultTypeInternal _HistoryRequest_default_instance_;
+class HistoryResponse;
+struct HistoryResponseDefaultTypeInternal;
+extern HistoryResponseDefaultTypeInternal _HistoryResponse_default_instance_;
+class MyInfoAcknowledge;
+struct MyInfoAcknowledgeDefaultTypeInternal;
+extern MyInfoAcknowledgeDefaultTypeInternal _MyInfoAcknowledge_default_instance_;
+class MyInfoResponse;
+struct MyInfoResponseDefaultTypeInternal;
+extern MyInfoResponseDefaultTypeInternal _MyInfoResponse_default_instance_;
+class MyInfoSynchronize;
+struct MyInfoSynchronizeDefaultTypeInternal;
+extern MyInfoSynchronizeDefaultTypeInternal _MyInfoSynchronize_default_instance_;
+class PresenceDelta;
+struct PresenceDeltaDefaultTypeInternal;
+extern PresenceDeltaDefaultTypeInternal _PresenceDelta_default_instance_;
+class PresenceRequest;
+struct PresenceRequestDefaultTypeInternal;
+extern PresenceRequestDefaultTypeInternal _PresenceRequest_default_instance_;
+class PresenceUpdate;
+struct PresenceUpdateDefaultTypeInternal;
+extern PresenceUpdateDefaultTypeInternal _PresenceUpdate_default_instance_;
+class ServerMessage;
+struct ServerMessageDefaultTypeInternal;
+extern ServerMessageDefaultTypeInternal _ServerMessage_default_instance_;
+class ServerMessageBatch;
+struct ServerMessageBatchDefaultTypeInternal;
+extern ServerMessageBatchDefaultTypeInternal _ServerMessageBatch_default_instance_;
+class connectedUserRequest;
+struct connectedUserRequestDefaultTypeInternal;
+extern connectedUserRequestDefaultTypeInternal _connectedUserRequest_default_instance_;
+}  // namespace chat
+PROTOBUF_NAMESPACE_OPEN
+template<> ::chat::BroadcastMessage* Arena::CreateMaybeMessage<::chat::BroadcastMessage>(Arena*);
+template<> ::chat::BroadcastRequest* Arena::CreateMaybeMessage<::chat::BroadcastRequest>(Arena*);
+template<> ::chat::BroadcastResponse* Arena::CreateMaybeMessage<::chat::BroadcastResponse>(Arena*);
+template<> ::chat::ChangeStatusRequest* Arena::CreateMaybeMessage<::chat::ChangeStatusRequest>(Arena*);
+template<> ::chat::ChangeStatusResponse* Arena::CreateMaybeMessage<::chat::ChangeStatusResponse>(Arena*);
+template<> ::chat::ChannelMessage* Arena::CreateMaybeMessage<::chat::ChannelMessage>(Arena*);
+template<> ::chat::ChannelMessageRequest* Arena::CreateMaybeMessage<::chat::ChannelMessageRequest>(Arena*);
+template<> ::chat::ChannelRequest* Arena::CreateMaybeMessage<::chat::ChannelRequest>(Arena*);
+template<> ::chat::ChannelResponse* Arena::CreateMaybeMessage<::chat::ChannelResponse>(Arena*);
+template<> ::chat::ClientMessage* Arena::CreateMaybeMessage<::chat::ClientMessage>(Arena*);
+template<> ::chat::ConnectedUser* Arena::CreateMaybeMessage<::chat::ConnectedUser>(Arena*);
+template<> ::chat::ConnectedUserResponse* Arena::CreateMaybeMessage<::chat::ConnectedUserResponse>(Arena*);
+template<> ::chat::DirectMessage* Arena::CreateMaybeMessage<::chat::DirectMessage>(Arena*);
+template<> ::chat::DirectMessageRequest* Arena::CreateMaybeMessage<::chat::DirectMessageRequest>(Arena*);
+template<> ::chat::DirectMessageResponse* Arena::CreateMaybeMessage<::chat::DirectMessageResponse>(Arena*);
+template<> ::chat::ErrorResponse* Arena::CreateMaybeMessage<::chat::ErrorResponse>(Arena*);
+template<> ::chat::HistoryRequest* Arena::CreateMaybeMessage<::chat::HistoryRequest>(Arena*);
+template<> ::chat::HistoryResponse* Arena::CreateMaybeMessage<::chat::HistoryResponse>(Arena*);
+template<> ::chat::MyInfoAcknowledge* Arena::CreateMaybeMessage<::chat::MyInfoAcknowledge>(Arena*);
+template<> ::chat::MyInfoResponse* Arena::CreateMaybeMessage<::chat::MyInfoResponse>(Arena*);
+template<> ::chat::MyInfoSynchronize* Arena::CreateMaybeMessage<::chat::MyInfoSynchronize>(Arena*);
+template<> ::chat::PresenceDelta* Arena::CreateMaybeMessage<::chat::PresenceDelta>(Arena*);
+template<> ::chat::PresenceRequest* Arena::CreateMaybeMessage<::chat::PresenceRequest>(Arena*);
+template<> ::chat::PresenceUpdate* Arena::CreateMaybeMessage<::chat::PresenceUpdate>(Arena*);
+template<> ::chat::ServerMessage* Arena::CreateMaybeMessage<::chat::ServerMessage>(Arena*);
+template<> ::chat::ServerMessageBatch* Arena::CreateMaybeMessage<::chat::ServerMessageBatch>(Arena*);
+template<> ::chat::connectedUserRequest* Arena::CreateMaybeMessage<::chat::connectedUserRequest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace chat {
+
+// ===================================================================
+
+class MyInfoSynchronize final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.MyInfoSynchronize) */ {
+ public:
+  inline MyInfoSynchronize() : MyInfoSynchronize(nullptr) {}
+  ~MyInfoSynchronize() override;
+  explicit PROTOBUF_CONSTEXPR MyInfoSynchronize(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MyInfoSynchronize(const MyInfoSynchronize& from);
+  MyInfoSynchronize(MyInfoSynchronize&& from) noexcept
+    : MyInfoSynchronize() {
+    *this = ::std::move(from);
+  }
+
+  inline MyInfoSynchronize& operator=(const MyInfoSynchronize& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MyInfoSynchronize& operator=(MyInfoSynchronize&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MyInfoSynchronize& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MyInfoSynchronize* internal_default_instance() {
+    return reinterpret_cast<const MyInfoSynchronize*>(
+               &_MyInfoSynchronize_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(MyInfoSynchronize& a, MyInfoSynchronize& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MyInfoSynchronize* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MyInfoSynchronize* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MyInfoSynchronize* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MyInfoSynchronize>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MyInfoSynchronize& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MyInfoSynchronize& from) {
+    MyInfoSynchronize::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MyInfoSynchronize* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.MyInfoSynchronize";
+  }
+  protected:
+  explicit MyInfoSynchronize(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kIpFieldNumber = 2,
+    kResumeTokenFieldNumber = 6,
+    kStatusFieldNumber = 7,
+    kLastSequenceFieldNumber = 5,
+    kBatchFieldNumber = 3,
+    kPresenceFieldNumber = 4,
+  };
+  // required string username = 1;
+  bool has_username() const;
+  private:
+  bool _internal_has_username() const;
+  public:
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // optional string ip = 2;
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // optional string resumeToken = 6;
+  bool has_resumetoken() const;
+  private:
+  bool _internal_has_resumetoken() const;
+  public:
+  void clear_resumetoken();
+  const std::string& resumetoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_resumetoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_resumetoken();
+  PROTOBUF_NODISCARD std::string* release_resumetoken();
+  void set_allocated_resumetoken(std::string* resumetoken);
+  private:
+  const std::string& _internal_resumetoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resumetoken(const std::string& value);
+  std::string* _internal_mutable_resumetoken();
+  public:
+
+  // optional string status = 7;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  const std::string& status() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status();
+  PROTOBUF_NODISCARD std::string* release_status();
+  void set_allocated_status(std::string* status);
+  private:
+  const std::string& _internal_status() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(const std::string& value);
+  std::string* _internal_mutable_status();
+  public:
+
+  // optional uint64 lastSequence = 5;
+  bool has_lastsequence() const;
+  private:
+  bool _internal_has_lastsequence() const;
+  public:
+  void clear_lastsequence();
+  uint64_t lastsequence() const;
+  void set_lastsequence(uint64_t value);
+  private:
+  uint64_t _internal_lastsequence() const;
+  void _internal_set_lastsequence(uint64_t value);
+  public:
+
+  // optional bool batch = 3;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+  public:
+  void clear_batch();
+  bool batch() const;
+  void set_batch(bool value);
+  private:
+  bool _internal_batch() const;
+  void _internal_set_batch(bool value);
+  public:
+
+  // optional bool presence = 4;
+  bool has_presence() const;
+  private:
+  bool _internal_has_presence() const;
+  public:
+  void clear_presence();
+  bool presence() const;
+  void set_presence(bool value);
+  private:
+  bool _internal_presence() const;
+  void _internal_set_presence(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.MyInfoSynchronize)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr resumetoken_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_;
+    uint64_t lastsequence_;
+    bool batch_;
+    bool presence_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MyInfoResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.MyInfoResponse) */ {
+ public:
+  inline MyInfoResponse() : MyInfoResponse(nullptr) {}
+  ~MyInfoResponse() override;
+  explicit PROTOBUF_CONSTEXPR MyInfoResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MyInfoResponse(const MyInfoResponse& from);
+  MyInfoResponse(MyInfoResponse&& from) noexcept
+    : MyInfoResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MyInfoResponse& operator=(const MyInfoResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MyInfoResponse& operator=(MyInfoResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MyInfoResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MyInfoResponse* internal_default_instance() {
+    return reinterpret_cast<const MyInfoResponse*>(
+               &_MyInfoResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(MyInfoResponse& a, MyInfoResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MyInfoResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MyInfoResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MyInfoResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MyInfoResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MyInfoResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MyInfoResponse& from) {
+    MyInfoResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MyInfoResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.MyInfoResponse";
+  }
+  protected:
+  explicit MyInfoResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResumeTokenFieldNumber = 2,
+    kSequenceFieldNumber = 3,
+    kUserIdFieldNumber = 1,
+  };
+  // optional string resumeToken = 2;
+  bool has_resumetoken() const;
+  private:
+  bool _internal_has_resumetoken() const;
+  public:
+  void clear_resumetoken();
+  const std::string& resumetoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_resumetoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_resumetoken();
+  PROTOBUF_NODISCARD std::string* release_resumetoken();
+  void set_allocated_resumetoken(std::string* resumetoken);
+  private:
+  const std::string& _internal_resumetoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resumetoken(const std::string& value);
+  std::string* _internal_mutable_resumetoken();
+  public:
+
+  // optional uint64 sequence = 3;
+  bool has_sequence() const;
+  private:
+  bool _internal_has_sequence() const;
+  public:
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // required int32 userId = 1;
+  bool has_userid() const;
+  private:
+  bool _internal_has_userid() const;
+  public:
+  void clear_userid();
+  int32_t userid() const;
+  void set_userid(int32_t value);
+  private:
+  int32_t _internal_userid() const;
+  void _internal_set_userid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.MyInfoResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr resumetoken_;
+    uint64_t sequence_;
+    int32_t userid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MyInfoAcknowledge final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.MyInfoAcknowledge) */ {
+ public:
+  inline MyInfoAcknowledge() : MyInfoAcknowledge(nullptr) {}
+  ~MyInfoAcknowledge() override;
+  explicit PROTOBUF_CONSTEXPR MyInfoAcknowledge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MyInfoAcknowledge(const MyInfoAcknowledge& from);
+  MyInfoAcknowledge(MyInfoAcknowledge&& from) noexcept
+    : MyInfoAcknowledge() {
+    *this = ::std::move(from);
+  }
+
+  inline MyInfoAcknowledge& operator=(const MyInfoAcknowledge& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MyInfoAcknowledge& operator=(MyInfoAcknowledge&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MyInfoAcknowledge& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MyInfoAcknowledge* internal_default_instance() {
+    return reinterpret_cast<const MyInfoAcknowledge*>(
+               &_MyInfoAcknowledge_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(MyInfoAcknowledge& a, MyInfoAcknowledge& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MyInfoAcknowledge* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MyInfoAcknowledge* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MyInfoAcknowledge* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MyInfoAcknowledge>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MyInfoAcknowledge& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MyInfoAcknowledge& from) {
+    MyInfoAcknowledge::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MyInfoAcknowledge* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.MyInfoAcknowledge";
+  }
+  protected:
+  explicit MyInfoAcknowledge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUserIdFieldNumber = 1,
+  };
+  // required int32 userId = 1;
+  bool has_userid() const;
+  private:
+  bool _internal_has_userid() const;
+  public:
+  void clear_userid();
+  int32_t userid() const;
+  void set_userid(int32_t value);
+  private:
+  int32_t _internal_userid() const;
+  void _internal_set_userid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.MyInfoAcknowledge)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t userid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class connectedUserRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.connectedUserRequest) */ {
+ public:
+  inline connectedUserRequest() : connectedUserRequest(nullptr) {}
+  ~connectedUserRequest() override;
+  explicit PROTOBUF_CONSTEXPR connectedUserRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  connectedUserRequest(const connectedUserRequest& from);
+  connectedUserRequest(connectedUserRequest&& from) noexcept
+    : connectedUserRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline connectedUserRequest& operator=(const connectedUserRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline connectedUserRequest& operator=(connectedUserRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const connectedUserRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const connectedUserRequest* internal_default_instance() {
+    return reinterpret_cast<const connectedUserRequest*>(
+               &_connectedUserRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(connectedUserRequest& a, connectedUserRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(connectedUserRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(connectedUserRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  connectedUserRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<connectedUserRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const connectedUserRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const connectedUserRequest& from) {
+    connectedUserRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(connectedUserRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.connectedUserRequest";
+  }
+  protected:
+  explicit connectedUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 2,
+    kPrefixFieldNumber = 3,
+    kCursorFieldNumber = 4,
+    kUserIdFieldNumber = 1,
+    kLimitFieldNumber = 5,
+  };
+  // optional string username = 2;
+  bool has_username() const;
+  private:
+  bool _internal_has_username() const;
+  public:
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // optional string prefix = 3;
+  bool has_prefix() const;
+  private:
+  bool _internal_has_prefix() const;
+  public:
+  void clear_prefix();
+  const std::string& prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
+  private:
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
+  public:
+
+  // optional string cursor = 4;
+  bool has_cursor() const;
+  private:
+  bool _internal_has_cursor() const;
+  public:
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
+  // optional int32 userId = 1;
+  bool has_userid() const;
+  private:
+  bool _internal_has_userid() const;
+  public:
+  void clear_userid();
+  int32_t userid() const;
+  void set_userid(int32_t value);
+  private:
+  int32_t _internal_userid() const;
+  void _internal_set_userid(int32_t value);
+  public:
+
+  // optional int32 limit = 5;
+  bool has_limit() const;
+  private:
+  bool _internal_has_limit() const;
+  public:
+  void clear_limit();
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.connectedUserRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
+    int32_t userid_;
+    int32_t limit_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ConnectedUser final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ConnectedUser) */ {
+ public:
+  inline ConnectedUser() : ConnectedUser(nullptr) {}
+  ~ConnectedUser() override;
+  explicit PROTOBUF_CONSTEXPR ConnectedUser(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConnectedUser(const ConnectedUser& from);
+  ConnectedUser(ConnectedUser&& from) noexcept
+    : ConnectedUser() {
+    *this = ::std::move(from);
+  }
+
+  inline ConnectedUser& operator=(const ConnectedUser& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConnectedUser& operator=(ConnectedUser&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConnectedUser& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConnectedUser* internal_default_instance() {
+    return reinterpret_cast<const ConnectedUser*>(
+               &_ConnectedUser_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ConnectedUser& a, ConnectedUser& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConnectedUser* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConnectedUser* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConnectedUser* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConnectedUser>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConnectedUser& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConnectedUser& from) {
+    ConnectedUser::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConnectedUser* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ConnectedUser";
+  }
+  protected:
+  explicit ConnectedUser(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kStatusFieldNumber = 2,
+    kIpFieldNumber = 4,
+    kUserIdFieldNumber = 3,
+  };
+  // required string username = 1;
+  bool has_username() const;
+  private:
+  bool _internal_has_username() const;
+  public:
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // optional string status = 2;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  const std::string& status() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status();
+  PROTOBUF_NODISCARD std::string* release_status();
+  void set_allocated_status(std::string* status);
+  private:
+  const std::string& _internal_status() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(const std::string& value);
+  std::string* _internal_mutable_status();
+  public:
+
+  // optional string ip = 4;
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // optional int32 userId = 3;
+  bool has_userid() const;
+  private:
+  bool _internal_has_userid() const;
+  public:
+  void clear_userid();
+  int32_t userid() const;
+  void set_userid(int32_t value);
+  private:
+  int32_t _internal_userid() const;
+  void _internal_set_userid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ConnectedUser)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int32_t userid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ConnectedUserResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ConnectedUserResponse) */ {
+ public:
+  inline ConnectedUserResponse() : ConnectedUserResponse(nullptr) {}
+  ~ConnectedUserResponse() override;
+  explicit PROTOBUF_CONSTEXPR ConnectedUserResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConnectedUserResponse(const ConnectedUserResponse& from);
+  ConnectedUserResponse(ConnectedUserResponse&& from) noexcept
+    : ConnectedUserResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ConnectedUserResponse& operator=(const ConnectedUserResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConnectedUserResponse& operator=(ConnectedUserResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConnectedUserResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConnectedUserResponse* internal_default_instance() {
+    return reinterpret_cast<const ConnectedUserResponse*>(
+               &_ConnectedUserResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ConnectedUserResponse& a, ConnectedUserResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConnectedUserResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConnectedUserResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConnectedUserResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConnectedUserResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConnectedUserResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConnectedUserResponse& from) {
+    ConnectedUserResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConnectedUserResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ConnectedUserResponse";
+  }
+  protected:
+  explicit ConnectedUserResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConnectedUsersFieldNumber = 1,
+    kNextCursorFieldNumber = 2,
+  };
+  // repeated .chat.ConnectedUser connectedUsers = 1;
+  int connectedusers_size() const;
+  private:
+  int _internal_connectedusers_size() const;
+  public:
+  void clear_connectedusers();
+  ::chat::ConnectedUser* mutable_connectedusers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ConnectedUser >*
+      mutable_connectedusers();
+  private:
+  const ::chat::ConnectedUser& _internal_connectedusers(int index) const;
+  ::chat::ConnectedUser* _internal_add_connectedusers();
+  public:
+  const ::chat::ConnectedUser& connectedusers(int index) const;
+  ::chat::ConnectedUser* add_connectedusers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ConnectedUser >&
+      connectedusers() const;
+
+  // optional string nextCursor = 2;
+  bool has_nextcursor() const;
+  private:
+  bool _internal_has_nextcursor() const;
+  public:
+  void clear_nextcursor();
+  const std::string& nextcursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nextcursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nextcursor();
+  PROTOBUF_NODISCARD std::string* release_nextcursor();
+  void set_allocated_nextcursor(std::string* nextcursor);
+  private:
+  const std::string& _internal_nextcursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nextcursor(const std::string& value);
+  std::string* _internal_mutable_nextcursor();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ConnectedUserResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ConnectedUser > connectedusers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nextcursor_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangeStatusRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ChangeStatusRequest) */ {
+ public:
+  inline ChangeStatusRequest() : ChangeStatusRequest(nullptr) {}
+  ~ChangeStatusRequest() override;
+  explicit PROTOBUF_CONSTEXPR ChangeStatusRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangeStatusRequest(const ChangeStatusRequest& from);
+  ChangeStatusRequest(ChangeStatusRequest&& from) noexcept
+    : ChangeStatusRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangeStatusRequest& operator=(const ChangeStatusRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangeStatusRequest& operator=(ChangeStatusRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangeStatusRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangeStatusRequest* internal_default_instance() {
+    return reinterpret_cast<const ChangeStatusRequest*>(
+               &_ChangeStatusRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ChangeStatusRequest& a, ChangeStatusRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangeStatusRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangeStatusRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangeStatusRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangeStatusRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangeStatusRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangeStatusRequest& from) {
+    ChangeStatusRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangeStatusRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ChangeStatusRequest";
+  }
+  protected:
+  explicit ChangeStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatusFieldNumber = 1,
+  };
+  // required string status = 1;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  const std::string& status() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status();
+  PROTOBUF_NODISCARD std::string* release_status();
+  void set_allocated_status(std::string* status);
+  private:
+  const std::string& _internal_status() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(const std::string& value);
+  std::string* _internal_mutable_status();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ChangeStatusRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangeStatusResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ChangeStatusResponse) */ {
+ public:
+  inline ChangeStatusResponse() : ChangeStatusResponse(nullptr) {}
+  ~ChangeStatusResponse() override;
+  explicit PROTOBUF_CONSTEXPR ChangeStatusResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangeStatusResponse(const ChangeStatusResponse& from);
+  ChangeStatusResponse(ChangeStatusResponse&& from) noexcept
+    : ChangeStatusResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangeStatusResponse& operator=(const ChangeStatusResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangeStatusResponse& operator=(ChangeStatusResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangeStatusResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangeStatusResponse* internal_default_instance() {
+    return reinterpret_cast<const ChangeStatusResponse*>(
+               &_ChangeStatusResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(ChangeStatusResponse& a, ChangeStatusResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangeStatusResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangeStatusResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangeStatusResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangeStatusResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangeStatusResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangeStatusResponse& from) {
+    ChangeStatusResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangeStatusResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ChangeStatusResponse";
+  }
+  protected:
+  explicit ChangeStatusResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatusFieldNumber = 2,
+    kUserIdFieldNumber = 1,
+  };
+  // required string status = 2;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  const std::string& status() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status();
+  PROTOBUF_NODISCARD std::string* release_status();
+  void set_allocated_status(std::string* status);
+  private:
+  const std::string& _internal_status() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(const std::string& value);
+  std::string* _internal_mutable_status();
+  public:
+
+  // required int32 userId = 1;
+  bool has_userid() const;
+  private:
+  bool _internal_has_userid() const;
+  public:
+  void clear_userid();
+  int32_t userid() const;
+  void set_userid(int32_t value);
+  private:
+  int32_t _internal_userid() const;
+  void _internal_set_userid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ChangeStatusResponse)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_;
+    int32_t userid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BroadcastRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.BroadcastRequest) */ {
+ public:
+  inline BroadcastRequest() : BroadcastRequest(nullptr) {}
+  ~BroadcastRequest() override;
+  explicit PROTOBUF_CONSTEXPR BroadcastRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BroadcastRequest(const BroadcastRequest& from);
+  BroadcastRequest(BroadcastRequest&& from) noexcept
+    : BroadcastRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BroadcastRequest& operator=(const BroadcastRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BroadcastRequest& operator=(BroadcastRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BroadcastRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BroadcastRequest* internal_default_instance() {
+    return reinterpret_cast<const BroadcastRequest*>(
+               &_BroadcastRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(BroadcastRequest& a, BroadcastRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BroadcastRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BroadcastRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BroadcastRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BroadcastRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BroadcastRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BroadcastRequest& from) {
+    BroadcastRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BroadcastRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.BroadcastRequest";
+  }
+  protected:
+  explicit BroadcastRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+  };
+  // required string message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.BroadcastRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BroadcastResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.BroadcastResponse) */ {
+ public:
+  inline BroadcastResponse() : BroadcastResponse(nullptr) {}
+  ~BroadcastResponse() override;
+  explicit PROTOBUF_CONSTEXPR BroadcastResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BroadcastResponse(const BroadcastResponse& from);
+  BroadcastResponse(BroadcastResponse&& from) noexcept
+    : BroadcastResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline BroadcastResponse& operator=(const BroadcastResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BroadcastResponse& operator=(BroadcastResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BroadcastResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BroadcastResponse* internal_default_instance() {
+    return reinterpret_cast<const BroadcastResponse*>(
+               &_BroadcastResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(BroadcastResponse& a, BroadcastResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BroadcastResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BroadcastResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BroadcastResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BroadcastResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BroadcastResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BroadcastResponse& from) {
+    BroadcastResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BroadcastResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.BroadcastResponse";
+  }
+  protected:
+  explicit BroadcastResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageStatusFieldNumber = 1,
+  };
+  // required string messageStatus = 1;
+  bool has_messagestatus() const;
+  private:
+  bool _internal_has_messagestatus() const;
+  public:
+  void clear_messagestatus();
+  const std::string& messagestatus() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_messagestatus(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_messagestatus();
+  PROTOBUF_NODISCARD std::string* release_messagestatus();
+  void set_allocated_messagestatus(std::string* messagestatus);
+  private:
+  const std::string& _internal_messagestatus() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_messagestatus(const std::string& value);
+  std::string* _internal_mutable_messagestatus();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.BroadcastResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr messagestatus_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BroadcastMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.BroadcastMessage) */ {
+ public:
+  inline BroadcastMessage() : BroadcastMessage(nullptr) {}
+  ~BroadcastMessage() override;
+  explicit PROTOBUF_CONSTEXPR BroadcastMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BroadcastMessage(const BroadcastMessage& from);
+  BroadcastMessage(BroadcastMessage&& from) noexcept
+    : BroadcastMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline BroadcastMessage& operator=(const BroadcastMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BroadcastMessage& operator=(BroadcastMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BroadcastMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BroadcastMessage* internal_default_instance() {
+    return reinterpret_cast<const BroadcastMessage*>(
+               &_BroadcastMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(BroadcastMessage& a, BroadcastMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BroadcastMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BroadcastMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BroadcastMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BroadcastMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BroadcastMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BroadcastMessage& from) {
+    BroadcastMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BroadcastMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.BroadcastMessage";
+  }
+  protected:
+  explicit BroadcastMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+    kUsernameFieldNumber = 3,
+    kSequenceFieldNumber = 4,
+    kUserIdFieldNumber = 2,
+  };
+  // required string message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // optional string username = 3;
+  bool has_username() const;
+  private:
+  bool _internal_has_username() const;
+  public:
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // optional uint64 sequence = 4;
+  bool has_sequence() const;
+  private:
+  bool _internal_has_sequence() const;
+  public:
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // required int32 userId = 2;
+  bool has_userid() const;
+  private:
+  bool _internal_has_userid() const;
+  public:
+  void clear_userid();
+  int32_t userid() const;
+  void set_userid(int32_t value);
+  private:
+  int32_t _internal_userid() const;
+  void _internal_set_userid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.BroadcastMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint64_t sequence_;
+    int32_t userid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DirectMessageRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.DirectMessageRequest) */ {
+ public:
+  inline DirectMessageRequest() : DirectMessageRequest(nullptr) {}
+  ~DirectMessageRequest() override;
+  explicit PROTOBUF_CONSTEXPR DirectMessageRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DirectMessageRequest(const DirectMessageRequest& from);
+  DirectMessageRequest(DirectMessageRequest&& from) noexcept
+    : DirectMessageRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DirectMessageRequest& operator=(const DirectMessageRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DirectMessageRequest& operator=(DirectMessageRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DirectMessageRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DirectMessageRequest* internal_default_instance() {
+    return reinterpret_cast<const DirectMessageRequest*>(
+               &_DirectMessageRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(DirectMessageRequest& a, DirectMessageRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DirectMessageRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DirectMessageRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DirectMessageRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DirectMessageRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DirectMessageRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DirectMessageRequest& from) {
+    DirectMessageRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DirectMessageRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.DirectMessageRequest";
+  }
+  protected:
+  explicit DirectMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+    kUsernameFieldNumber = 3,
+    kUserIdFieldNumber = 2,
+  };
+  // required string message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // optional string username = 3;
+  bool has_username() const;
+  private:
+  bool _internal_has_username() const;
+  public:
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // optional int32 userId = 2;
+  bool has_userid() const;
+  private:
+  bool _internal_has_userid() const;
+  public:
+  void clear_userid();
+  int32_t userid() const;
+  void set_userid(int32_t value);
+  private:
+  int32_t _internal_userid() const;
+  void _internal_set_userid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.DirectMessageRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int32_t userid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DirectMessageResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.DirectMessageResponse) */ {
+ public:
+  inline DirectMessageResponse() : DirectMessageResponse(nullptr) {}
+  ~DirectMessageResponse() override;
+  explicit PROTOBUF_CONSTEXPR DirectMessageResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DirectMessageResponse(const DirectMessageResponse& from);
+  DirectMessageResponse(DirectMessageResponse&& from) noexcept
+    : DirectMessageResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline DirectMessageResponse& operator=(const DirectMessageResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DirectMessageResponse& operator=(DirectMessageResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DirectMessageResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DirectMessageResponse* internal_default_instance() {
+    return reinterpret_cast<const DirectMessageResponse*>(
+               &_DirectMessageResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(DirectMessageResponse& a, DirectMessageResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DirectMessageResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DirectMessageResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DirectMessageResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DirectMessageResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DirectMessageResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DirectMessageResponse& from) {
+    DirectMessageResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DirectMessageResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.DirectMessageResponse";
+  }
+  protected:
+  explicit DirectMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageStatusFieldNumber = 1,
+  };
+  // required string messageStatus = 1;
+  bool has_messagestatus() const;
+  private:
+  bool _internal_has_messagestatus() const;
+  public:
+  void clear_messagestatus();
+  const std::string& messagestatus() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_messagestatus(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_messagestatus();
+  PROTOBUF_NODISCARD std::string* release_messagestatus();
+  void set_allocated_messagestatus(std::string* messagestatus);
+  private:
+  const std::string& _internal_messagestatus() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_messagestatus(const std::string& value);
+  std::string* _internal_mutable_messagestatus();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.DirectMessageResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr messagestatus_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DirectMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.DirectMessage) */ {
+ public:
+  inline DirectMessage() : DirectMessage(nullptr) {}
+  ~DirectMessage() override;
+  explicit PROTOBUF_CONSTEXPR DirectMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DirectMessage(const DirectMessage& from);
+  DirectMessage(DirectMessage&& from) noexcept
+    : DirectMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline DirectMessage& operator=(const DirectMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DirectMessage& operator=(DirectMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DirectMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DirectMessage* internal_default_instance() {
+    return reinterpret_cast<const DirectMessage*>(
+               &_DirectMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(DirectMessage& a, DirectMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DirectMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DirectMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DirectMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DirectMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DirectMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DirectMessage& from) {
+    DirectMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DirectMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.DirectMessage";
+  }
+  protected:
+  explicit DirectMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+    kUsernameFieldNumber = 3,
+    kSequenceFieldNumber = 4,
+    kUserIdFieldNumber = 2,
+  };
+  // required string message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // optional string username = 3;
+  bool has_username() const;
+  private:
+  bool _internal_has_username() const;
+  public:
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // optional uint64 sequence = 4;
+  bool has_sequence() const;
+  private:
+  bool _internal_has_sequence() const;
+  public:
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // required int32 userId = 2;
+  bool has_userid() const;
+  private:
+  bool _internal_has_userid() const;
+  public:
+  void clear_userid();
+  int32_t userid() const;
+  void set_userid(int32_t value);
+  private:
+  int32_t _internal_userid() const;
+  void _internal_set_userid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.DirectMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint64_t sequence_;
+    int32_t userid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceRequest) */ {
+ public:
+  inline PresenceRequest() : PresenceRequest(nullptr) {}
+  ~PresenceRequest() override;
+  explicit PROTOBUF_CONSTEXPR PresenceRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceRequest(const PresenceRequest& from);
+  PresenceRequest(PresenceRequest&& from) noexcept
+    : PresenceRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceRequest& operator=(const PresenceRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceRequest& operator=(PresenceRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceRequest* internal_default_instance() {
+    return reinterpret_cast<const PresenceRequest*>(
+               &_PresenceRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(PresenceRequest& a, PresenceRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceRequest& from) {
+    PresenceRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceRequest";
+  }
+  protected:
+  explicit PresenceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+  };
+  // optional uint64 version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceDelta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceDelta) */ {
+ public:
+  inline PresenceDelta() : PresenceDelta(nullptr) {}
+  ~PresenceDelta() override;
+  explicit PROTOBUF_CONSTEXPR PresenceDelta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceDelta(const PresenceDelta& from);
+  PresenceDelta(PresenceDelta&& from) noexcept
+    : PresenceDelta() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceDelta& operator=(const PresenceDelta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceDelta& operator=(PresenceDelta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceDelta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceDelta* internal_default_instance() {
+    return reinterpret_cast<const PresenceDelta*>(
+               &_PresenceDelta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(PresenceDelta& a, PresenceDelta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceDelta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceDelta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceDelta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceDelta>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceDelta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceDelta& from) {
+    PresenceDelta::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceDelta* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceDelta";
+  }
+  protected:
+  explicit PresenceDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUserFieldNumber = 2,
+    kKindFieldNumber = 1,
+  };
+  // required .chat.ConnectedUser user = 2;
+  bool has_user() const;
+  private:
+  bool _internal_has_user() const;
+  public:
+  void clear_user();
+  const ::chat::ConnectedUser& user() const;
+  PROTOBUF_NODISCARD ::chat::ConnectedUser* release_user();
+  ::chat::ConnectedUser* mutable_user();
+  void set_allocated_user(::chat::ConnectedUser* user);
+  private:
+  const ::chat::ConnectedUser& _internal_user() const;
+  ::chat::ConnectedUser* _internal_mutable_user();
+  public:
+  void unsafe_arena_set_allocated_user(
+      ::chat::ConnectedUser* user);
+  ::chat::ConnectedUser* unsafe_arena_release_user();
+
+  // required int32 kind = 1;
+  bool has_kind() const;
+  private:
+  bool _internal_has_kind() const;
+  public:
+  void clear_kind();
+  int32_t kind() const;
+  void set_kind(int32_t value);
+  private:
+  int32_t _internal_kind() const;
+  void _internal_set_kind(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceDelta)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::chat::ConnectedUser* user_;
+    int32_t kind_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceUpdate) */ {
+ public:
+  inline PresenceUpdate() : PresenceUpdate(nullptr) {}
+  ~PresenceUpdate() override;
+  explicit PROTOBUF_CONSTEXPR PresenceUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceUpdate(const PresenceUpdate& from);
+  PresenceUpdate(PresenceUpdate&& from) noexcept
+    : PresenceUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceUpdate& operator=(const PresenceUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceUpdate& operator=(PresenceUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceUpdate* internal_default_instance() {
+    return reinterpret_cast<const PresenceUpdate*>(
+               &_PresenceUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(PresenceUpdate& a, PresenceUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceUpdate& from) {
+    PresenceUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceUpdate";
+  }
+  protected:
+  explicit PresenceUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDeltasFieldNumber = 4,
+    kSnapshotFieldNumber = 3,
+    kVersionFieldNumber = 1,
+    kBaseVersionFieldNumber = 2,
+  };
+  // repeated .chat.PresenceDelta deltas = 4;
+  int deltas_size() const;
+  private:
+  int _internal_deltas_size() const;
+  public:
+  void clear_deltas();
+  ::chat::PresenceDelta* mutable_deltas(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDelta >*
+      mutable_deltas();
+  private:
+  const ::chat::PresenceDelta& _internal_deltas(int index) const;
+  ::chat::PresenceDelta* _internal_add_deltas();
+  public:
+  const ::chat::PresenceDelta& deltas(int index) const;
+  ::chat::PresenceDelta* add_deltas();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDelta >&
+      deltas() const;
+
+  // optional .chat.ConnectedUserResponse snapshot = 3;
+  bool has_snapshot() const;
+  private:
+  bool _internal_has_snapshot() const;
+  public:
+  void clear_snapshot();
+  const ::chat::ConnectedUserResponse& snapshot() const;
+  PROTOBUF_NODISCARD ::chat::ConnectedUserResponse* release_snapshot();
+  ::chat::ConnectedUserResponse* mutable_snapshot();
+  void set_allocated_snapshot(::chat::ConnectedUserResponse* snapshot);
+  private:
+  const ::chat::ConnectedUserResponse& _internal_snapshot() const;
+  ::chat::ConnectedUserResponse* _internal_mutable_snapshot();
+  public:
+  void unsafe_arena_set_allocated_snapshot(
+      ::chat::ConnectedUserResponse* snapshot);
+  ::chat::ConnectedUserResponse* unsafe_arena_release_snapshot();
+
+  // required uint64 version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // optional uint64 baseVersion = 2;
+  bool has_baseversion() const;
+  private:
+  bool _internal_has_baseversion() const;
+  public:
+  void clear_baseversion();
+  uint64_t baseversion() const;
+  void set_baseversion(uint64_t value);
+  private:
+  uint64_t _internal_baseversion() const;
+  void _internal_set_baseversion(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDelta > deltas_;
+    ::chat::ConnectedUserResponse* snapshot_;
+    uint64_t version_;
+    uint64_t baseversion_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChannelRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ChannelRequest) */ {
+ public:
+  inline ChannelRequest() : ChannelRequest(nullptr) {}
+  ~ChannelRequest() override;
+  explicit PROTOBUF_CONSTEXPR ChannelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChannelRequest(const ChannelRequest& from);
+  ChannelRequest(ChannelRequest&& from) noexcept
+    : ChannelRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ChannelRequest& operator=(const ChannelRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChannelRequest& operator=(ChannelRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChannelRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChannelRequest* internal_default_instance() {
+    return reinterpret_cast<const ChannelRequest*>(
+               &_ChannelRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(ChannelRequest& a, ChannelRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChannelRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChannelRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChannelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChannelRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChannelRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChannelRequest& from) {
+    ChannelRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChannelRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ChannelRequest";
+  }
+  protected:
+  explicit ChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelFieldNumber = 1,
+  };
+  // required string channel = 1;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ChannelRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChannelMessageRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ChannelMessageRequest) */ {
+ public:
+  inline ChannelMessageRequest() : ChannelMessageRequest(nullptr) {}
+  ~ChannelMessageRequest() override;
+  explicit PROTOBUF_CONSTEXPR ChannelMessageRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChannelMessageRequest(const ChannelMessageRequest& from);
+  ChannelMessageRequest(ChannelMessageRequest&& from) noexcept
+    : ChannelMessageRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ChannelMessageRequest& operator=(const ChannelMessageRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChannelMessageRequest& operator=(ChannelMessageRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChannelMessageRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChannelMessageRequest* internal_default_instance() {
+    return reinterpret_cast<const ChannelMessageRequest*>(
+               &_ChannelMessageRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(ChannelMessageRequest& a, ChannelMessageRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChannelMessageRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChannelMessageRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChannelMessageRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChannelMessageRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChannelMessageRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChannelMessageRequest& from) {
+    ChannelMessageRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChannelMessageRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ChannelMessageRequest";
+  }
+  protected:
+  explicit ChannelMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelFieldNumber = 1,
+    kMessageFieldNumber = 2,
+  };
+  // required string channel = 1;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // required string message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ChannelMessageRequest)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChannelResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ChannelResponse) */ {
+ public:
+  inline ChannelResponse() : ChannelResponse(nullptr) {}
+  ~ChannelResponse() override;
+  explicit PROTOBUF_CONSTEXPR ChannelResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChannelResponse(const ChannelResponse& from);
+  ChannelResponse(ChannelResponse&& from) noexcept
+    : ChannelResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ChannelResponse& operator=(const ChannelResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChannelResponse& operator=(ChannelResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChannelResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChannelResponse* internal_default_instance() {
+    return reinterpret_cast<const ChannelResponse*>(
+               &_ChannelResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(ChannelResponse& a, ChannelResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChannelResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChannelResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChannelResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChannelResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChannelResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChannelResponse& from) {
+    ChannelResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChannelResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ChannelResponse";
+  }
+  protected:
+  explicit ChannelResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelFieldNumber = 1,
+    kStatusFieldNumber = 2,
+    kMembersFieldNumber = 3,
+  };
+  // required string channel = 1;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // required string status = 2;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  const std::string& status() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status();
+  PROTOBUF_NODISCARD std::string* release_status();
+  void set_allocated_status(std::string* status);
+  private:
+  const std::string& _internal_status() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(const std::string& value);
+  std::string* _internal_mutable_status();
+  public:
+
+  // optional int32 members = 3;
+  bool has_members() const;
+  private:
+  bool _internal_has_members() const;
+  public:
+  void clear_members();
+  int32_t members() const;
+  void set_members(int32_t value);
+  private:
+  int32_t _internal_members() const;
+  void _internal_set_members(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ChannelResponse)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_;
+    int32_t members_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChannelMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ChannelMessage) */ {
+ public:
+  inline ChannelMessage() : ChannelMessage(nullptr) {}
+  ~ChannelMessage() override;
+  explicit PROTOBUF_CONSTEXPR ChannelMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChannelMessage(const ChannelMessage& from);
+  ChannelMessage(ChannelMessage&& from) noexcept
+    : ChannelMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ChannelMessage& operator=(const ChannelMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChannelMessage& operator=(ChannelMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChannelMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChannelMessage* internal_default_instance() {
+    return reinterpret_cast<const ChannelMessage*>(
+               &_ChannelMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(ChannelMessage& a, ChannelMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChannelMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChannelMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChannelMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChannelMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChannelMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChannelMessage& from) {
+    ChannelMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChannelMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ChannelMessage";
+  }
+  protected:
+  explicit ChannelMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelFieldNumber = 1,
+    kMessageFieldNumber = 2,
+    kUsernameFieldNumber = 4,
+    kUserIdFieldNumber = 3,
+  };
+  // required string channel = 1;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // required string message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // optional string username = 4;
+  bool has_username() const;
+  private:
+  bool _internal_has_username() const;
+  public:
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // required int32 userId = 3;
+  bool has_userid() const;
+  private:
+  bool _internal_has_userid() const;
+  public:
+  void clear_userid();
+  int32_t userid() const;
+  void set_userid(int32_t value);
+  private:
+  int32_t _internal_userid() const;
+  void _internal_set_userid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ChannelMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int32_t userid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerMessageBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ServerMessageBatch) */ {
+ public:
+  inline ServerMessageBatch() : ServerMessageBatch(nullptr) {}
+  ~ServerMessageBatch() override;
+  explicit PROTOBUF_CONSTEXPR ServerMessageBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerMessageBatch(const ServerMessageBatch& from);
+  ServerMessageBatch(ServerMessageBatch&& from) noexcept
+    : ServerMessageBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerMessageBatch& operator=(const ServerMessageBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerMessageBatch& operator=(ServerMessageBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerMessageBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerMessageBatch* internal_default_instance() {
+    return reinterpret_cast<const ServerMessageBatch*>(
+               &_ServerMessageBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(ServerMessageBatch& a, ServerMessageBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerMessageBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerMessageBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerMessageBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerMessageBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerMessageBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerMessageBatch& from) {
+    ServerMessageBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerMessageBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ServerMessageBatch";
+  }
+  protected:
+  explicit ServerMessageBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated .chat.ServerMessage messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::chat::ServerMessage* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ServerMessage >*
+      mutable_messages();
+  private:
+  const ::chat::ServerMessage& _internal_messages(int index) const;
+  ::chat::ServerMessage* _internal_add_messages();
+  public:
+  const ::chat::ServerMessage& messages(int index) const;
+  ::chat::ServerMessage* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ServerMessage >&
+      messages() const;
+
+  // @@protoc_insertion_point(class_scope:chat.ServerMessageBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ServerMessage > messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HistoryRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.HistoryRequest) */ {
+ public:
+  inline HistoryRequest() : HistoryRequest(nullptr) {}
+  ~HistoryRequest() override;
+  explicit PROTOBUF_CONSTEXPR HistoryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HistoryRequest(const HistoryRequest& from);
+  HistoryRequest(HistoryRequest&& from) noexcept
+    : HistoryRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline HistoryRequest& operator=(const HistoryRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HistoryRequest& operator=(HistoryRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HistoryRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HistoryRequest* internal_default_instance() {
+    return reinterpret_cast<const HistoryRequest*>(
+               &_HistoryRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(HistoryRequest& a, HistoryRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HistoryRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HistoryRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HistoryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HistoryRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HistoryRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HistoryRequest& from) {
+    HistoryRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HistoryRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.HistoryRequest";
+  }
+  protected:
+  explicit HistoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAfterFieldNumber = 1,
+    kUntilFieldNumber = 2,
+  };
+  // required uint64 after = 1;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  uint64_t after() const;
+  void set_after(uint64_t value);
+  private:
+  uint64_t _internal_after() const;
+  void _internal_set_after(uint64_t value);
+  public:
+
+  // optional uint64 until = 2;
+  bool has_until() const;
+  private:
+  bool _internal_has_until() const;
+  public:
+  void clear_until();
+  uint64_t until() const;
+  void set_until(uint64_t value);
+  private:
+  uint64_t _internal_until() const;
+  void _internal_set_until(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.HistoryRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t after_;
+    uint64_t until_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HistoryResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.HistoryResponse) */ {
+ public:
+  inline HistoryResponse() : HistoryResponse(nullptr) {}
+  ~HistoryResponse() override;
+  explicit PROTOBUF_CONSTEXPR HistoryResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HistoryResponse(const HistoryResponse& from);
+  HistoryResponse(HistoryResponse&& from) noexcept
+    : HistoryResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline HistoryResponse& operator=(const HistoryResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HistoryResponse& operator=(HistoryResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HistoryResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HistoryResponse* internal_default_instance() {
+    return reinterpret_cast<const HistoryResponse*>(
+               &_HistoryResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(HistoryResponse& a, HistoryResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HistoryResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HistoryResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HistoryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HistoryResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HistoryResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HistoryResponse& from) {
+    HistoryResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HistoryResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.HistoryResponse";
+  }
+  protected:
+  explicit HistoryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLastFieldNumber = 1,
+    kMoreFieldNumber = 2,
+    kTruncatedFieldNumber = 3,
+    kMessagesFieldNumber = 4,
+  };
+  // required uint64 last = 1;
+  bool has_last() const;
+  private:
+  bool _internal_has_last() const;
+  public:
+  void clear_last();
+  uint64_t last() const;
+  void set_last(uint64_t value);
+  private:
+  uint64_t _internal_last() const;
+  void _internal_set_last(uint64_t value);
+  public:
+
+  // optional bool more = 2;
+  bool has_more() const;
+  private:
+  bool _internal_has_more() const;
+  public:
+  void clear_more();
+  bool more() const;
+  void set_more(bool value);
+  private:
+  bool _internal_more() const;
+  void _internal_set_more(bool value);
+  public:
+
+  // optional bool truncated = 3;
+  bool has_truncated() const;
+  private:
+  bool _internal_has_truncated() const;
+  public:
+  void clear_truncated();
+  bool truncated() const;
+  void set_truncated(bool value);
+  private:
+  bool _internal_truncated() const;
+  void _internal_set_truncated(bool value);
+  public:
+
+  // optional int32 messages = 4;
+  bool has_messages() const;
+  private:
+  bool _internal_has_messages() const;
+  public:
+  void clear_messages();
+  int32_t messages() const;
+  void set_messages(int32_t value);
+  private:
+  int32_t _internal_messages() const;
+  void _internal_set_messages(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.HistoryResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t last_;
+    bool more_;
+    bool truncated_;
+    int32_t messages_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ErrorResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ErrorResponse) */ {
+ public:
+  inline ErrorResponse() : ErrorResponse(nullptr) {}
+  ~ErrorResponse() override;
+  explicit PROTOBUF_CONSTEXPR ErrorResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ErrorResponse(const ErrorResponse& from);
+  ErrorResponse(ErrorResponse&& from) noexcept
+    : ErrorResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ErrorResponse& operator=(const ErrorResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ErrorResponse& operator=(ErrorResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ErrorResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ErrorResponse* internal_default_instance() {
+    return reinterpret_cast<const ErrorResponse*>(
+               &_ErrorResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(ErrorResponse& a, ErrorResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ErrorResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ErrorResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ErrorResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ErrorResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ErrorResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ErrorResponse& from) {
+    ErrorResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ErrorResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ErrorResponse";
+  }
+  protected:
+  explicit ErrorResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorMessageFieldNumber = 1,
+  };
+  // required string errorMessage = 1;
+  bool has_errormessage() const;
+  private:
+  bool _internal_has_errormessage() const;
+  public:
+  void clear_errormessage();
+  const std::string& errormessage() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_errormessage(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_errormessage();
+  PROTOBUF_NODISCARD std::string* release_errormessage();
+  void set_allocated_errormessage(std::string* errormessage);
+  private:
+  const std::string& _internal_errormessage() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_errormessage(const std::string& value);
+  std::string* _internal_mutable_errormessage();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ErrorResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr errormessage_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClientMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ClientMessage) */ {
+ public:
+  inline ClientMessage() : ClientMessage(nullptr) {}
+  ~ClientMessage() override;
+  explicit PROTOBUF_CONSTEXPR ClientMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClientMessage(const ClientMessage& from);
+  ClientMessage(ClientMessage&& from) noexcept
+    : ClientMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ClientMessage& operator=(const ClientMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClientMessage& operator=(ClientMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClientMessage* internal_default_instance() {
+    return reinterpret_cast<const ClientMessage*>(
+               &_ClientMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(ClientMessage& a, ClientMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClientMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClientMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClientMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClientMessage& from) {
+    ClientMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClientMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ClientMessage";
+  }
+  protected:
+  explicit ClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSynchronizeFieldNumber = 3,
+    kConnectedUsersFieldNumber = 4,
+    kChangeStatusFieldNumber = 5,
+    kBroadcastFieldNumber = 6,
+    kDirectMessageFieldNumber = 7,
+    kAcknowledgeFieldNumber = 8,
+    kPresenceFieldNumber = 9,
+    kChannelFieldNumber = 10,
+    kChannelMessageFieldNumber = 11,
+    kHistoryFieldNumber = 12,
+    kOptionFieldNumber = 1,
+    kUserIdFieldNumber = 2,
+    kRequestIdFieldNumber = 13,
+  };
+  // optional .chat.MyInfoSynchronize synchronize = 3;
+  bool has_synchronize() const;
+  private:
+  bool _internal_has_synchronize() const;
+  public:
+  void clear_synchronize();
+  const ::chat::MyInfoSynchronize& synchronize() const;
+  PROTOBUF_NODISCARD ::chat::MyInfoSynchronize* release_synchronize();
+  ::chat::MyInfoSynchronize* mutable_synchronize();
+  void set_allocated_synchronize(::chat::MyInfoSynchronize* synchronize);
+  private:
+  const ::chat::MyInfoSynchronize& _internal_synchronize() const;
+  ::chat::MyInfoSynchronize* _internal_mutable_synchronize();
+  public:
+  void unsafe_arena_set_allocated_synchronize(
+      ::chat::MyInfoSynchronize* synchronize);
+  ::chat::MyInfoSynchronize* unsafe_arena_release_synchronize();
+
+  // optional .chat.connectedUserRequest connectedUsers = 4;
+  bool has_connectedusers() const;
+  private:
+  bool _internal_has_connectedusers() const;
+  public:
+  void clear_connectedusers();
+  const ::chat::connectedUserRequest& connectedusers() const;
+  PROTOBUF_NODISCARD ::chat::connectedUserRequest* release_connectedusers();
+  ::chat::connectedUserRequest* mutable_connectedusers();
+  void set_allocated_connectedusers(::chat::connectedUserRequest* connectedusers);
+  private:
+  const ::chat::connectedUserRequest& _internal_connectedusers() const;
+  ::chat::connectedUserRequest* _internal_mutable_connectedusers();
+  public:
+  void unsafe_arena_set_allocated_connectedusers(
+      ::chat::connectedUserRequest* connectedusers);
+  ::chat::connectedUserRequest* unsafe_arena_release_connectedusers();
+
+  // optional .chat.ChangeStatusRequest changeStatus = 5;
+  bool has_changestatus() const;
+  private:
+  bool _internal_has_changestatus() const;
+  public:
+  void clear_changestatus();
+  const ::chat::ChangeStatusRequest& changestatus() const;
+  PROTOBUF_NODISCARD ::chat::ChangeStatusRequest* release_changestatus();
+  ::chat::ChangeStatusRequest* mutable_changestatus();
+  void set_allocated_changestatus(::chat::ChangeStatusRequest* changestatus);
+  private:
+  const ::chat::ChangeStatusRequest& _internal_changestatus() const;
+  ::chat::ChangeStatusRequest* _internal_mutable_changestatus();
+  public:
+  void unsafe_arena_set_allocated_changestatus(
+      ::chat::ChangeStatusRequest* changestatus);
+  ::chat::ChangeStatusRequest* unsafe_arena_release_changestatus();
+
+  // optional .chat.BroadcastRequest broadcast = 6;
+  bool has_broadcast() const;
+  private:
+  bool _internal_has_broadcast() const;
+  public:
+  void clear_broadcast();
+  const ::chat::BroadcastRequest& broadcast() const;
+  PROTOBUF_NODISCARD ::chat::BroadcastRequest* release_broadcast();
+  ::chat::BroadcastRequest* mutable_broadcast();
+  void set_allocated_broadcast(::chat::BroadcastRequest* broadcast);
+  private:
+  const ::chat::BroadcastRequest& _internal_broadcast() const;
+  ::chat::BroadcastRequest* _internal_mutable_broadcast();
+  public:
+  void unsafe_arena_set_allocated_broadcast(
+      ::chat::BroadcastRequest* broadcast);
+  ::chat::BroadcastRequest* unsafe_arena_release_broadcast();
+
+  // optional .chat.DirectMessageRequest directMessage = 7;
+  bool has_directmessage() const;
+  private:
+  bool _internal_has_directmessage() const;
+  public:
+  void clear_directmessage();
+  const ::chat::DirectMessageRequest& directmessage() const;
+  PROTOBUF_NODISCARD ::chat::DirectMessageRequest* release_directmessage();
+  ::chat::DirectMessageRequest* mutable_directmessage();
+  void set_allocated_directmessage(::chat::DirectMessageRequest* directmessage);
+  private:
+  const ::chat::DirectMessageRequest& _internal_directmessage() const;
+  ::chat::DirectMessageRequest* _internal_mutable_directmessage();
+  public:
+  void unsafe_arena_set_allocated_directmessage(
+      ::chat::DirectMessageRequest* directmessage);
+  ::chat::DirectMessageRequest* unsafe_arena_release_directmessage();
+
+  // optional .chat.MyInfoAcknowledge acknowledge = 8;
+  bool has_acknowledge() const;
+  private:
+  bool _internal_has_acknowledge() const;
+  public:
+  void clear_acknowledge();
+  const ::chat::MyInfoAcknowledge& acknowledge() const;
+  PROTOBUF_NODISCARD ::chat::MyInfoAcknowledge* release_acknowledge();
+  ::chat::MyInfoAcknowledge* mutable_acknowledge();
+  void set_allocated_acknowledge(::chat::MyInfoAcknowledge* acknowledge);
+  private:
+  const ::chat::MyInfoAcknowledge& _internal_acknowledge() const;
+  ::chat::MyInfoAcknowledge* _internal_mutable_acknowledge();
+  public:
+  void unsafe_arena_set_allocated_acknowledge(
+      ::chat::MyInfoAcknowledge* acknowledge);
+  ::chat::MyInfoAcknowledge* unsafe_arena_release_acknowledge();
+
+  // optional .chat.PresenceRequest presence = 9;
+  bool has_presence() const;
+  private:
+  bool _internal_has_presence() const;
+  public:
+  void clear_presence();
+  const ::chat::PresenceRequest& presence() const;
+  PROTOBUF_NODISCARD ::chat::PresenceRequest* release_presence();
+  ::chat::PresenceRequest* mutable_presence();
+  void set_allocated_presence(::chat::PresenceRequest* presence);
+  private:
+  const ::chat::PresenceRequest& _internal_presence() const;
+  ::chat::PresenceRequest* _internal_mutable_presence();
+  public:
+  void unsafe_arena_set_allocated_presence(
+      ::chat::PresenceRequest* presence);
+  ::chat::PresenceRequest* unsafe_arena_release_presence();
+
+  // optional .chat.ChannelRequest channel = 10;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const ::chat::ChannelRequest& channel() const;
+  PROTOBUF_NODISCARD ::chat::ChannelRequest* release_channel();
+  ::chat::ChannelRequest* mutable_channel();
+  void set_allocated_channel(::chat::ChannelRequest* channel);
+  private:
+  const ::chat::ChannelRequest& _internal_channel() const;
+  ::chat::ChannelRequest* _internal_mutable_channel();
+  public:
+  void unsafe_arena_set_allocated_channel(
+      ::chat::ChannelRequest* channel);
+  ::chat::ChannelRequest* unsafe_arena_release_channel();
+
+  // optional .chat.ChannelMessageRequest channelMessage = 11;
+  bool has_channelmessage() const;
+  private:
+  bool _internal_has_channelmessage() const;
+  public:
+  void clear_channelmessage();
+  const ::chat::ChannelMessageRequest& channelmessage() const;
+  PROTOBUF_NODISCARD ::chat::ChannelMessageRequest* release_channelmessage();
+  ::chat::ChannelMessageRequest* mutable_channelmessage();
+  void set_allocated_channelmessage(::chat::ChannelMessageRequest* channelmessage);
+  private:
+  const ::chat::ChannelMessageRequest& _internal_channelmessage() const;
+  ::chat::ChannelMessageRequest* _internal_mutable_channelmessage();
+  public:
+  void unsafe_arena_set_allocated_channelmessage(
+      ::chat::ChannelMessageRequest* channelmessage);
+  ::chat::ChannelMessageRequest* unsafe_arena_release_channelmessage();
+
+  // optional .chat.HistoryRequest history = 12;
+  bool has_history() const;
+  private:
+  bool _internal_has_history() const;
+  public:
+  void clear_history();
+  const ::chat::HistoryRequest& history() const;
+  PROTOBUF_NODISCARD ::chat::HistoryRequest* release_history();
+  ::chat::HistoryRequest* mutable_history();
+  void set_allocated_history(::chat::HistoryRequest* history);
+  private:
+  const ::chat::HistoryRequest& _internal_history() const;
+  ::chat::HistoryRequest* _internal_mutable_history();
+  public:
+  void unsafe_arena_set_allocated_history(
+      ::chat::HistoryRequest* history);
+  ::chat::HistoryRequest* unsafe_arena_release_history();
+
+  // required int32 option = 1;
+  bool has_option() const;
+  private:
+  bool _internal_has_option() const;
+  public:
+  void clear_option();
+  int32_t option() const;
+  void set_option(int32_t value);
+  private:
+  int32_t _internal_option() const;
+  void _internal_set_option(int32_t value);
+  public:
+
+  // optional int32 userId = 2;
+  bool has_userid() const;
+  private:
+  bool _internal_has_userid() const;
+  public:
+  void clear_userid();
+  int32_t userid() const;
+  void set_userid(int32_t value);
+  private:
+  int32_t _internal_userid() const;
+  void _internal_set_userid(int32_t value);
+  public:
+
+  // optional uint32 requestId = 13;
+  bool has_requestid() const;
+  private:
+  bool _internal_has_requestid() const;
+  public:
+  void clear_requestid();
+  uint32_t requestid() const;
+  void set_requestid(uint32_t value);
+  private:
+  uint32_t _internal_requestid() const;
+  void _internal_set_requestid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ClientMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::chat::MyInfoSynchronize* synchronize_;
+    ::chat::connectedUserRequest* connectedusers_;
+    ::chat::ChangeStatusRequest* changestatus_;
+    ::chat::BroadcastRequest* broadcast_;
+    ::chat::DirectMessageRequest* directmessage_;
+    ::chat::MyInfoAcknowledge* acknowledge_;
+    ::chat::PresenceRequest* presence_;
+    ::chat::ChannelRequest* channel_;
+    ::chat::ChannelMessageRequest* channelmessage_;
+    ::chat::HistoryRequest* history_;
+    int32_t option_;
+    int32_t userid_;
+    uint32_t requestid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ServerMessage) */ {
+ public:
+  inline ServerMessage() : ServerMessage(nullptr) {}
+  ~ServerMessage() override;
+  explicit PROTOBUF_CONSTEXPR ServerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerMessage(const ServerMessage& from);
+  ServerMessage(ServerMessage&& from) noexcept
+    : ServerMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerMessage& operator=(const ServerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerMessage& operator=(ServerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerMessage* internal_default_instance() {
+    return reinterpret_cast<const ServerMessage*>(
+               &_ServerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(ServerMessage& a, ServerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerMessage& from) {
+    ServerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ServerMessage";
+  }
+  protected:
+  explicit ServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBroadcastFieldNumber = 2,
+    kMessageFieldNumber = 3,
+    kErrorFieldNumber = 4,
+    kMyInfoResponseFieldNumber = 5,
+    kConnectedUserResponseFieldNumber = 6,
+    kChangeStatusResponseFieldNumber = 7,
+    kBroadcastResponseFieldNumber = 8,
+    kDirectMessageResponseFieldNumber = 9,
+    kBatchFieldNumber = 10,
+    kPresenceFieldNumber = 11,
+    kChannelResponseFieldNumber = 12,
+    kChannelMessageFieldNumber = 13,
+    kHistoryFieldNumber = 14,
+    kOptionFieldNumber = 1,
+    kRequestIdFieldNumber = 15,
+  };
+  // optional .chat.BroadcastMessage broadcast = 2;
+  bool has_broadcast() const;
+  private:
+  bool _internal_has_broadcast() const;
+  public:
+  void clear_broadcast();
+  const ::chat::BroadcastMessage& broadcast() const;
+  PROTOBUF_NODISCARD ::chat::BroadcastMessage* release_broadcast();
+  ::chat::BroadcastMessage* mutable_broadcast();
+  void set_allocated_broadcast(::chat::BroadcastMessage* broadcast);
+  private:
+  const ::chat::BroadcastMessage& _internal_broadcast() const;
+  ::chat::BroadcastMessage* _internal_mutable_broadcast();
+  public:
+  void unsafe_arena_set_allocated_broadcast(
+      ::chat::BroadcastMessage* broadcast);
+  ::chat::BroadcastMessage* unsafe_arena_release_broadcast();
+
+  // optional .chat.DirectMessage message = 3;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::chat::DirectMessage& message() const;
+  PROTOBUF_NODISCARD ::chat::DirectMessage* release_message();
+  ::chat::DirectMessage* mutable_message();
+  void set_allocated_message(::chat::DirectMessage* message);
+  private:
+  const ::chat::DirectMessage& _internal_message() const;
+  ::chat::DirectMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::chat::DirectMessage* message);
+  ::chat::DirectMessage* unsafe_arena_release_message();
+
+  // optional .chat.ErrorResponse error = 4;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const ::chat::ErrorResponse& error() const;
+  PROTOBUF_NODISCARD ::chat::ErrorResponse* release_error();
+  ::chat::ErrorResponse* mutable_error();
+  void set_allocated_error(::chat::ErrorResponse* error);
+  private:
+  const ::chat::ErrorResponse& _internal_error() const;
+  ::chat::ErrorResponse* _internal_mutable_error();
+  public:
+  void unsafe_arena_set_allocated_error(
+      ::chat::ErrorResponse* error);
+  ::chat::ErrorResponse* unsafe_arena_release_error();
+
+  // optional .chat.MyInfoResponse myInfoResponse = 5;
+  bool has_myinforesponse() const;
+  private:
+  bool _internal_has_myinforesponse() const;
+  public:
+  void clear_myinforesponse();
+  const ::chat::MyInfoResponse& myinforesponse() const;
+  PROTOBUF_NODISCARD ::chat::MyInfoResponse* release_myinforesponse();
+  ::chat::MyInfoResponse* mutable_myinforesponse();
+  void set_allocated_myinforesponse(::chat::MyInfoResponse* myinforesponse);
+  private:
+  const ::chat::MyInfoResponse& _internal_myinforesponse() const;
+  ::chat::MyInfoResponse* _internal_mutable_myinforesponse();
+  public:
+  void unsafe_arena_set_allocated_myinforesponse(
+      ::chat::MyInfoResponse* myinforesponse);
+  ::chat::MyInfoResponse* unsafe_arena_release_myinforesponse();
+
+  // optional .chat.ConnectedUserResponse connectedUserResponse = 6;
+  bool has_connecteduserresponse() const;
+  private:
+  bool _internal_has_connecteduserresponse() const;
+  public:
+  void clear_connecteduserresponse();
+  const ::chat::ConnectedUserResponse& connecteduserresponse() const;
+  PROTOBUF_NODISCARD ::chat::ConnectedUserResponse* release_connecteduserresponse();
+  ::chat::ConnectedUserResponse* mutable_connecteduserresponse();
+  void set_allocated_connecteduserresponse(::chat::ConnectedUserResponse* connecteduserresponse);
+  private:
+  const ::chat::ConnectedUserResponse& _internal_connecteduserresponse() const;
+  ::chat::ConnectedUserResponse* _internal_mutable_connecteduserresponse();
+  public:
+  void unsafe_arena_set_allocated_connecteduserresponse(
+      ::chat::ConnectedUserResponse* connecteduserresponse);
+  ::chat::ConnectedUserResponse* unsafe_arena_release_connecteduserresponse();
+
+  // optional .chat.ChangeStatusResponse changeStatusResponse = 7;
+  bool has_changestatusresponse() const;
+  private:
+  bool _internal_has_changestatusresponse() const;
+  public:
+  void clear_changestatusresponse();
+  const ::chat::ChangeStatusResponse& changestatusresponse() const;
+  PROTOBUF_NODISCARD ::chat::ChangeStatusResponse* release_changestatusresponse();
+  ::chat::ChangeStatusResponse* mutable_changestatusresponse();
+  void set_allocated_changestatusresponse(::chat::ChangeStatusResponse* changestatusresponse);
+  private:
+  const ::chat::ChangeStatusResponse& _internal_changestatusresponse() const;
+  ::chat::ChangeStatusResponse* _internal_mutable_changestatusresponse();
+  public:
+  void unsafe_arena_set_allocated_changestatusresponse(
+      ::chat::ChangeStatusResponse* changestatusresponse);
+  ::chat::ChangeStatusResponse* unsafe_arena_release_changestatusresponse();
+
+  // optional .chat.BroadcastResponse broadcastResponse = 8;
+  bool has_broadcastresponse() const;
+  private:
+  bool _internal_has_broadcastresponse() const;
+  public:
+  void clear_broadcastresponse();
+  const ::chat::BroadcastResponse& broadcastresponse() const;
+  PROTOBUF_NODISCARD ::chat::BroadcastResponse* release_broadcastresponse();
+  ::chat::BroadcastResponse* mutable_broadcastresponse();
+  void set_allocated_broadcastresponse(::chat::BroadcastResponse* broadcastresponse);
+  private:
+  const ::chat::BroadcastResponse& _internal_broadcastresponse() const;
+  ::chat::BroadcastResponse* _internal_mutable_broadcastresponse();
+  public:
+  void unsafe_arena_set_allocated_broadcastresponse(
+      ::chat::BroadcastResponse* broadcastresponse);
+  ::chat::BroadcastResponse* unsafe_arena_release_broadcastresponse();
+
+  // optional .chat.DirectMessageResponse directMessageResponse = 9;
+  bool has_directmessageresponse() const;
+  private:
+  bool _internal_has_directmessageresponse() const;
+  public:
+  void clear_directmessageresponse();
+  const ::chat::DirectMessageResponse& directmessageresponse() const;
+  PROTOBUF_NODISCARD ::chat::DirectMessageResponse* release_directmessageresponse();
+  ::chat::DirectMessageResponse* mutable_directmessageresponse();
+  void set_allocated_directmessageresponse(::chat::DirectMessageResponse* directmessageresponse);
+  private:
+  const ::chat::DirectMessageResponse& _internal_directmessageresponse() const;
+  ::chat::DirectMessageResponse* _internal_mutable_directmessageresponse();
+  public:
+  void unsafe_arena_set_allocated_directmessageresponse(
+      ::chat::DirectMessageResponse* directmessageresponse);
+  ::chat::DirectMessageResponse* unsafe_arena_release_directmessageresponse();
+
+  // optional .chat.ServerMessageBatch batch = 10;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+  public:
+  void clear_batch();
+  const ::chat::ServerMessageBatch& batch() const;
+  PROTOBUF_NODISCARD ::chat::ServerMessageBatch* release_batch();
+  ::chat::ServerMessageBatch* mutable_batch();
+  void set_allocated_batch(::chat::ServerMessageBatch* batch);
+  private:
+  const ::chat::ServerMessageBatch& _internal_batch() const;
+  ::chat::ServerMessageBatch* _internal_mutable_batch();
+  public:
+  void unsafe_arena_set_allocated_batch(
+      ::chat::ServerMessageBatch* batch);
+  ::chat::ServerMessageBatch* unsafe_arena_release_batch();
+
+  // optional .chat.PresenceUpdate presence = 11;
+  bool has_presence() const;
+  private:
+  bool _internal_has_presence() const;
+  public:
+  void clear_presence();
+  const ::chat::PresenceUpdate& presence() const;
+  PROTOBUF_NODISCARD ::chat::PresenceUpdate* release_presence();
+  ::chat::PresenceUpdate* mutable_presence();
+  void set_allocated_presence(::chat::PresenceUpdate* presence);
+  private:
+  const ::chat::PresenceUpdate& _internal_presence() const;
+  ::chat::PresenceUpdate* _internal_mutable_presence();
+  public:
+  void unsafe_arena_set_allocated_presence(
+      ::chat::PresenceUpdate* presence);
+  ::chat::PresenceUpdate* unsafe_arena_release_presence();
+
+  // optional .chat.ChannelResponse channelResponse = 12;
+  bool has_channelresponse() const;
+  private:
+  bool _internal_has_channelresponse() const;
+  public:
+  void clear_channelresponse();
+  const ::chat::ChannelResponse& channelresponse() const;
+  PROTOBUF_NODISCARD ::chat::ChannelResponse* release_channelresponse();
+  ::chat::ChannelResponse* mutable_channelresponse();
+  void set_allocated_channelresponse(::chat::ChannelResponse* channelresponse);
+  private:
+  const ::chat::ChannelResponse& _internal_channelresponse() const;
+  ::chat::ChannelResponse* _internal_mutable_channelresponse();
+  public:
+  void unsafe_arena_set_allocated_channelresponse(
+      ::chat::ChannelResponse* channelresponse);
+  ::chat::ChannelResponse* unsafe_arena_release_channelresponse();
+
+  // optional .chat.ChannelMessage channelMessage = 13;
+  bool has_channelmessage() const;
+  private:
+  bool _internal_has_channelmessage() const;
+  public:
+  void clear_channelmessage();
+  const ::chat::ChannelMessage& channelmessage() const;
+  PROTOBUF_NODISCARD ::chat::ChannelMessage* release_channelmessage();
+  ::chat::ChannelMessage* mutable_channelmessage();
+  void set_allocated_channelmessage(::chat::ChannelMessage* channelmessage);
+  private:
+  const ::chat::ChannelMessage& _internal_channelmessage() const;
+  ::chat::ChannelMessage* _internal_mutable_channelmessage();
+  public:
+  void unsafe_arena_set_allocated_channelmessage(
+      ::chat::ChannelMessage* channelmessage);
+  ::chat::ChannelMessage* unsafe_arena_release_channelmessage();
+
+  // optional .chat.HistoryResponse history = 14;
+  bool has_history() const;
+  private:
+  bool _internal_has_history() const;
+  public:
+  void clear_history();
+  const ::chat::HistoryResponse& history() const;
+  PROTOBUF_NODISCARD ::chat::HistoryResponse* release_history();
+  ::chat::HistoryResponse* mutable_history();
+  void set_allocated_history(::chat::HistoryResponse* history);
+  private:
+  const ::chat::HistoryResponse& _internal_history() const;
+  ::chat::HistoryResponse* _internal_mutable_history();
+  public:
+  void unsafe_arena_set_allocated_history(
+      ::chat::HistoryResponse* history);
+  ::chat::HistoryResponse* unsafe_arena_release_history();
+
+  // required int32 option = 1;
+  bool has_option() const;
+  private:
+  bool _internal_has_option() const;
+  public:
+  void clear_option();
+  int32_t option() const;
+  void set_option(int32_t value);
+  private:
+  int32_t _internal_option() const;
+  void _internal_set_option(int32_t value);
+  public:
+
+  // optional uint32 requestId = 15;
+  bool has_requestid() const;
+  private:
+  bool _internal_has_requestid() const;
+  public:
+  void clear_requestid();
+  uint32_t requestid() const;
+  void set_requestid(uint32_t value);
+  private:
+  uint32_t _internal_requestid() const;
+  void _internal_set_requestid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ServerMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::chat::BroadcastMessage* broadcast_;
+    ::chat::DirectMessage* message_;
+    ::chat::ErrorResponse* error_;
+    ::chat::MyInfoResponse* myinforesponse_;
+    ::chat::ConnectedUserResponse* connecteduserresponse_;
+    ::chat::ChangeStatusResponse* changestatusresponse_;
+    ::chat::BroadcastResponse* broadcastresponse_;
+    ::chat::DirectMessageResponse* directmessageresponse_;
+    ::chat::ServerMessageBatch* batch_;
+    ::chat::PresenceUpdate* presence_;
+    ::chat::ChannelResponse* channelresponse_;
+    ::chat::ChannelMessage* channelmessage_;
+    ::chat::HistoryResponse* history_;
+    int32_t option_;
+    uint32_t requestid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mensaje_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// MyInfoSynchronize
+
+// required string username = 1;
+inline bool MyInfoSynchronize::_internal_has_username() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MyInfoSynchronize::has_username() const {
+  return _internal_has_username();
+}
+inline void MyInfoSynchronize::clear_username() {
+  _impl_.username_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MyInfoSynchronize::username() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoSynchronize.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MyInfoSynchronize::set_username(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.MyInfoSynchronize.username)
+}
+inline std::string* MyInfoSynchronize::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.MyInfoSynchronize.username)
+  return _s;
+}
+inline const std::string& MyInfoSynchronize::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void MyInfoSynchronize::_internal_set_username(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MyInfoSynchronize::_internal_mutable_username() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MyInfoSynchronize::release_username() {
+  // @@protoc_insertion_point(field_release:chat.MyInfoSynchronize.username)
+  if (!_internal_has_username()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.username_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MyInfoSynchronize::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.MyInfoSynchronize.username)
+}
+
+// optional string ip = 2;
+inline bool MyInfoSynchronize::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MyInfoSynchronize::has_ip() const {
+  return _internal_has_ip();
+}
+inline void MyInfoSynchronize::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& MyInfoSynchronize::ip() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoSynchronize.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MyInfoSynchronize::set_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.MyInfoSynchronize.ip)
+}
+inline std::string* MyInfoSynchronize::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:chat.MyInfoSynchronize.ip)
+  return _s;
+}
+inline const std::string& MyInfoSynchronize::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void MyInfoSynchronize::_internal_set_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MyInfoSynchronize::_internal_mutable_ip() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MyInfoSynchronize::release_ip() {
+  // @@protoc_insertion_point(field_release:chat.MyInfoSynchronize.ip)
+  if (!_internal_has_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MyInfoSynchronize::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.MyInfoSynchronize.ip)
+}
+
+// optional bool batch = 3;
+inline bool MyInfoSynchronize::_internal_has_batch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool MyInfoSynchronize::has_batch() const {
+  return _internal_has_batch();
+}
+inline void MyInfoSynchronize::clear_batch() {
+  _impl_.batch_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool MyInfoSynchronize::_internal_batch() const {
+  return _impl_.batch_;
+}
+inline bool MyInfoSynchronize::batch() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoSynchronize.batch)
+  return _internal_batch();
+}
+inline void MyInfoSynchronize::_internal_set_batch(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.batch_ = value;
+}
+inline void MyInfoSynchronize::set_batch(bool value) {
+  _internal_set_batch(value);
+  // @@protoc_insertion_point(field_set:chat.MyInfoSynchronize.batch)
+}
+
+// optional bool presence = 4;
+inline bool MyInfoSynchronize::_internal_has_presence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool MyInfoSynchronize::has_presence() const {
+  return _internal_has_presence();
+}
+inline void MyInfoSynchronize::clear_presence() {
+  _impl_.presence_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool MyInfoSynchronize::_internal_presence() const {
+  return _impl_.presence_;
+}
+inline bool MyInfoSynchronize::presence() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoSynchronize.presence)
+  return _internal_presence();
+}
+inline void MyInfoSynchronize::_internal_set_presence(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.presence_ = value;
+}
+inline void MyInfoSynchronize::set_presence(bool value) {
+  _internal_set_presence(value);
+  // @@protoc_insertion_point(field_set:chat.MyInfoSynchronize.presence)
+}
+
+// optional uint64 lastSequence = 5;
+inline bool MyInfoSynchronize::_internal_has_lastsequence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool MyInfoSynchronize::has_lastsequence() const {
+  return _internal_has_lastsequence();
+}
+inline void MyInfoSynchronize::clear_lastsequence() {
+  _impl_.lastsequence_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t MyInfoSynchronize::_internal_lastsequence() const {
+  return _impl_.lastsequence_;
+}
+inline uint64_t MyInfoSynchronize::lastsequence() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoSynchronize.lastSequence)
+  return _internal_lastsequence();
+}
+inline void MyInfoSynchronize::_internal_set_lastsequence(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.lastsequence_ = value;
+}
+inline void MyInfoSynchronize::set_lastsequence(uint64_t value) {
+  _internal_set_lastsequence(value);
+  // @@protoc_insertion_point(field_set:chat.MyInfoSynchronize.lastSequence)
+}
+
+// optional string resumeToken = 6;
+inline bool MyInfoSynchronize::_internal_has_resumetoken() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MyInfoSynchronize::has_resumetoken() const {
+  return _internal_has_resumetoken();
+}
+inline void MyInfoSynchronize::clear_resumetoken() {
+  _impl_.resumetoken_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& MyInfoSynchronize::resumetoken() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoSynchronize.resumeToken)
+  return _internal_resumetoken();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MyInfoSynchronize::set_resumetoken(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.resumetoken_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.MyInfoSynchronize.resumeToken)
+}
+inline std::string* MyInfoSynchronize::mutable_resumetoken() {
+  std::string* _s = _internal_mutable_resumetoken();
+  // @@protoc_insertion_point(field_mutable:chat.MyInfoSynchronize.resumeToken)
+  return _s;
+}
+inline const std::string& MyInfoSynchronize::_internal_resumetoken() const {
+  return _impl_.resumetoken_.Get();
+}
+inline void MyInfoSynchronize::_internal_set_resumetoken(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.resumetoken_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MyInfoSynchronize::_internal_mutable_resumetoken() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.resumetoken_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MyInfoSynchronize::release_resumetoken() {
+  // @@protoc_insertion_point(field_release:chat.MyInfoSynchronize.resumeToken)
+  if (!_internal_has_resumetoken()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.resumetoken_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resumetoken_.IsDefault()) {
+    _impl_.resumetoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MyInfoSynchronize::set_allocated_resumetoken(std::string* resumetoken) {
+  if (resumetoken != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.resumetoken_.SetAllocated(resumetoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resumetoken_.IsDefault()) {
+    _impl_.resumetoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.MyInfoSynchronize.resumeToken)
+}
+
+// optional string status = 7;
+inline bool MyInfoSynchronize::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool MyInfoSynchronize::has_status() const {
+  return _internal_has_status();
+}
+inline void MyInfoSynchronize::clear_status() {
+  _impl_.status_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& MyInfoSynchronize::status() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoSynchronize.status)
+  return _internal_status();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MyInfoSynchronize::set_status(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.status_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.MyInfoSynchronize.status)
+}
+inline std::string* MyInfoSynchronize::mutable_status() {
+  std::string* _s = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:chat.MyInfoSynchronize.status)
+  return _s;
+}
+inline const std::string& MyInfoSynchronize::_internal_status() const {
+  return _impl_.status_.Get();
+}
+inline void MyInfoSynchronize::_internal_set_status(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.status_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MyInfoSynchronize::_internal_mutable_status() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.status_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MyInfoSynchronize::release_status() {
+  // @@protoc_insertion_point(field_release:chat.MyInfoSynchronize.status)
+  if (!_internal_has_status()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.status_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_.IsDefault()) {
+    _impl_.status_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MyInfoSynchronize::set_allocated_status(std::string* status) {
+  if (status != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.status_.SetAllocated(status, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_.IsDefault()) {
+    _impl_.status_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.MyInfoSynchronize.status)
+}
+
+// -------------------------------------------------------------------
+
+// MyInfoResponse
+
+// required int32 userId = 1;
+inline bool MyInfoResponse::_internal_has_userid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MyInfoResponse::has_userid() const {
+  return _internal_has_userid();
+}
+inline void MyInfoResponse::clear_userid() {
+  _impl_.userid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t MyInfoResponse::_internal_userid() const {
+  return _impl_.userid_;
+}
+inline int32_t MyInfoResponse::userid() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoResponse.userId)
+  return _internal_userid();
+}
+inline void MyInfoResponse::_internal_set_userid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.userid_ = value;
+}
+inline void MyInfoResponse::set_userid(int32_t value) {
+  _internal_set_userid(value);
+  // @@protoc_insertion_point(field_set:chat.MyInfoResponse.userId)
+}
+
+// optional string resumeToken = 2;
+inline bool MyInfoResponse::_internal_has_resumetoken() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MyInfoResponse::has_resumetoken() const {
+  return _internal_has_resumetoken();
+}
+inline void MyInfoResponse::clear_resumetoken() {
+  _impl_.resumetoken_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MyInfoResponse::resumetoken() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoResponse.resumeToken)
+  return _internal_resumetoken();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MyInfoResponse::set_resumetoken(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.resumetoken_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.MyInfoResponse.resumeToken)
+}
+inline std::string* MyInfoResponse::mutable_resumetoken() {
+  std::string* _s = _internal_mutable_resumetoken();
+  // @@protoc_insertion_point(field_mutable:chat.MyInfoResponse.resumeToken)
+  return _s;
+}
+inline const std::string& MyInfoResponse::_internal_resumetoken() const {
+  return _impl_.resumetoken_.Get();
+}
+inline void MyInfoResponse::_internal_set_resumetoken(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.resumetoken_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MyInfoResponse::_internal_mutable_resumetoken() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.resumetoken_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MyInfoResponse::release_resumetoken() {
+  // @@protoc_insertion_point(field_release:chat.MyInfoResponse.resumeToken)
+  if (!_internal_has_resumetoken()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.resumetoken_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resumetoken_.IsDefault()) {
+    _impl_.resumetoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MyInfoResponse::set_allocated_resumetoken(std::string* resumetoken) {
+  if (resumetoken != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.resumetoken_.SetAllocated(resumetoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resumetoken_.IsDefault()) {
+    _impl_.resumetoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.MyInfoResponse.resumeToken)
+}
+
+// optional uint64 sequence = 3;
+inline bool MyInfoResponse::_internal_has_sequence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MyInfoResponse::has_sequence() const {
+  return _internal_has_sequence();
+}
+inline void MyInfoResponse::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t MyInfoResponse::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t MyInfoResponse::sequence() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoResponse.sequence)
+  return _internal_sequence();
+}
+inline void MyInfoResponse::_internal_set_sequence(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sequence_ = value;
+}
+inline void MyInfoResponse::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:chat.MyInfoResponse.sequence)
+}
+
+// -------------------------------------------------------------------
+
+// MyInfoAcknowledge
+
+// required int32 userId = 1;
+inline bool MyInfoAcknowledge::_internal_has_userid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MyInfoAcknowledge::has_userid() const {
+  return _internal_has_userid();
+}
+inline void MyInfoAcknowledge::clear_userid() {
+  _impl_.userid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t MyInfoAcknowledge::_internal_userid() const {
+  return _impl_.userid_;
+}
+inline int32_t MyInfoAcknowledge::userid() const {
+  // @@protoc_insertion_point(field_get:chat.MyInfoAcknowledge.userId)
+  return _internal_userid();
+}
+inline void MyInfoAcknowledge::_internal_set_userid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.userid_ = value;
+}
+inline void MyInfoAcknowledge::set_userid(int32_t value) {
+  _internal_set_userid(value);
+  // @@protoc_insertion_point(field_set:chat.MyInfoAcknowledge.userId)
+}
+
+// -------------------------------------------------------------------
+
+// connectedUserRequest
+
+// optional int32 userId = 1;
+inline bool connectedUserRequest::_internal_has_userid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool connectedUserRequest::has_userid() const {
+  return _internal_has_userid();
+}
+inline void connectedUserRequest::clear_userid() {
+  _impl_.userid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t connectedUserRequest::_internal_userid() const {
+  return _impl_.userid_;
+}
+inline int32_t connectedUserRequest::userid() const {
+  // @@protoc_insertion_point(field_get:chat.connectedUserRequest.userId)
+  return _internal_userid();
+}
+inline void connectedUserRequest::_internal_set_userid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.userid_ = value;
+}
+inline void connectedUserRequest::set_userid(int32_t value) {
+  _internal_set_userid(value);
+  // @@protoc_insertion_point(field_set:chat.connectedUserRequest.userId)
+}
+
+// optional string username = 2;
+inline bool connectedUserRequest::_internal_has_username() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool connectedUserRequest::has_username() const {
+  return _internal_has_username();
+}
+inline void connectedUserRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& connectedUserRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.connectedUserRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void connectedUserRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.connectedUserRequest.username)
+}
+inline std::string* connectedUserRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.connectedUserRequest.username)
+  return _s;
+}
+inline const std::string& connectedUserRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void connectedUserRequest::_internal_set_username(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* connectedUserRequest::_internal_mutable_username() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* connectedUserRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.connectedUserRequest.username)
+  if (!_internal_has_username()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.username_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void connectedUserRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.connectedUserRequest.username)
+}
+
+// optional string prefix = 3;
+inline bool connectedUserRequest::_internal_has_prefix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool connectedUserRequest::has_prefix() const {
+  return _internal_has_prefix();
+}
+inline void connectedUserRequest::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& connectedUserRequest::prefix() const {
+  // @@protoc_insertion_point(field_get:chat.connectedUserRequest.prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void connectedUserRequest::set_prefix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.connectedUserRequest.prefix)
+}
+inline std::string* connectedUserRequest::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:chat.connectedUserRequest.prefix)
+  return _s;
+}
+inline const std::string& connectedUserRequest::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void connectedUserRequest::_internal_set_prefix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* connectedUserRequest::_internal_mutable_prefix() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* connectedUserRequest::release_prefix() {
+  // @@protoc_insertion_point(field_release:chat.connectedUserRequest.prefix)
+  if (!_internal_has_prefix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.prefix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void connectedUserRequest::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.connectedUserRequest.prefix)
+}
+
+// optional string cursor = 4;
+inline bool connectedUserRequest::_internal_has_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool connectedUserRequest::has_cursor() const {
+  return _internal_has_cursor();
+}
+inline void connectedUserRequest::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& connectedUserRequest::cursor() const {
+  // @@protoc_insertion_point(field_get:chat.connectedUserRequest.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void connectedUserRequest::set_cursor(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.connectedUserRequest.cursor)
+}
+inline std::string* connectedUserRequest::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:chat.connectedUserRequest.cursor)
+  return _s;
+}
+inline const std::string& connectedUserRequest::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void connectedUserRequest::_internal_set_cursor(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* connectedUserRequest::_internal_mutable_cursor() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* connectedUserRequest::release_cursor() {
+  // @@protoc_insertion_point(field_release:chat.connectedUserRequest.cursor)
+  if (!_internal_has_cursor()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.cursor_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void connectedUserRequest::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.connectedUserRequest.cursor)
+}
+
+// optional int32 limit = 5;
+inline bool connectedUserRequest::_internal_has_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool connectedUserRequest::has_limit() const {
+  return _internal_has_limit();
+}
+inline void connectedUserRequest::clear_limit() {
+  _impl_.limit_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t connectedUserRequest::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline int32_t connectedUserRequest::limit() const {
+  // @@protoc_insertion_point(field_get:chat.connectedUserRequest.limit)
+  return _internal_limit();
+}
+inline void connectedUserRequest::_internal_set_limit(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.limit_ = value;
+}
+inline void connectedUserRequest::set_limit(int32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:chat.connectedUserRequest.limit)
+}
+
+// -------------------------------------------------------------------
+
+// ConnectedUser
+
+// required string username = 1;
+inline bool ConnectedUser::_internal_has_username() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ConnectedUser::has_username() const {
+  return _internal_has_username();
+}
+inline void ConnectedUser::clear_username() {
+  _impl_.username_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ConnectedUser::username() const {
+  // @@protoc_insertion_point(field_get:chat.ConnectedUser.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConnectedUser::set_username(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ConnectedUser.username)
+}
+inline std::string* ConnectedUser::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.ConnectedUser.username)
+  return _s;
+}
+inline const std::string& ConnectedUser::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void ConnectedUser::_internal_set_username(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ConnectedUser::_internal_mutable_username() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ConnectedUser::release_username() {
+  // @@protoc_insertion_point(field_release:chat.ConnectedUser.username)
+  if (!_internal_has_username()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.username_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ConnectedUser::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ConnectedUser.username)
+}
+
+// optional string status = 2;
+inline bool ConnectedUser::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ConnectedUser::has_status() const {
+  return _internal_has_status();
+}
+inline void ConnectedUser::clear_status() {
+  _impl_.status_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ConnectedUser::status() const {
+  // @@protoc_insertion_point(field_get:chat.ConnectedUser.status)
+  return _internal_status();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConnectedUser::set_status(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.status_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ConnectedUser.status)
+}
+inline std::string* ConnectedUser::mutable_status() {
+  std::string* _s = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:chat.ConnectedUser.status)
+  return _s;
+}
+inline const std::string& ConnectedUser::_internal_status() const {
+  return _impl_.status_.Get();
+}
+inline void ConnectedUser::_internal_set_status(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.status_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ConnectedUser::_internal_mutable_status() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.status_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ConnectedUser::release_status() {
+  // @@protoc_insertion_point(field_release:chat.ConnectedUser.status)
+  if (!_internal_has_status()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.status_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_.IsDefault()) {
+    _impl_.status_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ConnectedUser::set_allocated_status(std::string* status) {
+  if (status != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.status_.SetAllocated(status, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_.IsDefault()) {
+    _impl_.status_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ConnectedUser.status)
+}
+
+// optional int32 userId = 3;
+inline bool ConnectedUser::_internal_has_userid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ConnectedUser::has_userid() const {
+  return _internal_has_userid();
+}
+inline void ConnectedUser::clear_userid() {
+  _impl_.userid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t ConnectedUser::_internal_userid() const {
+  return _impl_.userid_;
+}
+inline int32_t ConnectedUser::userid() const {
+  // @@protoc_insertion_point(field_get:chat.ConnectedUser.userId)
+  return _internal_userid();
+}
+inline void ConnectedUser::_internal_set_userid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.userid_ = value;
+}
+inline void ConnectedUser::set_userid(int32_t value) {
+  _internal_set_userid(value);
+  // @@protoc_insertion_point(field_set:chat.ConnectedUser.userId)
+}
+
+// optional string ip = 4;
+inline bool ConnectedUser::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ConnectedUser::has_ip() const {
+  return _internal_has_ip();
+}
+inline void ConnectedUser::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& ConnectedUser::ip() const {
+  // @@protoc_insertion_point(field_get:chat.ConnectedUser.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConnectedUser::set_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ConnectedUser.ip)
+}
+inline std::string* ConnectedUser::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:chat.ConnectedUser.ip)
+  return _s;
+}
+inline const std::string& ConnectedUser::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void ConnectedUser::_internal_set_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ConnectedUser::_internal_mutable_ip() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ConnectedUser::release_ip() {
+  // @@protoc_insertion_point(field_release:chat.ConnectedUser.ip)
+  if (!_internal_has_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ConnectedUser::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ConnectedUser.ip)
+}
+
+// -------------------------------------------------------------------
+
+// ConnectedUserResponse
+
+// repeated .chat.ConnectedUser connectedUsers = 1;
+inline int ConnectedUserResponse::_internal_connectedusers_size() const {
+  return _impl_.connectedusers_.size();
+}
+inline int ConnectedUserResponse::connectedusers_size() const {
+  return _internal_connectedusers_size();
+}
+inline void ConnectedUserResponse::clear_connectedusers() {
+  _impl_.connectedusers_.Clear();
+}
+inline ::chat::ConnectedUser* ConnectedUserResponse::mutable_connectedusers(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.ConnectedUserResponse.connectedUsers)
+  return _impl_.connectedusers_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ConnectedUser >*
+ConnectedUserResponse::mutable_connectedusers() {
+  // @@protoc_insertion_point(field_mutable_list:chat.ConnectedUserResponse.connectedUsers)
+  return &_impl_.connectedusers_;
+}
+inline const ::chat::ConnectedUser& ConnectedUserResponse::_internal_connectedusers(int index) const {
+  return _impl_.connectedusers_.Get(index);
+}
+inline const ::chat::ConnectedUser& ConnectedUserResponse::connectedusers(int index) const {
+  // @@protoc_insertion_point(field_get:chat.ConnectedUserResponse.connectedUsers)
+  return _internal_connectedusers(index);
+}
+inline ::chat::ConnectedUser* ConnectedUserResponse::_internal_add_connectedusers() {
+  return _impl_.connectedusers_.Add();
+}
+inline ::chat::ConnectedUser* ConnectedUserResponse::add_connectedusers() {
+  ::chat::ConnectedUser* _add = _internal_add_connectedusers();
+  // @@protoc_insertion_point(field_add:chat.ConnectedUserResponse.connectedUsers)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ConnectedUser >&
+ConnectedUserResponse::connectedusers() const {
+  // @@protoc_insertion_point(field_list:chat.ConnectedUserResponse.connectedUsers)
+  return _impl_.connectedusers_;
+}
+
+// optional string nextCursor = 2;
+inline bool ConnectedUserResponse::_internal_has_nextcursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ConnectedUserResponse::has_nextcursor() const {
+  return _internal_has_nextcursor();
+}
+inline void ConnectedUserResponse::clear_nextcursor() {
+  _impl_.nextcursor_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ConnectedUserResponse::nextcursor() const {
+  // @@protoc_insertion_point(field_get:chat.ConnectedUserResponse.nextCursor)
+  return _internal_nextcursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConnectedUserResponse::set_nextcursor(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.nextcursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ConnectedUserResponse.nextCursor)
+}
+inline std::string* ConnectedUserResponse::mutable_nextcursor() {
+  std::string* _s = _internal_mutable_nextcursor();
+  // @@protoc_insertion_point(field_mutable:chat.ConnectedUserResponse.nextCursor)
+  return _s;
+}
+inline const std::string& ConnectedUserResponse::_internal_nextcursor() const {
+  return _impl_.nextcursor_.Get();
+}
+inline void ConnectedUserResponse::_internal_set_nextcursor(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.nextcursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ConnectedUserResponse::_internal_mutable_nextcursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.nextcursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ConnectedUserResponse::release_nextcursor() {
+  // @@protoc_insertion_point(field_release:chat.ConnectedUserResponse.nextCursor)
+  if (!_internal_has_nextcursor()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.nextcursor_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nextcursor_.IsDefault()) {
+    _impl_.nextcursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ConnectedUserResponse::set_allocated_nextcursor(std::string* nextcursor) {
+  if (nextcursor != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.nextcursor_.SetAllocated(nextcursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nextcursor_.IsDefault()) {
+    _impl_.nextcursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ConnectedUserResponse.nextCursor)
+}
+
+// -------------------------------------------------------------------
+
+// ChangeStatusRequest
+
+// required string status = 1;
+inline bool ChangeStatusRequest::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ChangeStatusRequest::has_status() const {
+  return _internal_has_status();
+}
+inline void ChangeStatusRequest::clear_status() {
+  _impl_.status_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ChangeStatusRequest::status() const {
+  // @@protoc_insertion_point(field_get:chat.ChangeStatusRequest.status)
+  return _internal_status();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChangeStatusRequest::set_status(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.status_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChangeStatusRequest.status)
+}
+inline std::string* ChangeStatusRequest::mutable_status() {
+  std::string* _s = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:chat.ChangeStatusRequest.status)
+  return _s;
+}
+inline const std::string& ChangeStatusRequest::_internal_status() const {
+  return _impl_.status_.Get();
+}
+inline void ChangeStatusRequest::_internal_set_status(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.status_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChangeStatusRequest::_internal_mutable_status() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.status_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChangeStatusRequest::release_status() {
+  // @@protoc_insertion_point(field_release:chat.ChangeStatusRequest.status)
+  if (!_internal_has_status()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.status_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_.IsDefault()) {
+    _impl_.status_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChangeStatusRequest::set_allocated_status(std::string* status) {
+  if (status != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.status_.SetAllocated(status, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_.IsDefault()) {
+    _impl_.status_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChangeStatusRequest.status)
+}
+
+// -------------------------------------------------------------------
+
+// ChangeStatusResponse
+
+// required int32 userId = 1;
+inline bool ChangeStatusResponse::_internal_has_userid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ChangeStatusResponse::has_userid() const {
+  return _internal_has_userid();
+}
+inline void ChangeStatusResponse::clear_userid() {
+  _impl_.userid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t ChangeStatusResponse::_internal_userid() const {
+  return _impl_.userid_;
+}
+inline int32_t ChangeStatusResponse::userid() const {
+  // @@protoc_insertion_point(field_get:chat.ChangeStatusResponse.userId)
+  return _internal_userid();
+}
+inline void ChangeStatusResponse::_internal_set_userid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.userid_ = value;
+}
+inline void ChangeStatusResponse::set_userid(int32_t value) {
+  _internal_set_userid(value);
+  // @@protoc_insertion_point(field_set:chat.ChangeStatusResponse.userId)
+}
+
+// required string status = 2;
+inline bool ChangeStatusResponse::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ChangeStatusResponse::has_status() const {
+  return _internal_has_status();
+}
+inline void ChangeStatusResponse::clear_status() {
+  _impl_.status_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ChangeStatusResponse::status() const {
+  // @@protoc_insertion_point(field_get:chat.ChangeStatusResponse.status)
+  return _internal_status();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChangeStatusResponse::set_status(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.status_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChangeStatusResponse.status)
+}
+inline std::string* ChangeStatusResponse::mutable_status() {
+  std::string* _s = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:chat.ChangeStatusResponse.status)
+  return _s;
+}
+inline const std::string& ChangeStatusResponse::_internal_status() const {
+  return _impl_.status_.Get();
+}
+inline void ChangeStatusResponse::_internal_set_status(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.status_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChangeStatusResponse::_internal_mutable_status() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.status_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChangeStatusResponse::release_status() {
+  // @@protoc_insertion_point(field_release:chat.ChangeStatusResponse.status)
+  if (!_internal_has_status()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.status_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_.IsDefault()) {
+    _impl_.status_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChangeStatusResponse::set_allocated_status(std::string* status) {
+  if (status != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.status_.SetAllocated(status, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_.IsDefault()) {
+    _impl_.status_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChangeStatusResponse.status)
+}
+
+// -------------------------------------------------------------------
+
+// BroadcastRequest
+
+// required string message = 1;
+inline bool BroadcastRequest::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BroadcastRequest::has_message() const {
+  return _internal_has_message();
+}
+inline void BroadcastRequest::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BroadcastRequest::message() const {
+  // @@protoc_insertion_point(field_get:chat.BroadcastRequest.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BroadcastRequest::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.BroadcastRequest.message)
+}
+inline std::string* BroadcastRequest::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.BroadcastRequest.message)
+  return _s;
+}
+inline const std::string& BroadcastRequest::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void BroadcastRequest::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BroadcastRequest::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BroadcastRequest::release_message() {
+  // @@protoc_insertion_point(field_release:chat.BroadcastRequest.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BroadcastRequest::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.BroadcastRequest.message)
+}
+
+// -------------------------------------------------------------------
+
+// BroadcastResponse
+
+// required string messageStatus = 1;
+inline bool BroadcastResponse::_internal_has_messagestatus() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BroadcastResponse::has_messagestatus() const {
+  return _internal_has_messagestatus();
+}
+inline void BroadcastResponse::clear_messagestatus() {
+  _impl_.messagestatus_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BroadcastResponse::messagestatus() const {
+  // @@protoc_insertion_point(field_get:chat.BroadcastResponse.messageStatus)
+  return _internal_messagestatus();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BroadcastResponse::set_messagestatus(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.messagestatus_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.BroadcastResponse.messageStatus)
+}
+inline std::string* BroadcastResponse::mutable_messagestatus() {
+  std::string* _s = _internal_mutable_messagestatus();
+  // @@protoc_insertion_point(field_mutable:chat.BroadcastResponse.messageStatus)
+  return _s;
+}
+inline const std::string& BroadcastResponse::_internal_messagestatus() const {
+  return _impl_.messagestatus_.Get();
+}
+inline void BroadcastResponse::_internal_set_messagestatus(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.messagestatus_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BroadcastResponse::_internal_mutable_messagestatus() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.messagestatus_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BroadcastResponse::release_messagestatus() {
+  // @@protoc_insertion_point(field_release:chat.BroadcastResponse.messageStatus)
+  if (!_internal_has_messagestatus()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.messagestatus_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.messagestatus_.IsDefault()) {
+    _impl_.messagestatus_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BroadcastResponse::set_allocated_messagestatus(std::string* messagestatus) {
+  if (messagestatus != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.messagestatus_.SetAllocated(messagestatus, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.messagestatus_.IsDefault()) {
+    _impl_.messagestatus_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.BroadcastResponse.messageStatus)
+}
+
+// -------------------------------------------------------------------
+
+// BroadcastMessage
+
+// required string message = 1;
+inline bool BroadcastMessage::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BroadcastMessage::has_message() const {
+  return _internal_has_message();
+}
+inline void BroadcastMessage::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BroadcastMessage::message() const {
+  // @@protoc_insertion_point(field_get:chat.BroadcastMessage.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BroadcastMessage::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.BroadcastMessage.message)
+}
+inline std::string* BroadcastMessage::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.BroadcastMessage.message)
+  return _s;
+}
+inline const std::string& BroadcastMessage::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void BroadcastMessage::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BroadcastMessage::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BroadcastMessage::release_message() {
+  // @@protoc_insertion_point(field_release:chat.BroadcastMessage.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BroadcastMessage::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.BroadcastMessage.message)
+}
+
+// required int32 userId = 2;
+inline bool BroadcastMessage::_internal_has_userid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool BroadcastMessage::has_userid() const {
+  return _internal_has_userid();
+}
+inline void BroadcastMessage::clear_userid() {
+  _impl_.userid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t BroadcastMessage::_internal_userid() const {
+  return _impl_.userid_;
+}
+inline int32_t BroadcastMessage::userid() const {
+  // @@protoc_insertion_point(field_get:chat.BroadcastMessage.userId)
+  return _internal_userid();
+}
+inline void BroadcastMessage::_internal_set_userid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.userid_ = value;
+}
+inline void BroadcastMessage::set_userid(int32_t value) {
+  _internal_set_userid(value);
+  // @@protoc_insertion_point(field_set:chat.BroadcastMessage.userId)
+}
+
+// optional string username = 3;
+inline bool BroadcastMessage::_internal_has_username() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool BroadcastMessage::has_username() const {
+  return _internal_has_username();
+}
+inline void BroadcastMessage::clear_username() {
+  _impl_.username_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& BroadcastMessage::username() const {
+  // @@protoc_insertion_point(field_get:chat.BroadcastMessage.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BroadcastMessage::set_username(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.BroadcastMessage.username)
+}
+inline std::string* BroadcastMessage::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.BroadcastMessage.username)
+  return _s;
+}
+inline const std::string& BroadcastMessage::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void BroadcastMessage::_internal_set_username(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BroadcastMessage::_internal_mutable_username() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BroadcastMessage::release_username() {
+  // @@protoc_insertion_point(field_release:chat.BroadcastMessage.username)
+  if (!_internal_has_username()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.username_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BroadcastMessage::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.BroadcastMessage.username)
+}
+
+// optional uint64 sequence = 4;
+inline bool BroadcastMessage::_internal_has_sequence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool BroadcastMessage::has_sequence() const {
+  return _internal_has_sequence();
+}
+inline void BroadcastMessage::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t BroadcastMessage::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t BroadcastMessage::sequence() const {
+  // @@protoc_insertion_point(field_get:chat.BroadcastMessage.sequence)
+  return _internal_sequence();
+}
+inline void BroadcastMessage::_internal_set_sequence(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sequence_ = value;
+}
+inline void BroadcastMessage::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:chat.BroadcastMessage.sequence)
+}
+
+// -------------------------------------------------------------------
+
+// DirectMessageRequest
+
+// required string message = 1;
+inline bool DirectMessageRequest::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool DirectMessageRequest::has_message() const {
+  return _internal_has_message();
+}
+inline void DirectMessageRequest::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& DirectMessageRequest::message() const {
+  // @@protoc_insertion_point(field_get:chat.DirectMessageRequest.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectMessageRequest::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.DirectMessageRequest.message)
+}
+inline std::string* DirectMessageRequest::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.DirectMessageRequest.message)
+  return _s;
+}
+inline const std::string& DirectMessageRequest::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void DirectMessageRequest::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectMessageRequest::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectMessageRequest::release_message() {
+  // @@protoc_insertion_point(field_release:chat.DirectMessageRequest.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void DirectMessageRequest::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.DirectMessageRequest.message)
+}
+
+// optional int32 userId = 2;
+inline bool DirectMessageRequest::_internal_has_userid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool DirectMessageRequest::has_userid() const {
+  return _internal_has_userid();
+}
+inline void DirectMessageRequest::clear_userid() {
+  _impl_.userid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t DirectMessageRequest::_internal_userid() const {
+  return _impl_.userid_;
+}
+inline int32_t DirectMessageRequest::userid() const {
+  // @@protoc_insertion_point(field_get:chat.DirectMessageRequest.userId)
+  return _internal_userid();
+}
+inline void DirectMessageRequest::_internal_set_userid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.userid_ = value;
+}
+inline void DirectMessageRequest::set_userid(int32_t value) {
+  _internal_set_userid(value);
+  // @@protoc_insertion_point(field_set:chat.DirectMessageRequest.userId)
+}
+
+// optional string username = 3;
+inline bool DirectMessageRequest::_internal_has_username() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool DirectMessageRequest::has_username() const {
+  return _internal_has_username();
+}
+inline void DirectMessageRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& DirectMessageRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.DirectMessageRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectMessageRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.DirectMessageRequest.username)
+}
+inline std::string* DirectMessageRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.DirectMessageRequest.username)
+  return _s;
+}
+inline const std::string& DirectMessageRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void DirectMessageRequest::_internal_set_username(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectMessageRequest::_internal_mutable_username() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectMessageRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.DirectMessageRequest.username)
+  if (!_internal_has_username()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.username_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void DirectMessageRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.DirectMessageRequest.username)
+}
+
+// -------------------------------------------------------------------
+
+// DirectMessageResponse
+
+// required string messageStatus = 1;
+inline bool DirectMessageResponse::_internal_has_messagestatus() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool DirectMessageResponse::has_messagestatus() const {
+  return _internal_has_messagestatus();
+}
+inline void DirectMessageResponse::clear_messagestatus() {
+  _impl_.messagestatus_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& DirectMessageResponse::messagestatus() const {
+  // @@protoc_insertion_point(field_get:chat.DirectMessageResponse.messageStatus)
+  return _internal_messagestatus();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectMessageResponse::set_messagestatus(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.messagestatus_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.DirectMessageResponse.messageStatus)
+}
+inline std::string* DirectMessageResponse::mutable_messagestatus() {
+  std::string* _s = _internal_mutable_messagestatus();
+  // @@protoc_insertion_point(field_mutable:chat.DirectMessageResponse.messageStatus)
+  return _s;
+}
+inline const std::string& DirectMessageResponse::_internal_messagestatus() const {
+  return _impl_.messagestatus_.Get();
+}
+inline void DirectMessageResponse::_internal_set_messagestatus(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.messagestatus_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectMessageResponse::_internal_mutable_messagestatus() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.messagestatus_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectMessageResponse::release_messagestatus() {
+  // @@protoc_insertion_point(field_release:chat.DirectMessageResponse.messageStatus)
+  if (!_internal_has_messagestatus()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.messagestatus_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.messagestatus_.IsDefault()) {
+    _impl_.messagestatus_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void DirectMessageResponse::set_allocated_messagestatus(std::string* messagestatus) {
+  if (messagestatus != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.messagestatus_.SetAllocated(messagestatus, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.messagestatus_.IsDefault()) {
+    _impl_.messagestatus_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.DirectMessageResponse.messageStatus)
+}
+
+// -------------------------------------------------------------------
+
+// DirectMessage
+
+// required string message = 1;
+inline bool DirectMessage::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool DirectMessage::has_message() const {
+  return _internal_has_message();
+}
+inline void DirectMessage::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& DirectMessage::message() const {
+  // @@protoc_insertion_point(field_get:chat.DirectMessage.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectMessage::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.DirectMessage.message)
+}
+inline std::string* DirectMessage::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.DirectMessage.message)
+  return _s;
+}
+inline const std::string& DirectMessage::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void DirectMessage::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectMessage::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectMessage::release_message() {
+  // @@protoc_insertion_point(field_release:chat.DirectMessage.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void DirectMessage::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.DirectMessage.message)
+}
+
+// required int32 userId = 2;
+inline bool DirectMessage::_internal_has_userid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool DirectMessage::has_userid() const {
+  return _internal_has_userid();
+}
+inline void DirectMessage::clear_userid() {
+  _impl_.userid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t DirectMessage::_internal_userid() const {
+  return _impl_.userid_;
+}
+inline int32_t DirectMessage::userid() const {
+  // @@protoc_insertion_point(field_get:chat.DirectMessage.userId)
+  return _internal_userid();
+}
+inline void DirectMessage::_internal_set_userid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.userid_ = value;
+}
+inline void DirectMessage::set_userid(int32_t value) {
+  _internal_set_userid(value);
+  // @@protoc_insertion_point(field_set:chat.DirectMessage.userId)
+}
+
+// optional string username = 3;
+inline bool DirectMessage::_internal_has_username() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool DirectMessage::has_username() const {
+  return _internal_has_username();
+}
+inline void DirectMessage::clear_username() {
+  _impl_.username_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& DirectMessage::username() const {
+  // @@protoc_insertion_point(field_get:chat.DirectMessage.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectMessage::set_username(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.DirectMessage.username)
+}
+inline std::string* DirectMessage::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.DirectMessage.username)
+  return _s;
+}
+inline const std::string& DirectMessage::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void DirectMessage::_internal_set_username(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectMessage::_internal_mutable_username() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectMessage::release_username() {
+  // @@protoc_insertion_point(field_release:chat.DirectMessage.username)
+  if (!_internal_has_username()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.username_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void DirectMessage::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.DirectMessage.username)
+}
+
+// optional uint64 sequence = 4;
+inline bool DirectMessage::_internal_has_sequence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool DirectMessage::has_sequence() const {
+  return _internal_has_sequence();
+}
+inline void DirectMessage::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t DirectMessage::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t DirectMessage::sequence() const {
+  // @@protoc_insertion_point(field_get:chat.DirectMessage.sequence)
+  return _internal_sequence();
+}
+inline void DirectMessage::_internal_set_sequence(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sequence_ = value;
+}
+inline void DirectMessage::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:chat.DirectMessage.sequence)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceRequest
+
+// optional uint64 version = 1;
+inline bool PresenceRequest::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PresenceRequest::has_version() const {
+  return _internal_has_version();
+}
+inline void PresenceRequest::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t PresenceRequest::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t PresenceRequest::version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceRequest.version)
+  return _internal_version();
+}
+inline void PresenceRequest::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_ = value;
+}
+inline void PresenceRequest::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceRequest.version)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceDelta
+
+// required int32 kind = 1;
+inline bool PresenceDelta::_internal_has_kind() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PresenceDelta::has_kind() const {
+  return _internal_has_kind();
+}
+inline void PresenceDelta::clear_kind() {
+  _impl_.kind_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t PresenceDelta::_internal_kind() const {
+  return _impl_.kind_;
+}
+inline int32_t PresenceDelta::kind() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceDelta.kind)
+  return _internal_kind();
+}
+inline void PresenceDelta::_internal_set_kind(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.kind_ = value;
+}
+inline void PresenceDelta::set_kind(int32_t value) {
+  _internal_set_kind(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceDelta.kind)
+}
+
+// required .chat.ConnectedUser user = 2;
+inline bool PresenceDelta::_internal_has_user() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.user_ != nullptr);
+  return value;
+}
+inline bool PresenceDelta::has_user() const {
+  return _internal_has_user();
+}
+inline void PresenceDelta::clear_user() {
+  if (_impl_.user_ != nullptr) _impl_.user_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::chat::ConnectedUser& PresenceDelta::_internal_user() const {
+  const ::chat::ConnectedUser* p = _impl_.user_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ConnectedUser&>(
+      ::chat::_ConnectedUser_default_instance_);
+}
+inline const ::chat::ConnectedUser& PresenceDelta::user() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceDelta.user)
+  return _internal_user();
+}
+inline void PresenceDelta::unsafe_arena_set_allocated_user(
+    ::chat::ConnectedUser* user) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.user_);
+  }
+  _impl_.user_ = user;
+  if (user) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.PresenceDelta.user)
+}
+inline ::chat::ConnectedUser* PresenceDelta::release_user() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::chat::ConnectedUser* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ConnectedUser* PresenceDelta::unsafe_arena_release_user() {
+  // @@protoc_insertion_point(field_release:chat.PresenceDelta.user)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::chat::ConnectedUser* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+  return temp;
+}
+inline ::chat::ConnectedUser* PresenceDelta::_internal_mutable_user() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.user_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ConnectedUser>(GetArenaForAllocation());
+    _impl_.user_ = p;
+  }
+  return _impl_.user_;
+}
+inline ::chat::ConnectedUser* PresenceDelta::mutable_user() {
+  ::chat::ConnectedUser* _msg = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:chat.PresenceDelta.user)
+  return _msg;
+}
+inline void PresenceDelta::set_allocated_user(::chat::ConnectedUser* user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.user_;
+  }
+  if (user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user);
+    if (message_arena != submessage_arena) {
+      user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.user_ = user;
+  // @@protoc_insertion_point(field_set_allocated:chat.PresenceDelta.user)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceUpdate
+
+// required uint64 version = 1;
+inline bool PresenceUpdate::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PresenceUpdate::has_version() const {
+  return _internal_has_version();
+}
+inline void PresenceUpdate::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PresenceUpdate::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t PresenceUpdate::version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.version)
+  return _internal_version();
+}
+inline void PresenceUpdate::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
+}
+inline void PresenceUpdate::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceUpdate.version)
+}
+
+// optional uint64 baseVersion = 2;
+inline bool PresenceUpdate::_internal_has_baseversion() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PresenceUpdate::has_baseversion() const {
+  return _internal_has_baseversion();
+}
+inline void PresenceUpdate::clear_baseversion() {
+  _impl_.baseversion_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t PresenceUpdate::_internal_baseversion() const {
+  return _impl_.baseversion_;
+}
+inline uint64_t PresenceUpdate::baseversion() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.baseVersion)
+  return _internal_baseversion();
+}
+inline void PresenceUpdate::_internal_set_baseversion(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.baseversion_ = value;
+}
+inline void PresenceUpdate::set_baseversion(uint64_t value) {
+  _internal_set_baseversion(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceUpdate.baseVersion)
+}
+
+// optional .chat.ConnectedUserResponse snapshot = 3;
+inline bool PresenceUpdate::_internal_has_snapshot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.snapshot_ != nullptr);
+  return value;
+}
+inline bool PresenceUpdate::has_snapshot() const {
+  return _internal_has_snapshot();
+}
+inline void PresenceUpdate::clear_snapshot() {
+  if (_impl_.snapshot_ != nullptr) _impl_.snapshot_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::chat::ConnectedUserResponse& PresenceUpdate::_internal_snapshot() const {
+  const ::chat::ConnectedUserResponse* p = _impl_.snapshot_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ConnectedUserResponse&>(
+      ::chat::_ConnectedUserResponse_default_instance_);
+}
+inline const ::chat::ConnectedUserResponse& PresenceUpdate::snapshot() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.snapshot)
+  return _internal_snapshot();
+}
+inline void PresenceUpdate::unsafe_arena_set_allocated_snapshot(
+    ::chat::ConnectedUserResponse* snapshot) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.snapshot_);
+  }
+  _impl_.snapshot_ = snapshot;
+  if (snapshot) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.PresenceUpdate.snapshot)
+}
+inline ::chat::ConnectedUserResponse* PresenceUpdate::release_snapshot() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::chat::ConnectedUserResponse* temp = _impl_.snapshot_;
+  _impl_.snapshot_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ConnectedUserResponse* PresenceUpdate::unsafe_arena_release_snapshot() {
+  // @@protoc_insertion_point(field_release:chat.PresenceUpdate.snapshot)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::chat::ConnectedUserResponse* temp = _impl_.snapshot_;
+  _impl_.snapshot_ = nullptr;
+  return temp;
+}
+inline ::chat::ConnectedUserResponse* PresenceUpdate::_internal_mutable_snapshot() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.snapshot_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ConnectedUserResponse>(GetArenaForAllocation());
+    _impl_.snapshot_ = p;
+  }
+  return _impl_.snapshot_;
+}
+inline ::chat::ConnectedUserResponse* PresenceUpdate::mutable_snapshot() {
+  ::chat::ConnectedUserResponse* _msg = _internal_mutable_snapshot();
+  // @@protoc_insertion_point(field_mutable:chat.PresenceUpdate.snapshot)
+  return _msg;
+}
+inline void PresenceUpdate::set_allocated_snapshot(::chat::ConnectedUserResponse* snapshot) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.snapshot_;
+  }
+  if (snapshot) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(snapshot);
+    if (message_arena != submessage_arena) {
+      snapshot = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, snapshot, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.snapshot_ = snapshot;
+  // @@protoc_insertion_point(field_set_allocated:chat.PresenceUpdate.snapshot)
+}
+
+// repeated .chat.PresenceDelta deltas = 4;
+inline int PresenceUpdate::_internal_deltas_size() const {
+  return _impl_.deltas_.size();
+}
+inline int PresenceUpdate::deltas_size() const {
+  return _internal_deltas_size();
+}
+inline void PresenceUpdate::clear_deltas() {
+  _impl_.deltas_.Clear();
+}
+inline ::chat::PresenceDelta* PresenceUpdate::mutable_deltas(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PresenceUpdate.deltas)
+  return _impl_.deltas_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDelta >*
+PresenceUpdate::mutable_deltas() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PresenceUpdate.deltas)
+  return &_impl_.deltas_;
+}
+inline const ::chat::PresenceDelta& PresenceUpdate::_internal_deltas(int index) const {
+  return _impl_.deltas_.Get(index);
+}
+inline const ::chat::PresenceDelta& PresenceUpdate::deltas(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.deltas)
+  return _internal_deltas(index);
+}
+inline ::chat::PresenceDelta* PresenceUpdate::_internal_add_deltas() {
+  return _impl_.deltas_.Add();
+}
+inline ::chat::PresenceDelta* PresenceUpdate::add_deltas() {
+  ::chat::PresenceDelta* _add = _internal_add_deltas();
+  // @@protoc_insertion_point(field_add:chat.PresenceUpdate.deltas)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDelta >&
+PresenceUpdate::deltas() const {
+  // @@protoc_insertion_point(field_list:chat.PresenceUpdate.deltas)
+  return _impl_.deltas_;
+}
+
+// -------------------------------------------------------------------
+
+// ChannelRequest
+
+// required string channel = 1;
+inline bool ChannelRequest::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ChannelRequest::has_channel() const {
+  return _internal_has_channel();
+}
+inline void ChannelRequest::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ChannelRequest::channel() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelRequest.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelRequest::set_channel(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelRequest.channel)
+}
+inline std::string* ChannelRequest::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelRequest.channel)
+  return _s;
+}
+inline const std::string& ChannelRequest::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void ChannelRequest::_internal_set_channel(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelRequest::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelRequest::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.ChannelRequest.channel)
+  if (!_internal_has_channel()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.channel_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChannelRequest::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelRequest.channel)
+}
+
+// -------------------------------------------------------------------
+
+// ChannelMessageRequest
+
+// required string channel = 1;
+inline bool ChannelMessageRequest::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ChannelMessageRequest::has_channel() const {
+  return _internal_has_channel();
+}
+inline void ChannelMessageRequest::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ChannelMessageRequest::channel() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelMessageRequest.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelMessageRequest::set_channel(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelMessageRequest.channel)
+}
+inline std::string* ChannelMessageRequest::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelMessageRequest.channel)
+  return _s;
+}
+inline const std::string& ChannelMessageRequest::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void ChannelMessageRequest::_internal_set_channel(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelMessageRequest::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelMessageRequest::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.ChannelMessageRequest.channel)
+  if (!_internal_has_channel()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.channel_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChannelMessageRequest::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelMessageRequest.channel)
+}
+
+// required string message = 2;
+inline bool ChannelMessageRequest::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ChannelMessageRequest::has_message() const {
+  return _internal_has_message();
+}
+inline void ChannelMessageRequest::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ChannelMessageRequest::message() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelMessageRequest.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelMessageRequest::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelMessageRequest.message)
+}
+inline std::string* ChannelMessageRequest::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelMessageRequest.message)
+  return _s;
+}
+inline const std::string& ChannelMessageRequest::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void ChannelMessageRequest::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelMessageRequest::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelMessageRequest::release_message() {
+  // @@protoc_insertion_point(field_release:chat.ChannelMessageRequest.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChannelMessageRequest::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelMessageRequest.message)
+}
+
+// -------------------------------------------------------------------
+
+// ChannelResponse
+
+// required string channel = 1;
+inline bool ChannelResponse::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ChannelResponse::has_channel() const {
+  return _internal_has_channel();
+}
+inline void ChannelResponse::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ChannelResponse::channel() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelResponse.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelResponse::set_channel(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelResponse.channel)
+}
+inline std::string* ChannelResponse::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelResponse.channel)
+  return _s;
+}
+inline const std::string& ChannelResponse::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void ChannelResponse::_internal_set_channel(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelResponse::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelResponse::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.ChannelResponse.channel)
+  if (!_internal_has_channel()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.channel_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChannelResponse::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelResponse.channel)
+}
+
+// required string status = 2;
+inline bool ChannelResponse::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ChannelResponse::has_status() const {
+  return _internal_has_status();
+}
+inline void ChannelResponse::clear_status() {
+  _impl_.status_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ChannelResponse::status() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelResponse.status)
+  return _internal_status();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelResponse::set_status(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.status_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelResponse.status)
+}
+inline std::string* ChannelResponse::mutable_status() {
+  std::string* _s = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelResponse.status)
+  return _s;
+}
+inline const std::string& ChannelResponse::_internal_status() const {
+  return _impl_.status_.Get();
+}
+inline void ChannelResponse::_internal_set_status(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.status_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelResponse::_internal_mutable_status() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.status_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelResponse::release_status() {
+  // @@protoc_insertion_point(field_release:chat.ChannelResponse.status)
+  if (!_internal_has_status()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.status_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_.IsDefault()) {
+    _impl_.status_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChannelResponse::set_allocated_status(std::string* status) {
+  if (status != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.status_.SetAllocated(status, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_.IsDefault()) {
+    _impl_.status_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelResponse.status)
+}
+
+// optional int32 members = 3;
+inline bool ChannelResponse::_internal_has_members() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ChannelResponse::has_members() const {
+  return _internal_has_members();
+}
+inline void ChannelResponse::clear_members() {
+  _impl_.members_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t ChannelResponse::_internal_members() const {
+  return _impl_.members_;
+}
+inline int32_t ChannelResponse::members() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelResponse.members)
+  return _internal_members();
+}
+inline void ChannelResponse::_internal_set_members(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.members_ = value;
+}
+inline void ChannelResponse::set_members(int32_t value) {
+  _internal_set_members(value);
+  // @@protoc_insertion_point(field_set:chat.ChannelResponse.members)
+}
+
+// -------------------------------------------------------------------
+
+// ChannelMessage
+
+// required string channel = 1;
+inline bool ChannelMessage::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ChannelMessage::has_channel() const {
+  return _internal_has_channel();
+}
+inline void ChannelMessage::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ChannelMessage::channel() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelMessage.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelMessage::set_channel(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelMessage.channel)
+}
+inline std::string* ChannelMessage::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelMessage.channel)
+  return _s;
+}
+inline const std::string& ChannelMessage::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void ChannelMessage::_internal_set_channel(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelMessage::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelMessage::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.ChannelMessage.channel)
+  if (!_internal_has_channel()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.channel_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChannelMessage::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelMessage.channel)
+}
+
+// required string message = 2;
+inline bool ChannelMessage::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ChannelMessage::has_message() const {
+  return _internal_has_message();
+}
+inline void ChannelMessage::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ChannelMessage::message() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelMessage.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelMessage::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelMessage.message)
+}
+inline std::string* ChannelMessage::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelMessage.message)
+  return _s;
+}
+inline const std::string& ChannelMessage::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void ChannelMessage::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelMessage::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelMessage::release_message() {
+  // @@protoc_insertion_point(field_release:chat.ChannelMessage.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChannelMessage::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelMessage.message)
+}
+
+// required int32 userId = 3;
+inline bool ChannelMessage::_internal_has_userid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ChannelMessage::has_userid() const {
+  return _internal_has_userid();
+}
+inline void ChannelMessage::clear_userid() {
+  _impl_.userid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t ChannelMessage::_internal_userid() const {
+  return _impl_.userid_;
+}
+inline int32_t ChannelMessage::userid() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelMessage.userId)
+  return _internal_userid();
+}
+inline void ChannelMessage::_internal_set_userid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.userid_ = value;
+}
+inline void ChannelMessage::set_userid(int32_t value) {
+  _internal_set_userid(value);
+  // @@protoc_insertion_point(field_set:chat.ChannelMessage.userId)
+}
+
+// optional string username = 4;
+inline bool ChannelMessage::_internal_has_username() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ChannelMessage::has_username() const {
+  return _internal_has_username();
+}
+inline void ChannelMessage::clear_username() {
+  _impl_.username_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& ChannelMessage::username() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelMessage.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelMessage::set_username(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelMessage.username)
+}
+inline std::string* ChannelMessage::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelMessage.username)
+  return _s;
+}
+inline const std::string& ChannelMessage::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void ChannelMessage::_internal_set_username(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelMessage::_internal_mutable_username() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelMessage::release_username() {
+  // @@protoc_insertion_point(field_release:chat.ChannelMessage.username)
+  if (!_internal_has_username()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.username_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChannelMessage::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelMessage.username)
+}
+
+// -------------------------------------------------------------------
+
+// ServerMessageBatch
+
+// repeated .chat.ServerMessage messages = 1;
+inline int ServerMessageBatch::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int ServerMessageBatch::messages_size() const {
+  return _internal_messages_size();
+}
+inline void ServerMessageBatch::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::chat::ServerMessage* ServerMessageBatch::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessageBatch.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ServerMessage >*
+ServerMessageBatch::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:chat.ServerMessageBatch.messages)
+  return &_impl_.messages_;
+}
+inline const ::chat::ServerMessage& ServerMessageBatch::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::chat::ServerMessage& ServerMessageBatch::messages(int index) const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessageBatch.messages)
+  return _internal_messages(index);
+}
+inline ::chat::ServerMessage* ServerMessageBatch::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::chat::ServerMessage* ServerMessageBatch::add_messages() {
+  ::chat::ServerMessage* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:chat.ServerMessageBatch.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ServerMessage >&
+ServerMessageBatch::messages() const {
+  // @@protoc_insertion_point(field_list:chat.ServerMessageBatch.messages)
+  return _impl_.messages_;
+}
+
+// -------------------------------------------------------------------
+
+// HistoryRequest
+
+// required uint64 after = 1;
+inline bool HistoryRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HistoryRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void HistoryRequest::clear_after() {
+  _impl_.after_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t HistoryRequest::_internal_after() const {
+  return _impl_.after_;
+}
+inline uint64_t HistoryRequest::after() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryRequest.after)
+  return _internal_after();
+}
+inline void HistoryRequest::_internal_set_after(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.after_ = value;
+}
+inline void HistoryRequest::set_after(uint64_t value) {
+  _internal_set_after(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryRequest.after)
+}
+
+// optional uint64 until = 2;
+inline bool HistoryRequest::_internal_has_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool HistoryRequest::has_until() const {
+  return _internal_has_until();
+}
+inline void HistoryRequest::clear_until() {
+  _impl_.until_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t HistoryRequest::_internal_until() const {
+  return _impl_.until_;
+}
+inline uint64_t HistoryRequest::until() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryRequest.until)
+  return _internal_until();
+}
+inline void HistoryRequest::_internal_set_until(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.until_ = value;
+}
+inline void HistoryRequest::set_until(uint64_t value) {
+  _internal_set_until(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryRequest.until)
+}
+
+// -------------------------------------------------------------------
+
+// HistoryResponse
+
+// required uint64 last = 1;
+inline bool HistoryResponse::_internal_has_last() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HistoryResponse::has_last() const {
+  return _internal_has_last();
+}
+inline void HistoryResponse::clear_last() {
+  _impl_.last_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t HistoryResponse::_internal_last() const {
+  return _impl_.last_;
+}
+inline uint64_t HistoryResponse::last() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryResponse.last)
+  return _internal_last();
+}
+inline void HistoryResponse::_internal_set_last(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.last_ = value;
+}
+inline void HistoryResponse::set_last(uint64_t value) {
+  _internal_set_last(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryResponse.last)
+}
+
+// optional bool more = 2;
+inline bool HistoryResponse::_internal_has_more() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool HistoryResponse::has_more() const {
+  return _internal_has_more();
+}
+inline void HistoryResponse::clear_more() {
+  _impl_.more_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool HistoryResponse::_internal_more() const {
+  return _impl_.more_;
+}
+inline bool HistoryResponse::more() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryResponse.more)
+  return _internal_more();
+}
+inline void HistoryResponse::_internal_set_more(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.more_ = value;
+}
+inline void HistoryResponse::set_more(bool value) {
+  _internal_set_more(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryResponse.more)
+}
+
+// optional bool truncated = 3;
+inline bool HistoryResponse::_internal_has_truncated() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool HistoryResponse::has_truncated() const {
+  return _internal_has_truncated();
+}
+inline void HistoryResponse::clear_truncated() {
+  _impl_.truncated_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool HistoryResponse::_internal_truncated() const {
+  return _impl_.truncated_;
+}
+inline bool HistoryResponse::truncated() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryResponse.truncated)
+  return _internal_truncated();
+}
+inline void HistoryResponse::_internal_set_truncated(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.truncated_ = value;
+}
+inline void HistoryResponse::set_truncated(bool value) {
+  _internal_set_truncated(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryResponse.truncated)
+}
+
+// optional int32 messages = 4;
+inline bool HistoryResponse::_internal_has_messages() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool HistoryResponse::has_messages() const {
+  return _internal_has_messages();
+}
+inline void HistoryResponse::clear_messages() {
+  _impl_.messages_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t HistoryResponse::_internal_messages() const {
+  return _impl_.messages_;
+}
+inline int32_t HistoryResponse::messages() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryResponse.messages)
+  return _internal_messages();
+}
+inline void HistoryResponse::_internal_set_messages(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.messages_ = value;
+}
+inline void HistoryResponse::set_messages(int32_t value) {
+  _internal_set_messages(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryResponse.messages)
+}
+
+// -------------------------------------------------------------------
+
+// ErrorResponse
+
+// required string errorMessage = 1;
+inline bool ErrorResponse::_internal_has_errormessage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ErrorResponse::has_errormessage() const {
+  return _internal_has_errormessage();
+}
+inline void ErrorResponse::clear_errormessage() {
+  _impl_.errormessage_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ErrorResponse::errormessage() const {
+  // @@protoc_insertion_point(field_get:chat.ErrorResponse.errorMessage)
+  return _internal_errormessage();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ErrorResponse::set_errormessage(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.errormessage_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ErrorResponse.errorMessage)
+}
+inline std::string* ErrorResponse::mutable_errormessage() {
+  std::string* _s = _internal_mutable_errormessage();
+  // @@protoc_insertion_point(field_mutable:chat.ErrorResponse.errorMessage)
+  return _s;
+}
+inline const std::string& ErrorResponse::_internal_errormessage() const {
+  return _impl_.errormessage_.Get();
+}
+inline void ErrorResponse::_internal_set_errormessage(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.errormessage_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ErrorResponse::_internal_mutable_errormessage() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.errormessage_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ErrorResponse::release_errormessage() {
+  // @@protoc_insertion_point(field_release:chat.ErrorResponse.errorMessage)
+  if (!_internal_has_errormessage()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.errormessage_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.errormessage_.IsDefault()) {
+    _impl_.errormessage_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ErrorResponse::set_allocated_errormessage(std::string* errormessage) {
+  if (errormessage != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.errormessage_.SetAllocated(errormessage, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.errormessage_.IsDefault()) {
+    _impl_.errormessage_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ErrorResponse.errorMessage)
+}
+
+// -------------------------------------------------------------------
+
+// ClientMessage
+
+// required int32 option = 1;
+inline bool ClientMessage::_internal_has_option() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool ClientMessage::has_option() const {
+  return _internal_has_option();
+}
+inline void ClientMessage::clear_option() {
+  _impl_.option_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t ClientMessage::_internal_option() const {
+  return _impl_.option_;
+}
+inline int32_t ClientMessage::option() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.option)
+  return _internal_option();
+}
+inline void ClientMessage::_internal_set_option(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.option_ = value;
+}
+inline void ClientMessage::set_option(int32_t value) {
+  _internal_set_option(value);
+  // @@protoc_insertion_point(field_set:chat.ClientMessage.option)
+}
+
+// optional int32 userId = 2;
+inline bool ClientMessage::_internal_has_userid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool ClientMessage::has_userid() const {
+  return _internal_has_userid();
+}
+inline void ClientMessage::clear_userid() {
+  _impl_.userid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline int32_t ClientMessage::_internal_userid() const {
+  return _impl_.userid_;
+}
+inline int32_t ClientMessage::userid() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.userId)
+  return _internal_userid();
+}
+inline void ClientMessage::_internal_set_userid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.userid_ = value;
+}
+inline void ClientMessage::set_userid(int32_t value) {
+  _internal_set_userid(value);
+  // @@protoc_insertion_point(field_set:chat.ClientMessage.userId)
+}
+
+// optional .chat.MyInfoSynchronize synchronize = 3;
+inline bool ClientMessage::_internal_has_synchronize() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.synchronize_ != nullptr);
+  return value;
+}
+inline bool ClientMessage::has_synchronize() const {
+  return _internal_has_synchronize();
+}
+inline void ClientMessage::clear_synchronize() {
+  if (_impl_.synchronize_ != nullptr) _impl_.synchronize_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::chat::MyInfoSynchronize& ClientMessage::_internal_synchronize() const {
+  const ::chat::MyInfoSynchronize* p = _impl_.synchronize_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::MyInfoSynchronize&>(
+      ::chat::_MyInfoSynchronize_default_instance_);
+}
+inline const ::chat::MyInfoSynchronize& ClientMessage::synchronize() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.synchronize)
+  return _internal_synchronize();
+}
+inline void ClientMessage::unsafe_arena_set_allocated_synchronize(
+    ::chat::MyInfoSynchronize* synchronize) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.synchronize_);
+  }
+  _impl_.synchronize_ = synchronize;
+  if (synchronize) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ClientMessage.synchronize)
+}
+inline ::chat::MyInfoSynchronize* ClientMessage::release_synchronize() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::chat::MyInfoSynchronize* temp = _impl_.synchronize_;
+  _impl_.synchronize_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::MyInfoSynchronize* ClientMessage::unsafe_arena_release_synchronize() {
+  // @@protoc_insertion_point(field_release:chat.ClientMessage.synchronize)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::chat::MyInfoSynchronize* temp = _impl_.synchronize_;
+  _impl_.synchronize_ = nullptr;
+  return temp;
+}
+inline ::chat::MyInfoSynchronize* ClientMessage::_internal_mutable_synchronize() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.synchronize_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::MyInfoSynchronize>(GetArenaForAllocation());
+    _impl_.synchronize_ = p;
+  }
+  return _impl_.synchronize_;
+}
+inline ::chat::MyInfoSynchronize* ClientMessage::mutable_synchronize() {
+  ::chat::MyInfoSynchronize* _msg = _internal_mutable_synchronize();
+  // @@protoc_insertion_point(field_mutable:chat.ClientMessage.synchronize)
+  return _msg;
+}
+inline void ClientMessage::set_allocated_synchronize(::chat::MyInfoSynchronize* synchronize) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.synchronize_;
+  }
+  if (synchronize) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(synchronize);
+    if (message_arena != submessage_arena) {
+      synchronize = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, synchronize, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.synchronize_ = synchronize;
+  // @@protoc_insertion_point(field_set_allocated:chat.ClientMessage.synchronize)
+}
+
+// optional .chat.connectedUserRequest connectedUsers = 4;
+inline bool ClientMessage::_internal_has_connectedusers() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.connectedusers_ != nullptr);
+  return value;
+}
+inline bool ClientMessage::has_connectedusers() const {
+  return _internal_has_connectedusers();
+}
+inline void ClientMessage::clear_connectedusers() {
+  if (_impl_.connectedusers_ != nullptr) _impl_.connectedusers_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::chat::connectedUserRequest& ClientMessage::_internal_connectedusers() const {
+  const ::chat::connectedUserRequest* p = _impl_.connectedusers_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::connectedUserRequest&>(
+      ::chat::_connectedUserRequest_default_instance_);
+}
+inline const ::chat::connectedUserRequest& ClientMessage::connectedusers() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.connectedUsers)
+  return _internal_connectedusers();
+}
+inline void ClientMessage::unsafe_arena_set_allocated_connectedusers(
+    ::chat::connectedUserRequest* connectedusers) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.connectedusers_);
+  }
+  _impl_.connectedusers_ = connectedusers;
+  if (connectedusers) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ClientMessage.connectedUsers)
+}
+inline ::chat::connectedUserRequest* ClientMessage::release_connectedusers() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::chat::connectedUserRequest* temp = _impl_.connectedusers_;
+  _impl_.connectedusers_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::connectedUserRequest* ClientMessage::unsafe_arena_release_connectedusers() {
+  // @@protoc_insertion_point(field_release:chat.ClientMessage.connectedUsers)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::chat::connectedUserRequest* temp = _impl_.connectedusers_;
+  _impl_.connectedusers_ = nullptr;
+  return temp;
+}
+inline ::chat::connectedUserRequest* ClientMessage::_internal_mutable_connectedusers() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.connectedusers_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::connectedUserRequest>(GetArenaForAllocation());
+    _impl_.connectedusers_ = p;
+  }
+  return _impl_.connectedusers_;
+}
+inline ::chat::connectedUserRequest* ClientMessage::mutable_connectedusers() {
+  ::chat::connectedUserRequest* _msg = _internal_mutable_connectedusers();
+  // @@protoc_insertion_point(field_mutable:chat.ClientMessage.connectedUsers)
+  return _msg;
+}
+inline void ClientMessage::set_allocated_connectedusers(::chat::connectedUserRequest* connectedusers) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.connectedusers_;
+  }
+  if (connectedusers) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(connectedusers);
+    if (message_arena != submessage_arena) {
+      connectedusers = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, connectedusers, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.connectedusers_ = connectedusers;
+  // @@protoc_insertion_point(field_set_allocated:chat.ClientMessage.connectedUsers)
+}
+
+// optional .chat.ChangeStatusRequest changeStatus = 5;
+inline bool ClientMessage::_internal_has_changestatus() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.changestatus_ != nullptr);
+  return value;
+}
+inline bool ClientMessage::has_changestatus() const {
+  return _internal_has_changestatus();
+}
+inline void ClientMessage::clear_changestatus() {
+  if (_impl_.changestatus_ != nullptr) _impl_.changestatus_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::chat::ChangeStatusRequest& ClientMessage::_internal_changestatus() const {
+  const ::chat::ChangeStatusRequest* p = _impl_.changestatus_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ChangeStatusRequest&>(
+      ::chat::_ChangeStatusRequest_default_instance_);
+}
+inline const ::chat::ChangeStatusRequest& ClientMessage::changestatus() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.changeStatus)
+  return _internal_changestatus();
+}
+inline void ClientMessage::unsafe_arena_set_allocated_changestatus(
+    ::chat::ChangeStatusRequest* changestatus) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.changestatus_);
+  }
+  _impl_.changestatus_ = changestatus;
+  if (changestatus) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ClientMessage.changeStatus)
+}
+inline ::chat::ChangeStatusRequest* ClientMessage::release_changestatus() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::chat::ChangeStatusRequest* temp = _impl_.changestatus_;
+  _impl_.changestatus_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ChangeStatusRequest* ClientMessage::unsafe_arena_release_changestatus() {
+  // @@protoc_insertion_point(field_release:chat.ClientMessage.changeStatus)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::chat::ChangeStatusRequest* temp = _impl_.changestatus_;
+  _impl_.changestatus_ = nullptr;
+  return temp;
+}
+inline ::chat::ChangeStatusRequest* ClientMessage::_internal_mutable_changestatus() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.changestatus_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ChangeStatusRequest>(GetArenaForAllocation());
+    _impl_.changestatus_ = p;
+  }
+  return _impl_.changestatus_;
+}
+inline ::chat::ChangeStatusRequest* ClientMessage::mutable_changestatus() {
+  ::chat::ChangeStatusRequest* _msg = _internal_mutable_changestatus();
+  // @@protoc_insertion_point(field_mutable:chat.ClientMessage.changeStatus)
+  return _msg;
+}
+inline void ClientMessage::set_allocated_changestatus(::chat::ChangeStatusRequest* changestatus) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.changestatus_;
+  }
+  if (changestatus) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(changestatus);
+    if (message_arena != submessage_arena) {
+      changestatus = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, changestatus, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.changestatus_ = changestatus;
+  // @@protoc_insertion_point(field_set_allocated:chat.ClientMessage.changeStatus)
+}
+
+// optional .chat.BroadcastRequest broadcast = 6;
+inline bool ClientMessage::_internal_has_broadcast() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.broadcast_ != nullptr);
+  return value;
+}
+inline bool ClientMessage::has_broadcast() const {
+  return _internal_has_broadcast();
+}
+inline void ClientMessage::clear_broadcast() {
+  if (_impl_.broadcast_ != nullptr) _impl_.broadcast_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::chat::BroadcastRequest& ClientMessage::_internal_broadcast() const {
+  const ::chat::BroadcastRequest* p = _impl_.broadcast_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::BroadcastRequest&>(
+      ::chat::_BroadcastRequest_default_instance_);
+}
+inline const ::chat::BroadcastRequest& ClientMessage::broadcast() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.broadcast)
+  return _internal_broadcast();
+}
+inline void ClientMessage::unsafe_arena_set_allocated_broadcast(
+    ::chat::BroadcastRequest* broadcast) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.broadcast_);
+  }
+  _impl_.broadcast_ = broadcast;
+  if (broadcast) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ClientMessage.broadcast)
+}
+inline ::chat::BroadcastRequest* ClientMessage::release_broadcast() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::chat::BroadcastRequest* temp = _impl_.broadcast_;
+  _impl_.broadcast_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::BroadcastRequest* ClientMessage::unsafe_arena_release_broadcast() {
+  // @@protoc_insertion_point(field_release:chat.ClientMessage.broadcast)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::chat::BroadcastRequest* temp = _impl_.broadcast_;
+  _impl_.broadcast_ = nullptr;
+  return temp;
+}
+inline ::chat::BroadcastRequest* ClientMessage::_internal_mutable_broadcast() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.broadcast_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::BroadcastRequest>(GetArenaForAllocation());
+    _impl_.broadcast_ = p;
+  }
+  return _impl_.broadcast_;
+}
+inline ::chat::BroadcastRequest* ClientMessage::mutable_broadcast() {
+  ::chat::BroadcastRequest* _msg = _internal_mutable_broadcast();
+  // @@protoc_insertion_point(field_mutable:chat.ClientMessage.broadcast)
+  return _msg;
+}
+inline void ClientMessage::set_allocated_broadcast(::chat::BroadcastRequest* broadcast) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.broadcast_;
+  }
+  if (broadcast) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(broadcast);
+    if (message_arena != submessage_arena) {
+      broadcast = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, broadcast, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.broadcast_ = broadcast;
+  // @@protoc_insertion_point(field_set_allocated:chat.ClientMessage.broadcast)
+}
+
+// optional .chat.DirectMessageRequest directMessage = 7;
+inline bool ClientMessage::_internal_has_directmessage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.directmessage_ != nullptr);
+  return value;
+}
+inline bool ClientMessage::has_directmessage() const {
+  return _internal_has_directmessage();
+}
+inline void ClientMessage::clear_directmessage() {
+  if (_impl_.directmessage_ != nullptr) _impl_.directmessage_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::chat::DirectMessageRequest& ClientMessage::_internal_directmessage() const {
+  const ::chat::DirectMessageRequest* p = _impl_.directmessage_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::DirectMessageRequest&>(
+      ::chat::_DirectMessageRequest_default_instance_);
+}
+inline const ::chat::DirectMessageRequest& ClientMessage::directmessage() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.directMessage)
+  return _internal_directmessage();
+}
+inline void ClientMessage::unsafe_arena_set_allocated_directmessage(
+    ::chat::DirectMessageRequest* directmessage) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.directmessage_);
+  }
+  _impl_.directmessage_ = directmessage;
+  if (directmessage) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ClientMessage.directMessage)
+}
+inline ::chat::DirectMessageRequest* ClientMessage::release_directmessage() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::chat::DirectMessageRequest* temp = _impl_.directmessage_;
+  _impl_.directmessage_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::DirectMessageRequest* ClientMessage::unsafe_arena_release_directmessage() {
+  // @@protoc_insertion_point(field_release:chat.ClientMessage.directMessage)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::chat::DirectMessageRequest* temp = _impl_.directmessage_;
+  _impl_.directmessage_ = nullptr;
+  return temp;
+}
+inline ::chat::DirectMessageRequest* ClientMessage::_internal_mutable_directmessage() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.directmessage_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::DirectMessageRequest>(GetArenaForAllocation());
+    _impl_.directmessage_ = p;
+  }
+  return _impl_.directmessage_;
+}
+inline ::chat::DirectMessageRequest* ClientMessage::mutable_directmessage() {
+  ::chat::DirectMessageRequest* _msg = _internal_mutable_directmessage();
+  // @@protoc_insertion_point(field_mutable:chat.ClientMessage.directMessage)
+  return _msg;
+}
+inline void ClientMessage::set_allocated_directmessage(::chat::DirectMessageRequest* directmessage) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.directmessage_;
+  }
+  if (directmessage) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(directmessage);
+    if (message_arena != submessage_arena) {
+      directmessage = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, directmessage, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.directmessage_ = directmessage;
+  // @@protoc_insertion_point(field_set_allocated:chat.ClientMessage.directMessage)
+}
+
+// optional .chat.MyInfoAcknowledge acknowledge = 8;
+inline bool ClientMessage::_internal_has_acknowledge() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.acknowledge_ != nullptr);
+  return value;
+}
+inline bool ClientMessage::has_acknowledge() const {
+  return _internal_has_acknowledge();
+}
+inline void ClientMessage::clear_acknowledge() {
+  if (_impl_.acknowledge_ != nullptr) _impl_.acknowledge_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::chat::MyInfoAcknowledge& ClientMessage::_internal_acknowledge() const {
+  const ::chat::MyInfoAcknowledge* p = _impl_.acknowledge_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::MyInfoAcknowledge&>(
+      ::chat::_MyInfoAcknowledge_default_instance_);
+}
+inline const ::chat::MyInfoAcknowledge& ClientMessage::acknowledge() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.acknowledge)
+  return _internal_acknowledge();
+}
+inline void ClientMessage::unsafe_arena_set_allocated_acknowledge(
+    ::chat::MyInfoAcknowledge* acknowledge) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.acknowledge_);
+  }
+  _impl_.acknowledge_ = acknowledge;
+  if (acknowledge) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ClientMessage.acknowledge)
+}
+inline ::chat::MyInfoAcknowledge* ClientMessage::release_acknowledge() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::chat::MyInfoAcknowledge* temp = _impl_.acknowledge_;
+  _impl_.acknowledge_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::MyInfoAcknowledge* ClientMessage::unsafe_arena_release_acknowledge() {
+  // @@protoc_insertion_point(field_release:chat.ClientMessage.acknowledge)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::chat::MyInfoAcknowledge* temp = _impl_.acknowledge_;
+  _impl_.acknowledge_ = nullptr;
+  return temp;
+}
+inline ::chat::MyInfoAcknowledge* ClientMessage::_internal_mutable_acknowledge() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.acknowledge_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::MyInfoAcknowledge>(GetArenaForAllocation());
+    _impl_.acknowledge_ = p;
+  }
+  return _impl_.acknowledge_;
+}
+inline ::chat::MyInfoAcknowledge* ClientMessage::mutable_acknowledge() {
+  ::chat::MyInfoAcknowledge* _msg = _internal_mutable_acknowledge();
+  // @@protoc_insertion_point(field_mutable:chat.ClientMessage.acknowledge)
+  return _msg;
+}
+inline void ClientMessage::set_allocated_acknowledge(::chat::MyInfoAcknowledge* acknowledge) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.acknowledge_;
+  }
+  if (acknowledge) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(acknowledge);
+    if (message_arena != submessage_arena) {
+      acknowledge = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, acknowledge, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.acknowledge_ = acknowledge;
+  // @@protoc_insertion_point(field_set_allocated:chat.ClientMessage.acknowledge)
+}
+
+// optional .chat.PresenceRequest presence = 9;
+inline bool ClientMessage::_internal_has_presence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.presence_ != nullptr);
+  return value;
+}
+inline bool ClientMessage::has_presence() const {
+  return _internal_has_presence();
+}
+inline void ClientMessage::clear_presence() {
+  if (_impl_.presence_ != nullptr) _impl_.presence_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::chat::PresenceRequest& ClientMessage::_internal_presence() const {
+  const ::chat::PresenceRequest* p = _impl_.presence_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::PresenceRequest&>(
+      ::chat::_PresenceRequest_default_instance_);
+}
+inline const ::chat::PresenceRequest& ClientMessage::presence() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.presence)
+  return _internal_presence();
+}
+inline void ClientMessage::unsafe_arena_set_allocated_presence(
+    ::chat::PresenceRequest* presence) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.presence_);
+  }
+  _impl_.presence_ = presence;
+  if (presence) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ClientMessage.presence)
+}
+inline ::chat::PresenceRequest* ClientMessage::release_presence() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::chat::PresenceRequest* temp = _impl_.presence_;
+  _impl_.presence_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::PresenceRequest* ClientMessage::unsafe_arena_release_presence() {
+  // @@protoc_insertion_point(field_release:chat.ClientMessage.presence)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::chat::PresenceRequest* temp = _impl_.presence_;
+  _impl_.presence_ = nullptr;
+  return temp;
+}
+inline ::chat::PresenceRequest* ClientMessage::_internal_mutable_presence() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.presence_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::PresenceRequest>(GetArenaForAllocation());
+    _impl_.presence_ = p;
+  }
+  return _impl_.presence_;
+}
+inline ::chat::PresenceRequest* ClientMessage::mutable_presence() {
+  ::chat::PresenceRequest* _msg = _internal_mutable_presence();
+  // @@protoc_insertion_point(field_mutable:chat.ClientMessage.presence)
+  return _msg;
+}
+inline void ClientMessage::set_allocated_presence(::chat::PresenceRequest* presence) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.presence_;
+  }
+  if (presence) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(presence);
+    if (message_arena != submessage_arena) {
+      presence = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, presence, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.presence_ = presence;
+  // @@protoc_insertion_point(field_set_allocated:chat.ClientMessage.presence)
+}
+
+// optional .chat.ChannelRequest channel = 10;
+inline bool ClientMessage::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.channel_ != nullptr);
+  return value;
+}
+inline bool ClientMessage::has_channel() const {
+  return _internal_has_channel();
+}
+inline void ClientMessage::clear_channel() {
+  if (_impl_.channel_ != nullptr) _impl_.channel_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::chat::ChannelRequest& ClientMessage::_internal_channel() const {
+  const ::chat::ChannelRequest* p = _impl_.channel_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ChannelRequest&>(
+      ::chat::_ChannelRequest_default_instance_);
+}
+inline const ::chat::ChannelRequest& ClientMessage::channel() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.channel)
+  return _internal_channel();
+}
+inline void ClientMessage::unsafe_arena_set_allocated_channel(
+    ::chat::ChannelRequest* channel) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channel_);
+  }
+  _impl_.channel_ = channel;
+  if (channel) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ClientMessage.channel)
+}
+inline ::chat::ChannelRequest* ClientMessage::release_channel() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::chat::ChannelRequest* temp = _impl_.channel_;
+  _impl_.channel_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ChannelRequest* ClientMessage::unsafe_arena_release_channel() {
+  // @@protoc_insertion_point(field_release:chat.ClientMessage.channel)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::chat::ChannelRequest* temp = _impl_.channel_;
+  _impl_.channel_ = nullptr;
+  return temp;
+}
+inline ::chat::ChannelRequest* ClientMessage::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.channel_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ChannelRequest>(GetArenaForAllocation());
+    _impl_.channel_ = p;
+  }
+  return _impl_.channel_;
+}
+inline ::chat::ChannelRequest* ClientMessage::mutable_channel() {
+  ::chat::ChannelRequest* _msg = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.ClientMessage.channel)
+  return _msg;
+}
+inline void ClientMessage::set_allocated_channel(::chat::ChannelRequest* channel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channel_;
+  }
+  if (channel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channel);
+    if (message_arena != submessage_arena) {
+      channel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channel, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.channel_ = channel;
+  // @@protoc_insertion_point(field_set_allocated:chat.ClientMessage.channel)
+}
+
+// optional .chat.ChannelMessageRequest channelMessage = 11;
+inline bool ClientMessage::_internal_has_channelmessage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.channelmessage_ != nullptr);
+  return value;
+}
+inline bool ClientMessage::has_channelmessage() const {
+  return _internal_has_channelmessage();
+}
+inline void ClientMessage::clear_channelmessage() {
+  if (_impl_.channelmessage_ != nullptr) _impl_.channelmessage_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const ::chat::ChannelMessageRequest& ClientMessage::_internal_channelmessage() const {
+  const ::chat::ChannelMessageRequest* p = _impl_.channelmessage_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ChannelMessageRequest&>(
+      ::chat::_ChannelMessageRequest_default_instance_);
+}
+inline const ::chat::ChannelMessageRequest& ClientMessage::channelmessage() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.channelMessage)
+  return _internal_channelmessage();
+}
+inline void ClientMessage::unsafe_arena_set_allocated_channelmessage(
+    ::chat::ChannelMessageRequest* channelmessage) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channelmessage_);
+  }
+  _impl_.channelmessage_ = channelmessage;
+  if (channelmessage) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ClientMessage.channelMessage)
+}
+inline ::chat::ChannelMessageRequest* ClientMessage::release_channelmessage() {
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::chat::ChannelMessageRequest* temp = _impl_.channelmessage_;
+  _impl_.channelmessage_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ChannelMessageRequest* ClientMessage::unsafe_arena_release_channelmessage() {
+  // @@protoc_insertion_point(field_release:chat.ClientMessage.channelMessage)
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::chat::ChannelMessageRequest* temp = _impl_.channelmessage_;
+  _impl_.channelmessage_ = nullptr;
+  return temp;
+}
+inline ::chat::ChannelMessageRequest* ClientMessage::_internal_mutable_channelmessage() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.channelmessage_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ChannelMessageRequest>(GetArenaForAllocation());
+    _impl_.channelmessage_ = p;
+  }
+  return _impl_.channelmessage_;
+}
+inline ::chat::ChannelMessageRequest* ClientMessage::mutable_channelmessage() {
+  ::chat::ChannelMessageRequest* _msg = _internal_mutable_channelmessage();
+  // @@protoc_insertion_point(field_mutable:chat.ClientMessage.channelMessage)
+  return _msg;
+}
+inline void ClientMessage::set_allocated_channelmessage(::chat::ChannelMessageRequest* channelmessage) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channelmessage_;
+  }
+  if (channelmessage) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channelmessage);
+    if (message_arena != submessage_arena) {
+      channelmessage = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channelmessage, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  _impl_.channelmessage_ = channelmessage;
+  // @@protoc_insertion_point(field_set_allocated:chat.ClientMessage.channelMessage)
+}
+
+// optional .chat.HistoryRequest history = 12;
+inline bool ClientMessage::_internal_has_history() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.history_ != nullptr);
+  return value;
+}
+inline bool ClientMessage::has_history() const {
+  return _internal_has_history();
+}
+inline void ClientMessage::clear_history() {
+  if (_impl_.history_ != nullptr) _impl_.history_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline const ::chat::HistoryRequest& ClientMessage::_internal_history() const {
+  const ::chat::HistoryRequest* p = _impl_.history_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::HistoryRequest&>(
+      ::chat::_HistoryRequest_default_instance_);
+}
+inline const ::chat::HistoryRequest& ClientMessage::history() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.history)
+  return _internal_history();
+}
+inline void ClientMessage::unsafe_arena_set_allocated_history(
+    ::chat::HistoryRequest* history) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.history_);
+  }
+  _impl_.history_ = history;
+  if (history) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ClientMessage.history)
+}
+inline ::chat::HistoryRequest* ClientMessage::release_history() {
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::chat::HistoryRequest* temp = _impl_.history_;
+  _impl_.history_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::HistoryRequest* ClientMessage::unsafe_arena_release_history() {
+  // @@protoc_insertion_point(field_release:chat.ClientMessage.history)
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::chat::HistoryRequest* temp = _impl_.history_;
+  _impl_.history_ = nullptr;
+  return temp;
+}
+inline ::chat::HistoryRequest* ClientMessage::_internal_mutable_history() {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.history_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::HistoryRequest>(GetArenaForAllocation());
+    _impl_.history_ = p;
+  }
+  return _impl_.history_;
+}
+inline ::chat::HistoryRequest* ClientMessage::mutable_history() {
+  ::chat::HistoryRequest* _msg = _internal_mutable_history();
+  // @@protoc_insertion_point(field_mutable:chat.ClientMessage.history)
+  return _msg;
+}
+inline void ClientMessage::set_allocated_history(::chat::HistoryRequest* history) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.history_;
+  }
+  if (history) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(history);
+    if (message_arena != submessage_arena) {
+      history = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, history, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  _impl_.history_ = history;
+  // @@protoc_insertion_point(field_set_allocated:chat.ClientMessage.history)
+}
+
+// optional uint32 requestId = 13;
+inline bool ClientMessage::_internal_has_requestid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool ClientMessage::has_requestid() const {
+  return _internal_has_requestid();
+}
+inline void ClientMessage::clear_requestid() {
+  _impl_.requestid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint32_t ClientMessage::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline uint32_t ClientMessage::requestid() const {
+  // @@protoc_insertion_point(field_get:chat.ClientMessage.requestId)
+  return _internal_requestid();
+}
+inline void ClientMessage::_internal_set_requestid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.requestid_ = value;
+}
+inline void ClientMessage::set_requestid(uint32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:chat.ClientMessage.requestId)
+}
+
+// -------------------------------------------------------------------
+
+// ServerMessage
+
+// required int32 option = 1;
+inline bool ServerMessage::_internal_has_option() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool ServerMessage::has_option() const {
+  return _internal_has_option();
+}
+inline void ServerMessage::clear_option() {
+  _impl_.option_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline int32_t ServerMessage::_internal_option() const {
+  return _impl_.option_;
+}
+inline int32_t ServerMessage::option() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.option)
+  return _internal_option();
+}
+inline void ServerMessage::_internal_set_option(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.option_ = value;
+}
+inline void ServerMessage::set_option(int32_t value) {
+  _internal_set_option(value);
+  // @@protoc_insertion_point(field_set:chat.ServerMessage.option)
+}
+
+// optional .chat.BroadcastMessage broadcast = 2;
+inline bool ServerMessage::_internal_has_broadcast() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.broadcast_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_broadcast() const {
+  return _internal_has_broadcast();
+}
+inline void ServerMessage::clear_broadcast() {
+  if (_impl_.broadcast_ != nullptr) _impl_.broadcast_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::chat::BroadcastMessage& ServerMessage::_internal_broadcast() const {
+  const ::chat::BroadcastMessage* p = _impl_.broadcast_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::BroadcastMessage&>(
+      ::chat::_BroadcastMessage_default_instance_);
+}
+inline const ::chat::BroadcastMessage& ServerMessage::broadcast() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.broadcast)
+  return _internal_broadcast();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_broadcast(
+    ::chat::BroadcastMessage* broadcast) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.broadcast_);
+  }
+  _impl_.broadcast_ = broadcast;
+  if (broadcast) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.broadcast)
+}
+inline ::chat::BroadcastMessage* ServerMessage::release_broadcast() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::chat::BroadcastMessage* temp = _impl_.broadcast_;
+  _impl_.broadcast_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::BroadcastMessage* ServerMessage::unsafe_arena_release_broadcast() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.broadcast)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::chat::BroadcastMessage* temp = _impl_.broadcast_;
+  _impl_.broadcast_ = nullptr;
+  return temp;
+}
+inline ::chat::BroadcastMessage* ServerMessage::_internal_mutable_broadcast() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.broadcast_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::BroadcastMessage>(GetArenaForAllocation());
+    _impl_.broadcast_ = p;
+  }
+  return _impl_.broadcast_;
+}
+inline ::chat::BroadcastMessage* ServerMessage::mutable_broadcast() {
+  ::chat::BroadcastMessage* _msg = _internal_mutable_broadcast();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.broadcast)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_broadcast(::chat::BroadcastMessage* broadcast) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.broadcast_;
+  }
+  if (broadcast) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(broadcast);
+    if (message_arena != submessage_arena) {
+      broadcast = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, broadcast, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.broadcast_ = broadcast;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.broadcast)
+}
+
+// optional .chat.DirectMessage message = 3;
+inline bool ServerMessage::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.message_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_message() const {
+  return _internal_has_message();
+}
+inline void ServerMessage::clear_message() {
+  if (_impl_.message_ != nullptr) _impl_.message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::chat::DirectMessage& ServerMessage::_internal_message() const {
+  const ::chat::DirectMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::DirectMessage&>(
+      ::chat::_DirectMessage_default_instance_);
+}
+inline const ::chat::DirectMessage& ServerMessage::message() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.message)
+  return _internal_message();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_message(
+    ::chat::DirectMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.message)
+}
+inline ::chat::DirectMessage* ServerMessage::release_message() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::chat::DirectMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::DirectMessage* ServerMessage::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.message)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::chat::DirectMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::chat::DirectMessage* ServerMessage::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::DirectMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::chat::DirectMessage* ServerMessage::mutable_message() {
+  ::chat::DirectMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.message)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_message(::chat::DirectMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.message_;
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(message);
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.message)
+}
+
+// optional .chat.ErrorResponse error = 4;
+inline bool ServerMessage::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.error_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_error() const {
+  return _internal_has_error();
+}
+inline void ServerMessage::clear_error() {
+  if (_impl_.error_ != nullptr) _impl_.error_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::chat::ErrorResponse& ServerMessage::_internal_error() const {
+  const ::chat::ErrorResponse* p = _impl_.error_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ErrorResponse&>(
+      ::chat::_ErrorResponse_default_instance_);
+}
+inline const ::chat::ErrorResponse& ServerMessage::error() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.error)
+  return _internal_error();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_error(
+    ::chat::ErrorResponse* error) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.error_);
+  }
+  _impl_.error_ = error;
+  if (error) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.error)
+}
+inline ::chat::ErrorResponse* ServerMessage::release_error() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::chat::ErrorResponse* temp = _impl_.error_;
+  _impl_.error_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ErrorResponse* ServerMessage::unsafe_arena_release_error() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.error)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::chat::ErrorResponse* temp = _impl_.error_;
+  _impl_.error_ = nullptr;
+  return temp;
+}
+inline ::chat::ErrorResponse* ServerMessage::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.error_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ErrorResponse>(GetArenaForAllocation());
+    _impl_.error_ = p;
+  }
+  return _impl_.error_;
+}
+inline ::chat::ErrorResponse* ServerMessage::mutable_error() {
+  ::chat::ErrorResponse* _msg = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.error)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_error(::chat::ErrorResponse* error) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.error_;
+  }
+  if (error) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(error);
+    if (message_arena != submessage_arena) {
+      error = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, error, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.error_ = error;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.error)
+}
+
+// optional .chat.MyInfoResponse myInfoResponse = 5;
+inline bool ServerMessage::_internal_has_myinforesponse() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.myinforesponse_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_myinforesponse() const {
+  return _internal_has_myinforesponse();
+}
+inline void ServerMessage::clear_myinforesponse() {
+  if (_impl_.myinforesponse_ != nullptr) _impl_.myinforesponse_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::chat::MyInfoResponse& ServerMessage::_internal_myinforesponse() const {
+  const ::chat::MyInfoResponse* p = _impl_.myinforesponse_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::MyInfoResponse&>(
+      ::chat::_MyInfoResponse_default_instance_);
+}
+inline const ::chat::MyInfoResponse& ServerMessage::myinforesponse() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.myInfoResponse)
+  return _internal_myinforesponse();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_myinforesponse(
+    ::chat::MyInfoResponse* myinforesponse) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.myinforesponse_);
+  }
+  _impl_.myinforesponse_ = myinforesponse;
+  if (myinforesponse) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.myInfoResponse)
+}
+inline ::chat::MyInfoResponse* ServerMessage::release_myinforesponse() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::chat::MyInfoResponse* temp = _impl_.myinforesponse_;
+  _impl_.myinforesponse_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::MyInfoResponse* ServerMessage::unsafe_arena_release_myinforesponse() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.myInfoResponse)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::chat::MyInfoResponse* temp = _impl_.myinforesponse_;
+  _impl_.myinforesponse_ = nullptr;
+  return temp;
+}
+inline ::chat::MyInfoResponse* ServerMessage::_internal_mutable_myinforesponse() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.myinforesponse_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::MyInfoResponse>(GetArenaForAllocation());
+    _impl_.myinforesponse_ = p;
+  }
+  return _impl_.myinforesponse_;
+}
+inline ::chat::MyInfoResponse* ServerMessage::mutable_myinforesponse() {
+  ::chat::MyInfoResponse* _msg = _internal_mutable_myinforesponse();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.myInfoResponse)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_myinforesponse(::chat::MyInfoResponse* myinforesponse) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.myinforesponse_;
+  }
+  if (myinforesponse) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(myinforesponse);
+    if (message_arena != submessage_arena) {
+      myinforesponse = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, myinforesponse, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.myinforesponse_ = myinforesponse;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.myInfoResponse)
+}
+
+// optional .chat.ConnectedUserResponse connectedUserResponse = 6;
+inline bool ServerMessage::_internal_has_connecteduserresponse() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.connecteduserresponse_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_connecteduserresponse() const {
+  return _internal_has_connecteduserresponse();
+}
+inline void ServerMessage::clear_connecteduserresponse() {
+  if (_impl_.connecteduserresponse_ != nullptr) _impl_.connecteduserresponse_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::chat::ConnectedUserResponse& ServerMessage::_internal_connecteduserresponse() const {
+  const ::chat::ConnectedUserResponse* p = _impl_.connecteduserresponse_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ConnectedUserResponse&>(
+      ::chat::_ConnectedUserResponse_default_instance_);
+}
+inline const ::chat::ConnectedUserResponse& ServerMessage::connecteduserresponse() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.connectedUserResponse)
+  return _internal_connecteduserresponse();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_connecteduserresponse(
+    ::chat::ConnectedUserResponse* connecteduserresponse) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.connecteduserresponse_);
+  }
+  _impl_.connecteduserresponse_ = connecteduserresponse;
+  if (connecteduserresponse) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.connectedUserResponse)
+}
+inline ::chat::ConnectedUserResponse* ServerMessage::release_connecteduserresponse() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::chat::ConnectedUserResponse* temp = _impl_.connecteduserresponse_;
+  _impl_.connecteduserresponse_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ConnectedUserResponse* ServerMessage::unsafe_arena_release_connecteduserresponse() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.connectedUserResponse)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::chat::ConnectedUserResponse* temp = _impl_.connecteduserresponse_;
+  _impl_.connecteduserresponse_ = nullptr;
+  return temp;
+}
+inline ::chat::ConnectedUserResponse* ServerMessage::_internal_mutable_connecteduserresponse() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.connecteduserresponse_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ConnectedUserResponse>(GetArenaForAllocation());
+    _impl_.connecteduserresponse_ = p;
+  }
+  return _impl_.connecteduserresponse_;
+}
+inline ::chat::ConnectedUserResponse* ServerMessage::mutable_connecteduserresponse() {
+  ::chat::ConnectedUserResponse* _msg = _internal_mutable_connecteduserresponse();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.connectedUserResponse)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_connecteduserresponse(::chat::ConnectedUserResponse* connecteduserresponse) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.connecteduserresponse_;
+  }
+  if (connecteduserresponse) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(connecteduserresponse);
+    if (message_arena != submessage_arena) {
+      connecteduserresponse = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, connecteduserresponse, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.connecteduserresponse_ = connecteduserresponse;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.connectedUserResponse)
+}
+
+// optional .chat.ChangeStatusResponse changeStatusResponse = 7;
+inline bool ServerMessage::_internal_has_changestatusresponse() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.changestatusresponse_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_changestatusresponse() const {
+  return _internal_has_changestatusresponse();
+}
+inline void ServerMessage::clear_changestatusresponse() {
+  if (_impl_.changestatusresponse_ != nullptr) _impl_.changestatusresponse_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::chat::ChangeStatusResponse& ServerMessage::_internal_changestatusresponse() const {
+  const ::chat::ChangeStatusResponse* p = _impl_.changestatusresponse_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ChangeStatusResponse&>(
+      ::chat::_ChangeStatusResponse_default_instance_);
+}
+inline const ::chat::ChangeStatusResponse& ServerMessage::changestatusresponse() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.changeStatusResponse)
+  return _internal_changestatusresponse();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_changestatusresponse(
+    ::chat::ChangeStatusResponse* changestatusresponse) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.changestatusresponse_);
+  }
+  _impl_.changestatusresponse_ = changestatusresponse;
+  if (changestatusresponse) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.changeStatusResponse)
+}
+inline ::chat::ChangeStatusResponse* ServerMessage::release_changestatusresponse() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::chat::ChangeStatusResponse* temp = _impl_.changestatusresponse_;
+  _impl_.changestatusresponse_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ChangeStatusResponse* ServerMessage::unsafe_arena_release_changestatusresponse() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.changeStatusResponse)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::chat::ChangeStatusResponse* temp = _impl_.changestatusresponse_;
+  _impl_.changestatusresponse_ = nullptr;
+  return temp;
+}
+inline ::chat::ChangeStatusResponse* ServerMessage::_internal_mutable_changestatusresponse() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.changestatusresponse_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ChangeStatusResponse>(GetArenaForAllocation());
+    _impl_.changestatusresponse_ = p;
+  }
+  return _impl_.changestatusresponse_;
+}
+inline ::chat::ChangeStatusResponse* ServerMessage::mutable_changestatusresponse() {
+  ::chat::ChangeStatusResponse* _msg = _internal_mutable_changestatusresponse();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.changeStatusResponse)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_changestatusresponse(::chat::ChangeStatusResponse* changestatusresponse) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.changestatusresponse_;
+  }
+  if (changestatusresponse) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(changestatusresponse);
+    if (message_arena != submessage_arena) {
+      changestatusresponse = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, changestatusresponse, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.changestatusresponse_ = changestatusresponse;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.changeStatusResponse)
+}
+
+// optional .chat.BroadcastResponse broadcastResponse = 8;
+inline bool ServerMessage::_internal_has_broadcastresponse() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.broadcastresponse_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_broadcastresponse() const {
+  return _internal_has_broadcastresponse();
+}
+inline void ServerMessage::clear_broadcastresponse() {
+  if (_impl_.broadcastresponse_ != nullptr) _impl_.broadcastresponse_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::chat::BroadcastResponse& ServerMessage::_internal_broadcastresponse() const {
+  const ::chat::BroadcastResponse* p = _impl_.broadcastresponse_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::BroadcastResponse&>(
+      ::chat::_BroadcastResponse_default_instance_);
+}
+inline const ::chat::BroadcastResponse& ServerMessage::broadcastresponse() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.broadcastResponse)
+  return _internal_broadcastresponse();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_broadcastresponse(
+    ::chat::BroadcastResponse* broadcastresponse) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.broadcastresponse_);
+  }
+  _impl_.broadcastresponse_ = broadcastresponse;
+  if (broadcastresponse) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.broadcastResponse)
+}
+inline ::chat::BroadcastResponse* ServerMessage::release_broadcastresponse() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::chat::BroadcastResponse* temp = _impl_.broadcastresponse_;
+  _impl_.broadcastresponse_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::BroadcastResponse* ServerMessage::unsafe_arena_release_broadcastresponse() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.broadcastResponse)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::chat::BroadcastResponse* temp = _impl_.broadcastresponse_;
+  _impl_.broadcastresponse_ = nullptr;
+  return temp;
+}
+inline ::chat::BroadcastResponse* ServerMessage::_internal_mutable_broadcastresponse() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.broadcastresponse_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::BroadcastResponse>(GetArenaForAllocation());
+    _impl_.broadcastresponse_ = p;
+  }
+  return _impl_.broadcastresponse_;
+}
+inline ::chat::BroadcastResponse* ServerMessage::mutable_broadcastresponse() {
+  ::chat::BroadcastResponse* _msg = _internal_mutable_broadcastresponse();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.broadcastResponse)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_broadcastresponse(::chat::BroadcastResponse* broadcastresponse) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.broadcastresponse_;
+  }
+  if (broadcastresponse) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(broadcastresponse);
+    if (message_arena != submessage_arena) {
+      broadcastresponse = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, broadcastresponse, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.broadcastresponse_ = broadcastresponse;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.broadcastResponse)
+}
+
+// optional .chat.DirectMessageResponse directMessageResponse = 9;
+inline bool ServerMessage::_internal_has_directmessageresponse() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.directmessageresponse_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_directmessageresponse() const {
+  return _internal_has_directmessageresponse();
+}
+inline void ServerMessage::clear_directmessageresponse() {
+  if (_impl_.directmessageresponse_ != nullptr) _impl_.directmessageresponse_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::chat::DirectMessageResponse& ServerMessage::_internal_directmessageresponse() const {
+  const ::chat::DirectMessageResponse* p = _impl_.directmessageresponse_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::DirectMessageResponse&>(
+      ::chat::_DirectMessageResponse_default_instance_);
+}
+inline const ::chat::DirectMessageResponse& ServerMessage::directmessageresponse() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.directMessageResponse)
+  return _internal_directmessageresponse();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_directmessageresponse(
+    ::chat::DirectMessageResponse* directmessageresponse) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.directmessageresponse_);
+  }
+  _impl_.directmessageresponse_ = directmessageresponse;
+  if (directmessageresponse) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.directMessageResponse)
+}
+inline ::chat::DirectMessageResponse* ServerMessage::release_directmessageresponse() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::chat::DirectMessageResponse* temp = _impl_.directmessageresponse_;
+  _impl_.directmessageresponse_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::DirectMessageResponse* ServerMessage::unsafe_arena_release_directmessageresponse() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.directMessageResponse)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::chat::DirectMessageResponse* temp = _impl_.directmessageresponse_;
+  _impl_.directmessageresponse_ = nullptr;
+  return temp;
+}
+inline ::chat::DirectMessageResponse* ServerMessage::_internal_mutable_directmessageresponse() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.directmessageresponse_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::DirectMessageResponse>(GetArenaForAllocation());
+    _impl_.directmessageresponse_ = p;
+  }
+  return _impl_.directmessageresponse_;
+}
+inline ::chat::DirectMessageResponse* ServerMessage::mutable_directmessageresponse() {
+  ::chat::DirectMessageResponse* _msg = _internal_mutable_directmessageresponse();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.directMessageResponse)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_directmessageresponse(::chat::DirectMessageResponse* directmessageresponse) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.directmessageresponse_;
+  }
+  if (directmessageresponse) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(directmessageresponse);
+    if (message_arena != submessage_arena) {
+      directmessageresponse = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, directmessageresponse, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.directmessageresponse_ = directmessageresponse;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.directMessageResponse)
+}
+
+// optional .chat.ServerMessageBatch batch = 10;
+inline bool ServerMessage::_internal_has_batch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.batch_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_batch() const {
+  return _internal_has_batch();
+}
+inline void ServerMessage::clear_batch() {
+  if (_impl_.batch_ != nullptr) _impl_.batch_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const ::chat::ServerMessageBatch& ServerMessage::_internal_batch() const {
+  const ::chat::ServerMessageBatch* p = _impl_.batch_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ServerMessageBatch&>(
+      ::chat::_ServerMessageBatch_default_instance_);
+}
+inline const ::chat::ServerMessageBatch& ServerMessage::batch() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.batch)
+  return _internal_batch();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_batch(
+    ::chat::ServerMessageBatch* batch) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.batch_);
+  }
+  _impl_.batch_ = batch;
+  if (batch) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.batch)
+}
+inline ::chat::ServerMessageBatch* ServerMessage::release_batch() {
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::chat::ServerMessageBatch* temp = _impl_.batch_;
+  _impl_.batch_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ServerMessageBatch* ServerMessage::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.batch)
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::chat::ServerMessageBatch* temp = _impl_.batch_;
+  _impl_.batch_ = nullptr;
+  return temp;
+}
+inline ::chat::ServerMessageBatch* ServerMessage::_internal_mutable_batch() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.batch_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ServerMessageBatch>(GetArenaForAllocation());
+    _impl_.batch_ = p;
+  }
+  return _impl_.batch_;
+}
+inline ::chat::ServerMessageBatch* ServerMessage::mutable_batch() {
+  ::chat::ServerMessageBatch* _msg = _internal_mutable_batch();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.batch)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_batch(::chat::ServerMessageBatch* batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.batch_;
+  }
+  if (batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(batch);
+    if (message_arena != submessage_arena) {
+      batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  _impl_.batch_ = batch;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.batch)
+}
+
+// optional .chat.PresenceUpdate presence = 11;
+inline bool ServerMessage::_internal_has_presence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.presence_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_presence() const {
+  return _internal_has_presence();
+}
+inline void ServerMessage::clear_presence() {
+  if (_impl_.presence_ != nullptr) _impl_.presence_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline const ::chat::PresenceUpdate& ServerMessage::_internal_presence() const {
+  const ::chat::PresenceUpdate* p = _impl_.presence_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::PresenceUpdate&>(
+      ::chat::_PresenceUpdate_default_instance_);
+}
+inline const ::chat::PresenceUpdate& ServerMessage::presence() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.presence)
+  return _internal_presence();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_presence(
+    ::chat::PresenceUpdate* presence) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.presence_);
+  }
+  _impl_.presence_ = presence;
+  if (presence) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.presence)
+}
+inline ::chat::PresenceUpdate* ServerMessage::release_presence() {
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::chat::PresenceUpdate* temp = _impl_.presence_;
+  _impl_.presence_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::PresenceUpdate* ServerMessage::unsafe_arena_release_presence() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.presence)
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::chat::PresenceUpdate* temp = _impl_.presence_;
+  _impl_.presence_ = nullptr;
+  return temp;
+}
+inline ::chat::PresenceUpdate* ServerMessage::_internal_mutable_presence() {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.presence_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::PresenceUpdate>(GetArenaForAllocation());
+    _impl_.presence_ = p;
+  }
+  return _impl_.presence_;
+}
+inline ::chat::PresenceUpdate* ServerMessage::mutable_presence() {
+  ::chat::PresenceUpdate* _msg = _internal_mutable_presence();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.presence)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_presence(::chat::PresenceUpdate* presence) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.presence_;
+  }
+  if (presence) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(presence);
+    if (message_arena != submessage_arena) {
+      presence = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, presence, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  _impl_.presence_ = presence;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.presence)
+}
+
+// optional .chat.ChannelResponse channelResponse = 12;
+inline bool ServerMessage::_internal_has_channelresponse() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.channelresponse_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_channelresponse() const {
+  return _internal_has_channelresponse();
+}
+inline void ServerMessage::clear_channelresponse() {
+  if (_impl_.channelresponse_ != nullptr) _impl_.channelresponse_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline const ::chat::ChannelResponse& ServerMessage::_internal_channelresponse() const {
+  const ::chat::ChannelResponse* p = _impl_.channelresponse_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ChannelResponse&>(
+      ::chat::_ChannelResponse_default_instance_);
+}
+inline const ::chat::ChannelResponse& ServerMessage::channelresponse() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.channelResponse)
+  return _internal_channelresponse();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_channelresponse(
+    ::chat::ChannelResponse* channelresponse) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channelresponse_);
+  }
+  _impl_.channelresponse_ = channelresponse;
+  if (channelresponse) {
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.channelResponse)
+}
+inline ::chat::ChannelResponse* ServerMessage::release_channelresponse() {
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::chat::ChannelResponse* temp = _impl_.channelresponse_;
+  _impl_.channelresponse_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ChannelResponse* ServerMessage::unsafe_arena_release_channelresponse() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.channelResponse)
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::chat::ChannelResponse* temp = _impl_.channelresponse_;
+  _impl_.channelresponse_ = nullptr;
+  return temp;
+}
+inline ::chat::ChannelResponse* ServerMessage::_internal_mutable_channelresponse() {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  if (_impl_.channelresponse_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ChannelResponse>(GetArenaForAllocation());
+    _impl_.channelresponse_ = p;
+  }
+  return _impl_.channelresponse_;
+}
+inline ::chat::ChannelResponse* ServerMessage::mutable_channelresponse() {
+  ::chat::ChannelResponse* _msg = _internal_mutable_channelresponse();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.channelResponse)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_channelresponse(::chat::ChannelResponse* channelresponse) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channelresponse_;
+  }
+  if (channelresponse) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channelresponse);
+    if (message_arena != submessage_arena) {
+      channelresponse = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channelresponse, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+  _impl_.channelresponse_ = channelresponse;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.channelResponse)
+}
+
+// optional .chat.ChannelMessage channelMessage = 13;
+inline bool ServerMessage::_internal_has_channelmessage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.channelmessage_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_channelmessage() const {
+  return _internal_has_channelmessage();
+}
+inline void ServerMessage::clear_channelmessage() {
+  if (_impl_.channelmessage_ != nullptr) _impl_.channelmessage_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline const ::chat::ChannelMessage& ServerMessage::_internal_channelmessage() const {
+  const ::chat::ChannelMessage* p = _impl_.channelmessage_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::ChannelMessage&>(
+      ::chat::_ChannelMessage_default_instance_);
+}
+inline const ::chat::ChannelMessage& ServerMessage::channelmessage() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.channelMessage)
+  return _internal_channelmessage();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_channelmessage(
+    ::chat::ChannelMessage* channelmessage) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channelmessage_);
+  }
+  _impl_.channelmessage_ = channelmessage;
+  if (channelmessage) {
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.channelMessage)
+}
+inline ::chat::ChannelMessage* ServerMessage::release_channelmessage() {
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::chat::ChannelMessage* temp = _impl_.channelmessage_;
+  _impl_.channelmessage_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::ChannelMessage* ServerMessage::unsafe_arena_release_channelmessage() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.channelMessage)
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::chat::ChannelMessage* temp = _impl_.channelmessage_;
+  _impl_.channelmessage_ = nullptr;
+  return temp;
+}
+inline ::chat::ChannelMessage* ServerMessage::_internal_mutable_channelmessage() {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  if (_impl_.channelmessage_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::ChannelMessage>(GetArenaForAllocation());
+    _impl_.channelmessage_ = p;
+  }
+  return _impl_.channelmessage_;
+}
+inline ::chat::ChannelMessage* ServerMessage::mutable_channelmessage() {
+  ::chat::ChannelMessage* _msg = _internal_mutable_channelmessage();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.channelMessage)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_channelmessage(::chat::ChannelMessage* channelmessage) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channelmessage_;
+  }
+  if (channelmessage) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channelmessage);
+    if (message_arena != submessage_arena) {
+      channelmessage = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channelmessage, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+  _impl_.channelmessage_ = channelmessage;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.channelMessage)
+}
+
+// optional .chat.HistoryResponse history = 14;
+inline bool ServerMessage::_internal_has_history() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.history_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_history() const {
+  return _internal_has_history();
+}
+inline void ServerMessage::clear_history() {
+  if (_impl_.history_ != nullptr) _impl_.history_->Clear();
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline const ::chat::HistoryResponse& ServerMessage::_internal_history() const {
+  const ::chat::HistoryResponse* p = _impl_.history_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::HistoryResponse&>(
+      ::chat::_HistoryResponse_default_instance_);
+}
+inline const ::chat::HistoryResponse& ServerMessage::history() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.history)
+  return _internal_history();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_history(
+    ::chat::HistoryResponse* history) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.history_);
+  }
+  _impl_.history_ = history;
+  if (history) {
+    _impl_._has_bits_[0] |= 0x00001000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00001000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerMessage.history)
+}
+inline ::chat::HistoryResponse* ServerMessage::release_history() {
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::chat::HistoryResponse* temp = _impl_.history_;
+  _impl_.history_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::HistoryResponse* ServerMessage::unsafe_arena_release_history() {
+  // @@protoc_insertion_point(field_release:chat.ServerMessage.history)
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::chat::HistoryResponse* temp = _impl_.history_;
+  _impl_.history_ = nullptr;
+  return temp;
+}
+inline ::chat::HistoryResponse* ServerMessage::_internal_mutable_history() {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  if (_impl_.history_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::HistoryResponse>(GetArenaForAllocation());
+    _impl_.history_ = p;
+  }
+  return _impl_.history_;
+}
+inline ::chat::HistoryResponse* ServerMessage::mutable_history() {
+  ::chat::HistoryResponse* _msg = _internal_mutable_history();
+  // @@protoc_insertion_point(field_mutable:chat.ServerMessage.history)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_history(::chat::HistoryResponse* history) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.history_;
+  }
+  if (history) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(history);
+    if (message_arena != submessage_arena) {
+      history = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, history, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00001000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00001000u;
+  }
+  _impl_.history_ = history;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerMessage.history)
+}
+
+// optional uint32 requestId = 15;
+inline bool ServerMessage::_internal_has_requestid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool ServerMessage::has_requestid() const {
+  return _internal_has_requestid();
+}
+inline void ServerMessage::clear_requestid() {
+  _impl_.requestid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint32_t ServerMessage::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline uint32_t ServerMessage::requestid() const {
+  // @@protoc_insertion_point(field_get:chat.ServerMessage.requestId)
+  return _internal_requestid();
+}
+inline void ServerMessage::_internal_set_requestid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.requestid_ = value;
+}
+inline void ServerMessage::set_requestid(uint32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:chat.ServerMessage.requestId)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace chat
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_mensaje_2eproto
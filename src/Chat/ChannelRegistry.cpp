@@ -0,0 +1,138 @@
+#include <algorithm>
+#include "Chat.h"
+
+/*
+* Copy on write index of channel members. Every channel has an immutable member list, a post
+* takes the current list and fans out to it without locking. Joins and leaves build the next
+* list of that channel under _write_mutex and swap it in atomically, the table of channels is
+* only copied when a channel is created or its last member leaves.
+*/
+
+/*
+* Members of channel name. returns an empty pointer if nobody is in it
+*/
+member_list channel_table::find( const string &name ) const {
+    unordered_map<string, shared_ptr<channel> >::const_iterator it = channels.find( name );
+    return it != channels.end() ? atomic_load( &it->second->members ) : member_list();
+}
+
+ChannelRegistry::ChannelRegistry() {
+    pthread_mutex_init( &_write_mutex, NULL );
+    _current = channel_snapshot( new channel_table );
+}
+
+/*
+* Current members of channel. The list never changes, it stays valid while it is held
+*/
+member_list ChannelRegistry::members( const string &channel ) const {
+    return atomic_load( &_current )->find( channel );
+}
+
+/*
+* Add cl to channel, the channel is created by its first member
+* returns the number of members or -1 if cl is already in the channel
+*/
+int ChannelRegistry::join( const string &name, const client_info &cl ) {
+    pthread_mutex_lock( &_write_mutex );
+    vector<string> &joined = _by_user[ cl.id ];
+    if( find( joined.begin(), joined.end(), name ) != joined.end() ) {
+        pthread_mutex_unlock( &_write_mutex );
+        return -1;
+    }
+    joined.push_back( name );
+
+    unordered_map<string, shared_ptr<channel> >::const_iterator it = _current->channels.find( name );
+    int res;
+    if( it == _current->channels.end() ) {
+        shared_ptr<channel> ch( new channel );
+        ch->members = member_list( new channel_members( 1, cl ) );
+        shared_ptr<channel_table> next( new channel_table( *_current ) );
+        next->channels[ name ] = ch;
+        atomic_store( &_current, channel_snapshot( next ) );
+        res = 1;
+    } else {
+        member_list old = it->second->members;
+        shared_ptr<channel_members> members( new channel_members );
+        members->reserve( old->size() + 1 );
+        members->assign( old->begin(), old->end() );
+        members->push_back( cl );
+        atomic_store( &it->second->members, member_list( members ) );
+        res = members->size();
+    }
+    pthread_mutex_unlock( &_write_mutex );
+    return res;
+}
+
+/*
+* Remove user id from channel
+* returns the number of members left or -1 if the user is not in the channel
+*/
+int ChannelRegistry::leave( const string &name, int id ) {
+    pthread_mutex_lock( &_write_mutex );
+    vector<string> &joined = _by_user[ id ];
+    vector<string>::iterator it = find( joined.begin(), joined.end(), name );
+    if( it == joined.end() ) {
+        if( joined.empty() )
+            _by_user.erase( id );
+        pthread_mutex_unlock( &_write_mutex );
+        return -1;
+    }
+    joined.erase( it );
+    if( joined.empty() )
+        _by_user.erase( id );
+
+    shared_ptr<channel_table> next;
+    remove_member( name, id, &next );
+    if( next )
+        atomic_store( &_current, channel_snapshot( next ) );
+    member_list left = _current->find( name );
+    int res = left ? left->size() : 0;
+    pthread_mutex_unlock( &_write_mutex );
+    return res;
+}
+
+/*
+* Remove user id from every channel it joined, used when it disconnects
+*/
+void ChannelRegistry::leave_all( int id ) {
+    pthread_mutex_lock( &_write_mutex );
+    unordered_map<int, vector<string> >::iterator joined = _by_user.find( id );
+    if( joined == _by_user.end() ) {
+        pthread_mutex_unlock( &_write_mutex );
+        return;
+    }
+
+    shared_ptr<channel_table> next;
+    for( size_t i = 0; i < joined->second.size(); i++ )
+        remove_member( joined->second[ i ], id, &next );
+    _by_user.erase( joined );
+    if( next )
+        atomic_store( &_current, channel_snapshot( next ) );
+    pthread_mutex_unlock( &_write_mutex );
+}
+
+/*
+* Swap in a member list of channel name without user id. The last member removes the channel
+* from a copy of the table kept in next, published by the caller. Must be called with _write_mutex held
+*/
+void ChannelRegistry::remove_member( const string &name, int id, shared_ptr<channel_table> *next ) {
+    const channel_table *table = *next ? next->get() : _current.get();
+    unordered_map<string, shared_ptr<channel> >::const_iterator it = table->channels.find( name );
+    if( it == table->channels.end() )
+        return;
+
+    member_list old = it->second->members;
+    if( old->size() <= 1 ) {
+        if( !*next )
+            *next = shared_ptr<channel_table>( new channel_table( *_current ) );
+        ( *next )->channels.erase( name );
+        return;
+    }
+    shared_ptr<channel_members> members( new channel_members );
+    members->reserve( old->size() - 1 );
+    for( size_t i = 0; i < old->size(); i++ ) {
+        if( ( *old )[ i ].id != id )
+            members->push_back( ( *old )[ i ] );
+    }
+    atomic_store( &it->second->members, member_list( members ) );
+}
@@ -6,12 +6,50 @@ Client::Client( char * username, FILE *log_level ) {
     _user_id = -1;
     _sock = -1;
     _close_issued = 0;
-    pthread_mutex_init(  &_noti_queue_mutex, NULL );
+    _presence = 1;
+    _presence_version = 0;
+    _presence_stale = 0;
+    _users_paging = 0;
+    _last_sequence = 0;
+    _history_after = 0;
+    _history_until = 0;
+    _listening = 0;
+    _nonblocking = 0;
+    _state = CLIENT_DISCONNECTED;
+    _out_off = 0;
+    _resuming = 0;
+    _resume_cursor = 0;
+    _has_local = 0;
+    _reconnect_base_ms = 0;
+    _reconnect_max_ms = 0;
+    _backoff_attempt = 0;
+    _retry_us = 0;
+    _jitter_seed = ( unsigned )monotonic_ns() ^ ( unsigned )( uintptr_t )this;
+    _on_message = NULL;
+    _on_message_context = NULL;
+    _dropped.store( 0 );
+    _users_updates.store( 0 );
+    _rings.store( NULL );
+    _noti_fd.store( -1 );
+    _next_request = 1;
+    pthread_mutex_init( &_pending_mutex, NULL );
+    pthread_mutex_init( &_cursor_mutex, NULL );
     pthread_mutex_init( &_stop_mutex, NULL );
     pthread_mutex_init( &_connected_users_mutex, NULL );
+    pthread_mutex_init( &_send_mutex, NULL );
     pthread_mutex_init( &_error_queue_mutex, NULL );
     _username = username;
-    _log_level = log_level;
+    log_init( log_level );
+}
+
+/*
+* Stop the session and free the rings and the notify fd
+*/
+Client::~Client() {
+    stop_session();
+    delete[] _rings.load();
+    if( _noti_fd.load() >= 0 )
+        close( _noti_fd.load() );
 }
 
 /*
@@ -19,165 +57,745 @@ Client::Client( char * username, FILE *log_level ) {
 * returns 0 on succes -1 on error
 */
 int Client::connect_server(char *server_address, int server_port) {
-    /* Create socket */
-    fprintf(_log_level,"INFO: Creating socket\n");
-    if( ( _sock = socket(AF_INET, SOCK_STREAM, 0) ) < 0 ) {
-        fprintf(_log_level,"ERROR: Error on socket creation");
-        return -1;
-    }
-
     /* Save server info on ds*/
-    fprintf(_log_level, "DEBUG: Saving server info\n");
+    LOG_DEBUG( "Saving server info\n" );
     _serv_addr.sin_family = AF_INET; 
     _serv_addr.sin_port = htons(server_port); // Convert to host byte order
-    fprintf(_log_level,"Converting to network address");
+    LOG_DEBUG( "Converting to network address" );
     if(  inet_pton(AF_INET, server_address, &_serv_addr.sin_addr) <= 0 ) { // Convert ti network address
-        fprintf(_log_level,"ERROR: Invalid server address\n");
+        LOG_ERROR( "Invalid server address\n" );
         return -1;
     }
 
     /* Set up connection */
-    fprintf(_log_level,"INFO: Setting up connection\n");
-    if( connect(_sock, (struct sockaddr *)&_serv_addr, sizeof(_serv_addr)) < 0 ) {
-        fprintf(_log_level,"ERROR: Unable to connect to server\n");
+    LOG_INFO( "Setting up connection\n" );
+    return start_connect();
+}
+
+/*
+* Start connecting to serv without blocking, from local when it is not NULL. The connection and
+* the log in go on in on_writable and on_readable, requests made before the log in ends are
+* sent right after it
+* returns 0 on succes -1 on error
+*/
+int Client::connect_async( const struct sockaddr_in *serv, const struct sockaddr_in *local ) {
+    _serv_addr = *serv;
+    _has_local = local != NULL;
+    if( _has_local )
+        _local_addr = *local;
+    _nonblocking = 1;
+    if( start_connect() < 0 ) {
+        close_connection();
+        return -1;
+    }
+    return 0;
+}
+
+/*
+* Open a new socket to _serv_addr from the local address if there is one. Blocking clients
+* wait for the connection, non-blocking ones finish it in on_writable
+* returns 0 on succes -1 on error
+*/
+int Client::start_connect() {
+    int sock = socket( AF_INET, SOCK_STREAM | SOCK_CLOEXEC | ( _nonblocking ? SOCK_NONBLOCK : 0 ), 0 );
+    if( sock < 0 ) {
+        LOG_ERROR( "Error on socket creation\n" );
+        return -1;
+    }
+    if( _has_local && bind( sock, (struct sockaddr *)&_local_addr, sizeof( _local_addr ) ) < 0 ) {
+        LOG_ERROR( "Unable to bind local address: %s\n", strerror( errno ) );
+        close( sock );
+        return -1;
+    }
+    if( connect( sock, (struct sockaddr *)&_serv_addr, sizeof( _serv_addr ) ) < 0 && ( !_nonblocking || errno != EINPROGRESS ) ) {
+        LOG_ERROR( "Unable to connect to server: %s\n", strerror( errno ) );
+        close( sock );
         return -1;
     }
 
+    /* stop_session shuts down whatever socket it finds under the send mutex */
+    pthread_mutex_lock( &_send_mutex );
+    _sock = sock;
+    _state = _nonblocking ? CLIENT_CONNECTING : CLIENT_SYNCING;
+    pthread_mutex_unlock( &_send_mutex );
     return 0;
 }
 
 /*
-* Log in to server using username
-* Return 0 on succes -1 on error
+* Reconnect after a lost connection, waiting base_ms doubled on every failed attempt up to
+* max_ms. Each wait is a random time below that, so clients that lost a server together do not
+* come back together. Only sessions that were logged in reconnect, a base_ms of 0 (the default)
+* turns it off
 */
-int Client::log_in() {
+void Client::set_reconnect( long base_ms, long max_ms ) {
+    _reconnect_base_ms = base_ms;
+    _reconnect_max_ms = max( base_ms, max_ms );
+}
 
-    /* Step 1: Sync option 1 */
-    fprintf(_log_level,"DEBUG: Building log in request\n");
-    MyInfoSynchronize * my_info(new MyInfoSynchronize);
-    my_info->set_username(_username);
+/*
+* Milliseconds until on_timeout has to be called, -1 when nothing is scheduled
+*/
+long Client::next_timeout() {
+    if( _state != CLIENT_RECONNECTING )
+        return -1;
+    long wait_us = _retry_us - monotonic_us();
+    return wait_us > 0 ? ( wait_us + 999 ) / 1000 : 0;
+}
 
-    ClientMessage msg;
-    msg.set_option( SYNCHRONIZED );
-    msg.set_allocated_synchronize(my_info);
+/*
+* Start the next reconnection attempt of a non-blocking client once its backoff is over,
+* fd() is then a new socket to wait on
+* returns 0 on succes -1 if the attempt failed, the next one is scheduled
+*/
+int Client::on_timeout() {
+    if( _state != CLIENT_RECONNECTING || monotonic_us() < _retry_us )
+        return 0;
+    LOG_INFO( "Reconnecting to server\n" );
+    if( start_connect() < 0 ) {
+        lose_connection();
+        return -1;
+    }
+    return 0;
+}
 
-    /* Sending sync request to server */
-    send_request( msg );
+/*
+* Time to wait before the next reconnection attempt: random below the base doubled once per
+* failed attempt, capped
+*/
+long Client::backoff_us() {
+    long cap = _reconnect_base_ms << min( _backoff_attempt, 20 );
+    cap = min( cap, _reconnect_max_ms );
+    _backoff_attempt++;
+    return ( long )( rand_r( &_jitter_seed ) / ( RAND_MAX + 1.0 ) * cap * 1000 );
+}
 
-    /* Step 2: Read ack from server */
-    fprintf(_log_level,"DEBUG: Waiting for server ack\n");
-    char ack_res[ MESSAGE_SIZE ];
-    int rack_res_sz = read_message( ack_res );
-    ServerMessage res = parse_response( ack_res );
+/*
+* The connection failed or the server closed it. A session that was logged in, with reconnect
+* on, waits a backoff and connects again: the requests sent on the lost connection fail, the
+* held ones wait for the new session. Otherwise the connection is closed for good
+*/
+void Client::lose_connection() {
+    /* Only a successful log in sets the user id */
+    if( _reconnect_base_ms <= 0 || _user_id < 0 || get_stopped_status() ) {
+        close_connection();
+        return;
+    }
+    long delay = backoff_us();
+    pthread_mutex_lock( &_send_mutex );
+    if( _sock >= 0 )
+        close( _sock );
+    _sock = -1;
+    _state = CLIENT_RECONNECTING;
+    _out.clear();
+    _out_off = 0;
+    _retry_us = monotonic_us() + delay;
+    pthread_mutex_unlock( &_send_mutex );
+    _in_frames = FrameBuffer();
+    LOG_INFO( "Connection lost, reconnecting in %ld ms\n", delay / 1000 );
+    fail_requests( "Connection lost", 1 );
+    notify();
+}
+
+/*
+* Reconnect a blocking client from its listener thread, sleeping the backoff between attempts
+* returns 0 once logged in again -1 if reconnect is off or the session was stopped
+*/
+int Client::reconnect_blocking() {
+    lose_connection();
+    while( _state == CLIENT_RECONNECTING && !get_stopped_status() ) {
+        long wait_us = _retry_us - monotonic_us();
+        if( wait_us > 0 ) {
+            /* Short sleeps so stop_session is not kept waiting */
+            usleep( min( wait_us, 100000L ) );
+            continue;
+        }
+        if( start_connect() == 0 && !get_stopped_status() && log_in() == 0 )
+            return 0;
+        lose_connection();
+    }
+    return -1;
+}
+
+/*
+* Socket of the connection, -1 when there is none
+*/
+int Client::fd() {
+    return _sock;
+}
+
+/*
+* Where the connection is
+*/
+client_state Client::state() {
+    return _state;
+}
+
+/*
+* Events to wait for on fd(): POLLIN always, POLLOUT while connecting or while requests wait
+* for the socket. The values are the same for epoll
+*/
+short Client::poll_events() {
+    short events = POLLIN;
+    pthread_mutex_lock( &_send_mutex );
+    if( _state == CLIENT_CONNECTING || _out_off < _out.size() )
+        events |= POLLOUT;
+    pthread_mutex_unlock( &_send_mutex );
+    return events;
+}
 
-    fprintf(_log_level,"INFO: Checking for response option\n");
+/*
+* Fill msg with the log in request, resuming the previous session when there was one
+*/
+void Client::build_sync( ClientMessage *msg ) {
+    LOG_DEBUG( "Building log in request\n" );
+    MyInfoSynchronize *my_info = msg->mutable_synchronize();
+    my_info->set_username(_username);
+    my_info->set_batch( true );
+    my_info->set_presence( _presence != 0 );
+
+    /* A new session starts with the status of the previous one */
+    pthread_mutex_lock( &_send_mutex );
+    if( !_status.empty() )
+        my_info->set_status( _status );
+    pthread_mutex_unlock( &_send_mutex );
+
+    /* Resume the previous session, the server replays what was missed after the cursor */
+    pthread_mutex_lock( &_cursor_mutex );
+    _resuming = !_resume_token.empty();
+    _resume_cursor = _history_until > _history_after ? _history_after : _last_sequence;
+    if( _resuming ) {
+        my_info->set_resumetoken( _resume_token );
+        my_info->set_lastsequence( _resume_cursor );
+    }
+    pthread_mutex_unlock( &_cursor_mutex );
+
+    msg->set_option( SYNCHRONIZED );
+}
+
+/*
+* Take the server response to the log in request, send the ACK and the held requests
+* returns 0 on succes -1 on error
+*/
+int Client::accept_login( const ServerMessage &res ) {
+    LOG_INFO( "Checking for response option\n" );
     if( res.option() == ERROR ) {
-        fprintf(_log_level,"ERROR: Server returned error: %s\n", res.error().errormessage().c_str());
+        LOG_ERROR( "Server returned error: %s\n", res.error().errormessage().c_str() );
+        add_error( res.error() );
         return -1;
     } else if( res.option() != MYINFORESPONSE ){
-        fprintf(_log_level,"ERROR: Unexpected response from server\n");
+        LOG_ERROR( "Unexpected response from server\n" );
         return -1;
     }
 
-    fprintf(_log_level,"DEBUG: User id was returned by server %d\n",res.myinforesponse().userid() );
+    LOG_DEBUG( "User id was returned by server %d\n",res.myinforesponse().userid() );
     _user_id = res.myinforesponse().userid() ;
 
-    /* Step 3: Send ack to server */
-    // TODO MyInfoAcknowledge Not defined on protocol
-    MyInfoAcknowledge * my_info_ack(new MyInfoAcknowledge);
-    my_info_ack->set_userid(_user_id);
+    /* Messages up to sequence come from the replay, later ones live */
+    pthread_mutex_lock( &_cursor_mutex );
+    const MyInfoResponse &info = res.myinforesponse();
+    if( info.has_resumetoken() )
+        _resume_token = info.resumetoken();
+    if( _resuming && info.sequence() >= _resume_cursor ) {
+        _history_after = _resume_cursor;
+        _history_until = info.sequence();
+    } else {
+        /* A restarted server numbers its messages from the start again */
+        _last_sequence = _resuming ? info.sequence() : max( _last_sequence, ( unsigned long )info.sequence() );
+        _history_after = _history_until = _last_sequence;
+    }
+    pthread_mutex_unlock( &_cursor_mutex );
+    _backoff_attempt = 0;
+
+    /* Step 3: Send ack to server, resumed sessions do not */
+    string batch;
+    if( !_resuming ) {
+        ClientMessage res_ack;
+        res_ack.mutable_acknowledge()->set_userid(_user_id);
+        res_ack.set_option( ACKNOWLEDGE );
+        string srl;
+        res_ack.SerializeToString( &srl );
+        encode_frame( srl, &batch );
+    }
 
-    ClientMessage res_ack;
-    res_ack.set_allocated_acknowledge( my_info_ack );
-    res_ack.set_option( ACKNOWLEDGE );
+    /* The ACK, the channels of a previous session and the held requests go in one write */
+    pthread_mutex_lock( &_send_mutex );
+    restore_frames( &batch );
+    batch.append( _held );
+    _held.clear();
+    _held_ids.clear();
+    _state = CLIENT_ESTABLISHED;
+    int res_cd = 0;
+    if( _nonblocking ) {
+        _out.append( batch );
+    } else {
+        res_cd = write_all( _sock, batch.data(), batch.size() );
+    }
+    pthread_mutex_unlock( &_send_mutex );
+    if( res_cd < 0 )
+        return -1;
+    return _nonblocking ? flush_output() : 0;
+}
 
-    send_request(res_ack);
+/*
+* Keep the status and channels the server confirmed, a new session gets them back after a reconnect
+*/
+void Client::track_session( const ServerMessage &res ) {
+    pthread_mutex_lock( &_send_mutex );
+    if( res.option() == CHANGESTATUSRESPONSE ) {
+        _status = res.changestatusresponse().status();
+    } else if( res.channelresponse().status() == "joined" ) {
+        _channels.insert( res.channelresponse().channel() );
+    } else if( res.channelresponse().status() == "left" ) {
+        _channels.erase( res.channelresponse().channel() );
+    }
+    pthread_mutex_unlock( &_send_mutex );
+}
 
+/*
+* Append to out the joins that give a new session the channels the previous ones had, the server
+* starts every session without channels. The status goes in the log in request.
+* Called with the send mutex held
+*/
+void Client::restore_frames( string *out ) {
+    ClientMessage req;
+    req.set_option( JOINCHANNEL );
+    string srl;
+    set<string>::iterator it;
+    for( it = _channels.begin(); it != _channels.end(); it++ ) {
+        req.mutable_channel()->set_channel( *it );
+        req.SerializeToString( &srl );
+        encode_frame( srl, out );
+    }
+}
+
+/*
+* Log in to server using username, blocks until the server answers
+* Return 0 on succes -1 on error
+*/
+int Client::log_in() {
+
+    /* Step 1: Sync option 1 */
+    ClientMessage msg;
+    build_sync( &msg );
+
+    /* Sending sync request to server */
+    string srl, frame;
+    msg.SerializeToString( &srl );
+    encode_frame( srl, &frame );
+    if( send_frame( frame, 1 ) < 0 ) {
+        LOG_ERROR( "Unable to send log in request\n" );
+        return -1;
+    }
+
+    /* Step 2: Read ack from server */
+    LOG_DEBUG( "Waiting for server ack\n" );
+    string ack_res;
+    if( read_message( &ack_res ) <= 0 ) {
+        LOG_ERROR( "No response from server\n" );
+        return -1;
+    }
+    return accept_login( parse_response( ack_res ) );
+}
+
+/*
+* Continue the connection once the socket is writable: finish connecting and send the log in
+* request, then write the requests that did not fit in the socket
+* returns 0 on succes -1 if the connection failed, it is closed or reconnecting
+*/
+int Client::on_writable() {
+    if( _state == CLIENT_CONNECTING ) {
+        int err = 0;
+        socklen_t len = sizeof( err );
+        if( getsockopt( _sock, SOL_SOCKET, SO_ERROR, &err, &len ) < 0 || err != 0 ) {
+            LOG_ERROR( "Unable to connect to server: %s\n", strerror( err ) );
+            lose_connection();
+            return -1;
+        }
+        _state = CLIENT_SYNCING;
+        ClientMessage msg;
+        build_sync( &msg );
+        string srl, frame;
+        msg.SerializeToString( &srl );
+        encode_frame( srl, &frame );
+        if( send_frame( frame, 1 ) < 0 ) {
+            lose_connection();
+            return -1;
+        }
+        return 0;
+    }
+    if( flush_output() < 0 ) {
+        lose_connection();
+        return -1;
+    }
+    return 0;
+}
+
+/*
+* Read everything the socket has and handle the complete messages
+* returns 0 on succes -1 if the connection was closed or failed, it is closed or reconnecting
+*/
+int Client::on_readable() {
+    while( _sock >= 0 ) {
+        int rec_sz = _in_frames.read_from( _sock );
+        if( rec_sz < 0 && errno == EINTR )
+            continue;
+        if( rec_sz < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) )
+            return 0;
+        if( rec_sz <= 0 ) {
+            LOG_INFO( "Server disconnected\n" );
+            lose_connection();
+            return -1;
+        }
+
+        string res;
+        int frame_st;
+        while( ( frame_st = _in_frames.next_frame( &res ) ) > 0 ) {
+            if( handle_frame( res ) < 0 ) {
+                lose_connection();
+                return -1;
+            }
+        }
+        if( frame_st < 0 ) {
+            LOG_ERROR( "Invalid frame received from server\n" );
+            lose_connection();
+            return -1;
+        }
+        /* A short read emptied the socket */
+        if( rec_sz < MESSAGE_SIZE )
+            return 0;
+    }
+    return -1;
+}
+
+/*
+* Handle one message read by on_readable, the first one answers the log in
+* returns 0 on succes -1 on error
+*/
+int Client::handle_frame( const string &frame ) {
+    ServerMessage res = parse_response( frame );
+    if( _state == CLIENT_SYNCING )
+        return accept_login( res );
+    dispatch_response( res );
     return 0;
 }
 
 /*
-* Get all connected users to server
-* returns client message with request details
+* Close the socket and fail the requests waiting for a response
+*/
+void Client::close_connection() {
+    pthread_mutex_lock( &_send_mutex );
+    if( _sock >= 0 )
+        close( _sock );
+    _sock = -1;
+    _state = CLIENT_CLOSED;
+    _out.clear();
+    _out_off = 0;
+    _held.clear();
+    _held_ids.clear();
+    pthread_mutex_unlock( &_send_mutex );
+    fail_requests( "Connection closed", 0 );
+    notify();
+}
+
+/*
+* Ask for the presence stream at log in (the default). Without it the connected users are only
+* known after a connected users request, which saves a snapshot and every join, leave and status
+* change of the server for sessions that never show them
+*/
+void Client::set_presence( int enabled ) {
+    _presence = enabled;
+}
+
+/*
+* Deliver received messages to cb on the thread that reads them instead of the rings
+*/
+void Client::set_message_handler( message_cb cb, void *context ) {
+    _on_message = cb;
+    _on_message_context = context;
+}
+
+/*
+* Get all connected users to server. Nothing is sent while the presence stream keeps
+* the local list current, a snapshot is requested after a missed delta.
+* returns 0 if the local list is current, 1 if it was requested, -1 on error
 */
 int Client::get_connected_request() {
+    pthread_mutex_lock( &_connected_users_mutex );
+    unsigned long version = _presence_version;
+    int stale = _presence_stale;
+    pthread_mutex_unlock( &_connected_users_mutex );
+    if( version > 0 && !stale ) {
+        return 0;
+    }
+
+    /* Without the presence stream the list is fetched page by page */
+    if( !stale ) {
+        return request_users_page( "" ) < 0 ? -1 : 1;
+    }
+
     /* Build request */
-    fprintf(_log_level,"DEBUG: Building connected request\n");
-    connectedUserRequest * msg(new connectedUserRequest);
-    msg->set_userid( 0 );
-    
+    LOG_DEBUG( "Building connected request\n" );
     ClientMessage req;
-    req.set_option( CONNECTEDUSER );
-    req.set_allocated_connectedusers( msg );
-    
+    req.set_option( PRESENCEREQUEST );
+    req.mutable_presence()->set_version( version );
+
     if( send_request( req ) < 0 ) {
-        fprintf( _log_level, "ERROR: Unable to send request\n" );
+        LOG_ERROR( "Unable to send request\n" );
+        return -1;
     }
 
+    return 1;
+}
+
+/*
+* Ask for the page of connected users after cursor, the first page if cursor is empty
+* returns 0 on succes -1 on error
+*/
+int Client::request_users_page( const string &cursor ) {
+    ClientMessage req;
+    req.set_option( CONNECTEDUSER );
+    connectedUserRequest *msg = req.mutable_connectedusers();
+    msg->set_userid( 0 );
+    if( !cursor.empty() )
+        msg->set_cursor( cursor );
+
+    if( send_request( req ) < 0 ) {
+        LOG_ERROR( "Unable to send request\n" );
+        return -1;
+    }
     return 0;
 }
 
 /*
-* Parse the connected users on a connected_clients map
+* Apply a page of connected users in place, the users missing from the whole listing are removed
+* once the last page arrives and the consumer is notified. The next page is requested right away
 */
-map <string, connected_user> Client::parse_connected_users( ConnectedUserResponse c_usr ) {
-    /* Save connected users */
-    fprintf(_log_level, "DEBUG: Parsing connected users sent by server\n");
-    map <string, connected_user> c_users;
-    int i;
-    for( i = 0; i < c_usr.connectedusers().size(); i++ ) {
-        ConnectedUser rec_user = c_usr.connectedusers().at( i );
-        struct connected_user lst_users;
-        lst_users.name = rec_user.username();
-        lst_users.id = rec_user.userid();
-        lst_users.status = rec_user.status();
-        lst_users.ip = rec_user.status();
-        c_users[ rec_user.username() ] = lst_users;
+void Client::parse_connected_users( const ConnectedUserResponse &c_usr ) {
+    pthread_mutex_lock( &_connected_users_mutex );
+    if( !_users_paging ) {
+        _connected_users.begin_refresh();
+        _users_paging = 1;
+    }
+    load_connected_users( c_usr );
+    if( !c_usr.has_nextcursor() ) {
+        _connected_users.end_refresh();
+        _users_paging = 0;
+    }
+    pthread_mutex_unlock( &_connected_users_mutex );
+
+    if( c_usr.has_nextcursor() ) {
+        request_users_page( c_usr.nextcursor() );
+    } else {
+        _users_updates.fetch_add( 1 );
+        notify();
     }
-    set_connected_users( c_users );
-    return c_users;
+}
+
+/*
+* Move the replay cursor past a page of missed messages and ask for the next one until the
+* sequence the server had at log in is reached
+*/
+void Client::next_history_page( const HistoryResponse &page ) {
+    if( page.truncated() ) {
+        LOG_INFO( "Some missed messages are no longer kept by the server\n" );
+    }
+    pthread_mutex_lock( &_cursor_mutex );
+    _history_after = max( _history_after, ( unsigned long )page.last() );
+    if( !page.more() )
+        _history_after = _history_until;
+    unsigned long after = _history_after, until = _history_until;
+    pthread_mutex_unlock( &_cursor_mutex );
+    if( after >= until )
+        return;
+
+    ClientMessage req;
+    req.set_option( HISTORYREQUEST );
+    req.mutable_history()->set_after( after );
+    req.mutable_history()->set_until( until );
+    if( send_request( req ) < 0 ) {
+        LOG_ERROR( "Unable to send request\n" );
+    }
+}
+
+/*
+* Add or update the users of c_usr, must be called with _connected_users_mutex held
+*/
+void Client::load_connected_users( const ConnectedUserResponse &c_usr ) {
+    LOG_DEBUG( "Parsing connected users sent by server\n" );
+    for( int i = 0; i < c_usr.connectedusers_size(); i++ ) {
+        _connected_users.put( c_usr.connectedusers( i ) );
+    }
+}
+
+/*
+* Apply a presence update to the connected users. A snapshot replaces the whole list,
+* deltas are applied in place when they follow the local version. Old deltas are
+* ignored and a gap marks the map stale so the next listing asks for a snapshot.
+*/
+void Client::apply_presence( const PresenceUpdate &up ) {
+    pthread_mutex_lock( &_connected_users_mutex );
+    if( up.has_snapshot() ) {
+        _connected_users.begin_refresh();
+        load_connected_users( up.snapshot() );
+        _connected_users.end_refresh();
+        _presence_version = up.version();
+        _presence_stale = 0;
+        _users_updates.fetch_add( 1 );
+    } else if( _presence_version == 0 || up.version() <= _presence_version ) {
+        /* Waiting for the first snapshot or already included */
+    } else if( up.baseversion() != _presence_version ) {
+        LOG_DEBUG( "Missed presence update %lu, resync needed\n", ( unsigned long )up.baseversion() );
+        _presence_stale = 1;
+    } else {
+        for( int i = 0; i < up.deltas_size(); i++ ) {
+            const PresenceDelta &delta = up.deltas( i );
+            if( delta.kind() == PRESENCE_LEAVE ) {
+                _connected_users.remove( delta.user().username() );
+            } else {
+                _connected_users.put( delta.user() );
+            }
+        }
+        _presence_version = up.version();
+    }
+    pthread_mutex_unlock( &_connected_users_mutex );
+    if( up.has_snapshot() )
+        notify();
+}
+
+/*
+* Send req, with a callback it gets the next request id and cb is called with its response.
+* Without one the response is not tracked. Ids wrap before INT_MAX so they are never returned
+* as negative, an id still waiting for its response is skipped.
+* returns the request id, 0 without a callback, -1 on error
+*/
+int Client::send_tracked( ClientMessage &req, request_cb cb, void *context ) {
+    unsigned id = 0;
+    if( cb != NULL ) {
+        pending_call pending;
+        pending.cb = cb;
+        pending.context = context;
+        pthread_mutex_lock( &_pending_mutex );
+        do {
+            id = _next_request++;
+            if( _next_request == INT_MAX )
+                _next_request = 1;
+        } while( _pending.count( id ) > 0 );
+        _pending[ id ] = pending;
+        pthread_mutex_unlock( &_pending_mutex );
+        req.set_requestid( id );
+    }
+
+    if( send_request( req ) < 0 ) {
+        LOG_ERROR( "Unable to send request\n" );
+        if( id != 0 ) {
+            pthread_mutex_lock( &_pending_mutex );
+            _pending.erase( id );
+            pthread_mutex_unlock( &_pending_mutex );
+        }
+        return -1;
+    }
+    return id;
+}
+
+/*
+* Call the callback of the request res answers. An error nobody waits for goes to the error queue
+*/
+void Client::complete_request( const ServerMessage &res ) {
+    pending_call pending;
+    pending.cb = NULL;
+    pthread_mutex_lock( &_pending_mutex );
+    unordered_map<unsigned, pending_call>::iterator it = _pending.find( res.requestid() );
+    if( it != _pending.end() ) {
+        pending = it->second;
+        _pending.erase( it );
+    }
+    pthread_mutex_unlock( &_pending_mutex );
+
+    if( pending.cb != NULL ) {
+        pending.cb( pending.context, res );
+    } else if( res.option() == ERROR ) {
+        handle_error( res.error() );
+    }
+}
+
+/*
+* Complete the requests still waiting with an error response carrying reason. With keep_held
+* the held ones, not sent yet, keep waiting
+*/
+void Client::fail_requests( const char *reason, int keep_held ) {
+    unordered_set<unsigned> held;
+    if( keep_held ) {
+        pthread_mutex_lock( &_send_mutex );
+        held = _held_ids;
+        pthread_mutex_unlock( &_send_mutex );
+    }
+    unordered_map<unsigned, pending_call> pending;
+    pthread_mutex_lock( &_pending_mutex );
+    pending.swap( _pending );
+    unordered_map<unsigned, pending_call>::iterator keep;
+    for( keep = pending.begin(); !held.empty() && keep != pending.end(); ) {
+        if( held.count( keep->first ) ) {
+            _pending.insert( *keep );
+            keep = pending.erase( keep );
+        } else {
+            keep++;
+        }
+    }
+    pthread_mutex_unlock( &_pending_mutex );
+
+    ServerMessage res;
+    res.set_option( ERROR );
+    res.mutable_error()->set_errormessage( reason );
+    unordered_map<unsigned, pending_call>::iterator it;
+    for( it = pending.begin(); it != pending.end(); it++ ) {
+        res.set_requestid( it->first );
+        it->second.cb( it->second.context, res );
+    }
+}
+
+/*
+* Requests sent with a callback that have no response yet
+*/
+size_t Client::pending_requests() {
+    pthread_mutex_lock( &_pending_mutex );
+    size_t n = _pending.size();
+    pthread_mutex_unlock( &_pending_mutex );
+    return n;
 }
 
 /*
 * Build request to change the status to n_st
+* returns the request id, 0 without a callback, -1 on error
 */
-int Client::change_status( string n_st ) {
+int Client::change_status( string n_st, request_cb cb, void *context ) {
     ChangeStatusRequest * n_st_res( new ChangeStatusRequest );
     n_st_res->set_status( n_st );
     ClientMessage req;
     req.set_option( CHANGESTATUS );
     req.set_allocated_changestatus( n_st_res );
-    
-    if( send_request( req ) < 0 ) {
-        fprintf( _log_level, "ERROR: Unable to send request\n" );
-    }
-
-    return 0;
 
+    return send_tracked( req, cb, context );
 }
 
 /*
 * Build a request to broadcast msg to all connected users on server
+* returns the request id, 0 without a callback, -1 on error
 */
-int Client::broadcast_message( string msg ) {
+int Client::broadcast_message( string msg, request_cb cb, void *context ) {
     BroadcastRequest * br_msg( new BroadcastRequest );
     br_msg->set_message( msg );
     ClientMessage req;
     req.set_option( BROADCASTC );
     req.set_allocated_broadcast( br_msg );
 
-    if( send_request( req ) < 0 ) {
-        fprintf( _log_level, "ERROR: Unable to send request\n" );
-    }
-
-    return 0;
-
+    return send_tracked( req, cb, context );
 }
 
 /*
 * Build request to send a direct message
+* returns the request id, 0 without a callback, -1 on error
 */
-int Client::direct_message( string msg, int dest_id, string dest_nm ) {
+int Client::direct_message( string msg, int dest_id, string dest_nm, request_cb cb, void *context ) {
     DirectMessageRequest * dm( new DirectMessageRequest );
     dm->set_message( msg );
     /* Verify optional params were passed */
@@ -192,60 +810,153 @@ int Client::direct_message( string msg, int dest_id, string dest_nm ) {
     ClientMessage req;
     req.set_option( DIRECTMESSAGE );
     req.set_allocated_directmessage( dm );
-    
 
-    if( send_request( req ) < 0 ) {
-        fprintf( _log_level, "ERROR: Unable to send request\n" );
-    }
+    return send_tracked( req, cb, context );
+}
 
-    return 0;
+/*
+* Build a request to join (JOINCHANNEL) or leave (LEAVECHANNEL) a channel
+* returns the request id, 0 without a callback, -1 on error
+*/
+int Client::channel_request( int option, string channel, request_cb cb, void *context ) {
+    ClientMessage req;
+    req.set_option( option );
+    req.mutable_channel()->set_channel( channel );
+
+    return send_tracked( req, cb, context );
+}
+
+/*
+* Build a request to send msg to the members of channel
+* returns the request id, 0 without a callback, -1 on error
+*/
+int Client::channel_message( string msg, string channel, request_cb cb, void *context ) {
+    ClientMessage req;
+    req.set_option( CHANNELMESSAGE );
+    ChannelMessageRequest *ch_msg = req.mutable_channelmessage();
+    ch_msg->set_channel( channel );
+    ch_msg->set_message( msg );
+
+    return send_tracked( req, cb, context );
 }
 
 /*
 * Send request to server
 * returns 0 on succes -1 on error
 */
-int Client::send_request(ClientMessage request) {
+int Client::send_request( const ClientMessage &request ) {
     /* Serealize string */
     int res_code = request.option();
-    fprintf(_log_level,"DEBUG: Serealizing request with option %d\n", res_code);
+    LOG_DEBUG( "Serealizing request with option %d\n", res_code );
     std::string srl_req;
     request.SerializeToString(&srl_req);
 
-    char c_str[ srl_req.size() + 1 ];
-    strcpy( c_str, srl_req.c_str() );
+    string frame;
+    encode_frame( srl_req, &frame );
 
-    /* Send request to server */
-    fprintf(_log_level,"INFO: Sending request\n");
-    if( sendto( _sock, c_str, strlen(c_str ), 0, (struct sockaddr*)&_serv_addr,sizeof( &_serv_addr ) ) < 0 ) {
-        fprintf(_log_level,"ERROR: Error sending request");
+    LOG_INFO( "Sending request\n" );
+    if( send_frame( frame, 0, request.requestid() ) < 0 ) {
+        LOG_ERROR( "Error sending request" );
         return -1;
     }
 
-    fprintf(_log_level,"DEBUG: Request was send to socket %d\n", _sock);
+    LOG_DEBUG( "Request was send to socket %d\n", _sock );
+    return 0;
+}
+
+/*
+* Send an encoded frame. Frames other than the handshake are held until the log in ends, also
+* while reconnecting, up to CLIENT_HELD_BYTES. Blocking clients write it whole, non-blocking
+* clients write what the socket takes and keep the rest for on_writable. id is the request id
+* of the frame, 0 if it has none
+* returns 0 on succes -1 on error
+*/
+int Client::send_frame( const string &frame, int handshake, unsigned id ) {
+    /* The listener thread also sends requests */
+    pthread_mutex_lock( &_send_mutex );
+    if( _state == CLIENT_CLOSED ) {
+        pthread_mutex_unlock( &_send_mutex );
+        return -1;
+    }
+    if( !handshake && _state != CLIENT_ESTABLISHED ) {
+        if( _held.size() + frame.size() > CLIENT_HELD_BYTES ) {
+            pthread_mutex_unlock( &_send_mutex );
+            LOG_ERROR( "Too many requests waiting for the log in\n" );
+            return -1;
+        }
+        _held.append( frame );
+        if( id != 0 )
+            _held_ids.insert( id );
+        pthread_mutex_unlock( &_send_mutex );
+        return 0;
+    }
+    if( !_nonblocking ) {
+        int res = write_all( _sock, frame.data(), frame.size() );
+        pthread_mutex_unlock( &_send_mutex );
+        return res;
+    }
+    _out.append( frame );
+    pthread_mutex_unlock( &_send_mutex );
+    return flush_output();
+}
+
+/*
+* Write the queued output of a non-blocking client until the socket is full
+* returns 0 on succes -1 on error
+*/
+int Client::flush_output() {
+    pthread_mutex_lock( &_send_mutex );
+    while( _out_off < _out.size() ) {
+        int sent = send( _sock, _out.data() + _out_off, _out.size() - _out_off, MSG_NOSIGNAL );
+        if( sent < 0 && errno == EINTR )
+            continue;
+        if( sent < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) )
+            break;
+        if( sent < 0 ) {
+            pthread_mutex_unlock( &_send_mutex );
+            return -1;
+        }
+        _out_off += sent;
+    }
+    if( _out_off == _out.size() ) {
+        _out.clear();
+        _out_off = 0;
+    }
+    pthread_mutex_unlock( &_send_mutex );
     return 0;
 }
 
 /*
-* Read for messages from server
-* Returns the read message
+* Read the next framed message from server into res. Extra bytes received are kept for the next call.
+* Returns the size of the message, 0 if the server closed the connection or -1 on error
 */
-int Client::read_message( void *res ) {
+int Client::read_message( string *res ) {
     /* Read for server response */
-    int rec_sz;
-    fprintf(_log_level, "DEBUG: Waiting for messages from server on fd %d\n", _sock);
-    if( ( rec_sz = recvfrom(_sock, res, MESSAGE_SIZE, 0, NULL, NULL) ) < 0 ) {
-        fprintf(_log_level,"ERROR: Error reading response");
-        exit(EXIT_FAILURE);
+    int frame_st;
+    LOG_DEBUG( "Waiting for messages from server on fd %d\n", _sock );
+    while( ( frame_st = _in_frames.next_frame( res ) ) == 0 ) {
+        int rec_sz = _in_frames.read_from( _sock );
+        if( rec_sz < 0 && errno == EINTR )
+            continue;
+        if( rec_sz < 0 ) {
+            LOG_ERROR( "Error reading response: %s\n", strerror( errno ) );
+            return -1;
+        }
+        if( rec_sz == 0 )
+            return 0;
     }
-    fprintf(_log_level, "DEBUG: Received message from server\n");
-    return rec_sz;
+    if( frame_st < 0 ) {
+        LOG_ERROR( "Invalid frame received from server\n" );
+        return -1;
+    }
+    LOG_DEBUG( "Received message from server\n" );
+    return res->size();
 }
 
 /*
 * Parse the response to Server message
 */
-ServerMessage Client::parse_response( char *res ) {
+ServerMessage Client::parse_response( const string &res ) {
     ServerMessage response;
     response.ParseFromString(res);
     return response;
@@ -257,47 +968,67 @@ ServerMessage Client::parse_response( char *res ) {
 
 
  /*
- * Backgorund listener for server messages and adds them to response queue
+ * Backgorund listener for server messages of a blocking client
  */
 void * Client::bg_listener( void * context ) {
     /* Get Client context */
     Client * c = ( ( Client * )context );
 
     pid_t tid = gettid();
-    fprintf(c->_log_level, "DEBUG: Staring client interface on thread ID: %d\n", ( int )tid);
+    LOG_DEBUG( "Staring client interface on thread ID: %d\n", ( int )tid );
 
     /* read for messages */
+    string ack_res;
     while( c->get_stopped_status() == 0 ) {
-        char ack_res[ MESSAGE_SIZE ];
-        if( c->read_message( ack_res ) <= 0 ) {
-            fprintf( c->_log_level, "LOG: Server disconnected terminating session..." );
+        if( c->read_message( &ack_res ) <= 0 ) {
+            if( c->reconnect_blocking() == 0 )
+                continue;
+            LOG_INFO( "Server disconnected terminating session..." );
             c->send_stop();
             break;
         }
-        fprintf(c->_log_level,"DEBUG: New messages was received from server\n");
-        ServerMessage res = c->parse_response( ack_res );
-        fprintf(c->_log_level, "DEBUG: Adding response to queue\n" );
-        
-        /* Process acoorging to response, we ignore status responses */
-        switch ( res.option() ) {
-            case BROADCASTS:
-                c->push_res( res ); 
-                break;
-            case MESSAGE:
-                c->push_res( res ); 
-                break;
-            case CONNECTEDUSERRESPONSE:
-                c->parse_connected_users( res.connecteduserresponse() );
-                break;
-            case ERROR:
-                c->handle_error( res.error() );
-                break;
-            default:
-                break;
-        }
+        LOG_DEBUG( "New messages was received from server\n" );
+        c->dispatch_response( c->parse_response( ack_res ) );
     }
-    fprintf(c->_log_level, "INFO: Exiting listening thread\n");
-    pthread_exit( NULL );
+    c->fail_requests( "Connection closed", 0 );
+    LOG_INFO( "Exiting listening thread\n" );
+    return NULL;
+}
+
+/*
+* Handle a message from the server once logged in
+*/
+void Client::dispatch_response( const ServerMessage &res ) {
+    /* Process acoorging to response, status responses only complete their request */
+    switch ( res.option() ) {
+        case BROADCASTS:
+        case MESSAGE:
+        case BATCH:
+        case CHANNELMESSAGES:
+            push_res( res );
+            break;
+        case CONNECTEDUSERRESPONSE:
+            parse_connected_users( res.connecteduserresponse() );
+            break;
+        case PRESENCEUPDATE:
+            apply_presence( res.presence() );
+            break;
+        case HISTORYRESPONSE:
+            next_history_page( res.history() );
+            break;
+        case CHANGESTATUSRESPONSE:
+        case CHANNELRESPONSE:
+            track_session( res );
+            break;
+        case ERROR:
+            if( !res.has_requestid() )
+                handle_error( res.error() );
+            break;
+        default:
+            break;
+    }
+    if( res.has_requestid() )
+        complete_request( res );
 }
 
 /*
@@ -305,15 +1036,30 @@ void * Client::bg_listener( void * context ) {
 */
 void Client::handle_error( ErrorResponse err ) {
     add_error(err);
+    notify();
 }
 
 /*
 * Stop the server session
 */
 void Client::stop_session() {
-    fprintf(_log_level, "DEBUG: Starting shutting down process...\n");
-    close( _sock ); // Stop send an write operations
+    LOG_DEBUG( "Starting shutting down process...\n" );
     send_stop(); // Set stop flag
+
+    /* Wake the listener blocked on the socket and wait for it */
+    pthread_mutex_lock( &_send_mutex );
+    if( _sock >= 0 )
+        shutdown( _sock, SHUT_RDWR );
+    pthread_mutex_unlock( &_send_mutex );
+    if( _listening ) {
+        if( pthread_equal( pthread_self(), _listener ) ) {
+            pthread_detach( _listener );
+        } else {
+            pthread_join( _listener, NULL );
+        }
+        _listening = 0;
+    }
+    close_connection();
 }
 
 /*
@@ -331,11 +1077,12 @@ int Client::get_stopped_status() {
 * Send stop sets the stopped flag to start the shutdown process
 */
 void Client::send_stop() {
-    fprintf(_log_level, "DEBUG: Setting shutdown flag\n");
+    LOG_DEBUG( "Setting shutdown flag\n" );
     pthread_mutex_lock( &_stop_mutex );
     _close_issued = 1;
     pthread_mutex_unlock( &_stop_mutex );
-    fprintf(_log_level, "DEBUG: Shutdown flag set correctly\n");
+    notify();
+    LOG_DEBUG( "Shutdown flag set correctly\n" );
 }
 
 /*
@@ -344,20 +1091,11 @@ void Client::send_stop() {
 map <string, connected_user> Client::get_connected_users() {
     map <string, connected_user> tmp;
     pthread_mutex_lock( &_connected_users_mutex );
-    tmp = _connected_users;
+    _connected_users.list( &tmp );
     pthread_mutex_unlock( &_connected_users_mutex );
     return tmp;
 }
 
-/*
-* Refresh the list of connected users
-*/
-void Client::set_connected_users( map <string, connected_user> cn_u ) {
-    pthread_mutex_lock( &_connected_users_mutex );
-    _connected_users = cn_u;
-    pthread_mutex_unlock( &_connected_users_mutex );
-}
-
 /*
 * Add new error
 */
@@ -395,266 +1133,224 @@ string Client::get_last_error() {
 }
 
 /*
-* Add respoonse to queue using mutext locks
+* Add a response to the rings of its messages. Only the listener thread pushes, the consumer
+* is woken once for the whole frame if a ring was empty.
 */
-void Client::push_res( ServerMessage el ) {
-    int option = el.option();
-    fprintf(_log_level, "LOG: Adding new message to queue option %d\n", option);
+void Client::push_res( const ServerMessage &el ) {
+    unsigned long sequence = 0;
+    int wake = 0;
+    if( el.option() == BATCH ) {
+        for( int i = 0; i < el.batch().messages_size(); i++ ) {
+            wake |= queue_res( el.batch().messages( i ), &sequence );
+        }
+    } else {
+        wake = queue_res( el, &sequence );
+    }
+
+    if( sequence > 0 ) {
+        pthread_mutex_lock( &_cursor_mutex );
+        _last_sequence = max( _last_sequence, sequence );
+        pthread_mutex_unlock( &_cursor_mutex );
+    }
+    if( wake )
+        notify();
+}
+
+/*
+* Add a broadcast, direct or channel message to its ring and raise sequence to its sequence.
+* A full ring drops the message and counts it.
+* returns 1 if the ring was empty 0 otherwise
+*/
+int Client::queue_res( const ServerMessage &el, unsigned long *sequence ) {
     message_received msg;
-    pthread_mutex_lock( &_noti_queue_mutex );
-    if( option == 1 ) {
+    message_type type;
+    if( el.option() == BROADCASTS ) {
+        *sequence = max( *sequence, ( unsigned long )el.broadcast().sequence() );
         msg.from_id = el.broadcast().userid();
+        msg.from_username = el.broadcast().username();
         msg.message = el.broadcast().message();
-        msg.type = BROADCAST;
-        _br_queue.push( msg );
-    } else if( option == 2 ) {
+        type = BROADCAST;
+    } else if( el.option() == MESSAGE ) {
+        *sequence = max( *sequence, ( unsigned long )el.message().sequence() );
         msg.from_id = el.message().userid();
+        msg.from_username = el.message().username();
         msg.message = el.message().message();
-        msg.type = DIRECT;
-        _dm_queue.push( msg );
+        type = DIRECT;
+    } else if( el.option() == CHANNELMESSAGES ) {
+        msg.from_id = el.channelmessage().userid();
+        msg.from_username = el.channelmessage().username();
+        msg.channel = el.channelmessage().channel();
+        msg.message = el.channelmessage().message();
+        type = CHANNEL;
+    } else {
+        return 0;
+    }
+    msg.type = type;
+    if( msg.from_username.empty() )
+        resolve_sender( &msg );
+
+    if( _on_message != NULL ) {
+        _on_message( _on_message_context, msg );
+        return 0;
+    }
+
+    /* Rings are only allocated once a message has to wait in them */
+    if( _rings.load( memory_order_relaxed ) == NULL ) {
+        message_ring *rings = new message_ring[ 3 ];
+        for( int i = 0; i < 3; i++ ) {
+            rings[ i ].head.store( 0 );
+            rings[ i ].tail.store( 0 );
+        }
+        _rings.store( rings, memory_order_release );
+    }
+    message_ring *r = get_ring( type );
+    unsigned long tail = r->tail.load( memory_order_relaxed );
+    if( tail - r->head.load( memory_order_acquire ) >= NOTIFY_RING_SIZE ) {
+        _dropped.fetch_add( 1, memory_order_relaxed );
+        return 0;
     }
-    pthread_mutex_unlock( &_noti_queue_mutex );
+    swap( r->items[ tail & ( NOTIFY_RING_SIZE - 1 ) ], msg );
+    /* Publish then look at head, the consumer stores head then looks at tail: one sees the other */
+    r->tail.store( tail + 1 );
+    return r->head.load() == tail;
 }
 
 /*
-* Get element from response queue
+* Ring of the received messages of type mtype, NULL before the first message
 */
-message_received Client::pop_res( message_type mtype ) {
-    message_received res;
-    pthread_mutex_lock( &_noti_queue_mutex );
-    if( mtype == BROADCAST ) {
-        res = _br_queue.front();
-        _br_queue.pop();
-    } else if( mtype == DIRECT ) {
-        res = _dm_queue.front();
-        _dm_queue.pop();
+message_ring * Client::get_ring( message_type mtype ) {
+    message_ring *rings = _rings.load( memory_order_acquire );
+    if( rings == NULL )
+        return NULL;
+    if( mtype == DIRECT )
+        return &rings[ 1 ];
+    if( mtype == CHANNEL )
+        return &rings[ 2 ];
+    return &rings[ 0 ];
+}
+
+/*
+* Move up to max messages of type mtype to the end of out, only one thread may pop
+* returns the number of messages moved
+*/
+int Client::pop_batch( message_type mtype, vector<message_received> *out, size_t max ) {
+    message_ring *r = get_ring( mtype );
+    if( r == NULL )
+        return 0;
+    unsigned long head = r->head.load( memory_order_relaxed );
+    unsigned long n = min( ( unsigned long )max, r->tail.load() - head );
+    for( unsigned long i = 0; i < n; i++ ) {
+        out->push_back( message_received() );
+        swap( out->back(), r->items[ ( head + i ) & ( NOTIFY_RING_SIZE - 1 ) ] );
     }
-    pthread_mutex_unlock( &_noti_queue_mutex );
-    return res;
+    if( n > 0 )
+        r->head.store( head + n );
+    return n;
 }
 
 /*
-* Get element to buffer. Returns 0 on succes -1 if empty
+* Get element to buffer, only one thread may pop. Returns 0 on succes -1 if empty
 */
 int Client::pop_to_buffer( message_type mtype, message_received * buf ) {
-    int res;
-    fprintf(_log_level, "DEBUG: Locking noti queue mutex\n");
-    pthread_mutex_lock( &_noti_queue_mutex );
-    if( mtype == BROADCAST ) {
-        fprintf(_log_level, "DEBUG: Getting broadcast messages\n");
-        if( !_br_queue.empty() ) {
-            fprintf(_log_level, "DEBUG: Not empty, popping from queue\n");
-            *buf = _br_queue.front();
-            _br_queue.pop();
-            res = 0;
-        } else {
-            fprintf(_log_level, "DEBUG: Empty nothing to show\n");
-            res = -1;
-        }
-    } else if( mtype == DIRECT ) {
-        fprintf(_log_level, "DEBUG: Getting direct messages\n");
-        if( !_dm_queue.empty() ) {
-            fprintf(_log_level, "DEBUG: Not empty, popping from queue\n");
-            *buf = _dm_queue.front();
-            _dm_queue.pop();
-            res = 0;
-        } else {
-            fprintf(_log_level, "DEBUG: Empty nothing to show\n");
-            res = -1;
-        }
+    message_ring *r = get_ring( mtype );
+    if( r == NULL )
+        return -1;
+    unsigned long head = r->head.load( memory_order_relaxed );
+    if( head == r->tail.load() )
+        return -1;
+    swap( *buf, r->items[ head & ( NOTIFY_RING_SIZE - 1 ) ] );
+    r->head.store( head + 1 );
+    return 0;
+}
+
+/*
+* Eventfd that becomes readable when an empty ring gets a message, an error or a new list of
+* connected users arrives or the session stops. Read it, then pop until the rings are empty.
+* It is created by the first call, only one thread may call it
+*/
+int Client::notify_fd() {
+    if( _noti_fd.load() < 0 )
+        _noti_fd.store( eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC ) );
+    return _noti_fd.load();
+}
+
+/*
+* Messages dropped because their ring was full
+*/
+unsigned long Client::dropped_messages() {
+    return _dropped.load( memory_order_relaxed );
+}
+
+/*
+* Wake the consumer waiting on the notify fd
+*/
+void Client::notify() {
+    int efd = _noti_fd.load();
+    if( efd < 0 )
+        return;
+    uint64_t one = 1;
+    if( write( efd, &one, sizeof( one ) ) < 0 && errno != EAGAIN ) {
+        LOG_ERROR( "Unable to notify consumer: %s\n", strerror( errno ) );
     }
-    fprintf(_log_level, "DEBUG: Unlocking noti queue mutex\n");
-    pthread_mutex_unlock( &_noti_queue_mutex );
-    return res;
 }
 
 /*
-* Get a connected users info by its username
+* Get a connected users info by its username, an unknown user has id 0 and no name
 */
 connected_user Client::get_connected_user( string name ) {
-    connected_user tmp;
+    connected_user tmp = connected_user();
     pthread_mutex_lock( &_connected_users_mutex );
-    tmp = _connected_users[ name ];
+    const connected_user *usr = _connected_users.find( name );
+    if( usr != NULL )
+        tmp = *usr;
     pthread_mutex_unlock( &_connected_users_mutex );
     return tmp;
 }
 
 /*
-* Get a connected users info by its id
+* Get a connected users info by its id, an unknown user has id 0 and no name
 */
 connected_user Client::get_connected_user( int id ) {
-    connected_user tmp;
-    map<string, connected_user>::iterator it;
+    connected_user tmp = connected_user();
     pthread_mutex_lock( &_connected_users_mutex );
-    for( it = _connected_users.begin(); it != _connected_users.end(); it++ ){
-        if( it->second.id == id )
-            tmp = it->second;
-    }
+    const connected_user *usr = _connected_users.find( id );
+    if( usr != NULL )
+        tmp = *usr;
     pthread_mutex_unlock( &_connected_users_mutex );
     return tmp;
 }
 
+/*
+* Fill the username of a message whose sender only came with its id from the connected users
+*/
+void Client::resolve_sender( message_received *msg ) {
+    pthread_mutex_lock( &_connected_users_mutex );
+    const connected_user *usr = _connected_users.find( msg->from_id );
+    if( usr != NULL )
+        msg->from_username = usr->name;
+    pthread_mutex_unlock( &_connected_users_mutex );
+}
 
 
-  /*
- * Start a new session on server on cli interface
- */
-void Client::start_session() {
-    /* Verify a connection with server was stablished */
-    if ( _sock < 0 ){
-        fprintf(_log_level, "ERROR: No connection to server was found\n" );
-        exit( EXIT_FAILURE );
-    }
-
-    /* Verify if client was registered on server */
-    if( _user_id < 0 ) { // No user has been registered
-        /* Attempt to log in to server */
-        if( log_in() < 0 ) {
-            fprintf(_log_level, "ERROR: Unable to log in to server\n");
-            exit( EXIT_FAILURE );
-        } else {
-            fprintf(_log_level, "INFO: Logged in to server user id %d\n", _user_id);
-        }
-    }
-    /* Create a new thread to listen for messages from server */
-    pthread_t thread;
-    pthread_create( &thread, NULL, &bg_listener, this );
-
-    /* Start client interface */
-    int no = 0;
-    message_type msg_t;
-    while(1) {
-
-        if( no ) {
-            string err;
-
-            if( pop_error_message( &err ) == 0 ) {
-                cout << "Error: " << err << endl;
-            } else if( no == 1 ) {
-                message_received mtp;
-                while( pop_to_buffer( msg_t, &mtp ) == 0 ) {
-                    cout << "--------- Mensages ---------" << endl;
-                    cout << "ID from: " << mtp.from_id << endl;
-                    cout << "User name from: " << mtp.from_username << endl;
-                    cout << "Message: " << mtp.message << endl;
-                    cout << "----------------------------" << endl;
-                }
-            } else if( no == 2 ) {
-                map <string, connected_user> tmp = get_connected_users();
-                map<string, connected_user>::iterator it;
-                cout << "--------- Usuarios conetados ---------" << endl;
-                for( it = tmp.begin(); it != tmp.end(); it++ ) {
-                    cout << "User id: " << it->second.id << endl;
-                    cout << "User name: " << it->first << endl;
-                    cout << "User status: " << it->second.status << endl;
-                    cout << "--------------------------------------" << endl;
-                }
-            }
-        }
-        
-        int input;
-        printf("\n\n------ Bienvenido al chat %s ------\n", _username);
-        printf("Seleccione una opcion:\n");
-        printf("\t1. Enviar mensaje al canal publico\n");
-        printf("\t2. Enviar mensaje directo \n");
-        printf("\t3. Cambiar de estado \n");
-        printf("\t4. Ver usuarios conectados \n");
-        printf("\t5. Ver informacion de usuario \n");
-        printf("\t6. Ver canal general \n");
-        printf("\t7. Ver mensajes directos \n");
-        printf("\t8. Salir \n");
-        cin >> input;
-        string t;
-        getline(cin, t);
-        
-        string br_msg = "";
-        string dm = "";
-        string dest_nm = "";
-        int res_cd;
-        no = 0;
-        int st;
-        string n_sts = "activo";
-        int mm_ui, usr_id;
-        string usr;
-        connected_user c_usr;
-        switch ( input ) {
-            case 1:
-                cout << "Ingrese mensaje a enviar:\n";
-                getline( cin, br_msg );
-                res_cd = broadcast_message( br_msg );
-                break;
-            case 2:
-                printf("Ingrese nombre de usuario del destinatario:\n");
-                getline( cin, dest_nm );
-                printf("Ingrese el mensaje a enviar: \n");
-                getline( cin, dm );
-                res_cd = direct_message( dm, -1, dest_nm );
-                break;
-            case 3:
-                printf("Seleccione un estado: \n");
-                printf("1. Activo\n");
-                printf("2. Inctivo\n");
-                printf("3. Ocupado\n");
-                cin >> st;
-                getline(cin, t);
-                if(st == 1)
-                    n_sts = "activo";
-                else if( st == 2 )
-                    n_sts = "inactivo";
-                else if( st == 3 )
-                    n_sts = "ocupado";
-                res_cd = change_status( n_sts );
-                break;
-            case 4:
-                res_cd = get_connected_request();
-                no = 2;
-                break;
-            case 5:
-                printf("Buscar usuario por:\n");
-                printf("1. ID de usuario\n");
-                printf("2. Nombre de usuario\n");
-                cin >> mm_ui;
-                getline(cin, t);
-                switch ( mm_ui ){
-                    case 1:
-                        printf("Ingresa el id de usuario:\n");
-                        cin >> usr_id;
-                        getline(cin, t);
-                        c_usr = get_connected_user( usr_id );
-                        break;
-                    case 2:
-                        printf("Ingresa el nombre de usuario:\n");
-                        getline(cin, usr);
-                        c_usr = get_connected_user( usr );
-                        break;
-                    default:
-                        printf("Opcion invalida!");
-                        break;
-                }
-                cout << "--------------------------------------" << endl;
-                cout << "User id: " << c_usr.id << endl;
-                cout << "User name: " << c_usr.name << endl;
-                cout << "User status: " << c_usr.status << endl;
-                cout << "User IP: " << c_usr.ip << endl;
-                cout << "--------------------------------------" << endl;
-                break;
-            case 6:
-                msg_t = BROADCAST;
-                no = 1;
-                break;
-            case 7:
-                msg_t = DIRECT;
-                no = 1;
-                break;
-            case 8:
-                break;
-            default:
-                printf("Opcion invalida\n");
-                break;
-        }
-        sleep( 2 );
-        if( input == 8 )
-            break;
+
+/*
+* Start the thread that reads server messages into the rings
+* returns 0 on succes -1 on error
+*/
+int Client::start_listener() {
+    if( _listening )
+        return 0;
+    if( pthread_create( &_listener, NULL, &bg_listener, this ) != 0 ) {
+        LOG_ERROR( "Unable to start listener thread\n" );
+        return -1;
     }
-    stop_session();
-}
\ No newline at end of file
+    _listening = 1;
+    return 0;
+}
+
+/*
+* Number of times the connected users were replaced by a snapshot or a complete list
+*/
+unsigned long Client::users_updates() {
+    return _users_updates.load();
+}
@@ -0,0 +1,533 @@
+#include "Chat.h"
+
+/*
+* Frames are a 4 byte big endian length followed by the serialized message.
+* Shared by Client and Server so a single read can hold many messages and a message can span many reads.
+*/
+
+FrameBuffer::FrameBuffer() {
+    _start = 0;
+}
+
+/*
+* Append received bytes to the reassembly buffer
+*/
+void FrameBuffer::append( const char *data, size_t len ) {
+    compact();
+    _buf.append( data, len );
+}
+
+/*
+* Read whatever is available on fd straight into the buffer.
+* Returns the number of bytes read, 0 if the peer closed the connection or -1 on error (errno is kept).
+*/
+int FrameBuffer::read_from( int fd ) {
+    compact();
+    size_t old_sz = _buf.size();
+    _buf.resize( old_sz + MESSAGE_SIZE );
+    int read_sz = recv( fd, &_buf[ old_sz ], MESSAGE_SIZE, 0 );
+    _buf.resize( old_sz + ( read_sz > 0 ? read_sz : 0 ) );
+    return read_sz;
+}
+
+/*
+* Pop the next complete frame payload into frame.
+* Returns 1 if a frame was popped, 0 if more data is needed or -1 if the frame is invalid.
+*/
+int FrameBuffer::next_frame( string *frame ) {
+    size_t avail = _buf.size() - _start;
+    if( avail < FRAME_HEADER_SIZE )
+        return 0;
+
+    const unsigned char *hdr = ( const unsigned char * )_buf.data() + _start;
+    uint32_t len = ( ( uint32_t )hdr[0] << 24 ) | ( ( uint32_t )hdr[1] << 16 ) | ( ( uint32_t )hdr[2] << 8 ) | hdr[3];
+    if( len > MAX_FRAME_SIZE )
+        return -1;
+    if( avail < FRAME_HEADER_SIZE + len )
+        return 0;
+
+    frame->assign( _buf, _start + FRAME_HEADER_SIZE, len );
+    _start += FRAME_HEADER_SIZE + len;
+    return 1;
+}
+
+/*
+* Bytes received that are not part of a popped frame yet
+*/
+size_t FrameBuffer::pending() {
+    return _buf.size() - _start;
+}
+
+/*
+* Drop already consumed bytes once they are most of the buffer
+*/
+void FrameBuffer::compact() {
+    if( _start == _buf.size() ) {
+        _buf.clear();
+        _start = 0;
+    } else if( _start > 0 && _start >= _buf.size() / 2 ) {
+        _buf.erase( 0, _start );
+        _start = 0;
+    }
+}
+
+/*
+* Append payload to out prefixed by its length
+*/
+void encode_frame( const string &payload, string *out ) {
+    uint32_t len = payload.size();
+    char hdr[ FRAME_HEADER_SIZE ];
+    hdr[0] = ( len >> 24 ) & 0xff;
+    hdr[1] = ( len >> 16 ) & 0xff;
+    hdr[2] = ( len >> 8 ) & 0xff;
+    hdr[3] = len & 0xff;
+    out->append( hdr, FRAME_HEADER_SIZE );
+    out->append( payload );
+}
+
+/*
+* Serialize msg once into a shared frame that can be queued on any number of connections.
+* The message is written right after the header, the frame is the only allocation besides its shared state.
+*/
+frame_ptr encode_message( const google::protobuf::Message &msg ) {
+    size_t len = msg.ByteSizeLong();
+    shared_ptr<string> frame = make_shared<string>();
+    frame->resize( FRAME_HEADER_SIZE + len );
+    unsigned char *out = ( unsigned char * )&( *frame )[ 0 ];
+    out[0] = ( len >> 24 ) & 0xff;
+    out[1] = ( len >> 16 ) & 0xff;
+    out[2] = ( len >> 8 ) & 0xff;
+    out[3] = len & 0xff;
+    msg.SerializeWithCachedSizesToArray( out + FRAME_HEADER_SIZE );
+    return frame;
+}
+
+static google::protobuf::ArenaOptions arena_options( char *block ) {
+    google::protobuf::ArenaOptions opts;
+    opts.initial_block = block;
+    opts.initial_block_size = ARENA_BLOCK_SIZE;
+    return opts;
+}
+
+/*
+* Arena whose first block is block, so resetting it keeps that block for the next request
+*/
+request_arena::request_arena() : arena( arena_options( block ) ) {
+}
+
+/*
+* Write exactly len bytes of data on a blocking fd
+* returns 0 on succes -1 on error
+*/
+int write_all( int fd, const char *data, size_t len ) {
+    while( len > 0 ) {
+        int sent = send( fd, data, len, MSG_NOSIGNAL );
+        if( sent < 0 ) {
+            if( errno == EINTR )
+                continue;
+            return -1;
+        }
+        data += sent;
+        len -= sent;
+    }
+    return 0;
+}
+
+/*
+* Create the outbound queue of socket fd with its limits.
+* with_wakeup creates an eventfd so the thread owning a blocking connection can be told to flush.
+*/
+shared_ptr<send_queue> new_send_queue( int fd, int with_wakeup, size_t max_bytes, size_t max_frames, overflow_policy policy ) {
+    shared_ptr<send_queue> q( new send_queue );
+    q->fd = fd;
+    q->wake_fd = with_wakeup ? eventfd( 0, EFD_NONBLOCK ) : -1;
+    q->offset = 0;
+    q->bytes = 0;
+    q->max_bytes = max_bytes;
+    q->max_frames = max_frames;
+    q->policy = policy;
+    q->overflowed = 0;
+    q->in_flight = 0;
+    q->batch_window_us = 0;
+    q->batch_max_bytes = 0;
+    q->held = 0;
+    q->held_bytes = 0;
+    q->held_since = 0;
+    q->presence.store( 0 );
+    q->since.store( 0 );
+    q->dropped = 0;
+    q->disconnects = 0;
+    pthread_mutex_init( &q->mutex, NULL );
+    return q;
+}
+
+/*
+* Monotonic clock in microseconds
+*/
+long monotonic_us() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec * 1000000L + ts.tv_nsec / 1000;
+}
+
+/*
+* Monotonic clock in nanoseconds
+*/
+long monotonic_ns() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+/*
+* Pop the first frame of q, must be called with q->mutex held
+*/
+static void pop_front_frame( send_queue *q ) {
+    q->bytes -= q->frames.front().frame->size();
+    q->frames.pop_front();
+    q->offset = 0;
+}
+
+/*
+* Tell the thread owning q that it has frames to flush
+*/
+static void wake_owner( send_queue *q ) {
+    if( q->wake_fd < 0 )
+        return;
+    uint64_t one = 1;
+    if( write( q->wake_fd, &one, sizeof( one ) ) < 0 ) {
+        LOG_DEBUG( "Wakeup of fd %d already pending\n", q->fd );
+    }
+}
+
+static const frame_ptr & frame_of( const queued_frame &qf ) {
+    return qf.frame;
+}
+
+static const frame_ptr & frame_of( const frame_ptr &frame ) {
+    return frame;
+}
+
+/*
+* Frame of a ServerMessage batch holding the already encoded messages of [first, last).
+* Every frame payload is a serialized ServerMessage, so it is copied as is into a repeated field
+* and nothing is parsed or serialized again.
+*/
+template <class It>
+static frame_ptr pack_frames( It first, It last ) {
+    using google::protobuf::io::CodedOutputStream;
+    using google::protobuf::internal::WireFormatLite;
+    const uint32_t entry_tag = WireFormatLite::MakeTag( ServerMessageBatch::kMessagesFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED );
+    const uint32_t option_tag = WireFormatLite::MakeTag( ServerMessage::kOptionFieldNumber, WireFormatLite::WIRETYPE_VARINT );
+    const uint32_t batch_tag = WireFormatLite::MakeTag( ServerMessage::kBatchFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED );
+
+    size_t body = 0;
+    It it;
+    for( it = first; it != last; it++ ) {
+        uint32_t len = frame_of( *it )->size() - FRAME_HEADER_SIZE;
+        body += CodedOutputStream::VarintSize32( entry_tag ) + CodedOutputStream::VarintSize32( len ) + len;
+    }
+    size_t len = CodedOutputStream::VarintSize32( option_tag ) + CodedOutputStream::VarintSize32( BATCH )
+        + CodedOutputStream::VarintSize32( batch_tag ) + CodedOutputStream::VarintSize32( body ) + body;
+
+    shared_ptr<string> frame = make_shared<string>();
+    frame->resize( FRAME_HEADER_SIZE + len );
+    uint8_t *out = ( uint8_t * )&( *frame )[ 0 ];
+    out[0] = ( len >> 24 ) & 0xff;
+    out[1] = ( len >> 16 ) & 0xff;
+    out[2] = ( len >> 8 ) & 0xff;
+    out[3] = len & 0xff;
+    out += FRAME_HEADER_SIZE;
+    out = CodedOutputStream::WriteVarint32ToArray( option_tag, out );
+    out = CodedOutputStream::WriteVarint32ToArray( BATCH, out );
+    out = CodedOutputStream::WriteVarint32ToArray( batch_tag, out );
+    out = CodedOutputStream::WriteVarint32ToArray( body, out );
+    for( it = first; it != last; it++ ) {
+        uint32_t msg_len = frame_of( *it )->size() - FRAME_HEADER_SIZE;
+        out = CodedOutputStream::WriteVarint32ToArray( entry_tag, out );
+        out = CodedOutputStream::WriteVarint32ToArray( msg_len, out );
+        memcpy( out, frame_of( *it )->data() + FRAME_HEADER_SIZE, msg_len );
+        out += msg_len;
+    }
+    return frame;
+}
+
+/*
+* Frame of a ServerMessage batch holding the encoded frames
+*/
+frame_ptr encode_batch( const vector<frame_ptr> &frames ) {
+    return pack_frames( frames.begin(), frames.end() );
+}
+
+/*
+* Replace the deliveries held at the tail of q by one batch frame, ready to be written.
+* The batch can be dropped only if every message in it could. Must be called with q->mutex held.
+*/
+static void pack_held( send_queue *q ) {
+    size_t n = q->held;
+    q->held = 0;
+    q->held_bytes = 0;
+    if( n < 2 )
+        return;
+
+    deque<queued_frame>::iterator first = q->frames.end() - n;
+    queued_frame qf;
+    qf.frame = pack_frames( first, q->frames.end() );
+    qf.broadcast = 1;
+    qf.delivery = 1;
+    for( deque<queued_frame>::iterator it = first; it != q->frames.end(); it++ ) {
+        qf.broadcast = qf.broadcast && it->broadcast;
+        q->bytes -= it->frame->size();
+    }
+    q->frames.erase( first, q->frames.end() );
+    q->frames.push_back( qf );
+    q->bytes += qf.frame->size();
+}
+
+/*
+* Pack the deliveries held on q once its batch window is over. Must be called with q->mutex held.
+* returns the microseconds until the held deliveries are due or -1 if nothing is held
+*/
+long release_batch( send_queue *q ) {
+    if( q->held == 0 )
+        return -1;
+    long wait_us = q->held_since + q->batch_window_us - monotonic_us();
+    if( wait_us > 0 )
+        return wait_us;
+    pack_held( q );
+    return -1;
+}
+
+/*
+* Add frame to q applying the queue overflow policy. Must be called with q->mutex held.
+* Deliveries (broadcasts and direct messages) to a batching client are held at the tail of the
+* queue until release_batch packs them, any other frame sends them right away.
+* returns 0 if queued, 1 if a frame was dropped or -1 if the connection must be disconnected
+*/
+int enqueue_frame( send_queue *q, frame_ptr frame, int broadcast, int delivery ) {
+    if( q->fd < 0 || q->overflowed )
+        return -1;
+
+    int batch = delivery && q->batch_max_bytes > 0;
+    if( q->held > 0 && !batch )
+        pack_held( q );
+
+    int res = 0;
+    while( !q->frames.empty() && ( q->bytes + frame->size() > q->max_bytes || q->frames.size() + 1 > q->max_frames ) ) {
+        if( q->policy == DISCONNECT ) {
+            q->overflowed = 1;
+            q->disconnects++;
+            q->frames.clear();
+            q->bytes = 0;
+            q->offset = 0;
+            q->in_flight = 0;
+            q->held = 0;
+            q->held_bytes = 0;
+            return -1;
+        }
+
+        /* Oldest broadcast that has not been partially written or handed to an async send */
+        deque<queued_frame>::iterator it = q->frames.begin();
+        size_t busy = q->in_flight > 0 ? q->in_flight : ( q->offset > 0 ? 1 : 0 );
+        if( busy > q->frames.size() )
+            busy = q->frames.size();
+        it += busy;
+        while( it != q->frames.end() && !it->broadcast )
+            it++;
+
+        if( q->policy == DROP_NEWEST || it == q->frames.end() ) {
+            q->dropped++;
+            return 1;
+        }
+
+        if( q->frames.end() - it <= ( long )q->held ) {
+            q->held--;
+            q->held_bytes -= it->frame->size();
+        }
+        q->bytes -= it->frame->size();
+        q->frames.erase( it );
+        q->dropped++;
+        res = 1;
+    }
+
+    queued_frame qf;
+    qf.frame = frame;
+    qf.broadcast = broadcast;
+    qf.delivery = delivery;
+    q->frames.push_back( qf );
+    q->bytes += frame->size();
+
+    if( batch ) {
+        /* The owner of a blocking connection has to wake up to start the window timer */
+        if( q->held == 0 ) {
+            q->held_since = monotonic_us();
+            wake_owner( q );
+        }
+        q->held++;
+        q->held_bytes += frame->size();
+        if( q->held_bytes >= q->batch_max_bytes )
+            pack_held( q );
+    }
+    return res;
+}
+
+/*
+* Point iov to the first max_iov unwritten frames of q, held deliveries are left out.
+* Must be called with q->mutex held.
+* returns the number of iovecs filled
+*/
+int gather_frames( send_queue *q, struct iovec *iov, int max_iov ) {
+    int n_iov = 0;
+    deque<queued_frame>::iterator it;
+    deque<queued_frame>::iterator end = q->frames.end() - q->held;
+    for( it = q->frames.begin(); it != end && n_iov < max_iov; it++ ) {
+        size_t skip = n_iov == 0 ? q->offset : 0;
+        iov[ n_iov ].iov_base = ( void * )( it->frame->data() + skip );
+        iov[ n_iov ].iov_len = it->frame->size() - skip;
+        n_iov++;
+    }
+    return n_iov;
+}
+
+/*
+* Pop every frame completely covered by sent bytes and keep the offset of a partial one.
+* Must be called with q->mutex held.
+*/
+void consume_sent( send_queue *q, size_t sent ) {
+    size_t left = sent;
+    while( left > 0 && !q->frames.empty() ) {
+        size_t remaining = q->frames.front().frame->size() - q->offset;
+        if( left >= remaining ) {
+            left -= remaining;
+            pop_front_frame( q );
+        } else {
+            q->offset += left;
+            left = 0;
+        }
+    }
+}
+
+/*
+* Write the queued frames with gathered writes, IOV_BATCH frames per call. Never blocks, stops when
+* the socket is full and tells the owner thread (if any) to flush once it is writable again.
+* Held deliveries are only written once their batch is due.
+* Must be called with q->mutex held.
+* returns 0 on succes -1 on error
+*/
+int flush_send_queue( send_queue *q ) {
+    struct iovec iov[ IOV_BATCH ];
+    release_batch( q );
+    while( q->frames.size() > q->held ) {
+        if( q->fd < 0 ) {
+            q->frames.clear();
+            q->bytes = 0;
+            q->held = 0;
+            q->held_bytes = 0;
+            return -1;
+        }
+
+        int n_iov = gather_frames( q, iov, IOV_BATCH );
+
+        struct msghdr msg;
+        memset( &msg, 0, sizeof( msg ) );
+        msg.msg_iov = iov;
+        msg.msg_iovlen = n_iov;
+        int sent = sendmsg( q->fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT );
+        if( sent < 0 ) {
+            if( errno == EINTR )
+                continue;
+            if( errno == EAGAIN || errno == EWOULDBLOCK ) {
+                wake_owner( q );
+                return 0;
+            }
+            q->frames.clear();
+            q->bytes = 0;
+            q->offset = 0;
+            q->held = 0;
+            q->held_bytes = 0;
+            return -1;
+        }
+
+        consume_sent( q, sent );
+    }
+    return 0;
+}
+
+/*
+* Block until the socket of q has data to read. While waiting, flushes the pending frames whenever
+* the socket accepts more data or another thread queued frames. Used by threaded connections.
+* A deadline_us other than 0 is the monotonic time at which waiting fails with ETIMEDOUT.
+* returns 0 when readable -1 on error
+*/
+int wait_readable( send_queue *q, long deadline_us ) {
+    while( 1 ) {
+        struct pollfd fds[2];
+        pthread_mutex_lock( &q->mutex );
+        long wait_us = release_batch( q );
+        int pending = q->frames.size() > q->held;
+        fds[0].fd = q->fd;
+        fds[1].fd = q->wake_fd;
+        pthread_mutex_unlock( &q->mutex );
+        if( fds[0].fd < 0 )
+            return -1;
+
+        /* Wake up when the held deliveries are due or at the deadline */
+        if( deadline_us > 0 ) {
+            long left_us = deadline_us - monotonic_us();
+            if( left_us <= 0 ) {
+                errno = ETIMEDOUT;
+                return -1;
+            }
+            if( wait_us < 0 || left_us < wait_us )
+                wait_us = left_us;
+        }
+        int timeout = wait_us < 0 ? -1 : ( int )( ( wait_us + 999 ) / 1000 );
+        fds[0].events = POLLIN | ( pending ? POLLOUT : 0 );
+        fds[1].events = POLLIN;
+        fds[1].revents = 0;
+        if( poll( fds, fds[1].fd >= 0 ? 2 : 1, timeout ) < 0 ) {
+            if( errno == EINTR )
+                continue;
+            return -1;
+        }
+
+        if( fds[1].revents & POLLIN ) {
+            uint64_t count;
+            if( read( fds[1].fd, &count, sizeof( count ) ) < 0 ) {
+                LOG_DEBUG( "Wakeup of fd %d already consumed\n", fds[0].fd );
+            }
+        }
+
+        if( ( fds[0].revents & POLLOUT ) || ( fds[1].revents & POLLIN ) ) {
+            pthread_mutex_lock( &q->mutex );
+            flush_send_queue( q );
+            pthread_mutex_unlock( &q->mutex );
+        }
+
+        if( fds[0].revents & ( POLLIN | POLLHUP | POLLERR ) )
+            return 0;
+    }
+}
+
+/*
+* Close the socket of q and drop its pending frames.
+* Other threads holding the queue will see fd -1 instead of writing to a reused fd.
+*/
+void close_send_queue( send_queue *q ) {
+    pthread_mutex_lock( &q->mutex );
+    if( q->fd >= 0 ) {
+        close( q->fd );
+        q->fd = -1;
+    }
+    if( q->wake_fd >= 0 ) {
+        close( q->wake_fd );
+        q->wake_fd = -1;
+    }
+    q->frames.clear();
+    q->bytes = 0;
+    q->offset = 0;
+    q->in_flight = 0;
+    q->held = 0;
+    q->held_bytes = 0;
+    pthread_mutex_unlock( &q->mutex );
+}
@@ -0,0 +1,304 @@
+#include <dirent.h>
+#include <sys/stat.h>
+#include "Chat.h"
+
+/*
+* Sequence numbers and history of the broadcasts and direct messages. Every message gets the next
+* sequence and is encoded once under _mutex, then kept in a ring of the most recent ones so a
+* reconnecting client can get what it missed without the disk. When a directory is set the
+* messages that leave the ring are appended to history files there, read only by clients that
+* were away longer than the ring covers. Sequences start again with the server, so old files are
+* removed when the history is initiated.
+*
+* Senders fan out after the sequence is taken, two messages sent at the same time can reach a
+* client in either order.
+*/
+
+/* Record of a history file, followed by from, to and the frame */
+struct spill_header {
+    uint32_t length;
+    uint16_t from_size;
+    uint16_t to_size;
+    uint64_t seq;
+};
+
+/* Messages between two entries of a history file index */
+#define HISTORY_INDEX_STEP 1024
+
+history_file::~history_file() {
+    if( fd >= 0 )
+        ::close( fd );
+}
+
+History::History() {
+    pthread_mutex_init( &_mutex, NULL );
+    _size = HISTORY_SIZE;
+    _sequence = 0;
+}
+
+/*
+* Keep the last entries messages in memory (rounded up to a power of two) and spill older ones to
+* dir, an empty dir keeps only the ring. The ring is allocated by the first message.
+* returns 0 on succes -1 on error
+*/
+int History::initiate( size_t entries, const string &dir ) {
+    pthread_mutex_lock( &_mutex );
+    _size = 1;
+    while( _size < entries )
+        _size <<= 1;
+    _ring.clear();
+    _files.clear();
+    _spill.clear();
+    _dir = dir;
+    pthread_mutex_unlock( &_mutex );
+    if( dir.empty() )
+        return 0;
+
+    if( mkdir( dir.c_str(), 0755 ) < 0 && errno != EEXIST ) {
+        LOG_ERROR( "Unable to create history directory %s\n", dir.c_str() );
+        return -1;
+    }
+    DIR *d = opendir( dir.c_str() );
+    if( d == NULL ) {
+        LOG_ERROR( "Unable to open history directory %s\n", dir.c_str() );
+        return -1;
+    }
+    struct dirent *entry;
+    while( ( entry = readdir( d ) ) != NULL ) {
+        if( strstr( entry->d_name, ".hist" ) != NULL )
+            unlink( ( dir + "/" + entry->d_name ).c_str() );
+    }
+    closedir( d );
+    return 0;
+}
+
+/*
+* Sequence of the last message
+*/
+unsigned long History::sequence() {
+    pthread_mutex_lock( &_mutex );
+    unsigned long seq = _sequence;
+    pthread_mutex_unlock( &_mutex );
+    return seq;
+}
+
+/*
+* Give msg, a broadcast or direct message, the next sequence and keep it. to is the recipient of a
+* direct message and empty for a broadcast.
+* returns the encoded frame of msg
+*/
+frame_ptr History::add( ServerMessage *msg, const string &from, const string &to ) {
+    pthread_mutex_lock( &_mutex );
+    if( _ring.empty() )
+        _ring.resize( _size );
+    unsigned long seq = ++_sequence;
+    if( msg->has_broadcast() ) {
+        msg->mutable_broadcast()->set_sequence( seq );
+    } else {
+        msg->mutable_message()->set_sequence( seq );
+    }
+    frame_ptr frame = encode_message( *msg );
+
+    history_entry &slot = _ring[ seq & ( _size - 1 ) ];
+    if( slot.seq != 0 && !_dir.empty() )
+        spill( slot );
+    slot.seq = seq;
+    slot.from = from;
+    slot.to = to;
+    slot.frame = frame;
+    pthread_mutex_unlock( &_mutex );
+    return frame;
+}
+
+/*
+* Append entry, which is leaving the ring, to the last history file. A new file is started every
+* HISTORY_FILE_ENTRIES messages and the oldest one deleted past HISTORY_FILES.
+* Must be called with _mutex held.
+*/
+void History::spill( const history_entry &entry ) {
+    if( _files.empty() || entry.seq >= _files.rbegin()->first + HISTORY_FILE_ENTRIES ) {
+        write_spill();
+        char name[ 32 ];
+        snprintf( name, sizeof( name ), "/%016lx.hist", entry.seq );
+        shared_ptr<history_file> file( new history_file );
+        file->base = entry.seq;
+        file->size = 0;
+        file->path = _dir + name;
+        file->fd = ::open( file->path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+        if( file->fd < 0 ) {
+            LOG_ERROR( "Unable to open history file %s\n", file->path.c_str() );
+            return;
+        }
+        _files[ file->base ] = file;
+        if( _files.size() > HISTORY_FILES ) {
+            unlink( _files.begin()->second->path.c_str() );
+            _files.erase( _files.begin() );
+        }
+    }
+
+    history_file *file = _files.rbegin()->second.get();
+    if( ( entry.seq - file->base ) % HISTORY_INDEX_STEP == 0 )
+        file->index.push_back( file->size + _spill.size() );
+
+    spill_header hdr;
+    hdr.length = sizeof( hdr ) + entry.from.size() + entry.to.size() + entry.frame->size();
+    hdr.from_size = entry.from.size();
+    hdr.to_size = entry.to.size();
+    hdr.seq = entry.seq;
+    _spill.append( ( const char * )&hdr, sizeof( hdr ) );
+    _spill.append( entry.from );
+    _spill.append( entry.to );
+    _spill.append( *entry.frame );
+    if( _spill.size() >= HISTORY_PAGE_BYTES )
+        write_spill();
+}
+
+/*
+* Write the spilled records still in memory to the last history file.
+* Must be called with _mutex held.
+*/
+void History::write_spill() {
+    if( _spill.empty() || _files.empty() )
+        return;
+    history_file *file = _files.rbegin()->second.get();
+    size_t done = 0;
+    while( done < _spill.size() ) {
+        ssize_t n = write( file->fd, _spill.data() + done, _spill.size() - done );
+        if( n < 0 && errno == EINTR )
+            continue;
+        if( n < 0 ) {
+            LOG_ERROR( "Unable to write history file %s\n", file->path.c_str() );
+            break;
+        }
+        done += n;
+    }
+    file->size += done;
+    _spill.clear();
+}
+
+/*
+* Whether entry goes to name: broadcasts of other users and direct messages to name
+*/
+static int is_for( const string &from, const string &to, const string &name ) {
+    return to.empty() ? from != name : to == name;
+}
+
+/*
+* Messages for name with a sequence in (after, until], in order, up to max_bytes (at least one)
+* and HISTORY_SCAN messages looked at. last is the sequence the page ended at. truncated is set
+* when messages after after were no longer kept, the page then starts with the oldest one.
+* returns 1 if there are messages after last up to until, 0 otherwise
+*/
+int History::read( unsigned long after, unsigned long until, const string &name, size_t max_bytes, vector<frame_ptr> *out, unsigned long *last, int *truncated ) {
+    pthread_mutex_lock( &_mutex );
+    if( until > _sequence )
+        until = _sequence;
+    unsigned long oldest = _sequence >= _size ? _sequence - _size + 1 : 1;
+    *truncated = 0;
+
+    /* Older than the ring: from the history files if they go back that far */
+    if( after + 1 < oldest && after < until ) {
+        if( _files.empty() || after + 1 < _files.begin()->first ) {
+            *truncated = 1;
+            after = _files.empty() ? oldest - 1 : _files.begin()->first - 1;
+        }
+        if( after + 1 < oldest ) {
+            write_spill();
+            map<unsigned long, shared_ptr<history_file> >::iterator it = _files.upper_bound( after + 1 );
+            shared_ptr<history_file> file = ( --it )->second;
+            size_t size = file->size;
+            pthread_mutex_unlock( &_mutex );
+            *last = read_file( file, size, after, min( oldest - 1, until ), name, max_bytes, out );
+            return *last < until;
+        }
+    }
+
+    /*
+    * The lock is let go every HISTORY_LOCK_SCAN messages so add, on the path of every broadcast,
+    * does not wait for a whole page. The page ends early if add overwrote the next message
+    * meanwhile, the client asks again and gets it from the history files.
+    */
+    size_t bytes = 0;
+    unsigned long seq = after;
+    int done = 0;
+    for( unsigned long n = 0; seq < until && n < HISTORY_SCAN && !done; ) {
+        if( n > 0 ) {
+            pthread_mutex_unlock( &_mutex );
+            pthread_mutex_lock( &_mutex );
+        }
+        for( unsigned long run = 0; seq < until && n < HISTORY_SCAN && run < HISTORY_LOCK_SCAN; run++, n++ ) {
+            const history_entry &entry = _ring[ ( seq + 1 ) & ( _size - 1 ) ];
+            if( entry.seq != seq + 1 ) {
+                done = 1;
+                break;
+            }
+            if( is_for( entry.from, entry.to, name ) ) {
+                if( !out->empty() && bytes + entry.frame->size() > max_bytes ) {
+                    done = 1;
+                    break;
+                }
+                out->push_back( entry.frame );
+                bytes += entry.frame->size();
+            }
+            seq++;
+        }
+    }
+    pthread_mutex_unlock( &_mutex );
+    *last = seq;
+    return *last < until;
+}
+
+/*
+* Page of the messages for name in (after, end] of file, which has size bytes written. Starts at
+* the index entry before after and reads the file in HISTORY_PAGE_BYTES chunks.
+* returns the sequence of the last message looked at
+*/
+unsigned long History::read_file( shared_ptr<history_file> file, size_t size, unsigned long after, unsigned long end, const string &name, size_t max_bytes, vector<frame_ptr> *out ) {
+    size_t step = ( after + 1 - file->base ) / HISTORY_INDEX_STEP;
+    if( step >= file->index.size() )
+        return after;
+    size_t pos = file->index[ step ];
+
+    string buf;
+    size_t bytes = 0, scanned = 0;
+    unsigned long seq = after;
+    while( pos < size && seq < end && scanned < HISTORY_SCAN ) {
+        buf.resize( min( max( ( size_t )HISTORY_PAGE_BYTES, buf.size() ), size - pos ) );
+        ssize_t n = pread( file->fd, &buf[ 0 ], buf.size(), pos );
+        if( n <= 0 )
+            break;
+
+        size_t off = 0;
+        while( off + sizeof( spill_header ) <= ( size_t )n ) {
+            spill_header hdr;
+            memcpy( &hdr, buf.data() + off, sizeof( hdr ) );
+            if( hdr.length < sizeof( hdr ) )
+                return seq;
+            if( off + hdr.length > ( size_t )n ) {
+                /* Record past the chunk, read again from its start with room for it */
+                if( off == 0 )
+                    buf.resize( hdr.length );
+                break;
+            }
+            if( hdr.seq > after ) {
+                if( hdr.seq > end || scanned >= HISTORY_SCAN )
+                    return seq;
+                const char *from = buf.data() + off + sizeof( hdr );
+                const char *to = from + hdr.from_size;
+                const char *frame = to + hdr.to_size;
+                size_t frame_size = hdr.length - sizeof( hdr ) - hdr.from_size - hdr.to_size;
+                if( is_for( string( from, hdr.from_size ), string( to, hdr.to_size ), name ) ) {
+                    if( !out->empty() && bytes + frame_size > max_bytes )
+                        return seq;
+                    out->push_back( make_shared<string>( frame, frame_size ) );
+                    bytes += frame_size;
+                }
+                seq = hdr.seq;
+                scanned++;
+            }
+            off += hdr.length;
+        }
+        pos += off;
+    }
+    return seq;
+}
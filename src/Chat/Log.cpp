@@ -0,0 +1,270 @@
+#include "Chat.h"
+
+/*
+* Asynchronous leveled logger. Every thread formats its records into its own lock free single
+* producer ring, a background writer thread drains every ring in batches and writes them to the sink.
+* When a ring is full the record is dropped and counted instead of blocking the caller.
+* A writer that found nothing for a while blocks until the next record, only then a producer
+* takes a lock to wake it up.
+*/
+
+#ifndef log_record
+struct log_record {
+    int level;
+    int len;
+    char text[ LOG_RECORD_SIZE ];
+};
+#endif
+
+#ifndef log_ring
+struct log_ring {
+    log_record records[ LOG_RING_SIZE ];
+    atomic<unsigned long> head;
+    atomic<unsigned long> tail;
+    atomic<unsigned long> dropped;
+    atomic<int> retired;
+    log_ring *next;
+};
+#endif
+
+/*
+* Owns the ring of the current thread, marks it as retired when the thread exits so the writer frees it
+*/
+struct log_ring_owner {
+    log_ring *ring;
+    ~log_ring_owner() {
+        if( ring != NULL )
+            ring->retired.store( 1, memory_order_release );
+    }
+};
+
+static thread_local log_ring_owner _thread_ring = { NULL };
+static pthread_mutex_t _rings_mutex = PTHREAD_MUTEX_INITIALIZER;
+static log_ring *_rings = NULL;
+static atomic<FILE *> _sink( NULL );
+static atomic<int> _level( LOG_COMPILE_LEVEL );
+static atomic<int> _writer_started( 0 );
+static atomic<unsigned long> _passes( 0 );
+static atomic<unsigned long> _dropped( 0 );
+static pthread_mutex_t _wake_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t _wake_cond = PTHREAD_COND_INITIALIZER;
+static atomic<int> _writer_blocked( 0 );
+
+static const char * level_name( int level ) {
+    switch ( level ) {
+        case LOG_LEVEL_ERROR:
+            return "ERROR: ";
+        case LOG_LEVEL_INFO:
+            return "INFO: ";
+        default:
+            return "DEBUG: ";
+    }
+}
+
+/*
+* Get the ring of the calling thread, registering a new one on its first record
+*/
+static log_ring * thread_ring() {
+    if( _thread_ring.ring == NULL ) {
+        log_ring *ring = new log_ring;
+        ring->head = 0;
+        ring->tail = 0;
+        ring->dropped = 0;
+        ring->retired = 0;
+        pthread_mutex_lock( &_rings_mutex );
+        ring->next = _rings;
+        _rings = ring;
+        pthread_mutex_unlock( &_rings_mutex );
+        _thread_ring.ring = ring;
+    }
+    return _thread_ring.ring;
+}
+
+/*
+* Drain every ring once into the sink. returns the number of records written
+*/
+static unsigned long drain_rings() {
+    static char batch[ LOG_BATCH_SIZE ];
+    size_t batch_len = 0;
+    unsigned long drained = 0;
+    unsigned long dropped = 0;
+    FILE *sink = _sink.load( memory_order_acquire );
+
+    pthread_mutex_lock( &_rings_mutex );
+    log_ring **prev = &_rings;
+    while( *prev != NULL ) {
+        log_ring *ring = *prev;
+        unsigned long tail = ring->tail.load( memory_order_relaxed );
+        unsigned long head = ring->head.load( memory_order_acquire );
+        while( tail != head ) {
+            log_record *rec = &ring->records[ tail % LOG_RING_SIZE ];
+            const char *prefix = level_name( rec->level );
+            size_t needed = strlen( prefix ) + rec->len + 1;
+            if( batch_len + needed > sizeof( batch ) ) {
+                if( sink != NULL )
+                    fwrite( batch, 1, batch_len, sink );
+                batch_len = 0;
+            }
+            memcpy( batch + batch_len, prefix, strlen( prefix ) );
+            batch_len += strlen( prefix );
+            memcpy( batch + batch_len, rec->text, rec->len );
+            batch_len += rec->len;
+            if( rec->len == 0 || rec->text[ rec->len - 1 ] != '\n' )
+                batch[ batch_len++ ] = '\n';
+            tail++;
+            drained++;
+        }
+        ring->tail.store( tail, memory_order_release );
+        dropped += ring->dropped.exchange( 0 );
+
+        /* Free rings of finished threads once they are empty */
+        if( ring->retired.load( memory_order_acquire ) && ring->head.load( memory_order_acquire ) == tail ) {
+            *prev = ring->next;
+            delete ring;
+        } else {
+            prev = &ring->next;
+        }
+    }
+    pthread_mutex_unlock( &_rings_mutex );
+
+    if( sink != NULL ) {
+        if( batch_len > 0 )
+            fwrite( batch, 1, batch_len, sink );
+        if( dropped > 0 )
+            fprintf( sink, "ERROR: Log buffer full, dropped %lu records\n", dropped );
+        if( batch_len > 0 || dropped > 0 )
+            fflush( sink );
+    }
+    _dropped += dropped;
+    return drained;
+}
+
+/*
+* Wake the writer if it is blocked waiting for records
+*/
+static void wake_writer() {
+    if( !_writer_blocked.load() )
+        return;
+    pthread_mutex_lock( &_wake_mutex );
+    _writer_blocked.store( 0 );
+    pthread_cond_signal( &_wake_cond );
+    pthread_mutex_unlock( &_wake_mutex );
+}
+
+/*
+* Background writer, sleeps longer the longer there is nothing to write so records are written
+* in batches. Once the longest sleep found nothing it blocks until a record is logged.
+*/
+static void * log_writer( void * ) {
+    useconds_t idle_sleep = 1000;
+    while( 1 ) {
+        unsigned long drained = drain_rings();
+        _passes++;
+        if( drained > 0 ) {
+            idle_sleep = 1000;
+        } else if( idle_sleep < 20000 ) {
+            usleep( idle_sleep );
+            idle_sleep *= 2;
+        } else {
+            /* Producers check the flag after publishing, a record logged meanwhile is drained */
+            _writer_blocked.store( 1 );
+            atomic_thread_fence( memory_order_seq_cst );
+            if( drain_rings() > 0 ) {
+                _writer_blocked.store( 0 );
+                idle_sleep = 1000;
+                continue;
+            }
+            pthread_mutex_lock( &_wake_mutex );
+            while( _writer_blocked.load() )
+                pthread_cond_wait( &_wake_cond, &_wake_mutex );
+            pthread_mutex_unlock( &_wake_mutex );
+            idle_sleep = 1000;
+        }
+    }
+    return NULL;
+}
+
+/*
+* Set the log sink and start the writer thread if it is not running
+*/
+void log_init( FILE *sink ) {
+    _sink.store( sink, memory_order_release );
+    int expected = 0;
+    if( _writer_started.compare_exchange_strong( expected, 1 ) ) {
+        pthread_t thread;
+        pthread_create( &thread, NULL, &log_writer, NULL );
+        pthread_detach( thread );
+    }
+}
+
+/*
+* Change the runtime level. Levels above LOG_COMPILE_LEVEL are compiled out and can not be enabled
+*/
+void log_set_level( int level ) {
+    _level.store( level, memory_order_relaxed );
+}
+
+/*
+* Check level is enabled at runtime
+*/
+int log_enabled( int level ) {
+    return level <= _level.load( memory_order_relaxed );
+}
+
+/*
+* Format a record on the calling thread ring. Never blocks, drops the record if the ring is full
+*/
+void log_write( int level, const char *fmt, ... ) {
+    if( !log_enabled( level ) )
+        return;
+
+    log_ring *ring = thread_ring();
+    unsigned long head = ring->head.load( memory_order_relaxed );
+    if( head - ring->tail.load( memory_order_acquire ) >= LOG_RING_SIZE ) {
+        ring->dropped++;
+        return;
+    }
+
+    log_record *rec = &ring->records[ head % LOG_RING_SIZE ];
+    va_list args;
+    va_start( args, fmt );
+    int len = vsnprintf( rec->text, LOG_RECORD_SIZE, fmt, args );
+    va_end( args );
+    if( len < 0 )
+        len = 0;
+    if( len >= LOG_RECORD_SIZE )
+        len = LOG_RECORD_SIZE - 1;
+    rec->level = level;
+    rec->len = len;
+    ring->head.store( head + 1, memory_order_release );
+    atomic_thread_fence( memory_order_seq_cst );
+    wake_writer();
+}
+
+/*
+* Wait until every record logged before the call has been written
+*/
+void log_flush() {
+    if( !_writer_started.load() )
+        return;
+    unsigned long target = _passes.load() + 2;
+    while( _passes.load() < target ) {
+        wake_writer();
+        usleep( 1000 );
+    }
+}
+
+/*
+* Flush and stop writing to the current sink so it can be closed
+*/
+void log_close() {
+    log_flush();
+    _sink.store( NULL, memory_order_release );
+}
+
+/*
+* Total records dropped because a ring was full
+*/
+unsigned long log_dropped() {
+    return _dropped.load();
+}
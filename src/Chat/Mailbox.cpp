@@ -0,0 +1,43 @@
+#include "Chat.h"
+
+/*
+* Allocate an empty mailbox. Only one thread may push and only one thread may pop.
+*/
+mailbox * new_mailbox() {
+    mailbox *mb = new mailbox;
+    mb->head.store( 0, memory_order_relaxed );
+    mb->tail.store( 0, memory_order_relaxed );
+    return mb;
+}
+
+/*
+* Producer side: copy item into the next free slot
+* returns 0 on succes -1 if the mailbox is full
+*/
+int mailbox_push( mailbox *mb, const mail_item &item ) {
+    unsigned long tail = mb->tail.load( memory_order_relaxed );
+    if( tail - mb->head.load( memory_order_acquire ) >= MAILBOX_SIZE ) {
+        return -1;
+    }
+    mb->items[ tail & ( MAILBOX_SIZE - 1 ) ] = item;
+    mb->tail.store( tail + 1, memory_order_release );
+    return 0;
+}
+
+/*
+* Consumer side: move the oldest item into item and release its slot
+* returns 1 if an item was read 0 if the mailbox is empty
+*/
+int mailbox_pop( mailbox *mb, mail_item *item ) {
+    unsigned long head = mb->head.load( memory_order_relaxed );
+    if( head == mb->tail.load( memory_order_acquire ) ) {
+        return 0;
+    }
+    mail_item &slot = mb->items[ head & ( MAILBOX_SIZE - 1 ) ];
+    *item = slot;
+    /* Drop the slot references now so frames and queues are not kept alive by an old slot */
+    slot.out.reset();
+    slot.frame.reset();
+    mb->head.store( head + 1, memory_order_release );
+    return 1;
+}
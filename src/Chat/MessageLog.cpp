@@ -0,0 +1,456 @@
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include "Chat.h"
+
+/*
+* Append only log of the direct messages sent to offline users. The log is a directory of fixed
+* size segment files named after their base offset, each one preallocated and mapped whole.
+* Records are appended into the mapping of the last segment and read back from it when the
+* recipient logs in, a full segment rolls over to a new file. A background thread makes the
+* appends durable: it fdatasyncs every segment written since its last pass at once, so appenders
+* waiting in wait_durable share one sync (group commit).
+*
+* Record: header, recipient name, payload, padded to 8 bytes. The length is stored last so a
+* record that was being written when the process died reads as the end of the segment, and the
+* crc catches records torn by a power loss. A delivered record marks every message to its
+* recipient before the offset it carries as delivered, segments left without pending messages
+* are deleted from the oldest one.
+*/
+
+enum log_record_kind {
+    LOG_MESSAGE = 1,
+    LOG_DELIVERED = 2
+};
+
+struct log_header {
+    uint32_t length;
+    uint32_t crc;
+    uint16_t kind;
+    uint16_t name_size;
+    uint32_t reserved;
+};
+
+/* Table of the reflected crc32 polynomial */
+struct crc_table {
+    uint32_t values[ 256 ];
+    crc_table() {
+        for( uint32_t i = 0; i < 256; i++ ) {
+            uint32_t c = i;
+            for( int k = 0; k < 8; k++ )
+                c = c & 1 ? 0xEDB88320 ^ ( c >> 1 ) : c >> 1;
+            values[ i ] = c;
+        }
+    }
+};
+
+static uint32_t crc32( const char *data, size_t size ) {
+    static const crc_table table;
+    uint32_t c = 0xFFFFFFFF;
+    for( size_t i = 0; i < size; i++ )
+        c = table.values[ ( c ^ ( unsigned char )data[ i ] ) & 0xFF ] ^ ( c >> 8 );
+    return c ^ 0xFFFFFFFF;
+}
+
+static size_t align_record( size_t size ) {
+    return ( size + 7 ) & ~( size_t )7;
+}
+
+log_segment::~log_segment() {
+    if( map != NULL )
+        munmap( map, size );
+    if( fd >= 0 )
+        ::close( fd );
+}
+
+MessageLog::MessageLog() {
+    pthread_mutex_init( &_mutex, NULL );
+    pthread_cond_init( &_work, NULL );
+    pthread_cond_init( &_synced, NULL );
+    _running = 0;
+    _segment_size = MSG_LOG_SEGMENT_SIZE;
+    _pending_total = 0;
+    _pending_bytes = 0;
+    _written = 0;
+    _durable = 0;
+    _syncs = 0;
+}
+
+/*
+* Stops the flusher once everything written is durable
+*/
+MessageLog::~MessageLog() {
+    pthread_mutex_lock( &_mutex );
+    int running = _running;
+    _running = 0;
+    pthread_cond_signal( &_work );
+    pthread_mutex_unlock( &_mutex );
+    if( running )
+        pthread_join( _flusher, NULL );
+}
+
+/*
+* Open the log in dir, creating it if needed. Existing segments are scanned to rebuild the
+* pending messages, a torn record and everything after it in its segment is zeroed.
+* returns 0 on succes -1 on error
+*/
+int MessageLog::initiate( const string &dir, size_t segment_size ) {
+    _dir = dir;
+    _segment_size = segment_size;
+    if( mkdir( dir.c_str(), 0755 ) < 0 && errno != EEXIST ) {
+        LOG_ERROR( "Unable to create message log directory %s\n", dir.c_str() );
+        return -1;
+    }
+    DIR *d = opendir( dir.c_str() );
+    if( d == NULL ) {
+        LOG_ERROR( "Unable to open message log directory %s\n", dir.c_str() );
+        return -1;
+    }
+    vector<long> bases;
+    struct dirent *entry;
+    while( ( entry = readdir( d ) ) != NULL ) {
+        long base;
+        char end;
+        if( strlen( entry->d_name ) == 20 && sscanf( entry->d_name, "%16lx.lo%c", &base, &end ) == 2 && end == 'g' )
+            bases.push_back( base );
+    }
+    closedir( d );
+    sort( bases.begin(), bases.end() );
+
+    for( size_t i = 0; i < bases.size(); i++ ) {
+        if( open_segment( bases[ i ], 0 ) < 0 )
+            return -1;
+        recover( _segments.rbegin()->second.get() );
+    }
+    if( _segments.empty() && open_segment( 0, 1 ) < 0 )
+        return -1;
+
+    /* Every segment counts its pending messages so the delivered ones can be deleted */
+    for( unordered_map<string, deque<long> >::iterator it = _pending.begin(); it != _pending.end(); it++ ) {
+        for( size_t i = 0; i < it->second.size(); i++ )
+            segment_for( it->second[ i ] )->pending++;
+    }
+    drop_segments();
+
+    log_segment *last = _segments.rbegin()->second.get();
+    _written = _durable = last->base + last->used;
+    LOG_INFO( "Message log %s: %lu segments, %lu pending messages\n", dir.c_str(), _segments.size(), _pending_total );
+
+    _running = 1;
+    if( pthread_create( &_flusher, NULL, &flusher_h, this ) != 0 ) {
+        _running = 0;
+        return -1;
+    }
+    return 0;
+}
+
+/*
+* Map the segment starting at base, a new one is preallocated and its directory entry synced
+* returns 0 on succes -1 on error
+*/
+int MessageLog::open_segment( long base, int create ) {
+    char name[ 32 ];
+    snprintf( name, sizeof( name ), "/%016lx.log", base );
+    shared_ptr<log_segment> seg( new log_segment );
+    seg->base = base;
+    seg->map = NULL;
+    seg->used = 0;
+    seg->pending = 0;
+    seg->dirty = 0;
+    seg->path = _dir + name;
+    seg->fd = ::open( seg->path.c_str(), O_RDWR | ( create ? O_CREAT | O_EXCL : 0 ), 0644 );
+    if( seg->fd < 0 ) {
+        LOG_ERROR( "Unable to open message log segment %s\n", seg->path.c_str() );
+        return -1;
+    }
+
+    if( create ) {
+        seg->size = _segment_size;
+        if( posix_fallocate( seg->fd, 0, seg->size ) != 0 ) {
+            LOG_ERROR( "Unable to allocate message log segment %s\n", seg->path.c_str() );
+            unlink( seg->path.c_str() );
+            return -1;
+        }
+        int dir_fd = ::open( _dir.c_str(), O_RDONLY );
+        if( dir_fd >= 0 ) {
+            fsync( dir_fd );
+            ::close( dir_fd );
+        }
+    } else {
+        struct stat st;
+        if( fstat( seg->fd, &st ) < 0 || st.st_size < ( off_t )sizeof( log_header ) ) {
+            LOG_ERROR( "Invalid message log segment %s\n", seg->path.c_str() );
+            return -1;
+        }
+        seg->size = st.st_size;
+    }
+
+    void *map = mmap( NULL, seg->size, PROT_READ | PROT_WRITE, MAP_SHARED, seg->fd, 0 );
+    if( map == MAP_FAILED ) {
+        LOG_ERROR( "Unable to map message log segment %s\n", seg->path.c_str() );
+        return -1;
+    }
+    seg->map = ( char * )map;
+    _segments[ base ] = seg;
+    return 0;
+}
+
+/*
+* Replay the records of seg into the pending index. Stops at the first empty or invalid record,
+* an invalid one is zeroed with the rest of the segment so new records can take its place.
+* returns 1 if a torn record was found 0 otherwise
+*/
+int MessageLog::recover( log_segment *seg ) {
+    size_t pos = 0;
+    int torn = 0;
+    while( pos + sizeof( log_header ) <= seg->size ) {
+        const log_header *hdr = ( const log_header * )( seg->map + pos );
+        if( hdr->length == 0 )
+            break;
+        if( hdr->length < sizeof( log_header ) + hdr->name_size || pos + hdr->length > seg->size ||
+            hdr->crc != crc32( seg->map + pos + 8, hdr->length - 8 ) ) {
+            torn = 1;
+            break;
+        }
+
+        string name( seg->map + pos + sizeof( log_header ), hdr->name_size );
+        const char *data = seg->map + pos + sizeof( log_header ) + hdr->name_size;
+        if( hdr->kind == LOG_MESSAGE ) {
+            _pending[ name ].push_back( seg->base + pos );
+            _pending_total++;
+            _pending_bytes += align_record( hdr->length );
+        } else if( hdr->kind == LOG_DELIVERED ) {
+            long upto;
+            memcpy( &upto, data, sizeof( upto ) );
+            unordered_map<string, deque<long> >::iterator it = _pending.find( name );
+            while( it != _pending.end() && !it->second.empty() && it->second.front() < upto ) {
+                _pending_bytes -= record_size( it->second.front() );
+                it->second.pop_front();
+                _pending_total--;
+            }
+            if( it != _pending.end() && it->second.empty() )
+                _pending.erase( it );
+        }
+        pos += align_record( hdr->length );
+    }
+
+    if( torn ) {
+        LOG_ERROR( "Message log segment %s: torn record at %lu, truncated\n", seg->path.c_str(), pos );
+        memset( seg->map + pos, 0, seg->size - pos );
+        fdatasync( seg->fd );
+    }
+    seg->used = pos;
+    return torn;
+}
+
+/*
+* Write a record at the end of the log, rolling to a new segment when it does not fit.
+* Must be called with _mutex held.
+* returns the offset of the record or -1 on error
+*/
+long MessageLog::write_record( int kind, const string &name, const char *data, size_t size ) {
+    size_t length = sizeof( log_header ) + name.size() + size;
+    size_t rec = align_record( length );
+    if( rec > _segment_size || name.size() > 0xFFFF )
+        return -1;
+
+    shared_ptr<log_segment> seg = _segments.rbegin()->second;
+    if( seg->used + rec > seg->size ) {
+        if( open_segment( seg->base + seg->size, 1 ) < 0 )
+            return -1;
+        seg = _segments.rbegin()->second;
+    }
+
+    size_t pos = seg->used;
+    char *p = seg->map + pos;
+    log_header *hdr = ( log_header * )p;
+    hdr->kind = kind;
+    hdr->name_size = name.size();
+    hdr->reserved = 0;
+    memcpy( p + sizeof( log_header ), name.data(), name.size() );
+    memcpy( p + sizeof( log_header ) + name.size(), data, size );
+    hdr->crc = crc32( p + 8, length - 8 );
+    __atomic_store_n( &hdr->length, ( uint32_t )length, __ATOMIC_RELEASE );
+
+    seg->used = pos + rec;
+    _written = seg->base + seg->used;
+    if( !seg->dirty ) {
+        seg->dirty = 1;
+        _dirty.push_back( seg );
+    }
+    pthread_cond_signal( &_work );
+    return seg->base + pos;
+}
+
+/*
+* Segment holding offset
+*/
+log_segment * MessageLog::segment_for( long offset ) {
+    map<long, shared_ptr<log_segment> >::iterator it = _segments.upper_bound( offset );
+    return ( --it )->second.get();
+}
+
+/*
+* Bytes taken in the log by the record at offset
+*/
+size_t MessageLog::record_size( long offset ) {
+    log_segment *seg = segment_for( offset );
+    return align_record( ( ( const log_header * )( seg->map + ( offset - seg->base ) ) )->length );
+}
+
+/*
+* Delete the oldest segments while none of their messages is pending. Later segments may hold
+* delivered records of their messages, so a segment is never deleted before an older one.
+*/
+void MessageLog::drop_segments() {
+    while( _segments.size() > 1 && _segments.begin()->second->pending == 0 ) {
+        unlink( _segments.begin()->second->path.c_str() );
+        _segments.erase( _segments.begin() );
+    }
+}
+
+/*
+* Store message for recipient. The record is in the page cache when this returns, it survives
+* the process dying but not the machine until the flusher synced it, see wait_durable.
+* returns the offset of the record or -1 on error
+*/
+long MessageLog::append( const string &recipient, const string &message ) {
+    pthread_mutex_lock( &_mutex );
+    long offset = write_record( LOG_MESSAGE, recipient, message.data(), message.size() );
+    if( offset >= 0 ) {
+        _pending[ recipient ].push_back( offset );
+        _pending_total++;
+        _pending_bytes += record_size( offset );
+        segment_for( offset )->pending++;
+    }
+    pthread_mutex_unlock( &_mutex );
+    return offset;
+}
+
+/*
+* Block until the record at offset is on disk
+* returns 0 on succes -1 if the log was closed first
+*/
+int MessageLog::wait_durable( long offset ) {
+    pthread_mutex_lock( &_mutex );
+    while( _durable <= offset && _running )
+        pthread_cond_wait( &_synced, &_mutex );
+    int res = _durable > offset ? 0 : -1;
+    pthread_mutex_unlock( &_mutex );
+    return res;
+}
+
+/*
+* Move the oldest pending messages of recipient into messages, at most max_count and, past the
+* first one, max_bytes of payload. A delivered record is appended so they are not replayed.
+* returns the number of messages taken
+*/
+size_t MessageLog::take( const string &recipient, size_t max_bytes, size_t max_count, vector<string> *messages ) {
+    pthread_mutex_lock( &_mutex );
+    unordered_map<string, deque<long> >::iterator it = _pending.find( recipient );
+    size_t taken = 0, bytes = 0;
+    long last = -1;
+    while( it != _pending.end() && !it->second.empty() && taken < max_count ) {
+        long offset = it->second.front();
+        log_segment *seg = segment_for( offset );
+        const char *p = seg->map + ( offset - seg->base );
+        const log_header *hdr = ( const log_header * )p;
+        size_t size = hdr->length - sizeof( log_header ) - hdr->name_size;
+        if( taken > 0 && bytes + size > max_bytes )
+            break;
+        messages->push_back( string( p + sizeof( log_header ) + hdr->name_size, size ) );
+        bytes += size;
+        _pending_bytes -= align_record( hdr->length );
+        seg->pending--;
+        it->second.pop_front();
+        last = offset;
+        taken++;
+    }
+
+    if( taken > 0 ) {
+        long upto = last + 1;
+        if( write_record( LOG_DELIVERED, recipient, ( const char * )&upto, sizeof( upto ) ) < 0 )
+            LOG_ERROR( "Unable to mark messages of %s delivered, they will be sent again after a restart\n", recipient.c_str() );
+        _pending_total -= taken;
+        if( it->second.empty() )
+            _pending.erase( it );
+        drop_segments();
+    }
+    pthread_mutex_unlock( &_mutex );
+    return taken;
+}
+
+/*
+* Messages waiting for recipient
+*/
+size_t MessageLog::pending( const string &recipient ) {
+    pthread_mutex_lock( &_mutex );
+    unordered_map<string, deque<long> >::iterator it = _pending.find( recipient );
+    size_t res = it != _pending.end() ? it->second.size() : 0;
+    pthread_mutex_unlock( &_mutex );
+    return res;
+}
+
+size_t MessageLog::pending_total() {
+    pthread_mutex_lock( &_mutex );
+    size_t res = _pending_total;
+    pthread_mutex_unlock( &_mutex );
+    return res;
+}
+
+/*
+* Log bytes of the messages waiting for every recipient
+*/
+size_t MessageLog::pending_bytes() {
+    pthread_mutex_lock( &_mutex );
+    size_t res = _pending_bytes;
+    pthread_mutex_unlock( &_mutex );
+    return res;
+}
+
+/*
+* Number of group commits done by the flusher
+*/
+long MessageLog::syncs() {
+    pthread_mutex_lock( &_mutex );
+    long res = _syncs;
+    pthread_mutex_unlock( &_mutex );
+    return res;
+}
+
+void * MessageLog::flusher_h( void * context ) {
+    ( ( MessageLog * )context )->flush_loop();
+    return NULL;
+}
+
+/*
+* Sync every segment written since the last pass and publish how far the log is durable.
+* Appends that arrive during a sync go in the next one.
+*/
+void MessageLog::flush_loop() {
+    pthread_mutex_lock( &_mutex );
+    while( 1 ) {
+        while( _running && _written == _durable )
+            pthread_cond_wait( &_work, &_mutex );
+        if( _written == _durable )
+            break;
+
+        long target = _written;
+        vector< shared_ptr<log_segment> > dirty;
+        dirty.swap( _dirty );
+        for( size_t i = 0; i < dirty.size(); i++ )
+            dirty[ i ]->dirty = 0;
+        pthread_mutex_unlock( &_mutex );
+
+        for( size_t i = 0; i < dirty.size(); i++ ) {
+            if( fdatasync( dirty[ i ]->fd ) < 0 )
+                LOG_ERROR( "Unable to sync message log segment %s\n", dirty[ i ]->path.c_str() );
+        }
+
+        pthread_mutex_lock( &_mutex );
+        _durable = target;
+        _syncs++;
+        pthread_cond_broadcast( &_synced );
+    }
+    pthread_mutex_unlock( &_mutex );
+}
@@ -0,0 +1,372 @@
+#include <sys/un.h>
+#include "Chat.h"
+
+/*
+* Metrics registry. Counters and histograms live in slots of METRIC_SHARDS shards, every thread
+* is given a shard the first time it updates a metric and only adds to it with relaxed atomics,
+* a scrape sums the shards. Threads share a shard only when there are more of them than shards.
+* Gauges are functions called by the scrape. Metrics are registered before the server starts,
+* the hot paths use the ids without any lookup.
+*
+* Histograms are log linear like HDR histograms: values under 2 * METRIC_HIST_SUB have their own
+* bucket, then every power of two is split in METRIC_HIST_SUB buckets (12.5% wide). The text
+* format gets cumulative buckets at every power of two, and the quantiles from the fine buckets
+* in a name_quantile gauge.
+*/
+
+/* Shard of the calling thread, handed out round robin */
+static atomic<int> next_shard( 0 );
+static thread_local int shard_index = -1;
+
+static const double ranks[] = { 0.5, 0.9, 0.99, 0.999 };
+
+Metrics::Metrics() {
+    pthread_mutex_init( &_mutex, NULL );
+    _next_slot = 0;
+    for( int i = 0; i < METRIC_SHARDS; i++ )
+        _shards[ i ].store( NULL );
+    _admin_fd = -1;
+    _running = 0;
+}
+
+Metrics::~Metrics() {
+    if( _running.exchange( 0 ) ) {
+        pthread_join( _admin, NULL );
+    }
+    if( _admin_fd >= 0 ) {
+        close( _admin_fd );
+        if( !_admin_path.empty() )
+            unlink( _admin_path.c_str() );
+    }
+    for( int i = 0; i < METRIC_SHARDS; i++ )
+        delete _shards[ i ].load();
+}
+
+/*
+* Add info to the registry with slots shard slots
+* returns the first slot or -1 if the shards are full
+*/
+int Metrics::reserve( const metric_info &info, int slots ) {
+    pthread_mutex_lock( &_mutex );
+    int slot = -1;
+    if( _next_slot + slots <= METRIC_SLOTS ) {
+        slot = _next_slot;
+        _next_slot += slots;
+        _metrics.push_back( info );
+        _metrics.back().slot = slot;
+    }
+    pthread_mutex_unlock( &_mutex );
+    if( slot < 0 )
+        LOG_ERROR( "No room for metric %s\n", info.name.c_str() );
+    return slot;
+}
+
+/*
+* Register a counter, labels is empty or a list like option="broadcast".
+* Metrics with the same name must be registered one after the other.
+* returns the id to add to or -1 on error
+*/
+int Metrics::counter( const string &name, const string &help, const string &labels ) {
+    metric_info info;
+    info.name = name;
+    info.labels = labels;
+    info.help = help;
+    info.kind = METRIC_COUNTER;
+    info.scale = 1;
+    info.fn = NULL;
+    info.context = NULL;
+    return reserve( info, 1 );
+}
+
+/*
+* Register a gauge whose value fn returns when the metrics are scraped
+* returns 0 on succes -1 on error
+*/
+int Metrics::gauge( const string &name, const string &help, metric_fn fn, void *context, const string &labels ) {
+    metric_info info;
+    info.name = name;
+    info.labels = labels;
+    info.help = help;
+    info.kind = METRIC_GAUGE;
+    info.scale = 1;
+    info.fn = fn;
+    info.context = context;
+    return reserve( info, 0 ) < 0 ? -1 : 0;
+}
+
+/*
+* Register a histogram, observed values times scale are the exposed unit (1e-9 for nanoseconds
+* exposed as seconds)
+* returns the id to observe or -1 on error
+*/
+int Metrics::histogram( const string &name, const string &help, double scale, const string &labels ) {
+    metric_info info;
+    info.name = name;
+    info.labels = labels;
+    info.help = help;
+    info.kind = METRIC_HISTOGRAM;
+    info.scale = scale;
+    info.fn = NULL;
+    info.context = NULL;
+    return reserve( info, METRIC_HIST_BUCKETS + 2 );
+}
+
+/*
+* Shard of the calling thread, allocated by its first update
+*/
+metric_shard * Metrics::shard() {
+    if( shard_index < 0 )
+        shard_index = next_shard.fetch_add( 1, memory_order_relaxed ) % METRIC_SHARDS;
+    metric_shard *s = _shards[ shard_index ].load( memory_order_acquire );
+    if( s == NULL ) {
+        metric_shard *fresh = new metric_shard;
+        for( int i = 0; i < METRIC_SLOTS; i++ )
+            fresh->slots[ i ].store( 0, memory_order_relaxed );
+        if( _shards[ shard_index ].compare_exchange_strong( s, fresh, memory_order_acq_rel ) ) {
+            s = fresh;
+        } else {
+            delete fresh;
+        }
+    }
+    return s;
+}
+
+void Metrics::add( int id, long value ) {
+    if( id < 0 )
+        return;
+    shard()->slots[ id ].fetch_add( value, memory_order_relaxed );
+}
+
+/*
+* Bucket of value in a histogram
+*/
+static int hist_index( long value ) {
+    if( value < 2 * METRIC_HIST_SUB )
+        return value < 0 ? 0 : value;
+    if( value >= ( 1L << ( METRIC_HIST_SHIFTS + 4 ) ) )
+        value = ( 1L << ( METRIC_HIST_SHIFTS + 4 ) ) - 1;
+    int shift = 63 - __builtin_clzl( value ) - 3;
+    return METRIC_HIST_SUB * ( shift + 1 ) + ( int )( ( value >> shift ) - METRIC_HIST_SUB );
+}
+
+/*
+* Smallest value of bucket idx
+*/
+static long hist_lower( int idx ) {
+    if( idx < 2 * METRIC_HIST_SUB )
+        return idx;
+    int shift = idx / METRIC_HIST_SUB - 1;
+    return ( long )( idx % METRIC_HIST_SUB + METRIC_HIST_SUB ) << shift;
+}
+
+/*
+* Count value in histogram id, the sum and count follow the buckets
+*/
+void Metrics::observe( int id, long value ) {
+    if( id < 0 )
+        return;
+    metric_shard *s = shard();
+    s->slots[ id + hist_index( value ) ].fetch_add( 1, memory_order_relaxed );
+    s->slots[ id + METRIC_HIST_BUCKETS ].fetch_add( 1, memory_order_relaxed );
+    s->slots[ id + METRIC_HIST_BUCKETS + 1 ].fetch_add( value, memory_order_relaxed );
+}
+
+/*
+* Sum of slot id over the shards
+*/
+long Metrics::total( int id ) {
+    if( id < 0 )
+        return 0;
+    long sum = 0;
+    for( int i = 0; i < METRIC_SHARDS; i++ ) {
+        metric_shard *s = _shards[ i ].load( memory_order_acquire );
+        if( s != NULL )
+            sum += s->slots[ id ].load( memory_order_relaxed );
+    }
+    return sum;
+}
+
+/*
+* name{labels,extra} value
+*/
+static void write_sample( string *out, const string &name, const string &labels, const char *extra, double value ) {
+    char buf[ 64 ];
+    out->append( name );
+    if( !labels.empty() || extra != NULL ) {
+        out->append( "{" );
+        out->append( labels );
+        if( extra != NULL ) {
+            if( !labels.empty() )
+                out->append( "," );
+            out->append( extra );
+        }
+        out->append( "}" );
+    }
+    snprintf( buf, sizeof( buf ), " %.9g\n", value );
+    out->append( buf );
+}
+
+/*
+* Buckets at every power of two, sum and count of a histogram to out, its quantiles to quantiles
+*/
+void Metrics::write_histogram( const metric_info &info, string *out, string *quantiles ) {
+    vector<long> counts( METRIC_HIST_BUCKETS + 2 );
+    for( int i = 0; i < METRIC_HIST_BUCKETS + 2; i++ )
+        counts[ i ] = total( info.slot + i );
+
+    char le[ 64 ];
+    long seen = 0;
+    for( int i = 0; i < METRIC_HIST_BUCKETS; i++ ) {
+        if( i >= 2 * METRIC_HIST_SUB && i % METRIC_HIST_SUB == 0 ) {
+            snprintf( le, sizeof( le ), "le=\"%.9g\"", ( hist_lower( i ) - 1 ) * info.scale );
+            write_sample( out, info.name + "_bucket", info.labels, le, seen );
+        }
+        seen += counts[ i ];
+    }
+    write_sample( out, info.name + "_bucket", info.labels, "le=\"+Inf\"", seen );
+    write_sample( out, info.name + "_sum", info.labels, NULL, counts[ METRIC_HIST_BUCKETS + 1 ] * info.scale );
+    write_sample( out, info.name + "_count", info.labels, NULL, counts[ METRIC_HIST_BUCKETS ] );
+
+    for( size_t q = 0; q < sizeof( ranks ) / sizeof( ranks[0] ); q++ ) {
+        long rank = ( long )( ranks[ q ] * seen ), cumulative = 0;
+        int i = 0;
+        while( i < METRIC_HIST_BUCKETS - 1 && cumulative + counts[ i ] <= rank ) {
+            cumulative += counts[ i ];
+            i++;
+        }
+        snprintf( le, sizeof( le ), "quantile=\"%g\"", ranks[ q ] );
+        write_sample( quantiles, info.name + "_quantile", info.labels, le, seen > 0 ? ( hist_lower( i + 1 ) - 1 ) * info.scale : 0 );
+    }
+}
+
+/*
+* Every metric in the Prometheus text format
+*/
+string Metrics::scrape() {
+    pthread_mutex_lock( &_mutex );
+    vector<metric_info> metrics = _metrics;
+    pthread_mutex_unlock( &_mutex );
+
+    static const char *types[] = { "counter", "gauge", "histogram" };
+    string out, quantiles;
+    for( size_t i = 0; i < metrics.size(); i++ ) {
+        const metric_info &info = metrics[ i ];
+        if( i == 0 || metrics[ i - 1 ].name != info.name ) {
+            out.append( "# HELP " + info.name + " " + info.help + "\n" );
+            out.append( "# TYPE " + info.name + " " + types[ info.kind ] + "\n" );
+        }
+        if( info.kind == METRIC_COUNTER ) {
+            write_sample( &out, info.name, info.labels, NULL, total( info.slot ) );
+        } else if( info.kind == METRIC_GAUGE ) {
+            write_sample( &out, info.name, info.labels, NULL, info.fn( info.context ) );
+        } else {
+            write_histogram( info, &out, &quantiles );
+        }
+
+        /* The quantiles of a histogram family follow it as a gauge family */
+        if( !quantiles.empty() && ( i + 1 == metrics.size() || metrics[ i + 1 ].name != info.name ) ) {
+            out.append( "# HELP " + info.name + "_quantile Quantiles of " + info.name + "\n" );
+            out.append( "# TYPE " + info.name + "_quantile gauge\n" );
+            out.append( quantiles );
+            quantiles.clear();
+        }
+    }
+    return out;
+}
+
+/*
+* Answer scrapes on address, a port number listens on 127.0.0.1 and anything else is the path of
+* a Unix socket. Every connection gets the metrics as an HTTP response and is closed.
+* returns 0 on succes -1 on error
+*/
+int Metrics::serve( const char *address ) {
+    int is_port = address[0] != '\0' && strspn( address, "0123456789" ) == strlen( address );
+    if( is_port ) {
+        struct sockaddr_in addr;
+        memset( &addr, 0, sizeof( addr ) );
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons( atoi( address ) );
+        addr.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+        if( ( _admin_fd = socket( AF_INET, SOCK_STREAM, 0 ) ) < 0 ) {
+            LOG_ERROR( "Unable to create admin socket\n" );
+            return -1;
+        }
+        int one = 1;
+        setsockopt( _admin_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof( one ) );
+        if( bind( _admin_fd, (struct sockaddr *)&addr, sizeof( addr ) ) < 0 ) {
+            LOG_ERROR( "Unable to bind admin port %s\n", address );
+            return -1;
+        }
+    } else {
+        struct sockaddr_un addr;
+        memset( &addr, 0, sizeof( addr ) );
+        addr.sun_family = AF_UNIX;
+        if( strlen( address ) >= sizeof( addr.sun_path ) ) {
+            LOG_ERROR( "Admin socket path too long\n" );
+            return -1;
+        }
+        strcpy( addr.sun_path, address );
+        unlink( address );
+        _admin_fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+        if( _admin_fd < 0 || bind( _admin_fd, (struct sockaddr *)&addr, sizeof( addr ) ) < 0 ) {
+            LOG_ERROR( "Unable to bind admin socket %s\n", address );
+            return -1;
+        }
+        _admin_path = address;
+    }
+    if( listen( _admin_fd, 16 ) < 0 ) {
+        LOG_ERROR( "Unable to listen on admin address %s\n", address );
+        return -1;
+    }
+
+    _running = 1;
+    if( pthread_create( &_admin, NULL, &admin_h, this ) != 0 ) {
+        _running = 0;
+        LOG_ERROR( "Unable to start admin thread\n" );
+        return -1;
+    }
+    LOG_INFO( "Serving metrics on %s\n", address );
+    return 0;
+}
+
+void * Metrics::admin_h( void * context ) {
+    ( ( Metrics * )context )->admin_loop();
+    return NULL;
+}
+
+/*
+* Answer one scrape at a time until the registry is destroyed, the request is read up to its
+* blank line and otherwise ignored
+*/
+void Metrics::admin_loop() {
+    struct pollfd pfd;
+    pfd.fd = _admin_fd;
+    pfd.events = POLLIN;
+    while( _running ) {
+        if( poll( &pfd, 1, 200 ) <= 0 )
+            continue;
+        int fd = accept( _admin_fd, NULL, NULL );
+        if( fd < 0 )
+            continue;
+
+        struct timeval timeout;
+        timeout.tv_sec = 1;
+        timeout.tv_usec = 0;
+        setsockopt( fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof( timeout ) );
+        string req;
+        char buf[ 1024 ];
+        while( req.size() < 8192 && req.find( "\r\n\r\n" ) == string::npos ) {
+            ssize_t n = recv( fd, buf, sizeof( buf ), 0 );
+            if( n <= 0 )
+                break;
+            req.append( buf, n );
+        }
+
+        string body = scrape();
+        char head[ 128 ];
+        snprintf( head, sizeof( head ), "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %lu\r\n\r\n", body.size() );
+        if( write_all( fd, head, strlen( head ) ) == 0 )
+            write_all( fd, body.data(), body.size() );
+        close( fd );
+    }
+}
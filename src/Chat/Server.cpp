@@ -1,382 +1,2139 @@
+#include <random>
 #include "Chat.h"
 
 using namespace chat;
 
+/* Worker running on the calling thread, NULL outside the event loop */
+thread_local event_worker *Server::_self = NULL;
+
+/*
+* Start server instance. Saves port where the server will be running and defines the log level
+*/
+Server::Server( int port, FILE *log_level, server_mode mode ) {
+    _user_count = 1;
+    _port = port;
+    log_init( log_level );
+    _mode = mode;
+    _n_workers = 1;
+    _backlog = MAX_QUEUE;
+    _handshake_timeout_ms = HANDSHAKE_TIMEOUT_MS;
+    _backend = EPOLL_BACKEND;
+    _out_max_bytes = OUT_MAX_BYTES;
+    _out_max_frames = OUT_MAX_FRAMES;
+    _out_policy = DROP_OLDEST_BROADCAST;
+    _batch_window_us = BATCH_WINDOW_US;
+    _batch_max_bytes = BATCH_MAX_BYTES;
+    _log = NULL;
+    pthread_mutex_init( &_req_queue_mutex, NULL );
+    register_metrics();
+}
+
+/* Names of the client options in the request metrics, 0 counts the invalid ones */
+static const char *option_names[ CLIENT_OPTIONS ] = {
+    "invalid", "synchronize", "connected_users", "change_status", "broadcast", "direct_message",
+    "acknowledge", "presence", "join_channel", "leave_channel", "channel_message", "history"
+};
+
+/*
+* Register the server metrics, the ids are kept in _m for the hot paths
+*/
+void Server::register_metrics() {
+    _m.accepted = _metrics.counter( "chat_connections_accepted_total", "Connections accepted" );
+    _m.closed = _metrics.counter( "chat_connections_closed_total", "Connections closed" );
+    _m.logins = _metrics.counter( "chat_logins_total", "Users registered, including resumed sessions" );
+    _m.login_failures = _metrics.counter( "chat_login_failures_total", "Registrations refused" );
+    for( int i = 0; i < CLIENT_OPTIONS; i++ ) {
+        string label = string( "option=\"" ) + option_names[ i ] + "\"";
+        _m.requests[ i ] = _metrics.counter( "chat_requests_total", "Requests of logged in users by option", label );
+    }
+    for( int i = 0; i < CLIENT_OPTIONS; i++ ) {
+        string label = string( "option=\"" ) + option_names[ i ] + "\"";
+        _m.latency[ i ] = _metrics.histogram( "chat_request_duration_seconds", "Time from parsing a request to queueing its response", 1e-9, label );
+    }
+    _m.bytes_in = _metrics.counter( "chat_bytes_received_total", "Bytes of the frames received" );
+    _m.bytes_out = _metrics.counter( "chat_bytes_sent_total", "Bytes of the frames queued to clients" );
+    _m.fanout = _metrics.histogram( "chat_broadcast_recipients", "Connections a broadcast is queued to", 1 );
+    _m.dropped = _metrics.counter( "chat_frames_dropped_total", "Frames dropped by full outbound queues" );
+    _m.send_errors = _metrics.counter( "chat_send_errors_total", "Frames that could not be queued or written" );
+    _m.handshake_timeouts = _metrics.counter( "chat_handshake_timeouts_total", "Connections closed before finishing the login handshake in time" );
+    _metrics.gauge( "chat_connections_open", "Connections accepted and not closed yet", &open_connections, this );
+    _metrics.gauge( "chat_users", "Registered users", &connected_users, this );
+    _metrics.gauge( "chat_send_queue_bytes", "Bytes waiting in the outbound queues", &queued_bytes, this );
+    _metrics.gauge( "chat_send_queue_frames", "Frames waiting in the outbound queues", &queued_frames, this );
+    _metrics.gauge( "chat_send_queue_max_bytes", "Bytes waiting in the fullest outbound queue", &max_queued_bytes, this );
+}
+
+/*
+* Serve the metrics on address, a localhost port or the path of a Unix socket
+* returns 0 on succes -1 on error
+*/
+int Server::set_admin( const char *address ) {
+    return _metrics.serve( address );
+}
+
+long Server::open_connections( void *context ) {
+    Server *s = ( Server * )context;
+    return s->_metrics.total( s->_m.accepted ) - s->_metrics.total( s->_m.closed );
+}
+
+long Server::connected_users( void *context ) {
+    return ( ( Server * )context )->get_all_users()->users.size();
+}
+
+/*
+* Sum or max of the queued bytes or frames of every user queue
+*/
+static long queue_stat( user_snapshot all_users, int frames, int largest ) {
+    long res = 0;
+    user_map::const_iterator it;
+    for( it = all_users->users.begin(); it != all_users->users.end(); it++ ) {
+        send_queue *q = it->second.out.get();
+        pthread_mutex_lock( &q->mutex );
+        long value = frames ? q->frames.size() : q->bytes;
+        pthread_mutex_unlock( &q->mutex );
+        res = largest ? max( res, value ) : res + value;
+    }
+    return res;
+}
+
+long Server::queued_bytes( void *context ) {
+    return queue_stat( ( ( Server * )context )->get_all_users(), 0, 0 );
+}
+
+long Server::queued_frames( void *context ) {
+    return queue_stat( ( ( Server * )context )->get_all_users(), 1, 0 );
+}
+
+long Server::max_queued_bytes( void *context ) {
+    return queue_stat( ( ( Server * )context )->get_all_users(), 0, 1 );
+}
+
+/*
+* Count a request of a logged in user with option that started at start_ns
+*/
+void Server::count_request( int option, long start_ns ) {
+    int slot = option > 0 && option < CLIENT_OPTIONS ? option : 0;
+    _metrics.add( _m.requests[ slot ] );
+    _metrics.observe( _m.latency[ slot ], monotonic_ns() - start_ns );
+}
+
+/*
+* Close the outbound queue of a connection that is going away
+*/
+void Server::release_client( const client_info &cl ) {
+    close_send_queue( cl.out.get() );
+    _metrics.add( _m.closed );
+}
+
+/*
+* Limits of every connection outbound queue and what to do when a slow client goes over them.
+* Applies to connections accepted after the call.
+*/
+void Server::set_outbound_limits( size_t max_bytes, size_t max_frames, overflow_policy policy ) {
+    _out_max_bytes = max_bytes;
+    _out_max_frames = max_frames;
+    _out_policy = policy;
+}
+
+/*
+* Coalescing of deliveries to clients that support batches: they wait up to window_us microseconds
+* or until max_bytes are held. A window of 0 turns batching off.
+* Applies to users registered after the call.
+*/
+void Server::set_batching( long window_us, size_t max_bytes ) {
+    _batch_window_us = window_us;
+    _batch_max_bytes = window_us > 0 ? max_bytes : 0;
+}
+
+/*
+* Number of event loop threads started by the WORKERS mode
+*/
+void Server::set_workers( int n_workers ) {
+    _n_workers = n_workers > 0 ? n_workers : 1;
+}
+
+/*
+* I/O backend of the event loop modes. io_uring falls back to epoll when the kernel lacks support.
+*/
+void Server::set_backend( io_backend backend ) {
+    _backend = backend;
+}
+
+/*
+* Connections the kernel queues on the listening sockets before refusing new ones, capped by
+* net.core.somaxconn. Applies to listeners opened after the call.
+*/
+void Server::set_backlog( int backlog ) {
+    _backlog = backlog > 0 ? backlog : MAX_QUEUE;
+}
+
+/*
+* Time a new connection has to log in and ACK its id before it is closed
+*/
+void Server::set_handshake_timeout( long timeout_ms ) {
+    _handshake_timeout_ms = timeout_ms > 0 ? timeout_ms : HANDSHAKE_TIMEOUT_MS;
+}
+
+/*
+* Initiate server on port
+* returns 0 on succes -1 on error
+*/
+int Server::initiate() {
+    _serv_addr.sin_family = AF_INET; 
+    _serv_addr.sin_addr.s_addr = INADDR_ANY; 
+    _serv_addr.sin_port = htons( _port ); // Convert to host byte order
+
+    /* Workers share the port, every one of them gets its own listening socket */
+    if( ( _sock = open_listener( _mode == WORKERS ) ) < 0 ) {
+        return -1;
+    }
+    return 0;
+}
+
+/*
+* Create a socket listening on the server port. With reuse_port the kernel balances
+* new connections between every socket bound to the port.
+* returns the socket fd or -1 on error
+*/
+int Server::open_listener( int reuse_port ) {
+    /* Create socket for server */
+    LOG_DEBUG( "Creating new server socket\n" );
+    int sock;
+    if( ( sock = socket( AF_INET, SOCK_STREAM, 0 ) ) < 0 ) {
+        LOG_ERROR( "Socket creation error\n" );
+        return -1;
+    }
+
+    LOG_DEBUG( "Socket created correctly fd: %d\n", sock );
+
+    int on = 1;
+    /* A restarted server binds again while connections of the previous one are in TIME_WAIT */
+    if( setsockopt( sock, SOL_SOCKET, SO_REUSEADDR, &on, sizeof( on ) ) < 0 ) {
+        LOG_ERROR( "Unable to set SO_REUSEADDR on socket %d\n", sock );
+        close( sock );
+        return -1;
+    }
+    if( reuse_port && setsockopt( sock, SOL_SOCKET, SO_REUSEPORT, &on, sizeof( on ) ) < 0 ) {
+        LOG_ERROR( "Unable to set SO_REUSEPORT on socket %d\n", sock );
+        close( sock );
+        return -1;
+    }
+
+    /* Bind server to port */
+    LOG_DEBUG( "Binding socket %d to port %d\n", sock, _port );
+    if( bind(sock, (struct sockaddr *)&_serv_addr, sizeof(_serv_addr)) < 0 ) { // Bind server address to socket
+        LOG_ERROR( "Error binding address to socket\n" );
+        close( sock );
+        return -1;
+    }
+
+    /* Set socket to listen for connections */
+    LOG_DEBUG( "Setting socket to listen for connections...\n" );
+    if( listen( sock, _backlog ) < 0 ) { // queue _backlog requests before refusing
+        LOG_ERROR( "Unable to listen for messages\n" );
+        close( sock );
+        return -1;
+    }
+
+    return sock;
+}
+
+/*
+* Listen for new connections and adds them to the request queue to be processed
+* returns 0 on succes -1 on error
+*/
+int Server::listen_connections() {
+    /* Accept incoming request */
+    int addr_size = sizeof(_cl_addr);
+    int req_fd = accept( _sock, (struct sockaddr *)&_cl_addr, (socklen_t*)&addr_size );
+    if(req_fd < 0) {
+        LOG_ERROR( "Error on connection with cliet\n" );
+        return -1;
+    }
+
+    LOG_INFO( "Accepted request with fd: %d\n", req_fd );
+
+    /* Save request info to queue */
+    req_push( new_client( req_fd, _cl_addr ) );
+
+    LOG_DEBUG( "Request added to queue id: %d\n", _user_count.load() );
+
+    return 0;
+}
+
+/*
+* Build the client info of a new connection on fd: assigns the user id, ip and outbound queue
+*/
+client_info Server::new_client( int fd, struct sockaddr_in addr ) {
+    /* Get the incomming request ip */
+    char ipstr[ INET6_ADDRSTRLEN ];
+    inet_ntop( AF_INET, &addr.sin_addr, ipstr, sizeof( ipstr ) );
+    LOG_INFO( "Incomming request ip %s\n", ipstr );
+
+    /* Writes are already coalesced by the outbound queue, Nagle would only delay them */
+    int one = 1;
+    setsockopt( fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof( one ) );
+
+    event_worker *w = current_worker();
+    _metrics.add( _m.accepted );
+    client_info new_cl;
+    new_cl.id = _user_count++;
+    new_cl.socket_info = addr;
+    new_cl.req_fd = fd;
+    new_cl.ip = ipstr;
+    new_cl.out = new_send_queue( fd, _mode == THREADED, _out_max_bytes, _out_max_frames, _out_policy );
+    new_cl.worker = w != NULL ? w->id : -1;
+    return new_cl;
+}
+
+/*
+* Accept every pending connection on the worker listening socket and register them
+* on its event loop. Used by the event loop modes instead of listen_connections.
+* returns the number of accepted connections or -1 on error
+*/
+int Server::accept_connections( event_worker *w ) {
+    int accepted = 0;
+    while( 1 ) {
+        struct sockaddr_in cl_addr;
+        socklen_t addr_size = sizeof( cl_addr );
+        int req_fd = accept4( w->listen_fd, (struct sockaddr *)&cl_addr, &addr_size, SOCK_NONBLOCK );
+        if( req_fd < 0 ) {
+            if( errno == EINTR )
+                continue;
+            if( errno == EAGAIN || errno == EWOULDBLOCK )
+                break;
+            LOG_ERROR( "Error on connection with client\n" );
+            return -1;
+        }
+
+        if( add_connection( w, req_fd, cl_addr ) != NULL )
+            accepted++;
+    }
+    return accepted;
+}
+
+/*
+* Register an accepted socket on worker w. On epoll it is watched for reads and writes,
+* on io_uring a multishot receive is armed.
+* returns the new connection or NULL on error
+*/
+connection * Server::add_connection( event_worker *w, int fd, struct sockaddr_in addr ) {
+    LOG_INFO( "Accepted request with fd: %d\n", fd );
+
+    /* Connection starts waiting for the sync message */
+    connection *conn = new connection;
+    conn->fd = fd;
+    conn->phase = AWAITING_SYNC;
+    conn->handshake_deadline = monotonic_us() + _handshake_timeout_ms * 1000;
+    w->handshaking++;
+    conn->info = new_client( fd, addr );
+    conn->worker = w;
+    conn->send = NULL;
+    conn->sending = 0;
+    conn->dirty = 0;
+    conn->ops = 0;
+    conn->recv_armed = 0;
+    conn->resume = 0;
+    conn->batching = 0;
+    conn->closing = 0;
+
+    if( w->ring != NULL ) {
+        arm_uring_recv( w, conn );
+    } else {
+        struct epoll_event ev;
+        ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+        ev.data.ptr = conn;
+        if( epoll_ctl( w->epoll_fd, EPOLL_CTL_ADD, fd, &ev ) < 0 ) {
+            LOG_ERROR( "Unable to register fd %d on event loop\n", fd );
+            close( fd );
+            delete conn;
+            return NULL;
+        }
+    }
+    w->conns[ fd ] = conn;
+    return conn;
+}
+
+/*
+* Read the next framed request on socket fd into req. Bytes past the frame stay on in
+* so the next call can use them without reading the socket again. A deadline_us other than 0 is
+* the monotonic time at which it gives up with ETIMEDOUT.
+* Returns the size of the request, 0 if the client disconnected, or -1 if an error occurred.
+*/
+int Server::read_request( const client_info &cl, FrameBuffer *in, string *req, long deadline_us ) {
+    int fd = cl.req_fd;
+    LOG_DEBUG( "Waiting for request of fd: %d \n", fd );
+    int frame_st;
+    while( ( frame_st = in->next_frame( req ) ) == 0 ) {
+        /* Keep flushing queued responses while waiting for the client */
+        if( wait_readable( cl.out.get(), deadline_us ) < 0 ) {
+            LOG_ERROR( "Error waiting for request\n" );
+            return -1;
+        }
+        int read_size = in->read_from( fd );
+        if( read_size < 0 && errno == EINTR )
+            continue;
+        if( read_size < 0 ) {
+            LOG_ERROR( "Error reading request\n" );
+            return -1;
+        }
+        if( read_size == 0 )
+            return 0;
+    }
+    if( frame_st < 0 ) {
+        LOG_ERROR( "Invalid frame on fd %d\n", fd );
+        return -1;
+    }
+    return req->size();
+}
+
+/*
+* Send response res to client cl
+* returns 0 on succes -1 on error
+*/
+int Server::send_response( const client_info &cl, const ServerMessage &res ) {
+    /* Serealizing response */
+    LOG_DEBUG( "Serealizing response\n" );
+    return send_frame( cl, encode_message( res ) );
+}
+
+/*
+* Queue an already encoded frame on the client outbound queue and write as much as the socket takes
+* without blocking. The rest is written by the connection owner (event loop or connection thread).
+* Clients owned by another worker get the frame through the owner mailbox.
+* broadcast marks frames that can be dropped when the queue is full, delivery the ones that can be batched.
+* returns 0 on succes, 1 if a frame was dropped, -1 on error
+*/
+int Server::send_frame( const client_info &cl, frame_ptr frame, int broadcast, int delivery ) {
+    if( !cl.out ) {
+        LOG_ERROR( "Client %d has no connection\n", cl.id );
+        return -1;
+    }
+
+    event_worker *w = current_worker();
+    if( _mode == WORKERS && w != NULL && cl.worker >= 0 && cl.worker != w->id ) {
+        mail_item item;
+        item.kind = MAIL_DELIVER;
+        item.out = cl.out;
+        item.frame = frame;
+        item.broadcast = broadcast;
+        item.delivery = delivery;
+        item.presence = 0;
+        item.sequence = 0;
+        post_mail( w, cl.worker, item );
+        return 0;
+    }
+
+    LOG_DEBUG( "Sending response %d bytes to fd %d...\n", ( int )frame->size(), cl.req_fd );
+    return queue_frame( cl.out.get(), frame, broadcast, delivery );
+}
+
+/*
+* Enqueue and flush frame on q from the thread that is allowed to write it.
+* On io_uring the connection is only marked, its frames are submitted with the rest of the batch.
+* A worker connection that starts holding deliveries is tracked until its batch is sent.
+* conn is the connection of q if the caller has it at hand.
+* returns 0 on succes, 1 if a frame was dropped, -1 on error
+*/
+int Server::queue_frame( send_queue *q, frame_ptr frame, int broadcast, int delivery, connection *conn ) {
+    event_worker *w = current_worker();
+    int deferred = w != NULL && w->ring != NULL;
+
+    pthread_mutex_lock( &q->mutex );
+    int res = enqueue_frame( q, frame, broadcast, delivery );
+    int track = res >= 0 && w != NULL && q->held == 1;
+    if( conn == NULL && ( deferred || track ) && res >= 0 ) {
+        map<int, connection *>::iterator it = w->conns.find( q->fd );
+        conn = it != w->conns.end() ? it->second : NULL;
+    }
+    if( track && conn != NULL && !conn->batching ) {
+        conn->batching = 1;
+        w->batching.push_back( conn );
+    }
+    if( res >= 0 && deferred ) {
+        if( conn != NULL && q->frames.size() > q->held )
+            mark_dirty( w, conn );
+    } else if( res >= 0 ) {
+        if( flush_send_queue( q ) < 0 ) {
+            LOG_ERROR( "Error sending response\n" );
+            res = -1;
+        }
+    } else if( q->overflowed && q->fd >= 0 ) {
+        /* Slow consumer: the owner sees the shutdown as a disconnect and cleans up */
+        LOG_INFO( "Disconnecting slow client on fd %d\n", q->fd );
+        shutdown( q->fd, SHUT_RDWR );
+    }
+    pthread_mutex_unlock( &q->mutex );
+
+    if( res == 0 ) {
+        _metrics.add( _m.bytes_out, frame->size() );
+    } else if( res > 0 ) {
+        _metrics.add( _m.dropped );
+    } else {
+        _metrics.add( _m.send_errors );
+    }
+    return res;
+}
+
+/*
+* Add conn to the connections whose frames are submitted at the end of the io_uring batch
+*/
+void Server::mark_dirty( event_worker *w, connection *conn ) {
+    if( !conn->dirty ) {
+        conn->dirty = 1;
+        w->dirty.push_back( conn );
+    }
+}
+
+/*
+* Send the batches of w that are due
+* returns the microseconds until the next one is due or -1 if no connection holds deliveries
+*/
+long Server::flush_batches( event_worker *w ) {
+    long next = -1;
+    size_t kept = 0;
+    for( size_t i = 0; i < w->batching.size(); i++ ) {
+        connection *conn = w->batching[ i ];
+        send_queue *q = conn->info.out.get();
+        long wait_us = -1;
+        if( conn->fd >= 0 ) {
+            pthread_mutex_lock( &q->mutex );
+            wait_us = release_batch( q );
+            if( w->ring == NULL ) {
+                flush_send_queue( q );
+            } else if( q->frames.size() > q->held ) {
+                mark_dirty( w, conn );
+            }
+            pthread_mutex_unlock( &q->mutex );
+        }
+        if( wait_us < 0 ) {
+            conn->batching = 0;
+            continue;
+        }
+        w->batching[ kept++ ] = conn;
+        if( next < 0 || wait_us < next )
+            next = wait_us;
+    }
+    w->batching.resize( kept );
+    return next;
+}
+
+/*
+* Parse an incomming request on arena, returns the ClientMessage that was received
+*/
+ClientMessage * Server::parse_request( const string &req, Arena *arena ) {
+    /* deserealizing request */
+    LOG_DEBUG( "Deserealizing request\n" );
+    ClientMessage *cl_msg = Arena::CreateMessage<ClientMessage>( arena );
+    cl_msg->ParseFromString(req);
+    _metrics.add( _m.bytes_in, req.size() + FRAME_HEADER_SIZE );
+    return cl_msg;
+}
+
+/*
+* Process incoming message and convert to appropiate Server response.
+* The response and every message built for it live on arena.
+*/
+ServerMessage * Server::process_request( const ClientMessage &cl_msg, const client_info &cl, Arena *arena ) {
+    /* Get option */
+    int option = cl_msg.option();
+    ServerMessage *res;
+
+    /* Process acording to option */
+    LOG_DEBUG( "Processing request option: %d\n", option );
+    switch (option) {
+        case CONNECTEDUSER:
+            res = get_connected_users( cl_msg.connectedusers(), arena );
+            break;
+        case PRESENCEREQUEST:
+            res = presence_snapshot( cl, arena );
+            break;
+        case CHANGESTATUS:
+            res = change_user_status( cl_msg.changestatus(), cl.name, arena );
+            break;
+        case BROADCASTC:
+            res = broadcast_message( cl_msg.broadcast(), cl, arena );
+            break;
+        case DIRECTMESSAGE:
+            res = direct_message( cl_msg.directmessage(), cl, arena );
+            break;
+        case JOINCHANNEL:
+            res = join_channel( cl_msg.channel(), cl, arena );
+            break;
+        case LEAVECHANNEL:
+            res = leave_channel( cl_msg.channel(), cl, arena );
+            break;
+        case CHANNELMESSAGE:
+            res = channel_message( cl_msg.channelmessage(), cl, arena );
+            break;
+        case HISTORYREQUEST:
+            res = history_page( cl_msg.history().after(), cl_msg.history().has_until() ? cl_msg.history().until() : _history.sequence(), cl, arena );
+            break;
+        default:
+            res = error_response( "Invalid option\n", arena );
+            break;
+    }
+
+    /* Echo the request id so a client can keep many requests in flight */
+    if( cl_msg.has_requestid() )
+        res->set_requestid( cl_msg.requestid() );
+    return res;
+}
+
+/*
+* Random token a client presents to resume its session
+*/
+static string new_token() {
+    static thread_local mt19937_64 gen( random_device{}() ^ ( unsigned long )gettid() );
+    char token[ 33 ];
+    snprintf( token, sizeof( token ), "%016lx%016lx", ( unsigned long )gen(), ( unsigned long )gen() );
+    return token;
+}
+
+/*
+* Register new user on connected users, the ACK must arrive before deadline_us (0 waits forever)
+* returns username or empty string if unable to register user.
+* Unlike more other functions this one handles the responses to server and process client responses.
+* Like in the event loop any request acknowledges the id, it is handled once the messages stored
+* while the user was away are delivered.
+*/
+string Server::register_user( const MyInfoSynchronize &req, const client_info &cl, FrameBuffer *in, Arena *arena, long deadline_us ) {
+    string usr_nm = begin_registration( req, cl, arena );
+    if( usr_nm == "" ) {
+        return "";
+    }
+
+    /* Step 3: Reading client ACK, resumed sessions do not send it */
+    string ack;
+    if( !req.has_resumetoken() ) {
+        LOG_DEBUG( "Reading client ACK..\n" );
+        if( read_request( cl, in, &ack, deadline_us ) <= 0 ) {
+            if( errno == ETIMEDOUT )
+                _metrics.add( _m.handshake_timeouts );
+            delete_user( usr_nm, cl.id );
+            return "";
+        }
+
+        LOG_DEBUG( "Client ACK was process correctly.\n" );
+    }
+
+    client_info usr;
+    if( get_user( usr_nm, &usr ) == 0 ) {
+        deliver_offline( usr );
+        if( !ack.empty() ) {
+            long start_ns = monotonic_ns();
+            ClientMessage *in_req = parse_request( ack, arena );
+            if( in_req->option() != ACKNOWLEDGE ) {
+                send_response( cl, *process_request( *in_req, usr, arena ) );
+                count_request( in_req->option(), start_ns );
+            }
+        }
+    }
+
+    return usr_nm;
+}
+
+/*
+* First half of the user registration: validates and saves the user and sends back its id.
+* returns username or empty string if unable to register user.
+* Does not wait for the client ACK so it can be used from the event loop.
+*/
+string Server::begin_registration( const MyInfoSynchronize &req, const client_info &cl, Arena *arena ) {
+    LOG_INFO( "Registering new user\n" );
+    if( req.has_resumetoken() ) {
+        take_over( req );
+    }
+
+    /* Step 1: Register user and assign user id */
+    client_info conn_user;
+    if( prepare_user( req, cl, &conn_user, arena ) < 0 ) {
+        return "";
+    }
+
+    // Adding to db, checked again in case another connection registered them after the snapshot
+    LOG_INFO( "Save new user: %s id %d with conn fd: %d\n", req.username().c_str(), conn_user.id, conn_user.req_fd );
+    int add_res = add_user( conn_user );
+    if( add_res < 0 ) {
+        send_response( cl, *error_response( add_res == -1 ? "Username already in use" : "Ip already in use", arena ) );
+        _metrics.add( _m.login_failures );
+        return "";
+    }
+    _metrics.add( _m.logins );
+
+    /* Step 2: Return userid to client */
+    finish_registration( req, conn_user, arena );
+    return conn_user.name;
+}
+
+/*
+* Check the username and ip of a sync are free and build the client info of the new user in out.
+* Sends the error response if they are not.
+* returns 0 on succes -1 on error
+*/
+int Server::prepare_user( const MyInfoSynchronize &req, const client_info &cl, client_info *out, Arena *arena ) {
+    user_snapshot all_users = get_all_users();
+
+    // Check if user name or ip is registered
+    LOG_DEBUG( "Checking if username is in used..\n" );
+    if( all_users->find( req.username() ) != NULL ) {
+        send_response( cl, *error_response( "Username already in use", arena ) );
+        _metrics.add( _m.login_failures );
+        return -1;
+    }
+    LOG_DEBUG( "Checking if ip adddress is already connected to server\n" );
+    if( all_users->find_ip( cl.ip ) != NULL ) {
+        send_response( cl, *error_response( "Ip already in use", arena ) );
+        _metrics.add( _m.login_failures );
+        return -1;
+    }
+
+    // Adding mising data to client info
+    *out = cl;
+    out->name = req.username();
+    out->status = req.has_status() ? req.status() : "activo";
+    out->token = new_token();
+    return 0;
+}
+
+/*
+* Second half of the registration once the user is saved: sends its id, resume token and
+* sequence, then the presence snapshot and first history page it asked for
+*/
+void Server::finish_registration( const MyInfoSynchronize &req, const client_info &conn_user, Arena *arena ) {
+    /* Deliveries to clients that understand batches are coalesced */
+    send_queue *q = conn_user.out.get();
+    if( req.batch() && _batch_max_bytes > 0 ) {
+        pthread_mutex_lock( &q->mutex );
+        q->batch_window_us = _batch_window_us;
+        q->batch_max_bytes = _batch_max_bytes;
+        pthread_mutex_unlock( &q->mutex );
+    }
+
+    /* Messages after the sequence are delivered live */
+    unsigned long seq = _history.sequence();
+    if( req.has_lastsequence() ) {
+        pthread_mutex_lock( &q->mutex );
+        q->since.store( seq );
+        pthread_mutex_unlock( &q->mutex );
+    }
+    ServerMessage *res = Arena::CreateMessage<ServerMessage>( arena );
+    res->set_option( MYINFORESPONSE );
+    res->mutable_myinforesponse()->set_userid( conn_user.id );
+    res->mutable_myinforesponse()->set_resumetoken( conn_user.token );
+    res->mutable_myinforesponse()->set_sequence( seq );
+
+    LOG_DEBUG( "Sending ACK to client..\n" );
+    send_response( conn_user, *res );
+
+    /* Presence subscribers start from a snapshot and follow the deltas */
+    if( req.presence() ) {
+        send_response( conn_user, *presence_snapshot( conn_user, arena ) );
+    }
+
+    /* A reconnecting client gets the first page of what it missed, it asks for the rest */
+    if( req.has_lastsequence() ) {
+        send_response( conn_user, *history_page( req.lastsequence(), seq, conn_user, arena ) );
+    }
+}
+
+/*
+* Remove the session of a reconnecting client that the server still has, the client lost the
+* connection but its owner did not notice yet. Its socket is shut down so the owner cleans up,
+* without touching the new session which has another id.
+* returns 0 if the session was taken over -1 if there was none or the token does not match
+*/
+int Server::take_over( const MyInfoSynchronize &req ) {
+    client_info old;
+    if( get_user( req.username(), &old ) < 0 || old.token != req.resumetoken() ) {
+        return -1;
+    }
+    LOG_INFO( "User %s resumed its session, closing fd %d\n", old.name.c_str(), old.req_fd );
+    delete_user( old.name, old.id );
+    send_queue *q = old.out.get();
+    pthread_mutex_lock( &q->mutex );
+    if( q->fd >= 0 ) {
+        shutdown( q->fd, SHUT_RDWR );
+    }
+    pthread_mutex_unlock( &q->mutex );
+    return 0;
+}
+
+/*
+* Next page of the broadcasts and direct messages for cl with a sequence in (after, until].
+* The messages are sent right away, batched if cl supports it, the response closes the page.
+* A message sent while cl was logging in can come both live and in the first page.
+* returns the server response with where the page ended
+*/
+ServerMessage * Server::history_page( unsigned long after, unsigned long until, const client_info &cl, Arena *arena ) {
+    vector<frame_ptr> frames;
+    unsigned long last;
+    int truncated;
+    int more = _history.read( after, until, cl.name, HISTORY_PAGE_BYTES, &frames, &last, &truncated );
+
+    send_queue *q = cl.out.get();
+    pthread_mutex_lock( &q->mutex );
+    int batch = q->batch_max_bytes > 0;
+    pthread_mutex_unlock( &q->mutex );
+    if( batch && frames.size() > 1 ) {
+        send_frame( cl, encode_batch( frames ) );
+    } else {
+        for( size_t i = 0; i < frames.size(); i++ )
+            send_frame( cl, frames[ i ] );
+    }
+
+    ServerMessage *res = Arena::CreateMessage<ServerMessage>( arena );
+    res->set_option( HISTORYRESPONSE );
+    HistoryResponse *page = res->mutable_history();
+    page->set_last( last );
+    page->set_more( more );
+    page->set_messages( frames.size() );
+    if( truncated ) {
+        page->set_truncated( true );
+    }
+    return res;
+}
+
+/*
+* Keep the last entries broadcasts and direct messages in memory for reconnecting clients,
+* older ones go to history files in dir if it is not NULL.
+* returns 0 on succes -1 on error
+*/
+int Server::set_history( size_t entries, const char *dir ) {
+    return _history.initiate( entries, dir != NULL ? dir : "" );
+}
+
+/*
+* Get the connected users on the server. A username or user id looks up that single user,
+* otherwise a page of the users ordered by username, see user_table::list
+* returns the server response with the connected users
+*/
+ServerMessage * Server::get_connected_users( const connectedUserRequest &req, Arena *arena ) {
+    user_snapshot all_users = get_all_users();
+    ServerMessage *res = Arena::CreateMessage<ServerMessage>( arena );
+    res->set_option( CONNECTEDUSERRESPONSE );
+    ConnectedUserResponse *users = res->mutable_connecteduserresponse();
+
+    /* Single user lookups go through the name and id indexes */
+    if( req.has_username() || req.userid() > 0 ) {
+        const client_info *usr = req.has_username() ? all_users->find( req.username() ) : all_users->find( req.userid() );
+        if( usr == NULL ) {
+            return error_response( "User not found", arena );
+        }
+        ConnectedUser *c_user_l = users->add_connectedusers();
+        c_user_l->set_username( usr->name );
+        c_user_l->set_status( usr->status );
+        c_user_l->set_userid( usr->id );
+        return res;
+    }
+
+    /* Verify if there are connected users */
+    if( all_users->users.empty() ) {
+        return error_response( "No connected users", arena );
+    }
+    LOG_DEBUG( "Mapping connected users to response\n" );
+    all_users->list( req, users );
+    return res;
+}
+
+/*
+* Subscribe cl to the presence stream and get the versioned list of connected users.
+* Deltas published after the subscription have a higher version than the snapshot.
+* returns the server response with the snapshot
+*/
+ServerMessage * Server::presence_snapshot( const client_info &cl, Arena *arena ) {
+    send_queue *q = cl.out.get();
+    pthread_mutex_lock( &q->mutex );
+    q->presence.store( 1 );
+    pthread_mutex_unlock( &q->mutex );
+
+    user_snapshot all_users = get_all_users();
+    ServerMessage *res = Arena::CreateMessage<ServerMessage>( arena );
+    res->set_option( PRESENCEUPDATE );
+    PresenceUpdate *update = res->mutable_presence();
+    update->set_version( all_users->version );
+    ConnectedUserResponse *users = update->mutable_snapshot();
+    users->mutable_connectedusers()->Reserve( all_users->users.size() );
+
+    user_map::const_iterator it;
+    for( it = all_users->users.begin(); it != all_users->users.end(); it++ ) {
+        ConnectedUser *c_user_l = users->add_connectedusers();
+        c_user_l->set_username( it->second.name );
+        c_user_l->set_status( it->second.status );
+        c_user_l->set_userid( it->second.id );
+    }
+    return res;
+}
+
+/*
+* Send a single change of the registry to the presence subscribers.
+* baseVersion lets them detect a missed or dropped delta and ask for a snapshot
+*/
+void Server::publish_presence( int kind, const client_info &usr, unsigned long version ) {
+    publish_presence( kind, vector<client_info>( 1, usr ), version );
+}
+
+/*
+* Send the users that joined or left together in one version as a single update
+*/
+void Server::publish_presence( int kind, const vector<client_info> &users, unsigned long version ) {
+    if( users.empty() )
+        return;
+    ServerMessage res;
+    res.set_option( PRESENCEUPDATE );
+    PresenceUpdate *update = res.mutable_presence();
+    update->set_version( version );
+    update->set_baseversion( version - 1 );
+    for( size_t i = 0; i < users.size(); i++ ) {
+        PresenceDelta *delta = update->add_deltas();
+        delta->set_kind( kind );
+        ConnectedUser *c_user = delta->mutable_user();
+        c_user->set_username( users[ i ].name );
+        c_user->set_userid( users[ i ].id );
+        if( kind != PRESENCE_LEAVE )
+            c_user->set_status( users[ i ].status );
+    }
+    send_all( res, "", 1 );
+}
+
+/*
+* Change the user status and notify the presence subscribers
+*/
+ServerMessage * Server::change_user_status( const ChangeStatusRequest &req, const string &name, Arena *arena ) {
+    const string &new_st = req.status();
+    client_info usr;
+    unsigned long version;
+    if( _users.set_status( name, new_st, &usr, &version ) < 0 ) {
+        return error_response( "User not found", arena );
+    }
+    publish_presence( PRESENCE_STATUS, usr, version );
+
+    ServerMessage *res = Arena::CreateMessage<ServerMessage>( arena );
+    res->set_option( CHANGESTATUSRESPONSE );
+    ChangeStatusResponse *ctr = res->mutable_changestatusresponse();
+    ctr->set_userid( usr.id );
+    ctr->set_status( new_st );
+    return res;
+}
+
+/*
+* Send response to all connected users, only to the presence subscribers if presence is set
+*/
+void Server::send_all( const ServerMessage &res, const string &sender, int presence ) {
+    LOG_INFO( "Sending request to all connected clients\n" );
+
+    /* Serialize once, every recipient queues the same frame */
+    fan_out( encode_message( res ), sender, presence );
+}
+
+/*
+* Queue frame to all connected users but sender, only to the presence subscribers if presence is set.
+* sequence is the history sequence of a broadcast, 0 for other messages.
+*/
+void Server::fan_out( frame_ptr frame, const string &sender, int presence, unsigned long sequence ) {
+    /* Every worker fans out to the connections it owns */
+    event_worker *w = current_worker();
+    if( _mode == WORKERS && w != NULL ) {
+        if( !presence ) {
+            size_t users = get_all_users()->users.size();
+            _metrics.observe( _m.fanout, users > 0 ? users - 1 : 0 );
+        }
+        for( size_t i = 0; i < _workers.size(); i++ ) {
+            if( _workers[ i ] == w ) {
+                local_broadcast( w, frame, sender, presence, sequence );
+                continue;
+            }
+            mail_item item;
+            item.kind = MAIL_BROADCAST;
+            item.frame = frame;
+            item.broadcast = 1;
+            item.delivery = 1;
+            item.presence = presence;
+            item.sequence = sequence;
+            item.exclude = sender;
+            post_mail( w, i, item );
+        }
+        return;
+    }
+
+    /* Iterate trough all connected users and send message */
+    user_snapshot all_users = get_all_users();
+    user_map::const_iterator it;
+    long recipients = 0;
+    for( it = all_users->users.begin(); it != all_users->users.end(); it++ ) {
+        if( it->second.name != sender && ( !presence || it->second.out->presence.load() ) ) {
+            send_frame( it->second, frame, 1, 1 );
+            recipients++;
+        }
+    }
+    if( !presence )
+        _metrics.observe( _m.fanout, recipients );
+}
+
+/*
+* Response to a channel request with its status and the number of members
+*/
+static ServerMessage * channel_response( const string &channel, const char *status, int members, Arena *arena ) {
+    ServerMessage *res = Arena::CreateMessage<ServerMessage>( arena );
+    res->set_option( CHANNELRESPONSE );
+    ChannelResponse *ch_res = res->mutable_channelresponse();
+    ch_res->set_channel( channel );
+    ch_res->set_status( status );
+    ch_res->set_members( members );
+    return res;
+}
+
+/*
+* Add the user to a channel, created if nobody is in it
+*/
+ServerMessage * Server::join_channel( const ChannelRequest &req, const client_info &cl, Arena *arena ) {
+    const string &channel = req.channel();
+    if( channel.empty() || channel.size() > CHANNEL_NAME_SIZE ) {
+        return error_response( "Invalid channel name", arena );
+    }
+    int members = _channels.join( channel, cl );
+    if( members < 0 ) {
+        return error_response( "Already in channel", arena );
+    }
+    return channel_response( channel, "joined", members, arena );
+}
+
+/*
+* Remove the user from a channel
+*/
+ServerMessage * Server::leave_channel( const ChannelRequest &req, const client_info &cl, Arena *arena ) {
+    int members = _channels.leave( req.channel(), cl.id );
+    if( members < 0 ) {
+        return error_response( "Not in channel", arena );
+    }
+    return channel_response( req.channel(), "left", members, arena );
+}
+
+/*
+* Send a message to the other members of a channel. Costs one frame per member
+* whatever the number of connected users, joins and leaves never wait for it.
+*/
+ServerMessage * Server::channel_message( const ChannelMessageRequest &req, const client_info &sender, Arena *arena ) {
+    member_list members = _channels.members( req.channel() );
+    int is_member = 0;
+    for( size_t i = 0; members && i < members->size() && !is_member; i++ )
+        is_member = ( *members )[ i ].id == sender.id;
+    if( !is_member ) {
+        return error_response( "Not in channel", arena );
+    }
+
+    ServerMessage *ch_msg = Arena::CreateMessage<ServerMessage>( arena );
+    ch_msg->set_option( CHANNELMESSAGES );
+    ChannelMessage *msg = ch_msg->mutable_channelmessage();
+    msg->set_channel( req.channel() );
+    msg->set_message( req.message() );
+    msg->set_userid( sender.id );
+    msg->set_username( sender.name );
+
+    /* Serialize once, every member queues the same frame */
+    frame_ptr frame = encode_message( *ch_msg );
+    for( size_t i = 0; i < members->size(); i++ ) {
+        if( ( *members )[ i ].id != sender.id )
+            send_frame( ( *members )[ i ], frame, 1, 1 );
+    }
+    return channel_response( req.channel(), "sent", members->size(), arena );
+}
+
+/*
+* Broadcast message to all users
+*/
+ServerMessage * Server::broadcast_message( const BroadcastRequest &req, const client_info &sender, Arena *arena ) {
+    /* Notify all users of message */
+    ServerMessage *all_res = Arena::CreateMessage<ServerMessage>( arena );
+    all_res->set_option( BROADCASTS );
+    BroadcastMessage *br_msg = all_res->mutable_broadcast();
+    br_msg->set_message( req.message() );
+    br_msg->set_userid( sender.id );
+    br_msg->set_username( sender.name );
+    frame_ptr frame = _history.add( all_res, sender.name, "" );
+    fan_out( frame, sender.name, 0, br_msg->sequence() );
+    /* Return message status */
+    ServerMessage *res = Arena::CreateMessage<ServerMessage>( arena );
+    res->set_option( BROADCASTRESPONSE );
+    res->mutable_broadcastresponse()->set_messagestatus( "sent" );
+    return res;
+}
+
+/*
+* Send dm
+*/
+ServerMessage * Server::direct_message( const DirectMessageRequest &req, const client_info &sender, Arena *arena ) {
+    /* Verify that username or id was sent */
+    client_info rec;
+    int found;
+    if( req.has_username() ) {
+        found = get_user( req.username(), &rec );
+    } else if( req.has_userid() ) {
+        found = get_user( req.userid(), &rec );
+    } else {
+        return error_response( "You have to include either userid or username", arena );
+    }
+    /* Ids only exist while connected, offline users are reached by username */
+    if( found < 0 && ( _log == NULL || !req.has_username() ) ) {
+        return error_response( "User not found", arena );
+    }
+
+    /* Send dm to rec */
+    ServerMessage *dm_res = Arena::CreateMessage<ServerMessage>( arena );
+    dm_res->set_option( MESSAGE );
+    DirectMessage *dm_msg = dm_res->mutable_message();
+    LOG_DEBUG( "User id sending message %d\n", sender.id );
+    dm_msg->set_userid( sender.id );
+    dm_msg->set_username( sender.name );
+    dm_msg->set_message( req.message() );
+
+    ServerMessage *res = Arena::CreateMessage<ServerMessage>( arena );
+    res->set_option( DIRECTMESSAGERESPONSE );
+    if( found < 0 ) {
+        /* Stored for the next log in, any name can be offline so the whole log is capped too */
+        if( _log->pending( req.username() ) >= MSG_LOG_MAX_PENDING ) {
+            return error_response( "User has too many pending messages", arena );
+        }
+        if( _log->pending_bytes() >= MSG_LOG_MAX_BYTES ) {
+            return error_response( "Too many stored messages", arena );
+        }
+        /* Only answered once the message would survive a machine crash, appenders share the sync */
+        long offset = _log->append( req.username(), dm_res->SerializeAsString() );
+        if( offset < 0 || _log->wait_durable( offset ) < 0 ) {
+            return error_response( "Unable to store message", arena );
+        }
+        /* The recipient may have logged in after the lookup, before the message was stored */
+        if( get_user( req.username(), &rec ) == 0 ) {
+            deliver_offline( rec );
+        }
+        res->mutable_directmessageresponse()->set_messagestatus( "stored" );
+        return res;
+    }
+
+    send_frame( rec, _history.add( dm_res, sender.name, rec.name ), 0, 1 );
+
+    /* Response to sender */
+    res->mutable_directmessageresponse()->set_messagestatus( "sent" );
+    return res;
+}
+
+/*
+* Keep the direct messages to offline users in a message log in dir, they are delivered when
+* the user logs in again. A message is only reported stored once the flusher made it durable
+* against a machine crash, senders waiting at the same time share one fdatasync.
+* returns 0 on succes -1 on error
+*/
+int Server::set_message_log( const char *dir ) {
+    MessageLog *log = new MessageLog;
+    if( log->initiate( dir ) < 0 ) {
+        delete log;
+        return -1;
+    }
+    _log = log;
+    return 0;
+}
+
+/*
+* Send cl the messages stored while it was offline. They go out as deliveries so batching
+* clients get them packed, at most half of the outbound queue is used so none is dropped,
+* the rest waits for the next log in.
+*/
+void Server::deliver_offline( const client_info &cl ) {
+    if( _log == NULL ) {
+        return;
+    }
+    vector<string> stored;
+    size_t taken = _log->take( cl.name, _out_max_bytes / 2, _out_max_frames / 2, &stored );
+    for( size_t i = 0; i < stored.size(); i++ ) {
+        shared_ptr<string> frame = make_shared<string>();
+        encode_frame( stored[ i ], frame.get() );
+        send_frame( cl, frame, 0, 1 );
+    }
+    if( taken > 0 ) {
+        LOG_INFO( "Delivered %lu stored messages to %s, %lu left\n", taken, cl.name.c_str(), _log->pending( cl.name ) );
+    }
+}
+
+/*
+* Form error response with message msg
+* returns server response with error details
+*/
+ServerMessage * Server::error_response( const char *msg, Arena *arena ) {
+    /* Building response */
+    LOG_INFO( "Bulding error response with message: %s\n", msg );
+    ServerMessage *res = Arena::CreateMessage<ServerMessage>( arena );
+    res->set_option( ERROR );
+    res->mutable_error()->set_errormessage( msg );
+    return res;
+}
+
+/*
+* Start the server infinite listening loop
+* Listens for new connections, creates a new thread for new every connection.
+*/
+void Server::start() {
+    if( _mode == EVENT_LOOP ) {
+        start_event_loop();
+        return;
+    }
+    if( _mode == WORKERS ) {
+        start_workers();
+        return;
+    }
+
+    /* Server infinite loop */
+    pthread_t thread;
+    LOG_INFO( "Listening for new connections on port %d...\n", _port );
+    while(1) {
+        if( listen_connections() < 0 ) {
+            continue;
+        }
+        LOG_DEBUG( "Processing connection on new thread...\n" );
+        if( pthread_create( &thread, NULL, &new_conn_h, this ) == 0 ) {
+            pthread_detach( thread );
+        }
+    }
+}
+
 /*
-* Start server instance. Saves port where the server will be running and defines the log level
+* Start the server edge triggered epoll loop.
+* Every connection is non blocking and is driven by its conn_phase instead of a dedicated thread.
 */
-Server::Server( int port, FILE *log_level ) {
-    _user_count = 1;
-    _port = port;
-    _log_level = log_level;
-    pthread_mutex_init( &_user_list_mutex, NULL );
-    pthread_mutex_init( &_req_queue_mutex, NULL );
+void Server::start_event_loop() {
+    _n_workers = 1;
+    event_worker *w = new_worker( 0, _sock );
+    if( w == NULL ) {
+        return;
+    }
+    _workers.push_back( w );
+
+    LOG_INFO( "Listening for new connections on port %d (event loop)...\n", _port );
+    run_worker( w );
 }
 
 /*
-* Initiate server on port
-* returns 0 on succes -1 on error
+* Start _n_workers event loops, each one pinned to a core with its own SO_REUSEPORT listener,
+* epoll instance and connections. The calling thread runs the first worker.
 */
-int Server::initiate() {
-    /* Create socket for server */
-    fprintf(_log_level, "DEBUG: Creating new server socket\n");
-    if( ( _sock = socket( AF_INET, SOCK_STREAM, 0 ) ) < 0 ) {
-        fprintf(_log_level, "ERROR: Socket creation error\n");
-        return -1;
+void Server::start_workers() {
+    long n_cpu = sysconf( _SC_NPROCESSORS_ONLN );
+    for( int i = 0; i < _n_workers; i++ ) {
+        int listen_fd = i == 0 ? _sock : open_listener( 1 );
+        if( listen_fd < 0 ) {
+            return;
+        }
+        event_worker *w = new_worker( i, listen_fd );
+        if( w == NULL ) {
+            return;
+        }
+        w->cpu = n_cpu > 0 ? i % n_cpu : -1;
+        _workers.push_back( w );
     }
 
-    fprintf(_log_level, "DEBUG: Socket created correctly fd: %d\n", _sock);
+    /* Every worker must exist before any of them can post mail */
+    LOG_INFO( "Listening for new connections on port %d (%d workers)...\n", _port, _n_workers );
+    for( int i = 1; i < _n_workers; i++ ) {
+        if( pthread_create( &_workers[ i ]->thread, NULL, &worker_h, _workers[ i ] ) != 0 ) {
+            LOG_ERROR( "Unable to start worker %d\n", i );
+        }
+    }
+    _workers[ 0 ]->thread = pthread_self();
+    worker_h( _workers[ 0 ] );
+}
 
-    /* Bind server to port */
-    fprintf(_log_level, "DEBUG: Binding socket %d to port %d\n", _sock, _port);
-    _serv_addr.sin_family = AF_INET; 
-    _serv_addr.sin_addr.s_addr = INADDR_ANY; 
-    _serv_addr.sin_port = htons( _port ); // Convert to host byte order
+/*
+* Create the event loop of worker id listening on listen_fd.
+* The listening socket is registered with a NULL pointer and the mailbox eventfd with the
+* worker pointer to tell them apart from connections.
+* returns the new worker or NULL on error
+*/
+event_worker * Server::new_worker( int id, int listen_fd ) {
+    event_worker *w = new event_worker;
+    w->id = id;
+    w->listen_fd = listen_fd;
+    w->cpu = -1;
+    w->server = this;
+    w->ring = NULL;
+    w->epoll_fd = -1;
+    w->wake_fd = -1;
+    w->handshaking = 0;
+    w->next_sweep = 0;
+    /* Requests of a worker run one at a time, they all share one arena */
+    w->arena = new request_arena;
+
+    /* inbox[ i ] is only written by worker i */
+    for( int i = 0; i < _n_workers; i++ ) {
+        w->inbox.push_back( i == id ? NULL : new_mailbox() );
+    }
+    w->backlog.resize( _n_workers );
+    w->notify.resize( _n_workers, 0 );
+
+    if( _backend == URING_BACKEND ) {
+        w->ring = new uring;
+        if( uring_init( w->ring, URING_ENTRIES ) < 0 || uring_setup_buffers( w->ring, URING_BUFFERS, URING_BUFFER_SIZE ) < 0 ) {
+            LOG_INFO( "io_uring not supported by the kernel (%s), worker %d uses epoll\n", strerror( errno ), id );
+            uring_exit( w->ring );
+            delete w->ring;
+            w->ring = NULL;
+        }
+    }
 
-    if( bind(_sock, (struct sockaddr *)&_serv_addr, sizeof(_serv_addr)) < 0 ) { // Bind server address to socket
-        fprintf(_log_level, "ERROR: Error binding address to socket\n");
-        return -1;
+    if( ( w->wake_fd = eventfd( 0, EFD_NONBLOCK ) ) < 0 ) {
+        LOG_ERROR( "Unable to create worker eventfd\n" );
+        free_worker( w );
+        return NULL;
+    }
+    if( w->ring != NULL ) {
+        return w;
     }
 
-    /* Set socket to listen for connections */
-    fprintf(_log_level, "DEBUG: Setting socket to listen for connections...\n");
-    if( listen( _sock, MAX_QUEUE ) < 0 ) { // queue MAX_QUEUE requests before refusing
-        fprintf(_log_level, "ERROR: Unable to listen for messages\n");
-        return -1;
+    LOG_DEBUG( "Creating epoll instance for worker %d\n", id );
+    if( ( w->epoll_fd = epoll_create1( 0 ) ) < 0 ) {
+        LOG_ERROR( "Unable to create epoll instance\n" );
+        free_worker( w );
+        return NULL;
     }
 
-    return 0;
+    set_non_blocking( listen_fd );
+    struct epoll_event ev;
+    ev.events = EPOLLIN | EPOLLET;
+    ev.data.ptr = NULL;
+    if( epoll_ctl( w->epoll_fd, EPOLL_CTL_ADD, listen_fd, &ev ) < 0 ) {
+        LOG_ERROR( "Unable to register server socket on event loop\n" );
+        free_worker( w );
+        return NULL;
+    }
+    ev.data.ptr = w;
+    if( epoll_ctl( w->epoll_fd, EPOLL_CTL_ADD, w->wake_fd, &ev ) < 0 ) {
+        LOG_ERROR( "Unable to register worker eventfd on event loop\n" );
+        free_worker( w );
+        return NULL;
+    }
+    return w;
 }
 
 /*
-* Listen for new connections and adds them to the request queue to be processed
-* returns 0 on succes -1 on error
+* Release a worker that new_worker could not finish: its mailboxes, arena, ring, eventfd, epoll
+* instance and its own listening socket. The listening socket of the server stays open.
 */
-int Server::listen_connections() {
-    /* Accept incoming request */
-    int addr_size = sizeof(_cl_addr);
-    int req_fd = accept( _sock, (struct sockaddr *)&_cl_addr, (socklen_t*)&addr_size );
-    if(req_fd < 0) {
-        fprintf(_log_level, "ERROR: Error on connection with cliet\n");
-        return -1;
+void Server::free_worker( event_worker *w ) {
+    for( size_t i = 0; i < w->inbox.size(); i++ ) {
+        delete w->inbox[ i ];
+    }
+    delete w->arena;
+    if( w->ring != NULL ) {
+        uring_exit( w->ring );
+        delete w->ring;
+    }
+    if( w->wake_fd >= 0 )
+        close( w->wake_fd );
+    if( w->epoll_fd >= 0 )
+        close( w->epoll_fd );
+    if( w->listen_fd != _sock )
+        close( w->listen_fd );
+    delete w;
+}
+
+/*
+* Pin a worker thread to its core and run its event loop
+* context is the worker to run
+*/
+void * Server::worker_h( void * context ) {
+    event_worker *w = ( event_worker * )context;
+    if( w->cpu >= 0 ) {
+        cpu_set_t cpus;
+        CPU_ZERO( &cpus );
+        CPU_SET( w->cpu, &cpus );
+        if( pthread_setaffinity_np( pthread_self(), sizeof( cpus ), &cpus ) != 0 ) {
+            LOG_ERROR( "Unable to pin worker %d to cpu %d\n", w->id, w->cpu );
+        }
     }
+    w->server->run_worker( w );
+    return NULL;
+}
 
-    fprintf( _log_level, "INFO: Accepted request with fd: %d\n", req_fd );
+/*
+* Event loop of one worker. Only this thread touches the worker connections.
+*/
+void Server::run_worker( event_worker *w ) {
+    _self = w;
+    if( w->ring != NULL ) {
+        run_uring_worker( w );
+        return;
+    }
+    LOG_DEBUG( "Worker %d running on thread ID: %d\n", w->id, ( int )gettid() );
+
+    struct epoll_event events[ MAX_EVENTS ];
+    int timeout = -1;
+    while( 1 ) {
+        int n_ev = epoll_wait( w->epoll_fd, events, MAX_EVENTS, timeout );
+        if( n_ev < 0 ) {
+            if( errno == EINTR )
+                continue;
+            LOG_ERROR( "Error waiting for events\n" );
+            break;
+        }
 
-    /* Get the incomming request ip */
-    char ipstr[ INET6_ADDRSTRLEN ];
-    struct sockaddr_in *tmp_s = (struct sockaddr_in *)&_cl_addr;
-    inet_ntop( AF_INET, &tmp_s->sin_addr, ipstr, sizeof( ipstr ) );
-    fprintf(_log_level, "INFO: Incomming request ip %s\n", ipstr);
+        for( int i = 0; i < n_ev; i++ ) {
+            if( events[ i ].data.ptr == NULL ) {
+                accept_connections( w );
+                continue;
+            }
+            if( events[ i ].data.ptr == w ) {
+                read_mail( w );
+                continue;
+            }
 
-    /* Save request info to queue */
-    struct client_info new_cl;
-    new_cl.id = _user_count;
-    new_cl.socket_info = _cl_addr;
-    new_cl.req_fd = req_fd;
-    new_cl.ip = ipstr;
-    req_push( new_cl );
-    _user_count++;
+            /* Connection may have been closed by a previous event on this batch */
+            connection *conn = ( connection * )events[ i ].data.ptr;
+            if( conn->fd < 0 )
+                continue;
 
-    fprintf(_log_level, "DEBUG: Request added to queue id: %d\n", _user_count);
+            if( events[ i ].events & ( EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR ) ) {
+                handle_readable( conn );
+            }
 
-    return 0;
+            if( conn->fd >= 0 && ( events[ i ].events & EPOLLOUT ) ) {
+                pthread_mutex_lock( &conn->info.out->mutex );
+                flush_send_queue( conn->info.out.get() );
+                pthread_mutex_unlock( &conn->info.out->mutex );
+            }
+        }
+
+        /* Users that left and logins of this batch go into the user table together */
+        remove_leaving( w );
+        register_joining( w );
+
+        /* Hand the mail of this batch to the other workers, retry soon if a mailbox was full */
+        timeout = flush_mail( w ) > 0 ? 1 : -1;
+
+        /* Send the batches that are due and wake up for the next one */
+        long batch_us = flush_batches( w );
+        if( batch_us >= 0 && ( timeout < 0 || batch_us < timeout * 1000L ) )
+            timeout = ( int )( ( batch_us + 999 ) / 1000 );
+        timeout = expire_handshakes( w, timeout );
+        close_drained( w );
+        remove_leaving( w );
+
+        /* Free connections closed on this batch */
+        for( size_t i = 0; i < w->closed_conns.size(); i++ ) {
+            delete w->closed_conns[ i ];
+        }
+        w->closed_conns.clear();
+    }
+    close( w->epoll_fd );
 }
 
 /*
-* Read message on socket fd and writes it to buf. This is just a wrapper on recvfrom
-* to make code easier to understand.
-* Returns the number of bytes received, or -1 if an error occurred.
+* Get the worker running on the calling thread if it belongs to this server
 */
-int Server::read_request( int fd, void *buf ) {
-    /* Read request info on socket */
-    fprintf(_log_level, "DEBUG: Waiting for request of fd: %d \n", fd);
-    int read_size;
-    if( ( read_size = recvfrom( fd, buf, MESSAGE_SIZE, 0, NULL, NULL ) ) < 0 ) {
-        fprintf(_log_level, "ERROR: Error reading request");
-        return -1;
+event_worker * Server::current_worker() {
+    if( _self != NULL && _self->server == this ) {
+        return _self;
     }
-    return read_size;
+    return NULL;
 }
 
 /*
-* Send response res on socket sock_fd to dest
-* returns 0 on succes -1 on error
+* Queue item for worker to. Items wait on the sender backlog while the mailbox is full
+* so their order is kept. The owner is woken up by flush_mail at the end of the batch.
 */
-int Server::send_response( int sock_fd, struct sockaddr_in *dest, ServerMessage res ) {
-    /* Serealizing response */
-    fprintf(_log_level, "DEBUG: Serealizing response\n");
-    string dsrl_res;
-    res.SerializeToString(&dsrl_res);
-
-    // Converting to c string
-    fprintf(_log_level, "DEBUG: Converting to c string\n");
-    char c_str[ dsrl_res.size() + 1 ];
-    strcpy( c_str, dsrl_res.c_str() );
-
-    /* Sending response */
-    fprintf(_log_level, "INFO: Sending response %d bytes to fd %d...\n", sizeof( c_str ), sock_fd);
-    if( sendto( sock_fd, c_str, sizeof(c_str), 0, (struct sockaddr *) &dest, sizeof( &dest ) ) < 0 ) {
-        fprintf(_log_level, "ERROR: Error sending response\n");
-        return -1;
+void Server::post_mail( event_worker *from, int to, const mail_item &item ) {
+    deque<mail_item> &pending = from->backlog[ to ];
+    if( !pending.empty() || mailbox_push( _workers[ to ]->inbox[ from->id ], item ) < 0 ) {
+        pending.push_back( item );
     }
-    return 0;
+    from->notify[ to ] = 1;
 }
 
 /*
-* Parse an incomming request, returns the ClientMessage that was received
+* Move backlogged items to the mailboxes and wake up every worker that got mail
+* returns the number of items still waiting on the backlog
 */
-ClientMessage Server::parse_request( char *req ) {
-    /* deserealizing request */
-    fprintf(_log_level, "DEBUG: Deserealizing request\n");
-    ClientMessage cl_msg;
-    cl_msg.ParseFromString(req);
-    return cl_msg;
+size_t Server::flush_mail( event_worker *w ) {
+    size_t waiting = 0;
+    for( size_t to = 0; to < w->backlog.size(); to++ ) {
+        deque<mail_item> &pending = w->backlog[ to ];
+        while( !pending.empty() && mailbox_push( _workers[ to ]->inbox[ w->id ], pending.front() ) == 0 ) {
+            pending.pop_front();
+            w->notify[ to ] = 1;
+        }
+        waiting += pending.size();
+
+        if( w->notify[ to ] ) {
+            uint64_t one = 1;
+            if( write( _workers[ to ]->wake_fd, &one, sizeof( one ) ) < 0 && errno != EAGAIN ) {
+                LOG_ERROR( "Unable to wake up worker %d\n", ( int )to );
+            }
+            w->notify[ to ] = 0;
+        }
+    }
+    return waiting;
 }
 
 /*
-* Process incoming message and convert to appropiate Server response
+* Deliver the mail other workers left for the connections of w
 */
-ServerMessage Server::process_request( ClientMessage cl_msg, client_info cl ) {
-    /* Get option */
-    int option = cl_msg.option();
+void Server::read_mail( event_worker *w ) {
+    uint64_t count;
+    if( read( w->wake_fd, &count, sizeof( count ) ) < 0 && errno != EAGAIN ) {
+        LOG_ERROR( "Unable to read worker %d eventfd\n", w->id );
+    }
 
-    /* Process acording to option */
-    fprintf(_log_level, "DEBUG: Processing request option: %d\n", option);
-    switch (option) {
-        case CONNECTEDUSER:
-            return get_connected_users();
-        case CHANGESTATUS:
-            return change_user_status( cl_msg.changestatus(), cl.name );
-        case BROADCASTC:
-            return broadcast_message( cl_msg.broadcast(), cl );
-        case DIRECTMESSAGE:
-            return direct_message( cl_msg.directmessage(), cl );
-        default:
-            return error_response("Invalid option\n");
+    mail_item item;
+    for( size_t from = 0; from < w->inbox.size(); from++ ) {
+        if( w->inbox[ from ] == NULL )
+            continue;
+        while( mailbox_pop( w->inbox[ from ], &item ) ) {
+            if( item.kind == MAIL_DELIVER ) {
+                queue_frame( item.out.get(), item.frame, item.broadcast, item.delivery );
+            } else {
+                local_broadcast( w, item.frame, item.exclude, item.presence, item.sequence );
+            }
+        }
     }
 }
 
 /*
-* Register new user on connected users
-* returns username or empty string if unable to register user.
-* Unlike more other functions this one handles the responses to server and process client responses.
+* Queue frame on every registered connection of w except the sender,
+* only on the presence subscribers if presence is set. Connections still in the login or closed
+* after a refused one are not in the registry and get nothing, like in fan_out. A broadcast that
+* was still in the mailbox when a client resumed is skipped for it, the history replay has it.
 */
-string Server::register_user( MyInfoSynchronize req, client_info cl ) {
-    fprintf(_log_level, "INFO: Registering new user\n");
-    map<std::string, client_info> all_users = get_all_users();
-    /* Step 1: Register user and assign user id */
+void Server::local_broadcast( event_worker *w, frame_ptr frame, const string &sender, int presence, unsigned long sequence ) {
+    map<int, connection *>::iterator it;
+    for( it = w->conns.begin(); it != w->conns.end(); it++ ) {
+        connection *conn = it->second;
+        if( ( conn->phase != AWAITING_ACK && conn->phase != ESTABLISHED ) || conn->closing )
+            continue;
+        if( conn->info.name == sender )
+            continue;
+        if( presence && !conn->info.out->presence.load() )
+            continue;
+        if( sequence != 0 && sequence <= conn->info.out->since.load() )
+            continue;
+        queue_frame( conn->info.out.get(), frame, 1, 1, conn );
+    }
+}
 
-    // Check if user name or ip is registered
-    fprintf(_log_level, "DEBUG: Checking if username is in used..\n");
-    if( all_users.find( req.username() ) != all_users.end() ) {
-        send_response( cl.req_fd, &cl.socket_info, error_response("Username already in use") );
-        return "";
-    } else {
-        fprintf(_log_level, "DEBUG: Checking if ip adddress is already connected to server\n");
-        map<std::string, client_info>::iterator it;
-        for( it = all_users.begin(); it != all_users.end(); it++ ) {
-            if( cl.ip == it->second.ip ) {
-                send_response( cl.req_fd, &cl.socket_info, error_response("Ip already in use") );
-                return "";
-            }
+/* Low bits of the io_uring user data tell what completed, the rest is the connection pointer */
+#define URING_ACCEPT 1
+#define URING_WAKE 2
+#define URING_RECV 3
+#define URING_SEND 4
+#define URING_CANCEL 5
+#define URING_TAG_MASK 7
+
+/*
+* Event loop of one worker on io_uring. Accepts and receives are multishot, every send queued
+* during a batch is submitted together with one io_uring_enter.
+*/
+void Server::run_uring_worker( event_worker *w ) {
+    uring *r = w->ring;
+    arm_uring_accept( w );
+    arm_uring_wake( w );
+
+    int timeout = -1;
+    while( 1 ) {
+        /* Submit pending sends and wait for a completion unless there is work left */
+        submit_uring_sends( w );
+        int busy = !w->resume.empty() || uring_cq_ready( r ) > 0;
+        if( uring_submit( r, busy ? 0 : 1, timeout ) < 0 && errno != EINTR && errno != ETIME && errno != EBUSY ) {
+            LOG_ERROR( "Error waiting for completions: %s\n", strerror( errno ) );
+            break;
         }
-    }
 
-    // Adding mising data to client info
-    cl.name = req.username();
-    cl.status = "activo";
+        /*
+        * At most URING_FRAME_BUDGET requests per iteration so the sends they produce go out soon,
+        * the rest stays buffered on the connection. Only the completions ready now are read,
+        * a busy multishot receive would otherwise keep the loop here.
+        */
+        int budget = URING_FRAME_BUDGET;
+        resume_uring_input( w, &budget );
+
+        unsigned ready = uring_cq_ready( r );
+        struct io_uring_cqe *cqe;
+        for( unsigned n = 0; n < ready && ( cqe = uring_peek_cqe( r ) ) != NULL; n++ ) {
+            unsigned long data = cqe->user_data;
+            int res = cqe->res;
+            unsigned flags = cqe->flags;
+            uring_cqe_seen( r );
+
+            connection *conn = ( connection * )( data & ~( unsigned long )URING_TAG_MASK );
+            switch( data & URING_TAG_MASK ) {
+                case URING_ACCEPT:
+                    if( res >= 0 ) {
+                        struct sockaddr_in cl_addr;
+                        socklen_t addr_size = sizeof( cl_addr );
+                        getpeername( res, ( struct sockaddr * )&cl_addr, &addr_size );
+                        add_connection( w, res, cl_addr );
+                    } else {
+                        LOG_ERROR( "Error on connection with client: %s\n", strerror( -res ) );
+                    }
+                    if( !( flags & IORING_CQE_F_MORE ) )
+                        arm_uring_accept( w );
+                    break;
+                case URING_WAKE:
+                    read_mail( w );
+                    if( !( flags & IORING_CQE_F_MORE ) )
+                        arm_uring_wake( w );
+                    break;
+                case URING_RECV:
+                    handle_uring_recv( w, conn, res, flags, &budget );
+                    break;
+                case URING_SEND:
+                    handle_uring_send( w, conn, res );
+                    break;
+            }
+        }
 
-    // Adding to db
-    fprintf(_log_level, "INFO: Save new user: %s id %d with conn fd: %d\n", req.username().c_str(), cl.id, cl.req_fd);
-    add_user( cl );
+        /* Users that left and logins of this batch go into the user table together */
+        remove_leaving( w );
+        register_joining( w );
+
+        /* Hand the mail of this batch to the other workers, retry soon if a mailbox was full */
+        timeout = flush_mail( w ) > 0 ? 1 : -1;
+
+        /* Send the batches that are due and wake up for the next one */
+        long batch_us = flush_batches( w );
+        if( batch_us >= 0 && ( timeout < 0 || batch_us < timeout * 1000L ) )
+            timeout = ( int )( ( batch_us + 999 ) / 1000 );
+        timeout = expire_handshakes( w, timeout );
+        close_drained( w );
+        remove_leaving( w );
+
+        /* Free closed connections once the kernel is done with them and they left the dirty list */
+        size_t kept = 0;
+        for( size_t i = 0; i < w->closed_conns.size(); i++ ) {
+            connection *conn = w->closed_conns[ i ];
+            if( conn->ops > 0 || conn->dirty || conn->resume || conn->batching ) {
+                w->closed_conns[ kept++ ] = conn;
+                continue;
+            }
+            delete conn->send;
+            delete conn;
+        }
+        w->closed_conns.resize( kept );
+    }
+    uring_exit( r );
+}
 
-    /* Step 2: Return userid to client */
-    client_info conn_user = get_user(  req.username() );
-    MyInfoResponse * myinfo_res(new MyInfoResponse);
-    myinfo_res->set_userid( conn_user.id );
+/*
+* Queue a send for every connection that got frames since the last call and has none in flight
+*/
+void Server::submit_uring_sends( event_worker *w ) {
+    for( size_t i = 0; i < w->dirty.size(); i++ ) {
+        connection *conn = w->dirty[ i ];
+        conn->dirty = 0;
+        if( conn->fd >= 0 && !conn->sending )
+            submit_uring_send( w, conn );
+    }
+    w->dirty.clear();
+}
 
-    ServerMessage res;
-    res.set_option( MYINFORESPONSE );
-    res.set_allocated_myinforesponse(myinfo_res);
+/*
+* Continue the connections that still had requests buffered or stopped receiving when the
+* previous iteration ended. Receives are armed again once the buffered input is under
+* URING_MAX_PENDING and there is budget left.
+*/
+void Server::resume_uring_input( event_worker *w, int *budget ) {
+    vector<connection *> pending;
+    pending.swap( w->resume );
+    for( size_t i = 0; i < pending.size(); i++ ) {
+        connection *conn = pending[ i ];
+        conn->resume = 0;
+        if( conn->fd < 0 )
+            continue;
+        dispatch_frames( conn, budget );
+        if( conn->fd >= 0 && !conn->recv_armed ) {
+            if( *budget > 0 && conn->in_buf.pending() <= URING_MAX_PENDING ) {
+                arm_uring_recv( w, conn );
+            } else {
+                defer_input( conn );
+            }
+        }
+    }
+}
 
-    
-    fprintf(_log_level, "DEBUG: Sending ACK to client..\n");
-    send_response( conn_user.req_fd, &conn_user.socket_info, res );
+/*
+* Put the connection on its worker resume list
+*/
+void Server::defer_input( connection *conn ) {
+    if( conn->resume )
+        return;
+    conn->resume = 1;
+    conn->worker->resume.push_back( conn );
+}
 
-    /* Reading client ACK */
-    
-    fprintf(_log_level, "DEBUG: Reading client ACK..\n");
-    char ack[ MESSAGE_SIZE ];
-    read_request( conn_user.req_fd, ack );
+/*
+* Multishot accept on the worker listening socket
+*/
+void Server::arm_uring_accept( event_worker *w ) {
+    struct io_uring_sqe *sqe = uring_get_sqe( w->ring );
+    if( sqe == NULL ) {
+        LOG_ERROR( "Unable to queue accept on worker %d\n", w->id );
+        return;
+    }
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = w->listen_fd;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->user_data = URING_ACCEPT;
+}
 
-    fprintf(_log_level, "DEBUG: Client ACK was process correctly.\n");
-    
-    return conn_user.name;
+/*
+* Multishot poll on the worker eventfd, completes whenever another worker leaves mail
+*/
+void Server::arm_uring_wake( event_worker *w ) {
+    struct io_uring_sqe *sqe = uring_get_sqe( w->ring );
+    if( sqe == NULL ) {
+        LOG_ERROR( "Unable to queue mailbox poll on worker %d\n", w->id );
+        return;
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = w->wake_fd;
+    sqe->poll32_events = POLLIN;
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->user_data = URING_WAKE;
 }
 
 /*
-* Get all the connected users on the server
-* returns the server response with all the connected users
+* Multishot receive on the connection, data lands on the registered buffer group
 */
-ServerMessage Server::get_connected_users() {
-    /* Verify if there are connected users */
-    map<std::string, client_info> all_users = get_all_users();
-    if( all_users.empty() ) {
-        return error_response("No connected users");
+void Server::arm_uring_recv( event_worker *w, connection *conn ) {
+    struct io_uring_sqe *sqe = uring_get_sqe( w->ring );
+    if( sqe == NULL ) {
+        LOG_ERROR( "Unable to queue receive on fd %d\n", conn->fd );
+        close_connection( conn );
+        return;
     }
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = conn->fd;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = 0;
+    sqe->user_data = ( unsigned long )conn | URING_RECV;
+    conn->recv_armed = 1;
+    conn->ops++;
+}
 
-    /* Get connected users */
+/*
+* Queue one gathered send with the frames waiting on the connection. They stay on the queue
+* (and referenced here) until the send completes.
+*/
+void Server::submit_uring_send( event_worker *w, connection *conn ) {
+    send_queue *q = conn->info.out.get();
+    if( conn->send == NULL )
+        conn->send = new uring_send;
+    uring_send *snd = conn->send;
+
+    pthread_mutex_lock( &q->mutex );
+    int n_iov = gather_frames( q, snd->iov, URING_IOV_BATCH );
+    q->in_flight = n_iov;
+    snd->frames.clear();
+    for( int i = 0; i < n_iov; i++ )
+        snd->frames.push_back( q->frames[ i ].frame );
+    pthread_mutex_unlock( &q->mutex );
+    if( n_iov == 0 )
+        return;
+
+    struct io_uring_sqe *sqe = uring_get_sqe( w->ring );
+    if( sqe == NULL ) {
+        LOG_ERROR( "Unable to queue send on fd %d\n", conn->fd );
+        pthread_mutex_lock( &q->mutex );
+        q->in_flight = 0;
+        pthread_mutex_unlock( &q->mutex );
+        snd->frames.clear();
+        return;
+    }
+    memset( &snd->msg, 0, sizeof( snd->msg ) );
+    snd->msg.msg_iov = snd->iov;
+    snd->msg.msg_iovlen = n_iov;
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = conn->fd;
+    sqe->addr = ( unsigned long )&snd->msg;
+    sqe->len = 1;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = ( unsigned long )conn | URING_SEND;
+    conn->sending = 1;
+    conn->ops++;
+}
 
-    map<std::string, client_info>::iterator it;
-    fprintf(_log_level, "DEBUG: Mapping connected users to response\n");
-    ConnectedUserResponse * users( new ConnectedUserResponse );
-    
-    for( it = all_users.begin(); it != all_users.end(); it++ ) {
-        ConnectedUser * c_user_l = users->add_connectedusers();
-        fprintf(_log_level, "DEBUG: Connected user %s\n", it->first.c_str());
-        c_user_l->set_username(it->first);
-        c_user_l->set_status(it->second.status);
-        c_user_l->set_userid(it->second.id);
-        fprintf(_log_level, "DEBUG: Saving connected user to response\n");
+/*
+* Completion of a multishot receive: buffer the bytes, give the buffer back and handle the frames
+*/
+void Server::handle_uring_recv( event_worker *w, connection *conn, int res, unsigned flags, int *budget ) {
+    int more = flags & IORING_CQE_F_MORE;
+    if( !more ) {
+        conn->ops--;
+        conn->recv_armed = 0;
     }
 
-    /* Form response */
-    ServerMessage res;
-    res.set_option( CONNECTEDUSERRESPONSE );
-    fprintf(_log_level, "DEBUG: Saving connected users on response\n");
-    res.set_allocated_connecteduserresponse( users );
+    if( res > 0 ) {
+        int bid = flags >> IORING_CQE_BUFFER_SHIFT;
+        if( conn->fd >= 0 )
+            conn->in_buf.append( uring_buffer( w->ring, bid ), res );
+        uring_recycle_buffer( w->ring, bid );
+        dispatch_frames( conn, budget );
+
+        /* Stop reading a client that sends faster than it is served, TCP slows it down */
+        if( conn->fd >= 0 && conn->recv_armed == 1 && conn->in_buf.pending() > URING_MAX_PENDING )
+            cancel_uring_recv( w, conn );
+    } else if( res == -ENOBUFS || res == -ECANCELED ) {
+        /* Out of receive buffers or paused, armed again by resume_uring_input */
+        if( conn->fd >= 0 )
+            defer_input( conn );
+        return;
+    } else if( conn->fd >= 0 ) {
+        if( res < 0 )
+            LOG_ERROR( "Unable to read request on fd %d: %s\n", conn->fd, strerror( -res ) );
+        close_connection( conn );
+        return;
+    }
 
-    return res;
+    if( !more && conn->fd >= 0 ) {
+        if( conn->in_buf.pending() <= URING_MAX_PENDING ) {
+            arm_uring_recv( w, conn );
+        } else {
+            defer_input( conn );
+        }
+    }
 }
 
 /*
-* Change the user status. Won't notify other users
+* Ask the kernel to end the multishot receive of the connection, its last completion
+* comes back with ECANCELED
 */
-ServerMessage Server::change_user_status( ChangeStatusRequest req, string name ) {
-    string new_st = req.status();
-    int id;
-    pthread_mutex_lock( &_user_list_mutex );
-    _user_list[ name ].status = new_st;
-    id = _user_list[ name ].id;
-    pthread_mutex_unlock( &_user_list_mutex );
-
-    ChangeStatusResponse * ctr(new ChangeStatusResponse);
-    ctr->set_userid( id );
-    ctr->set_status( new_st );
+void Server::cancel_uring_recv( event_worker *w, connection *conn ) {
+    struct io_uring_sqe *sqe = uring_get_sqe( w->ring );
+    if( sqe == NULL )
+        return;
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->addr = ( unsigned long )conn | URING_RECV;
+    sqe->user_data = URING_CANCEL;
+    conn->recv_armed = -1;
+}
 
-    ServerMessage res;
-    res.set_option( CHANGESTATUSRESPONSE );
-    res.set_allocated_changestatusresponse( ctr );
-    return res;
+/*
+* Completion of a send: pop what was written and send the rest, including frames queued meanwhile
+*/
+void Server::handle_uring_send( event_worker *w, connection *conn, int res ) {
+    conn->ops--;
+    conn->sending = 0;
+    conn->send->frames.clear();
+
+    send_queue *q = conn->info.out.get();
+    pthread_mutex_lock( &q->mutex );
+    /* in_flight is reset when the queue was cleared meanwhile */
+    if( q->in_flight > 0 && res > 0 )
+        consume_sent( q, res );
+    q->in_flight = 0;
+    int pending = !q->frames.empty();
+    pthread_mutex_unlock( &q->mutex );
+
+    if( conn->fd < 0 )
+        return;
+    if( res < 0 && res != -EAGAIN && res != -EINTR ) {
+        LOG_ERROR( "Error sending response on fd %d: %s\n", conn->fd, strerror( -res ) );
+        _metrics.add( _m.send_errors );
+        close_connection( conn );
+        return;
+    }
+    if( pending && !conn->dirty ) {
+        conn->dirty = 1;
+        w->dirty.push_back( conn );
+    }
 }
 
 /*
-* Send response to all connected users
+* Read everything available on a connection and dispatch every complete frame
 */
-void Server::send_all( ServerMessage res, string sender ) {
-    fprintf(_log_level, "INFO: Sending request to all connected clients\n");
+void Server::handle_readable( connection *conn ) {
+    while( conn->fd >= 0 ) {
+        int read_sz = conn->in_buf.read_from( conn->fd );
+        if( read_sz < 0 ) {
+            if( errno == EINTR )
+                continue;
+            if( errno == EAGAIN || errno == EWOULDBLOCK )
+                return;
+            LOG_ERROR( "Unable to read request on fd %d\n", conn->fd );
+            close_connection( conn );
+            return;
+        }
 
-    /* Iterate trough all connected users and send message */
-    map<std::string, client_info> all_users = get_all_users();
-    map<std::string, client_info>::iterator it;
-    for( it = all_users.begin(); it != all_users.end(); it++ ) {
-        if( it->first != sender ) {
-            client_info user = it->second;
-            send_response( user.req_fd, &user.socket_info, res );
+        if( read_sz == 0 ) {
+            close_connection( conn );
+            return;
         }
+
+        dispatch_frames( conn );
     }
 }
 
 /*
-* Broadcast message to all users
+* Handle the complete frames buffered on the connection. With a budget, stops once it is spent
+* and leaves the rest for the next iteration of the worker.
 */
-ServerMessage Server::broadcast_message( BroadcastRequest req, client_info sender ) {
-    string msg = req.message();
-    /* Notify all users of message */
-    BroadcastMessage * br_msg( new BroadcastMessage );
-    br_msg->set_message( msg );
-    br_msg->set_userid( sender.id );
-    ServerMessage all_res;
-    all_res.set_option( BROADCASTS );
-    all_res.set_allocated_broadcast( br_msg );
-    send_all( all_res, sender.name );
-    /* Return message status */
-    BroadcastResponse * res( new BroadcastResponse );
-    res->set_messagestatus( "sent" );
-    ServerMessage res_r;
-    res_r.set_option( BROADCASTRESPONSE );
-    res_r.set_allocated_broadcastresponse( res );
-    return res_r;
+void Server::dispatch_frames( connection *conn, int *budget ) {
+    string req;
+    int frame_st = 0;
+    while( conn->fd >= 0 && conn->phase != REGISTERING && ( budget == NULL || *budget > 0 ) && ( frame_st = conn->in_buf.next_frame( &req ) ) > 0 ) {
+        handle_message( conn, req );
+        if( budget != NULL )
+            ( *budget )--;
+    }
+    if( conn->fd >= 0 && frame_st < 0 ) {
+        LOG_ERROR( "Invalid frame on fd %d\n", conn->fd );
+        close_connection( conn );
+        return;
+    }
+    /* Out of budget, even before the first frame. Frames after a sync wait for its registration */
+    if( conn->fd >= 0 && budget != NULL && *budget <= 0 && conn->in_buf.pending() > 0 && conn->phase != REGISTERING )
+        defer_input( conn );
 }
 
 /*
-* Send dm
+* Process a message acording to the connection phase
+* AWAITING_SYNC -> register user, AWAITING_ACK -> client ACK, ESTABLISHED -> regular requests
 */
-ServerMessage Server::direct_message( DirectMessageRequest req, client_info sender ) {
-    /* Verify that username or id was sent */
-    client_info rec;
-    if( req.has_username() ) {
-        rec = get_user( req.username() );
-    } else if( req.has_userid() ) {
-        rec = get_user( req.userid() );
-    } else {
-        return error_response( "You have to include either userid or username" );
+void Server::handle_message( connection *conn, const string &req ) {
+    /* A connection waiting for its error to go out ignores what else it sent */
+    if( conn->closing )
+        return;
+    long start_ns = monotonic_ns();
+    Arena *arena = &conn->worker->arena->arena;
+    ClientMessage *in_req = parse_request( req, arena );
+    string usr_nm;
+
+    switch ( conn->phase ) {
+        case AWAITING_SYNC:
+            /* New connection must be new user, it is registered with the others of this batch */
+            if( in_req->option() != SYNCHRONIZED ) {
+                send_response( conn->info, *error_response( "You must log in first\n", arena ) );
+                close_after_send( conn );
+                break;
+            }
+            conn->sync = in_req->synchronize();
+            conn->phase = REGISTERING;
+            conn->worker->joining.push_back( conn );
+            break;
+        case REGISTERING:
+            break;
+        case AWAITING_ACK:
+            /* Any request acknowledges the id, like data carrying a TCP ACK */
+            LOG_DEBUG( "Client ACK was process correctly.\n" );
+            end_handshake( conn );
+            if( in_req->option() != ACKNOWLEDGE ) {
+                send_response( conn->info, *process_request( *in_req, conn->info, arena ) );
+                count_request( in_req->option(), start_ns );
+            }
+            break;
+        case ESTABLISHED:
+            LOG_INFO( "Incomming request from user %s on fd %d...\n", conn->info.name.c_str(), conn->fd );
+            send_response( conn->info, *process_request( *in_req, conn->info, arena ) );
+            count_request( in_req->option(), start_ns );
+            break;
     }
 
-    /* Send dm to rec */
-    DirectMessage * dm_msg( new DirectMessage );
-    fprintf(_log_level, "DEBUG: User id sending message %d\n", sender.id);
-    dm_msg->set_userid( sender.id );
-    dm_msg->set_message( req.message() );
+    /* Responses are encoded into their own frames, the messages can go */
+    arena->Reset();
+}
+
+/*
+* Register the users whose sync arrived on this iteration. They go into the user table together,
+* so a login storm copies the table once per batch of events instead of once per user, and the
+* presence subscribers get one update for all of them. Then every connection gets its id and the
+* requests it sent after the sync are handled.
+*/
+void Server::register_joining( event_worker *w ) {
+    if( w->joining.empty() )
+        return;
+    vector<connection *> batch;
+    batch.swap( w->joining );
+    Arena *arena = &w->arena->arena;
+
+    vector<connection *> conns;
+    vector<client_info> users;
+    for( size_t i = 0; i < batch.size(); i++ ) {
+        connection *conn = batch[ i ];
+        if( conn->fd < 0 )
+            continue;
+        LOG_INFO( "Registering new user\n" );
+        if( conn->sync.has_resumetoken() ) {
+            take_over( conn->sync );
+        }
+        client_info usr;
+        if( prepare_user( conn->sync, conn->info, &usr, arena ) < 0 ) {
+            close_after_send( conn );
+            continue;
+        }
+        conns.push_back( conn );
+        users.push_back( usr );
+    }
 
-    ServerMessage dm_res;
-    dm_res.set_option( MESSAGE );
-    dm_res.set_allocated_message( dm_msg );
+    /*
+    * Checked again in case a user of the batch or another worker took the name or ip. Joins are
+    * published with the id and not with the ACK, presence deltas follow the user table versions
+    */
+    vector<int> results;
+    unsigned long version;
+    _users.add_all( users, &results, &version );
+    vector<client_info> added;
+    for( size_t i = 0; i < users.size(); i++ ) {
+        if( results[ i ] == 0 )
+            added.push_back( users[ i ] );
+    }
+    publish_presence( PRESENCE_JOIN, added, version );
+
+    for( size_t i = 0; i < conns.size(); i++ ) {
+        connection *conn = conns[ i ];
+        if( results[ i ] < 0 ) {
+            send_response( conn->info, *error_response( results[ i ] == -1 ? "Username already in use" : "Ip already in use", arena ) );
+            _metrics.add( _m.login_failures );
+            close_after_send( conn );
+            continue;
+        }
+        LOG_INFO( "Save new user: %s id %d with conn fd: %d\n", users[ i ].name.c_str(), users[ i ].id, conn->fd );
+        _metrics.add( _m.logins );
+        conn->info = users[ i ];
+        finish_registration( conn->sync, conn->info, arena );
+        if( conn->sync.has_resumetoken() ) {
+            /* Resumed sessions do not send the ACK */
+            end_handshake( conn );
+        } else {
+            conn->phase = AWAITING_ACK;
+        }
+        arena->Reset();
+        dispatch_frames( conn );
+    }
+    arena->Reset();
+}
 
-    send_response( rec.req_fd, &rec.socket_info, dm_res );
+/*
+* Delete the users whose connections closed on this iteration with a single new version of the
+* user table and one presence update, a mass disconnect is a storm too
+*/
+void Server::remove_leaving( event_worker *w ) {
+    if( w->leaving.empty() )
+        return;
+    vector<client_info> removed;
+    unsigned long version;
+    _users.remove_all( w->leaving, &removed, &version );
+    w->leaving.clear();
+    for( size_t i = 0; i < removed.size(); i++ ) {
+        _channels.leave_all( removed[ i ].id );
+    }
+    publish_presence( PRESENCE_LEAVE, removed, version );
+}
 
-    /* Response to sender */
-    DirectMessageResponse * res_msg( new DirectMessageResponse );
-    res_msg->set_messagestatus( "sent" );
+/*
+* The connection finished its login, it gets what was stored for it while it was away
+*/
+void Server::end_handshake( connection *conn ) {
+    conn->phase = ESTABLISHED;
+    conn->worker->handshaking--;
+    deliver_offline( conn->info );
+}
 
-    ServerMessage res;
-    res.set_option( DIRECTMESSAGERESPONSE );
-    res.set_allocated_directmessageresponse( res_msg );
+/*
+* Close the connections of w that did not finish the login handshake in time. Runs at most every
+* HANDSHAKE_SWEEP_MS while w has connections in the handshake.
+* returns timeout shortened to the next sweep
+*/
+int Server::expire_handshakes( event_worker *w, int timeout ) {
+    if( w->handshaking == 0 )
+        return timeout;
+    long now = monotonic_us();
+    if( now >= w->next_sweep ) {
+        w->next_sweep = now + HANDSHAKE_SWEEP_MS * 1000L;
+        vector<connection *> expired;
+        map<int, connection *>::iterator it;
+        for( it = w->conns.begin(); it != w->conns.end(); it++ ) {
+            if( it->second->phase != ESTABLISHED && it->second->handshake_deadline <= now )
+                expired.push_back( it->second );
+        }
+        for( size_t i = 0; i < expired.size(); i++ ) {
+            LOG_INFO( "Login handshake timed out on fd %d\n", expired[ i ]->fd );
+            _metrics.add( _m.handshake_timeouts );
+            close_connection( expired[ i ] );
+        }
+        if( w->handshaking == 0 )
+            return timeout;
+    }
+    int sweep = ( int )( ( w->next_sweep - now + 999 ) / 1000 );
+    return timeout < 0 || sweep < timeout ? sweep : timeout;
+}
 
-    return res;
+/*
+* Disconnect the user of the connection and release its socket.
+* The connection is freed after the current event batch.
+*/
+void Server::close_connection( connection *conn ) {
+    if( conn->fd < 0 )
+        return;
 
+    LOG_INFO( "Disconnecting user %s on fd %d, dropped frames: %lu\n", conn->info.name.c_str(), conn->fd, conn->info.out->dropped );
+    if( conn->phase == AWAITING_ACK || conn->phase == ESTABLISHED ) {
+        conn->worker->leaving.push_back( conn->info );
+    }
+    if( conn->phase != ESTABLISHED ) {
+        conn->worker->handshaking--;
+    }
+    if( conn->worker->ring != NULL ) {
+        /* Ends the pending multishot receive so the connection can be freed */
+        shutdown( conn->fd, SHUT_RDWR );
+    } else {
+        epoll_ctl( conn->worker->epoll_fd, EPOLL_CTL_DEL, conn->fd, NULL );
+    }
+    conn->worker->conns.erase( conn->fd );
+    release_client( conn->info );
+    conn->fd = -1;
+    conn->worker->closed_conns.push_back( conn );
 }
 
 /*
-* Form error response with message msg
-* returns server response with error details
+* Close the connection once the responses queued for it are written, so the client gets the
+* error that ended its session. Until then its requests are ignored, the handshake timeout closes
+* it if the client does not read them.
 */
-ServerMessage Server::error_response( string msg ) {
-    /* Building response */
-    fprintf(_log_level, "INFO: Bulding error response with message: %s\n", msg.c_str());
-    ErrorResponse * err_msg(new ErrorResponse);
-    err_msg->set_errormessage(msg);
+void Server::close_after_send( connection *conn ) {
+    if( conn->fd < 0 || conn->closing )
+        return;
+    conn->closing = 1;
+    conn->worker->closing.push_back( conn );
+}
 
-    ServerMessage res;
-    res.set_option( ERROR );
-    res.set_allocated_error(err_msg);
-    return res;
+/*
+* Close the connections of w marked by close_after_send whose outbound queue is empty
+*/
+void Server::close_drained( event_worker *w ) {
+    size_t kept = 0;
+    for( size_t i = 0; i < w->closing.size(); i++ ) {
+        connection *conn = w->closing[ i ];
+        if( conn->fd < 0 )
+            continue;
+        send_queue *q = conn->info.out.get();
+        pthread_mutex_lock( &q->mutex );
+        int drained = q->frames.empty() && q->in_flight == 0;
+        pthread_mutex_unlock( &q->mutex );
+        if( drained ) {
+            close_connection( conn );
+        } else {
+            w->closing[ kept++ ] = conn;
+        }
+    }
+    w->closing.resize( kept );
 }
 
 /*
-* Start the server infinite listening loop
-* Listens for new connections, creates a new thread for new every connection.
+* Set O_NONBLOCK on fd
+* returns 0 on succes -1 on error
 */
-void Server::start() {
-    /* Server infinite loop */
-    pthread_t thread;
-    fprintf(_log_level, "INFO: Listening for new connections on port %d...\n", _port);
-    while(1) {
-        int client_id = listen_connections();
-        fprintf(_log_level, "DEBUG: Processing connection on new thread...\n");
-        pthread_create( &thread, NULL, &new_conn_h, this );
+int Server::set_non_blocking( int fd ) {
+    int flags = fcntl( fd, F_GETFL, 0 );
+    if( flags < 0 || fcntl( fd, F_SETFL, flags | O_NONBLOCK ) < 0 ) {
+        LOG_ERROR( "Unable to set fd %d as non blocking\n", fd );
+        return -1;
     }
+    return 0;
 }
 
 /*
@@ -389,64 +2146,81 @@ void * Server::new_conn_h( void * context ) {
 
     /* Getting thread ID*/
     pid_t tid = gettid();
-    fprintf( s->_log_level, "DEBUG: Staring connection process on thread ID: %d\n", ( int )tid);
+    LOG_DEBUG( "Staring connection process on thread ID: %d\n", ( int )tid );
 
     /* Start processing connection */
     struct client_info req_ds = s->req_pop();
-    char req[ MESSAGE_SIZE ];
-    s->read_request( req_ds.req_fd, req );
+    FrameBuffer in_frames;
+    request_arena req_arena;
+    Arena *arena = &req_arena.arena;
+    string req;
+    long deadline_us = monotonic_us() + s->_handshake_timeout_ms * 1000;
+    if( s->read_request( req_ds, &in_frames, &req, deadline_us ) <= 0 ) {
+        if( errno == ETIMEDOUT )
+            s->_metrics.add( s->_m.handshake_timeouts );
+        LOG_DEBUG( "Unable to read new connection exiting thread ID: %d\n", ( int )tid );
+        s->release_client( req_ds );
+        pthread_exit( NULL );
+    }
     
     /* New connection must be new user */
-    ClientMessage in_req = s->parse_request( req );
+    ClientMessage *in_req = s->parse_request( req, arena );
 
-    int in_opt = in_req.option();
+    int in_opt = in_req->option();
 
     string usr_nm;
 
     if( in_opt == 1 ) {
-        usr_nm = s->register_user( in_req.synchronize(), req_ds );
+        usr_nm = s->register_user( in_req->synchronize(), req_ds, &in_frames, arena, deadline_us );
+        arena->Reset();
     } else {
         usr_nm = "";
-        s->send_response( req_ds.req_fd, &req_ds.socket_info, s->error_response( "You must log in first\n" ) );
-        fprintf( s->_log_level, "DEBUG: Unable to process new connection exiting thread ID: %d\n", ( int )tid);
-        close( req_ds.req_fd );
+        s->send_response( req_ds, *s->error_response( "You must log in first\n", arena ) );
+        LOG_DEBUG( "Unable to process new connection exiting thread ID: %d\n", ( int )tid );
+        s->release_client( req_ds );
         pthread_exit( NULL );
     }
 
     /* Server infinite loop */
     if( usr_nm != "" ){
-        fprintf( s->_log_level, "INFO: Listenging for client '%s' messages on thread ID: %d\n", usr_nm.c_str(), ( int )tid);
-        client_info user_ifo = s->get_user( usr_nm );
+        LOG_INFO( "Listenging for client '%s' messages on thread ID: %d\n", usr_nm.c_str(), ( int )tid );
+        client_info user_ifo;
+        s->get_user( usr_nm, &user_ifo );
         user_ifo.id = req_ds.id;
-        char req[ MESSAGE_SIZE ];
         while( 1 ) {
             /* Read for new messages */
-            int read_sz = s->read_request( req_ds.req_fd, req );
+            int read_sz = s->read_request( req_ds, &in_frames, &req );
 
             /* Check if it has error or is empty */
             if( read_sz <= 0 ) {
                 /* Error will disconnect user */
-                fprintf(s->_log_level, "ERROR: Unable to read request\n");
-                fprintf(s->_log_level,"INFO: Disconnecting user %s on fd %d\n", usr_nm.c_str(), req_ds.req_fd);
-                s->delete_user( usr_nm );
-                fprintf(s->_log_level, "DEBUG: Closing Client fd\n");
-                close( req_ds.req_fd ); 
+                LOG_ERROR( "Unable to read request\n" );
+                LOG_INFO( "Disconnecting user %s on fd %d, dropped frames: %lu\n", usr_nm.c_str(), req_ds.req_fd, req_ds.out->dropped );
+                s->delete_user( usr_nm, user_ifo.id );
+                LOG_DEBUG( "Closing Client fd\n" );
+                s->release_client( req_ds );
                 break;
             }
 
             /* Valid incomming request */
-            fprintf(s->_log_level, "INFO: Incomming request from user %s on fd %d...\n", usr_nm.c_str(), req_ds.req_fd);
-            ServerMessage res = s->process_request( s->parse_request( req ), user_ifo );
+            LOG_INFO( "Incomming request from user %s on fd %d...\n", usr_nm.c_str(), req_ds.req_fd );
+            long start_ns = monotonic_ns();
+            ClientMessage *cl_msg = s->parse_request( req, arena );
+            ServerMessage *res = s->process_request( *cl_msg, user_ifo, arena );
             
-            if( s->send_response( req_ds.req_fd, &req_ds.socket_info, res ) < -1 ) {
-                fprintf( s->_log_level, "ERROR: Error sending response to fd %d\n", req_ds.req_fd );
+            if( s->send_response( req_ds, *res ) < 0 ) {
+                /* The socket is broken, the next read fails and disconnects the user */
+                LOG_ERROR( "Error sending response to fd %d\n", req_ds.req_fd );
+                shutdown( req_ds.req_fd, SHUT_RDWR );
             } else {
-                fprintf(s->_log_level, "DEBUG: Sent re to fd %d\n", req_ds.req_fd);
+                LOG_DEBUG( "Sent re to fd %d\n", req_ds.req_fd );
             }
+            s->count_request( cl_msg->option(), start_ns );
+            arena->Reset();
 
         }
     } else {
-        close( req_ds.req_fd ); 
+        s->release_client( req_ds );
     }
     pthread_exit( NULL );
 }
@@ -473,58 +2247,61 @@ void Server::req_push( client_info el ) {
 }
 
 /*
-* Get a user from the connected list using mutex
+* Get a user by its username from the connected users snapshot
+* returns 0 on succes -1 if the user is not connected
 */
-client_info Server::get_user( string key ) {
-    client_info user;
-    pthread_mutex_lock( &_user_list_mutex );
-    user = _user_list[ key ];
-    pthread_mutex_unlock( &_user_list_mutex );
-    return user;
+int Server::get_user( const string &key, client_info *out ) {
+    user_snapshot all_users = get_all_users();
+    const client_info *usr = all_users->find( key );
+    if( usr == NULL ) {
+        return -1;
+    }
+    *out = *usr;
+    return 0;
 }
 
 /*
-* Add a user to the connected list using mutex;
+* Add a user to the connected users and notify the presence subscribers
+* returns 0 on succes, -1 if the username is registered or -2 if the ip is already connected
 */
-void Server::add_user( client_info el ) {
-    pthread_mutex_lock( &_user_list_mutex );
-    _user_list[ el.name ] = el;
-    pthread_mutex_unlock( &_user_list_mutex );
+int Server::add_user( client_info el ) {
+    unsigned long version;
+    int res = _users.add( el, &version );
+    if( res == 0 )
+        publish_presence( PRESENCE_JOIN, el, version );
+    return res;
 }
 
 /*
-* Get a copy of the connected users
+* Get the current snapshot of connected users. It is shared, never copied, and does not change
 */
-map<std::string, client_info> Server::get_all_users() {
-    map<std::string, client_info> tmp;
-    pthread_mutex_lock( &_user_list_mutex );
-    tmp = _user_list;
-    pthread_mutex_unlock( &_user_list_mutex );
-    return tmp;
+user_snapshot Server::get_all_users() {
+    return _users.snapshot();
 }
 
 /*
-* Delete user with key
+* Delete user with key and notify the presence subscribers. With an id the user is only deleted
+* if it is still that connection, not a session that took over the username.
 */
-void Server::delete_user( string key ) {
-    pthread_mutex_lock( &_user_list_mutex );
-    _user_list.erase( key );
-    pthread_mutex_unlock( &_user_list_mutex );
+void Server::delete_user( string key, int id ) {
+    client_info usr;
+    unsigned long version;
+    if( _users.remove( key, &usr, &version, id ) == 0 ) {
+        _channels.leave_all( usr.id );
+        publish_presence( PRESENCE_LEAVE, usr, version );
+    }
 }
 
 /*
 * Get a user by its id
+* returns 0 on succes -1 if the user is not connected
 */
-client_info Server::get_user( int id ) {
-    map<std::string, client_info>::iterator it;
-    client_info usr;
-    pthread_mutex_lock( &_user_list_mutex );
-    for( it = _user_list.begin(); it != _user_list.end(); it++ ) {
-            if( it->second.id == id) {
-                usr = it->second;
-                break;
-            }
-        }
-    pthread_mutex_unlock( &_user_list_mutex );
-    return usr;
+int Server::get_user( int id, client_info *out ) {
+    user_snapshot all_users = get_all_users();
+    const client_info *usr = all_users->find( id );
+    if( usr == NULL ) {
+        return -1;
+    }
+    *out = *usr;
+    return 0;
 }
@@ -0,0 +1,215 @@
+#include "Chat.h"
+
+/*
+* Minimal io_uring wrapper on top of the raw system calls. Only one thread may use a ring.
+*/
+
+static int sys_uring_setup( unsigned entries, struct io_uring_params *p ) {
+    return ( int )syscall( __NR_io_uring_setup, entries, p );
+}
+
+static int sys_uring_enter( int fd, unsigned to_submit, unsigned min_complete, unsigned flags, void *arg, size_t arg_size ) {
+    return ( int )syscall( __NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, arg_size );
+}
+
+static int sys_uring_register( int fd, unsigned opcode, void *arg, unsigned nr_args ) {
+    return ( int )syscall( __NR_io_uring_register, fd, opcode, arg, nr_args );
+}
+
+/*
+* Create the ring and map its submission queue, completion queue and sqe array.
+* The completion queue is four times the submission queue so fan-out bursts do not overflow it.
+* returns 0 on succes -1 if the kernel does not support io_uring
+*/
+int uring_init( uring *r, unsigned entries ) {
+    struct io_uring_params p;
+    memset( r, 0, sizeof( *r ) );
+    memset( &p, 0, sizeof( p ) );
+    p.flags = IORING_SETUP_CQSIZE;
+    p.cq_entries = entries * 4;
+    r->fd = sys_uring_setup( entries, &p );
+    if( r->fd < 0 ) {
+        return -1;
+    }
+
+    /* Submission and completion rings share one mapping on every kernel with multishot support */
+    if( !( p.features & IORING_FEAT_SINGLE_MMAP ) || !( p.features & IORING_FEAT_EXT_ARG ) ) {
+        close( r->fd );
+        r->fd = -1;
+        errno = ENOSYS;
+        return -1;
+    }
+
+    r->sq_map_size = p.sq_off.array + p.sq_entries * sizeof( unsigned );
+    size_t cq_size = p.cq_off.cqes + p.cq_entries * sizeof( struct io_uring_cqe );
+    if( cq_size > r->sq_map_size )
+        r->sq_map_size = cq_size;
+    r->sq_map = mmap( NULL, r->sq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING );
+    if( r->sq_map == MAP_FAILED ) {
+        close( r->fd );
+        r->fd = -1;
+        return -1;
+    }
+
+    r->sqes_size = p.sq_entries * sizeof( struct io_uring_sqe );
+    r->sqes = ( struct io_uring_sqe * )mmap( NULL, r->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES );
+    if( r->sqes == MAP_FAILED ) {
+        munmap( r->sq_map, r->sq_map_size );
+        close( r->fd );
+        r->fd = -1;
+        return -1;
+    }
+
+    char *sq = ( char * )r->sq_map;
+    r->sq_head = ( unsigned * )( sq + p.sq_off.head );
+    r->sq_tail = ( unsigned * )( sq + p.sq_off.tail );
+    r->sq_array = ( unsigned * )( sq + p.sq_off.array );
+    r->sq_mask = *( unsigned * )( sq + p.sq_off.ring_mask );
+    r->sq_entries = p.sq_entries;
+    r->sq_local_tail = *r->sq_tail;
+
+    char *cq = ( char * )r->sq_map;
+    r->cq_head = ( unsigned * )( cq + p.cq_off.head );
+    r->cq_tail = ( unsigned * )( cq + p.cq_off.tail );
+    r->cq_mask = *( unsigned * )( cq + p.cq_off.ring_mask );
+    r->cqes = ( struct io_uring_cqe * )( cq + p.cq_off.cqes );
+
+    /* Identity mapping, sqe i always lives on slot i */
+    for( unsigned i = 0; i < p.sq_entries; i++ )
+        r->sq_array[ i ] = i;
+    return 0;
+}
+
+/*
+* Register count buffers of size bytes as buffer group 0, used by multishot receives
+* returns 0 on succes -1 if the kernel lacks provided buffer rings
+*/
+int uring_setup_buffers( uring *r, unsigned count, unsigned size ) {
+    size_t ring_size = count * sizeof( struct io_uring_buf );
+    void *ring = mmap( NULL, ring_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0 );
+    if( ring == MAP_FAILED )
+        return -1;
+
+    struct io_uring_buf_reg reg;
+    memset( &reg, 0, sizeof( reg ) );
+    reg.ring_addr = ( unsigned long )ring;
+    reg.ring_entries = count;
+    reg.bgid = 0;
+    if( sys_uring_register( r->fd, IORING_REGISTER_PBUF_RING, &reg, 1 ) < 0 ) {
+        munmap( ring, ring_size );
+        return -1;
+    }
+
+    r->buf_ring = ( struct io_uring_buf_ring * )ring;
+    r->buf_count = count;
+    r->buf_size = size;
+    r->buf_tail = 0;
+    r->buffers = ( char * )malloc( ( size_t )count * size );
+    for( unsigned i = 0; i < count; i++ )
+        uring_recycle_buffer( r, i );
+    return 0;
+}
+
+/*
+* Memory of provided buffer bid
+*/
+char * uring_buffer( uring *r, int bid ) {
+    return r->buffers + ( size_t )bid * r->buf_size;
+}
+
+/*
+* Give buffer bid back to the kernel
+*/
+void uring_recycle_buffer( uring *r, int bid ) {
+    /* Entries start at the ring base, bufs[] is shifted by the empty struct of its C++ declaration */
+    struct io_uring_buf *buf = ( struct io_uring_buf * )r->buf_ring + ( r->buf_tail & ( r->buf_count - 1 ) );
+    buf->addr = ( unsigned long )uring_buffer( r, bid );
+    buf->len = r->buf_size;
+    buf->bid = bid;
+    r->buf_tail++;
+    __atomic_store_n( &r->buf_ring->tail, r->buf_tail, __ATOMIC_RELEASE );
+}
+
+/*
+* Next free submission entry, cleared. Submits the queued entries first when the ring is full.
+* returns the entry or NULL on error
+*/
+struct io_uring_sqe * uring_get_sqe( uring *r ) {
+    unsigned head = __atomic_load_n( r->sq_head, __ATOMIC_ACQUIRE );
+    if( r->sq_local_tail - head >= r->sq_entries ) {
+        if( uring_submit( r, 0, 0 ) < 0 )
+            return NULL;
+        head = __atomic_load_n( r->sq_head, __ATOMIC_ACQUIRE );
+        if( r->sq_local_tail - head >= r->sq_entries )
+            return NULL;
+    }
+    struct io_uring_sqe *sqe = &r->sqes[ r->sq_local_tail & r->sq_mask ];
+    memset( sqe, 0, sizeof( *sqe ) );
+    r->sq_local_tail++;
+    return sqe;
+}
+
+/*
+* Submit every queued entry with a single io_uring_enter and wait for wait_nr completions,
+* at most timeout_ms milliseconds (-1 waits forever).
+* returns the number of submitted entries or -1 on error (ETIME on timeout)
+*/
+int uring_submit( uring *r, unsigned wait_nr, int timeout_ms ) {
+    unsigned to_submit = r->sq_local_tail - *r->sq_tail;
+    __atomic_store_n( r->sq_tail, r->sq_local_tail, __ATOMIC_RELEASE );
+    if( to_submit == 0 && wait_nr == 0 )
+        return 0;
+
+    unsigned flags = wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0;
+    struct io_uring_getevents_arg arg;
+    struct __kernel_timespec ts;
+    memset( &arg, 0, sizeof( arg ) );
+    if( timeout_ms >= 0 && wait_nr > 0 ) {
+        ts.tv_sec = timeout_ms / 1000;
+        ts.tv_nsec = ( long long )( timeout_ms % 1000 ) * 1000000;
+        arg.ts = ( unsigned long )&ts;
+    }
+    flags |= IORING_ENTER_EXT_ARG;
+
+    r->enters++;
+    return sys_uring_enter( r->fd, to_submit, wait_nr, flags, &arg, sizeof( arg ) );
+}
+
+/*
+* Number of completions waiting to be read
+*/
+unsigned uring_cq_ready( uring *r ) {
+    return __atomic_load_n( r->cq_tail, __ATOMIC_ACQUIRE ) - *r->cq_head;
+}
+
+/*
+* Oldest unread completion or NULL if there is none
+*/
+struct io_uring_cqe * uring_peek_cqe( uring *r ) {
+    unsigned head = *r->cq_head;
+    if( head == __atomic_load_n( r->cq_tail, __ATOMIC_ACQUIRE ) )
+        return NULL;
+    return &r->cqes[ head & r->cq_mask ];
+}
+
+/*
+* Release the completion returned by uring_peek_cqe
+*/
+void uring_cqe_seen( uring *r ) {
+    __atomic_store_n( r->cq_head, *r->cq_head + 1, __ATOMIC_RELEASE );
+}
+
+/*
+* Unmap and close the ring
+*/
+void uring_exit( uring *r ) {
+    if( r->fd < 0 )
+        return;
+    munmap( r->sqes, r->sqes_size );
+    munmap( r->sq_map, r->sq_map_size );
+    if( r->buf_ring != NULL )
+        munmap( r->buf_ring, r->buf_count * sizeof( struct io_uring_buf ) );
+    free( r->buffers );
+    close( r->fd );
+    r->fd = -1;
+}
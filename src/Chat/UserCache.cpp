@@ -0,0 +1,117 @@
+#include "Chat.h"
+
+/*
+* Connected users as the client knows them. Entries are keyed by id and found by username through
+* a second index, both are kept in step by put and remove. An update changes the fields of the
+* entry it names without touching the others, so a status change or a join costs a hash lookup
+* instead of rebuilding the list.
+*/
+
+UserCache::UserCache() {
+    _generation = 0;
+}
+
+/*
+* Find a user by id. returns NULL if not found
+*/
+const connected_user * UserCache::find( int id ) const {
+    unordered_map<int, cached_user>::const_iterator it = _users.find( id );
+    return it != _users.end() ? &it->second.user : NULL;
+}
+
+/*
+* Find a user by username. returns NULL if not found
+*/
+const connected_user * UserCache::find( const string &name ) const {
+    unordered_map<string, int>::const_iterator it = _by_name.find( name );
+    return it != _by_name.end() ? find( it->second ) : NULL;
+}
+
+/*
+* Add usr or update its entry. A username seen with another id is a new session of that user and
+* replaces the old entry, an id seen with another username was reused and is renamed. Status and
+* ip are kept when usr does not have them.
+* returns 0 on succes -1 if usr has no id and its username is unknown
+*/
+int UserCache::put( const ConnectedUser &usr ) {
+    const string &name = usr.username();
+    int id = usr.userid();
+    unordered_map<string, int>::iterator named = _by_name.find( name );
+    if( !usr.has_userid() ) {
+        if( named == _by_name.end() )
+            return -1;
+        id = named->second;
+    } else if( named != _by_name.end() && named->second != id ) {
+        _users.erase( named->second );
+        _by_name.erase( named );
+    }
+
+    cached_user &entry = _users[ id ];
+    if( entry.user.name != name ) {
+        if( !entry.user.name.empty() )
+            _by_name.erase( entry.user.name );
+        entry.user.id = id;
+        entry.user.name = name;
+        _by_name[ name ] = id;
+    }
+    if( usr.has_status() )
+        entry.user.status = usr.status();
+    if( usr.has_ip() )
+        entry.user.ip = usr.ip();
+    entry.generation = _generation;
+    return 0;
+}
+
+/*
+* Remove the user with name
+* returns 0 on succes -1 if not found
+*/
+int UserCache::remove( const string &name ) {
+    unordered_map<string, int>::iterator it = _by_name.find( name );
+    if( it == _by_name.end() )
+        return -1;
+    _users.erase( it->second );
+    _by_name.erase( it );
+    return 0;
+}
+
+/*
+* Start applying a complete list of users, the entries it puts are marked with a new generation
+*/
+void UserCache::begin_refresh() {
+    _generation++;
+}
+
+/*
+* Remove the users the list started by begin_refresh did not have
+*/
+void UserCache::end_refresh() {
+    unordered_map<int, cached_user>::iterator it = _users.begin();
+    while( it != _users.end() ) {
+        if( it->second.generation != _generation ) {
+            _by_name.erase( it->second.user.name );
+            it = _users.erase( it );
+        } else {
+            it++;
+        }
+    }
+}
+
+void UserCache::clear() {
+    _users.clear();
+    _by_name.clear();
+}
+
+size_t UserCache::size() const {
+    return _users.size();
+}
+
+/*
+* Copy every user to out, by username
+*/
+void UserCache::list( map <string, connected_user> *out ) const {
+    unordered_map<int, cached_user>::const_iterator it;
+    for( it = _users.begin(); it != _users.end(); it++ ) {
+        ( *out )[ it->second.user.name ] = it->second.user;
+    }
+}
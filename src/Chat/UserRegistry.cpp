@@ -0,0 +1,246 @@
+#include "Chat.h"
+
+/*
+* Copy on write registry of connected users. Readers get an immutable snapshot of the whole
+* user table without locking or copying it, writers build the next version under _write_mutex and
+* publish it with an atomic pointer swap.
+* Every snapshot keeps hash indexes by id, username and ip in sync, plus the usernames in order
+* so listings can be paged and filtered by prefix without scanning every user.
+*/
+
+
+/*
+* Find a user by id. returns NULL if not found
+*/
+const client_info * user_table::find( int id ) const {
+    user_map::const_iterator it = users.find( id );
+    return it != users.end() ? &it->second : NULL;
+}
+
+/*
+* Find a user by username. returns NULL if not found
+*/
+const client_info * user_table::find( const string &name ) const {
+    unordered_map<string, int>::const_iterator it = by_name.find( name );
+    return it != by_name.end() ? find( it->second ) : NULL;
+}
+
+/*
+* Append to out the users with username starting with req.prefix, in username order after
+* req.cursor. Stops at req.limit users (USERS_PAGE_SIZE at most) or before the page reaches
+* MESSAGE_SIZE bytes and sets nextCursor if more users match.
+* returns the number of users added
+*/
+int user_table::list( const connectedUserRequest &req, ConnectedUserResponse *out ) const {
+    const string &prefix = req.prefix();
+    size_t limit = req.limit() > 0 && req.limit() < USERS_PAGE_SIZE ? req.limit() : USERS_PAGE_SIZE;
+    map<string, int>::const_iterator it = req.has_cursor() && req.cursor() >= prefix ?
+        ordered_names.upper_bound( req.cursor() ) : ordered_names.lower_bound( prefix );
+
+    size_t bytes = 0;
+    int added = 0;
+    for( ; it != ordered_names.end() && it->first.compare( 0, prefix.size(), prefix ) == 0; it++ ) {
+        const client_info *usr = find( it->second );
+        size_t entry = usr->name.size() + usr->status.size() + 16;
+        if( ( size_t )added == limit || ( added > 0 && bytes + entry > MESSAGE_SIZE - 64 ) ) {
+            out->set_nextcursor( out->connectedusers( out->connectedusers_size() - 1 ).username() );
+            break;
+        }
+        ConnectedUser *c_user = out->add_connectedusers();
+        c_user->set_username( usr->name );
+        c_user->set_status( usr->status );
+        c_user->set_userid( usr->id );
+        bytes += entry;
+        added++;
+    }
+    return added;
+}
+
+/*
+* Find the user connected from ip. returns NULL if not found
+*/
+const client_info * user_table::find_ip( const string &ip ) const {
+    unordered_map<string, int>::const_iterator it = by_ip.find( ip );
+    return it != by_ip.end() ? find( it->second ) : NULL;
+}
+
+UserRegistry::UserRegistry() {
+    pthread_mutex_init( &_write_mutex, NULL );
+    shared_ptr<user_table> first( new user_table );
+    first->version = 1;
+    _current = first;
+    _version = 1;
+}
+
+/*
+* Get the current users snapshot. The snapshot never changes, it stays valid while it is held.
+* Nothing keeps it once the caller drops it, so a replaced table is freed with its last reader
+*/
+user_snapshot UserRegistry::snapshot() const {
+    return atomic_load( &_current );
+}
+
+/*
+* Version of the latest published snapshot, increases on every change
+*/
+unsigned long UserRegistry::version() const {
+    return _version.load( memory_order_acquire );
+}
+
+/*
+* Add user el. version gets the version that added it.
+* returns 0 on succes, -1 if the username is registered or -2 if the ip is already connected
+*/
+int UserRegistry::add( const client_info &el, unsigned long *version ) {
+    pthread_mutex_lock( &_write_mutex );
+    int res = can_add( *_current, el );
+    if( res == 0 ) {
+        shared_ptr<user_table> next( new user_table( *_current ) );
+        insert( next.get(), el );
+        unsigned long v = publish( next );
+        if( version != NULL )
+            *version = v;
+    }
+    pthread_mutex_unlock( &_write_mutex );
+    return res;
+}
+
+/*
+* Add every user in els publishing a single new version. Users that can not be added are skipped,
+* results gets what add would have returned for each of them and version the new version.
+* returns the number of users added
+*/
+int UserRegistry::add_all( const vector<client_info> &els, vector<int> *results, unsigned long *version ) {
+    int added = 0;
+    pthread_mutex_lock( &_write_mutex );
+    shared_ptr<user_table> next( new user_table( *_current ) );
+    for( size_t i = 0; i < els.size(); i++ ) {
+        int res = can_add( *next, els[ i ] );
+        if( res == 0 ) {
+            insert( next.get(), els[ i ] );
+            added++;
+        }
+        if( results != NULL )
+            results->push_back( res );
+    }
+    unsigned long v = added > 0 ? publish( next ) : _version.load( memory_order_relaxed );
+    if( version != NULL )
+        *version = v;
+    pthread_mutex_unlock( &_write_mutex );
+    return added;
+}
+
+/*
+* Remove user with name, copying it to out and the version that removed it to version.
+* With an id > 0 the user is only removed if it has that id.
+* returns 0 on succes -1 if not found
+*/
+int UserRegistry::remove( const string &name, client_info *out, unsigned long *version, int id ) {
+    pthread_mutex_lock( &_write_mutex );
+    const client_info *usr = _current->find( name );
+    if( usr == NULL || ( id > 0 && usr->id != id ) ) {
+        pthread_mutex_unlock( &_write_mutex );
+        return -1;
+    }
+    if( out != NULL )
+        *out = *usr;
+    shared_ptr<user_table> next( new user_table( *_current ) );
+    if( usr->ip != "" )
+        next->by_ip.erase( usr->ip );
+    next->by_name.erase( name );
+    next->ordered_names.erase( name );
+    next->users.erase( usr->id );
+    unsigned long v = publish( next );
+    if( version != NULL )
+        *version = v;
+    pthread_mutex_unlock( &_write_mutex );
+    return 0;
+}
+
+/*
+* Remove every user in els publishing a single new version, each by name and only if it still has
+* the id of its el when that is > 0. removed gets the users that were removed and version the new
+* version.
+* returns the number of users removed
+*/
+int UserRegistry::remove_all( const vector<client_info> &els, vector<client_info> *removed, unsigned long *version ) {
+    int count = 0;
+    pthread_mutex_lock( &_write_mutex );
+    shared_ptr<user_table> next( new user_table( *_current ) );
+    for( size_t i = 0; i < els.size(); i++ ) {
+        const client_info *usr = next->find( els[ i ].name );
+        if( usr == NULL || ( els[ i ].id > 0 && usr->id != els[ i ].id ) )
+            continue;
+        if( removed != NULL )
+            removed->push_back( *usr );
+        int id = usr->id;
+        if( usr->ip != "" )
+            next->by_ip.erase( usr->ip );
+        next->by_name.erase( els[ i ].name );
+        next->ordered_names.erase( els[ i ].name );
+        next->users.erase( id );
+        count++;
+    }
+    unsigned long v = count > 0 ? publish( next ) : _version.load( memory_order_relaxed );
+    if( version != NULL )
+        *version = v;
+    pthread_mutex_unlock( &_write_mutex );
+    return count;
+}
+
+/*
+* Change the status of user name, copying the updated user to out and the version to version.
+* returns 0 on succes -1 if not found
+*/
+int UserRegistry::set_status( const string &name, const string &status, client_info *out, unsigned long *version ) {
+    pthread_mutex_lock( &_write_mutex );
+    const client_info *usr = _current->find( name );
+    if( usr == NULL ) {
+        pthread_mutex_unlock( &_write_mutex );
+        return -1;
+    }
+    shared_ptr<user_table> next( new user_table( *_current ) );
+    client_info &n_usr = next->users[ usr->id ];
+    n_usr.status = status;
+    if( out != NULL )
+        *out = n_usr;
+    unsigned long v = publish( next );
+    if( version != NULL )
+        *version = v;
+    pthread_mutex_unlock( &_write_mutex );
+    return 0;
+}
+
+/*
+* Check el can be added to table. returns 0 if it can, -1 repeated username, -2 repeated ip
+*/
+int UserRegistry::can_add( const user_table &table, const client_info &el ) {
+    if( table.by_name.find( el.name ) != table.by_name.end() )
+        return -1;
+    if( el.ip != "" && table.by_ip.find( el.ip ) != table.by_ip.end() )
+        return -2;
+    return 0;
+}
+
+/*
+* Insert el on table and its indexes
+*/
+void UserRegistry::insert( user_table *table, const client_info &el ) {
+    table->users[ el.id ] = el;
+    table->by_name[ el.name ] = el.id;
+    table->ordered_names[ el.name ] = el.id;
+    if( el.ip != "" )
+        table->by_ip[ el.ip ] = el.id;
+}
+
+/*
+* Swap in the next version, the snapshot carries its own version number.
+* Must be called with _write_mutex held
+* returns the published version
+*/
+unsigned long UserRegistry::publish( shared_ptr<user_table> next ) {
+    next->version = _version.load( memory_order_relaxed ) + 1;
+    atomic_store( &_current, user_snapshot( next ) );
+    _version.store( next->version, memory_order_release );
+    return next->version;
+}
@@ -0,0 +1,34 @@
+#include <stdlib.h>
+#include <new>
+#include <atomic>
+
+/*
+* Global operator new that counts heap allocations, linked into the benchmarks that report
+* allocations per operation. Kept in its own file so the compiler never sees a new and its
+* matching free together.
+*/
+
+static std::atomic<long> allocations( 0 );
+
+/*
+* Heap allocations made through operator new so far
+*/
+long allocation_count() {
+    return allocations.load( std::memory_order_relaxed );
+}
+
+void * operator new( size_t size ) {
+    allocations.fetch_add( 1, std::memory_order_relaxed );
+    void *p = malloc( size ? size : 1 );
+    if( p == NULL )
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete( void *p ) noexcept {
+    free( p );
+}
+
+void operator delete( void *p, size_t ) noexcept {
+    free( p );
+}
@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include <algorithm>
+#include "Chat.h"
+
+/*
+* Delivery batching benchmark. For every coalescing window starts an in-process server,
+* logs in N loopback clients that advertise batch support and broadcasts at a fixed rate.
+* Every broadcast carries its send time, the clients unpack batches and report delivered
+* messages/sec, frames/sec and the p50/p99 delivery latency. Window 0 is batching turned off.
+*
+* usage: ./bench_batch [clients] [seconds] [broadcasts/s] [first port] [epoll|threaded|workers|uring]
+*/
+
+/*
+* Send a serialized client message on fd
+* returns 0 on succes -1 on error
+*/
+static int send_msg( int fd, ClientMessage &msg ) {
+    string srl, frame;
+    msg.SerializeToString( &srl );
+    encode_frame( srl, &frame );
+    return write_all( fd, frame.data(), frame.size() );
+}
+
+/*
+* Connect and log in client number idx asking for batches
+* returns the connected fd or -1 on error
+*/
+static int open_client( struct sockaddr_in *serv, int idx ) {
+    int fd = socket( AF_INET, SOCK_STREAM, 0 );
+    if( fd < 0 )
+        return -1;
+
+    struct sockaddr_in local;
+    memset( &local, 0, sizeof( local ) );
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl( ( 127 << 24 ) | ( 2 << 16 ) | ( idx + 1 ) );
+    int one = 1;
+    setsockopt( fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof( one ) );
+    if( bind( fd, (struct sockaddr *)&local, sizeof( local ) ) < 0 ||
+        connect( fd, (struct sockaddr *)serv, sizeof( *serv ) ) < 0 ) {
+        close( fd );
+        return -1;
+    }
+
+    char name[ 32 ];
+    snprintf( name, sizeof( name ), "batch%d", idx );
+    ClientMessage sync;
+    sync.set_option( SYNCHRONIZED );
+    sync.mutable_synchronize()->set_username( name );
+    sync.mutable_synchronize()->set_batch( true );
+    if( send_msg( fd, sync ) < 0 ) {
+        close( fd );
+        return -1;
+    }
+
+    FrameBuffer in;
+    string res;
+    while( in.next_frame( &res ) == 0 ) {
+        if( in.read_from( fd ) <= 0 ) {
+            close( fd );
+            return -1;
+        }
+    }
+    ServerMessage srv_res;
+    if( !srv_res.ParseFromString( res ) || srv_res.option() != MYINFORESPONSE ) {
+        close( fd );
+        return -1;
+    }
+
+    ClientMessage ack;
+    ack.set_option( ACKNOWLEDGE );
+    ack.mutable_acknowledge()->set_userid( srv_res.myinforesponse().userid() );
+    if( send_msg( fd, ack ) < 0 ) {
+        close( fd );
+        return -1;
+    }
+    return fd;
+}
+
+static void * run_server( void * context ) {
+    ( ( Server * )context )->start();
+    return NULL;
+}
+
+/*
+* Record the delivery latency of a broadcast, its message is the send time
+*/
+static void record( const ServerMessage &msg, long now, vector<long> *latencies ) {
+    if( msg.option() == BROADCASTS )
+        latencies->push_back( now - atol( msg.broadcast().message().c_str() ) );
+}
+
+int main( int argc, char *argv[] ) {
+    int n_clients = argc > 1 ? atoi( argv[1] ) : 64;
+    double seconds = argc > 2 ? atof( argv[2] ) : 3;
+    double rate = argc > 3 ? atof( argv[3] ) : 1000;
+    int port = argc > 4 ? atoi( argv[4] ) : 9500;
+    const char *mode_name = argc > 5 ? argv[5] : "epoll";
+    server_mode mode = EVENT_LOOP;
+    if( strcmp( mode_name, "threaded" ) == 0 ) {
+        mode = THREADED;
+    } else if( strcmp( mode_name, "workers" ) == 0 ) {
+        mode = WORKERS;
+    }
+    FILE *log_file = fopen( "/dev/null", "w" );
+    signal( SIGPIPE, SIG_IGN );
+
+    long windows[] = { 0, 250, 1000, 5000, 20000 };
+    for( size_t k = 0; k < sizeof( windows ) / sizeof( windows[0] ); k++ ) {
+        /* Servers are left running idle, every window gets its own port */
+        Server *server = new Server( port + k, log_file, mode );
+        server->set_batching( windows[ k ], BATCH_MAX_BYTES );
+        server->set_workers( 2 );
+        server->set_backend( strcmp( mode_name, "uring" ) == 0 ? URING_BACKEND : EPOLL_BACKEND );
+        if( server->initiate() < 0 ) {
+            printf( "Unable to start server on port %d\n", port + ( int )k );
+            return 1;
+        }
+        pthread_t thread;
+        pthread_create( &thread, NULL, &run_server, server );
+
+        struct sockaddr_in serv;
+        memset( &serv, 0, sizeof( serv ) );
+        serv.sin_family = AF_INET;
+        serv.sin_port = htons( port + k );
+        inet_pton( AF_INET, "127.0.0.1", &serv.sin_addr );
+
+        vector<int> fds;
+        for( int i = 0; i < n_clients; i++ ) {
+            int fd = open_client( &serv, i );
+            if( fd < 0 ) {
+                printf( "Unable to open client %d\n", i );
+                return 1;
+            }
+            fds.push_back( fd );
+        }
+
+        int ep = epoll_create1( 0 );
+        vector<FrameBuffer> in( fds.size() );
+        for( size_t i = 0; i < fds.size(); i++ ) {
+            struct epoll_event ev;
+            ev.events = EPOLLIN;
+            ev.data.u32 = i;
+            epoll_ctl( ep, EPOLL_CTL_ADD, fds[ i ], &ev );
+        }
+
+        long sent = 0, frames = 0;
+        vector<long> latencies;
+        struct epoll_event events[ MAX_EVENTS ];
+        string res;
+        ServerMessage msg;
+        long start = monotonic_us();
+        long end = start + ( long )( seconds * 1e6 );
+        long next_send = start;
+        char text[ 32 ];
+        while( monotonic_us() < end ) {
+            long now = monotonic_us();
+            while( now >= next_send ) {
+                ClientMessage br;
+                br.set_option( BROADCASTC );
+                snprintf( text, sizeof( text ), "%ld", now );
+                br.mutable_broadcast()->set_message( text );
+                if( send_msg( fds[ sent % fds.size() ], br ) < 0 )
+                    break;
+                sent++;
+                next_send += ( long )( 1e6 / rate );
+            }
+
+            /* Rounded up, spinning would take the core from the server thread */
+            int n_ev = epoll_wait( ep, events, MAX_EVENTS, ( int )( ( next_send - now + 999 ) / 1000 ) );
+            now = monotonic_us();
+            for( int i = 0; i < n_ev; i++ ) {
+                int idx = events[ i ].data.u32;
+                if( in[ idx ].read_from( fds[ idx ] ) <= 0 )
+                    continue;
+                while( in[ idx ].next_frame( &res ) > 0 ) {
+                    frames++;
+                    msg.ParseFromString( res );
+                    if( msg.option() == BATCH ) {
+                        for( int m = 0; m < msg.batch().messages_size(); m++ )
+                            record( msg.batch().messages( m ), now, &latencies );
+                    } else {
+                        record( msg, now, &latencies );
+                    }
+                }
+            }
+        }
+
+        double elapsed = ( monotonic_us() - start ) / 1e6;
+        sort( latencies.begin(), latencies.end() );
+        long p50 = latencies.empty() ? 0 : latencies[ latencies.size() / 2 ];
+        long p99 = latencies.empty() ? 0 : latencies[ latencies.size() * 99 / 100 ];
+        printf( "mode=%s window_us=%ld clients=%d broadcasts_per_sec=%.0f delivered_per_sec=%.0f frames_per_sec=%.0f p50_us=%ld p99_us=%ld\n",
+            mode_name, windows[ k ], n_clients, sent / elapsed, latencies.size() / elapsed, frames / elapsed, p50, p99 );
+
+        for( size_t i = 0; i < fds.size(); i++ )
+            close( fds[ i ] );
+        close( ep );
+    }
+
+    log_close();
+    return 0;
+}
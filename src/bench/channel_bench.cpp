@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include "Chat.h"
+
+/*
+* Channel fan-out benchmark. Registers N users on an in-process Server, spreads them over C
+* channels and compares the cost of a channel post with a global broadcast to every user.
+* The posts are timed again while another thread keeps joining and leaving channels, membership
+* changes must not slow the fan-out down. The users share a few socket pairs drained by a
+* background thread so 10k users fit in the fd limit.
+*
+* usage: ./bench_channels [users] [channels] [posts]
+*/
+
+#define SHARED_SOCKETS 64
+
+struct drain_args {
+    int epoll_fd;
+    volatile int running;
+};
+
+struct churn_args {
+    Server *server;
+    vector<client_info> *clients;
+    int channels;
+    volatile int running;
+    long changes;
+};
+
+/*
+* Current monotonic time in seconds
+*/
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+* Read and discard everything written to the clients
+*/
+static void * drainer( void * context ) {
+    drain_args *args = ( drain_args * )context;
+    struct epoll_event events[ MAX_EVENTS ];
+    char buf[ 65536 ];
+    while( args->running ) {
+        int n_ev = epoll_wait( args->epoll_fd, events, MAX_EVENTS, 10 );
+        for( int i = 0; i < n_ev; i++ ) {
+            while( recv( events[ i ].data.fd, buf, sizeof( buf ), MSG_DONTWAIT ) > 0 );
+        }
+    }
+    return NULL;
+}
+
+/*
+* Flush what the sockets did not take, like the connection owners do
+*/
+static void flush_all( vector<client_info> &clients ) {
+    for( size_t i = 0; i < clients.size(); i++ ) {
+        send_queue *q = clients[ i ].out.get();
+        pthread_mutex_lock( &q->mutex );
+        flush_send_queue( q );
+        pthread_mutex_unlock( &q->mutex );
+    }
+}
+
+/*
+* Parse, process and answer one request the way a connection owner does
+*/
+static void run_request( Server &server, const client_info &sender, const ClientMessage &req, request_arena *arena ) {
+    server.send_response( sender, *server.process_request( req, sender, &arena->arena ) );
+    arena->arena.Reset();
+}
+
+static void channel_name( int channel, char *name, size_t size ) {
+    snprintf( name, size, "room%d", channel );
+}
+
+/*
+* Keep moving users in and out of another populated channel
+*/
+static void * churner( void * context ) {
+    churn_args *args = ( churn_args * )context;
+    request_arena arena;
+    ClientMessage req;
+    char name[ 32 ];
+    unsigned int seed = 7;
+    while( args->running ) {
+        const client_info &cl = ( *args->clients )[ rand_r( &seed ) % args->clients->size() ];
+        channel_name( ( cl.id + 1 ) % args->channels, name, sizeof( name ) );
+        req.set_option( JOINCHANNEL );
+        req.mutable_channel()->set_channel( name );
+        run_request( *args->server, cl, req, &arena );
+        req.set_option( LEAVECHANNEL );
+        run_request( *args->server, cl, req, &arena );
+        args->changes += 2;
+    }
+    return NULL;
+}
+
+/*
+* Average ns per request of a spread of senders posting their request. Queues are flushed
+* about every 64 frames per user so walking every queue does not dominate small channels
+*/
+static double time_posts( Server &server, vector<client_info> &clients, vector<ClientMessage> &reqs, int posts, int recipients, request_arena *arena ) {
+    int flush_every = max( 1, 64 * ( int )clients.size() / recipients );
+    double start = now_sec();
+    for( int r = 0; r < posts; r++ ) {
+        size_t idx = ( ( size_t )r * 7919 ) % clients.size();
+        run_request( server, clients[ idx ], reqs[ idx ], arena );
+        if( r % flush_every == flush_every - 1 )
+            flush_all( clients );
+    }
+    flush_all( clients );
+    return ( now_sec() - start ) * 1e9 / posts;
+}
+
+int main( int argc, char *argv[] ) {
+    int n_users = argc > 1 ? atoi( argv[1] ) : 10000;
+    int n_channels = argc > 2 ? atoi( argv[2] ) : 1000;
+    int posts = argc > 3 ? atoi( argv[3] ) : 20000;
+    FILE *log_file = fopen( "/dev/null", "w" );
+    signal( SIGPIPE, SIG_IGN );
+    Server server( 0, log_file, EVENT_LOOP );
+
+    drain_args args;
+    args.epoll_fd = epoll_create1( 0 );
+    args.running = 1;
+    pthread_t thread;
+    pthread_create( &thread, NULL, &drainer, &args );
+
+    int fds[ SHARED_SOCKETS ];
+    for( int i = 0; i < SHARED_SOCKETS; i++ ) {
+        int sv[2];
+        if( socketpair( AF_UNIX, SOCK_STREAM, 0, sv ) < 0 ) {
+            perror( "socketpair" );
+            return 1;
+        }
+        fcntl( sv[0], F_SETFL, fcntl( sv[0], F_GETFL, 0 ) | O_NONBLOCK );
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.fd = sv[1];
+        epoll_ctl( args.epoll_fd, EPOLL_CTL_ADD, sv[1], &ev );
+        fds[ i ] = sv[0];
+    }
+
+    /* Every user joins channel i % channels, posts and broadcasts carry the same text */
+    request_arena arena;
+    vector<client_info> clients;
+    vector<ClientMessage> channel_posts( n_users ), broadcasts( n_users );
+    char name[ 32 ];
+    string text( 64, 'x' );
+    for( int i = 0; i < n_users; i++ ) {
+        struct sockaddr_in addr;
+        memset( &addr, 0, sizeof( addr ) );
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl( ( 10 << 24 ) + i + 1 );
+        client_info cl = server.new_client( fds[ i % SHARED_SOCKETS ], addr );
+        snprintf( name, sizeof( name ), "user%d", i );
+        MyInfoSynchronize sync;
+        sync.set_username( name );
+        server.begin_registration( sync, cl, &arena.arena );
+        arena.arena.Reset();
+        cl.name = name;
+        clients.push_back( cl );
+
+        channel_name( i % n_channels, name, sizeof( name ) );
+        ClientMessage join;
+        join.set_option( JOINCHANNEL );
+        join.mutable_channel()->set_channel( name );
+        run_request( server, cl, join, &arena );
+
+        channel_posts[ i ].set_option( CHANNELMESSAGE );
+        channel_posts[ i ].mutable_channelmessage()->set_channel( name );
+        channel_posts[ i ].mutable_channelmessage()->set_message( text );
+        broadcasts[ i ].set_option( BROADCASTC );
+        broadcasts[ i ].mutable_broadcast()->set_message( text );
+    }
+    flush_all( clients );
+
+    /* A broadcast reaches every user, a hundredth of the posts is enough */
+    int broadcast_posts = max( 64, posts / 100 );
+    int members = n_users / n_channels;
+    double broadcast_ns = time_posts( server, clients, broadcasts, broadcast_posts, n_users - 1, &arena );
+    double channel_ns = time_posts( server, clients, channel_posts, posts, members - 1, &arena );
+
+    churn_args churn;
+    churn.server = &server;
+    churn.clients = &clients;
+    churn.channels = n_channels;
+    churn.running = 1;
+    churn.changes = 0;
+    pthread_t churn_thread;
+    pthread_create( &churn_thread, NULL, &churner, &churn );
+    double start = now_sec();
+    double churn_ns = time_posts( server, clients, channel_posts, posts, members - 1, &arena );
+    churn.running = 0;
+    pthread_join( churn_thread, NULL );
+    double elapsed = now_sec() - start;
+
+    printf( "users=%d channels=%d members_per_channel=%d\n", n_users, n_channels, members );
+    printf( "broadcast_ns_per_message=%.0f recipients=%d\n", broadcast_ns, n_users - 1 );
+    printf( "channel_ns_per_message=%.0f recipients=%d speedup=%.0fx\n", channel_ns, members - 1, broadcast_ns / channel_ns );
+    printf( "channel_ns_per_message_with_churn=%.0f membership_changes_per_sec=%.0f\n", churn_ns, churn.changes / elapsed );
+
+    args.running = 0;
+    pthread_join( thread, NULL );
+    log_close();
+    fclose( log_file );
+    return 0;
+}
@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <time.h>
+#include <dirent.h>
+#include "Chat.h"
+
+/*
+* Connection benchmark: opens N loopback clients against a running server and reports the
+* server process RSS, thread count and open fds. In active mode the clients broadcast at a fixed
+* rate while every incoming message is drained. A rate of 0 broadcasts as fast as the server
+* takes them, the received bytes per second are the delivered throughput.
+* Every client binds to its own 127.1.x.y address because the server rejects repeated ips.
+*
+* usage: ./bench_conn <address> <port> <clients> <server_pid> [idle|active] [seconds] [broadcasts/s]
+*/
+
+/*
+* Current monotonic time in seconds
+*/
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+* Send a serialized client message on fd
+* returns 0 on succes -1 on error
+*/
+static int send_msg( int fd, ClientMessage &msg ) {
+    string srl, frame;
+    msg.SerializeToString( &srl );
+    encode_frame( srl, &frame );
+    return write_all( fd, frame.data(), frame.size() );
+}
+
+/*
+* Connect and log in client number idx
+* returns the connected fd or -1 on error
+*/
+static int open_client( struct sockaddr_in *serv, int idx ) {
+    int fd = socket( AF_INET, SOCK_STREAM, 0 );
+    if( fd < 0 )
+        return -1;
+
+    struct sockaddr_in local;
+    memset( &local, 0, sizeof( local ) );
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl( ( 127 << 24 ) | ( 1 << 16 ) | ( idx + 1 ) );
+    local.sin_port = 0;
+    if( bind( fd, (struct sockaddr *)&local, sizeof( local ) ) < 0 ||
+        connect( fd, (struct sockaddr *)serv, sizeof( *serv ) ) < 0 ) {
+        close( fd );
+        return -1;
+    }
+
+    /* Sync -> MyInfoResponse -> Ack */
+    char name[ 32 ];
+    snprintf( name, sizeof( name ), "bench%d", idx );
+    ClientMessage sync;
+    sync.set_option( SYNCHRONIZED );
+    sync.mutable_synchronize()->set_username( name );
+    if( send_msg( fd, sync ) < 0 ) {
+        close( fd );
+        return -1;
+    }
+
+    FrameBuffer in;
+    string res;
+    while( in.next_frame( &res ) == 0 ) {
+        if( in.read_from( fd ) <= 0 ) {
+            close( fd );
+            return -1;
+        }
+    }
+    ServerMessage srv_res;
+    if( !srv_res.ParseFromString( res ) || srv_res.option() != MYINFORESPONSE ) {
+        close( fd );
+        return -1;
+    }
+
+    ClientMessage ack;
+    ack.set_option( ACKNOWLEDGE );
+    ack.mutable_acknowledge()->set_userid( srv_res.myinforesponse().userid() );
+    if( send_msg( fd, ack ) < 0 ) {
+        close( fd );
+        return -1;
+    }
+    return fd;
+}
+
+/*
+* Print RSS, threads and open fds of process pid
+*/
+static void print_proc_stats( int pid, const char *label ) {
+    char path[ 64 ];
+    char line[ 256 ];
+    long rss_kb = -1, threads = -1;
+    snprintf( path, sizeof( path ), "/proc/%d/status", pid );
+    FILE *st = fopen( path, "r" );
+    if( st != NULL ) {
+        while( fgets( line, sizeof( line ), st ) != NULL ) {
+            sscanf( line, "VmRSS: %ld", &rss_kb );
+            sscanf( line, "Threads: %ld", &threads );
+        }
+        fclose( st );
+    }
+
+    int fds = 0;
+    snprintf( path, sizeof( path ), "/proc/%d/fd", pid );
+    DIR *dir = opendir( path );
+    if( dir != NULL ) {
+        while( readdir( dir ) != NULL )
+            fds++;
+        closedir( dir );
+        fds -= 2;
+    }
+    printf( "%s: rss_kb=%ld threads=%ld fds=%d\n", label, rss_kb, threads, fds );
+}
+
+int main( int argc, char *argv[] ) {
+    if( argc < 5 ) {
+        printf( "usage: %s <address> <port> <clients> <server_pid> [idle|active] [seconds] [broadcasts/s]\n", argv[0] );
+        return 1;
+    }
+
+    int n_clients = atoi( argv[3] );
+    int server_pid = atoi( argv[4] );
+    int active = argc > 5 && strcmp( argv[5], "active" ) == 0;
+    double seconds = argc > 6 ? atof( argv[6] ) : 10;
+    double rate = argc > 7 ? atof( argv[7] ) : 100;
+
+    struct sockaddr_in serv;
+    memset( &serv, 0, sizeof( serv ) );
+    serv.sin_family = AF_INET;
+    serv.sin_port = htons( atoi( argv[2] ) );
+    if( inet_pton( AF_INET, argv[1], &serv.sin_addr ) <= 0 ) {
+        printf( "Invalid server address\n" );
+        return 1;
+    }
+
+    print_proc_stats( server_pid, "baseline" );
+
+    /* Open and log in every client */
+    vector<int> fds;
+    double start = now_sec();
+    for( int i = 0; i < n_clients; i++ ) {
+        int fd = open_client( &serv, i );
+        if( fd < 0 ) {
+            printf( "Unable to open client %d\n", i );
+            break;
+        }
+        fds.push_back( fd );
+    }
+    printf( "connected=%d login_seconds=%.3f\n", ( int )fds.size(), now_sec() - start );
+
+    int ep = epoll_create1( 0 );
+    for( size_t i = 0; i < fds.size(); i++ ) {
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.fd = fds[ i ];
+        epoll_ctl( ep, EPOLL_CTL_ADD, fds[ i ], &ev );
+    }
+
+    /* Run for the given time, broadcasting on active mode and draining incoming data */
+    long sent = 0;
+    long rec_bytes = 0;
+    char buf[ 65536 ];
+    struct epoll_event events[ MAX_EVENTS ];
+    start = now_sec();
+    double next_send = start;
+    while( now_sec() - start < seconds && !fds.empty() ) {
+        if( active && ( rate <= 0 || now_sec() >= next_send ) ) {
+            ClientMessage br;
+            br.set_option( BROADCASTC );
+            br.mutable_broadcast()->set_message( "bench message" );
+            /* Sockets stay blocking for writes so a full send buffer throttles the bench */
+            if( send_msg( fds[ sent % fds.size() ], br ) < 0 )
+                break;
+            sent++;
+            if( rate > 0 )
+                next_send += 1.0 / rate;
+        }
+        int n_ev = epoll_wait( ep, events, MAX_EVENTS, active && rate <= 0 ? 0 : 1 );
+        for( int i = 0; i < n_ev; i++ ) {
+            int rd;
+            while( ( rd = recv( events[ i ].data.fd, buf, sizeof( buf ), MSG_DONTWAIT ) ) > 0 )
+                rec_bytes += rd;
+        }
+    }
+
+    double elapsed = now_sec() - start;
+    printf( "broadcasts_sent=%ld bytes_received=%ld\n", sent, rec_bytes );
+    printf( "broadcasts_per_sec=%.0f received_mb_per_sec=%.2f\n", sent / elapsed, rec_bytes / elapsed / 1e6 );
+    print_proc_stats( server_pid, active ? "active" : "idle" );
+
+    for( size_t i = 0; i < fds.size(); i++ )
+        close( fds[ i ] );
+    return 0;
+}
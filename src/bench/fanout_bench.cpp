@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <time.h>
+#include "Chat.h"
+
+/*
+* Broadcast fan-out microbenchmark. Registers recipients on an in-process Server whose connections
+* are socket pairs drained by a background thread, then compares serializing the broadcast for every
+* recipient (send_response per user) against the serialize-once path (broadcast_message).
+* Reports broadcasts/sec against recipient count.
+* The last scenario stops reading one recipient and checks the broadcast rate to the others holds.
+*
+* usage: ./bench_fanout [max recipients] [log file]
+*/
+
+struct drain_args {
+    int epoll_fd;
+    volatile int running;
+    atomic<long> bytes;
+};
+
+/*
+* Current monotonic time in seconds
+*/
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+* Read and discard everything written to the recipients
+*/
+static void * drainer( void * context ) {
+    drain_args *args = ( drain_args * )context;
+    struct epoll_event events[ MAX_EVENTS ];
+    char buf[ 65536 ];
+    while( args->running ) {
+        int n_ev = epoll_wait( args->epoll_fd, events, MAX_EVENTS, 10 );
+        for( int i = 0; i < n_ev; i++ ) {
+            int rd;
+            while( ( rd = recv( events[ i ].data.fd, buf, sizeof( buf ), MSG_DONTWAIT ) ) > 0 )
+                args->bytes += rd;
+        }
+    }
+    return NULL;
+}
+
+/*
+* Flush what the sockets did not take, like the connection owners do
+*/
+static void flush_all( vector<client_info> &recipients ) {
+    for( size_t i = 0; i < recipients.size(); i++ ) {
+        send_queue *q = recipients[ i ].out.get();
+        pthread_mutex_lock( &q->mutex );
+        flush_send_queue( q );
+        pthread_mutex_unlock( &q->mutex );
+    }
+}
+
+/*
+* Register recipients until there are size of them, their peer sockets are read by the drainer
+*/
+static void add_recipients( Server &server, drain_args &args, vector<client_info> &recipients, vector<int> &peers, int size ) {
+    request_arena arena;
+    while( ( int )recipients.size() < size ) {
+        int sv[2];
+        if( socketpair( AF_UNIX, SOCK_STREAM, 0, sv ) < 0 ) {
+            perror( "socketpair" );
+            exit( 1 );
+        }
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.fd = sv[1];
+        epoll_ctl( args.epoll_fd, EPOLL_CTL_ADD, sv[1], &ev );
+
+        struct sockaddr_in addr;
+        memset( &addr, 0, sizeof( addr ) );
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl( ( 10 << 24 ) + recipients.size() + 1 );
+        client_info cl = server.new_client( sv[0], addr );
+
+        char name[ 32 ];
+        snprintf( name, sizeof( name ), "user%d", ( int )recipients.size() );
+        MyInfoSynchronize sync;
+        sync.set_username( name );
+        server.begin_registration( sync, cl, &arena.arena );
+        arena.arena.Reset();
+        cl.name = name;
+        recipients.push_back( cl );
+        peers.push_back( sv[1] );
+    }
+}
+
+/*
+* Broadcast for the given time, returns broadcasts/sec
+*/
+static double timed_broadcasts( Server &server, vector<client_info> &recipients, BroadcastRequest &req, client_info &sender, double seconds ) {
+    request_arena arena;
+    long rounds = 0;
+    double start = now_sec();
+    while( now_sec() - start < seconds ) {
+        server.broadcast_message( req, sender, &arena.arena );
+        arena.arena.Reset();
+        flush_all( recipients );
+        rounds++;
+    }
+    return rounds / ( now_sec() - start );
+}
+
+int main( int argc, char *argv[] ) {
+    int max_recipients = argc > 1 ? atoi( argv[1] ) : 5000;
+    FILE *log_file = fopen( argc > 2 ? argv[2] : "/dev/null", "w" );
+    Server server( 0, log_file );
+
+    drain_args args;
+    args.epoll_fd = epoll_create1( 0 );
+    args.running = 1;
+    args.bytes = 0;
+    pthread_t thread;
+    pthread_create( &thread, NULL, &drainer, &args );
+
+    client_info sender;
+    sender.id = 0;
+    sender.name = "bench_sender";
+
+    BroadcastRequest req;
+    req.set_message( string( 64, 'x' ) );
+
+    ServerMessage msg;
+    msg.set_option( BROADCASTS );
+    msg.mutable_broadcast()->set_message( req.message() );
+    msg.mutable_broadcast()->set_userid( sender.id );
+
+    request_arena arena;
+    vector<client_info> recipients;
+    vector<int> peers;
+    for( int target = 10; target <= max_recipients; target *= 10 ) {
+        for( int step = 0; step < 2; step++ ) {
+            int size = step == 0 ? target : target * 5;
+            if( size > max_recipients )
+                break;
+            add_recipients( server, args, recipients, peers, size );
+
+            int rounds = 200000 / size;
+            if( rounds < 10 )
+                rounds = 10;
+
+            /* Serialize for every recipient */
+            double start = now_sec();
+            for( int r = 0; r < rounds; r++ ) {
+                for( size_t i = 0; i < recipients.size(); i++ )
+                    server.send_response( recipients[ i ], msg );
+                flush_all( recipients );
+            }
+            double per_recipient = rounds / ( now_sec() - start );
+
+            /* Serialize once */
+            start = now_sec();
+            for( int r = 0; r < rounds; r++ ) {
+                server.broadcast_message( req, sender, &arena.arena );
+                arena.arena.Reset();
+                flush_all( recipients );
+            }
+            double serialize_once = rounds / ( now_sec() - start );
+
+            printf( "recipients=%d per_recipient_broadcasts_per_sec=%.0f serialize_once_broadcasts_per_sec=%.0f\n",
+                size, per_recipient, serialize_once );
+        }
+    }
+
+    /* Slow consumer: new server with small queues, then stop reading its first recipient */
+    for( size_t i = 0; i < peers.size(); i++ )
+        epoll_ctl( args.epoll_fd, EPOLL_CTL_DEL, peers[ i ], NULL );
+
+    Server slow_server( 0, log_file );
+    slow_server.set_outbound_limits( 64 * 1024, 1024, DROP_OLDEST_BROADCAST );
+    vector<client_info> slow_set;
+    vector<int> slow_peers;
+    int slow_size = max_recipients < 100 ? max_recipients : 100;
+    add_recipients( slow_server, args, slow_set, slow_peers, slow_size );
+
+    long bytes_before = args.bytes;
+    double healthy = timed_broadcasts( slow_server, slow_set, req, sender, 3 );
+    double healthy_bytes = ( args.bytes - bytes_before ) / 3.0;
+
+    epoll_ctl( args.epoll_fd, EPOLL_CTL_DEL, slow_peers[ 0 ], NULL );
+    bytes_before = args.bytes;
+    double stalled = timed_broadcasts( slow_server, slow_set, req, sender, 3 );
+    double stalled_bytes = ( args.bytes - bytes_before ) / 3.0;
+
+    send_queue *slow_q = slow_set[ 0 ].out.get();
+    printf( "slow_consumer recipients=%d all_reading_broadcasts_per_sec=%.0f one_stalled_broadcasts_per_sec=%.0f "
+        "delivered_bytes_per_sec_before=%.0f after=%.0f stalled_queue_bytes=%zu stalled_dropped=%lu\n",
+        slow_size, healthy, stalled, healthy_bytes, stalled_bytes, slow_q->bytes, slow_q->dropped );
+
+    args.running = 0;
+    pthread_join( thread, NULL );
+    log_close();
+    fclose( log_file );
+    return 0;
+}
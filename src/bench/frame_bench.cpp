@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <time.h>
+#include "Chat.h"
+
+/*
+* Frame codec benchmark: a writer thread sends framed ServerMessages over a loopback socket pair
+* while the main thread reassembles, parses and counts them. Reports messages/sec and reads per message.
+*
+* usage: ./bench_frame [messages per size]
+*/
+
+struct writer_args {
+    int fd;
+    int count;
+    size_t payload;
+};
+
+/*
+* Current monotonic time in seconds
+*/
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+* Serialize and send count broadcasts with a payload of the given size
+*/
+static void * writer( void * context ) {
+    writer_args *args = ( writer_args * )context;
+    ServerMessage msg;
+    msg.set_option( BROADCASTS );
+    msg.mutable_broadcast()->set_message( string( args->payload, 'x' ) );
+    msg.mutable_broadcast()->set_userid( 1 );
+    for( int i = 0; i < args->count; i++ ) {
+        string srl, frame;
+        msg.SerializeToString( &srl );
+        encode_frame( srl, &frame );
+        if( write_all( args->fd, frame.data(), frame.size() ) < 0 )
+            break;
+    }
+    shutdown( args->fd, SHUT_WR );
+    return NULL;
+}
+
+/*
+* Run one size, returns messages/sec
+*/
+static void run( size_t payload, int count ) {
+    int sv[2];
+    if( socketpair( AF_UNIX, SOCK_STREAM, 0, sv ) < 0 ) {
+        perror( "socketpair" );
+        return;
+    }
+
+    writer_args args;
+    args.fd = sv[0];
+    args.count = count;
+    args.payload = payload;
+
+    double start = now_sec();
+    pthread_t thread;
+    pthread_create( &thread, NULL, &writer, &args );
+
+    FrameBuffer in;
+    string frame;
+    ServerMessage msg;
+    long received = 0, reads = 0;
+    while( 1 ) {
+        int read_sz = in.read_from( sv[1] );
+        if( read_sz <= 0 )
+            break;
+        reads++;
+        while( in.next_frame( &frame ) > 0 ) {
+            if( msg.ParseFromString( frame ) && msg.broadcast().message().size() == payload )
+                received++;
+        }
+    }
+    double elapsed = now_sec() - start;
+    pthread_join( thread, NULL );
+    close( sv[0] );
+    close( sv[1] );
+
+    printf( "payload=%zu messages=%ld msgs_per_sec=%.0f MB_per_sec=%.1f reads_per_msg=%.3f\n",
+        payload, received, received / elapsed, received * payload / elapsed / 1e6, ( double )reads / received );
+}
+
+int main( int argc, char *argv[] ) {
+    int count = argc > 1 ? atoi( argv[1] ) : 200000;
+    run( 64, count );
+    run( 1024, count );
+    run( 65536, count / 20 );
+    return 0;
+}
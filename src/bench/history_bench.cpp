@@ -0,0 +1,223 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include "Chat.h"
+
+/*
+* History replay benchmark. A reader logs in to an in-process server, keeps its resume token and
+* sequence and disconnects, then a writer broadcasts N messages. The reader comes back with the
+* token and its last sequence and pages through what it missed until the server has no more.
+* Runs once with every message still in the memory ring and once with a small ring so most of
+* the catch up comes from the history files.
+*
+* usage: ./bench_history [messages] [first port] [epoll|threaded|workers|uring]
+*/
+
+#define SMALL_RING 16384
+
+struct session {
+    int fd;
+    FrameBuffer in;
+    string token;
+    unsigned long sequence;
+};
+
+/*
+* Send a serialized client message on fd
+* returns 0 on succes -1 on error
+*/
+static int send_msg( int fd, ClientMessage &msg ) {
+    string srl, frame;
+    msg.SerializeToString( &srl );
+    encode_frame( srl, &frame );
+    return write_all( fd, frame.data(), frame.size() );
+}
+
+/*
+* Read the next server message of s
+* returns 0 on succes -1 on error
+*/
+static int read_msg( session *s, ServerMessage *msg ) {
+    string res;
+    while( s->in.next_frame( &res ) == 0 ) {
+        if( s->in.read_from( s->fd ) <= 0 )
+            return -1;
+    }
+    return msg->ParseFromString( res ) ? 0 : -1;
+}
+
+/*
+* Connect from 127.3.0.idx and log in as name, resuming with token and after when token is not empty
+* returns 0 on succes -1 on error
+*/
+static int log_in( struct sockaddr_in *serv, int idx, const char *name, const string &token, unsigned long after, session *s ) {
+    s->fd = socket( AF_INET, SOCK_STREAM, 0 );
+    if( s->fd < 0 )
+        return -1;
+    struct sockaddr_in local;
+    memset( &local, 0, sizeof( local ) );
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl( ( 127 << 24 ) | ( 3 << 16 ) | idx );
+    if( bind( s->fd, (struct sockaddr *)&local, sizeof( local ) ) < 0 ||
+        connect( s->fd, (struct sockaddr *)serv, sizeof( *serv ) ) < 0 )
+        return -1;
+
+    ClientMessage sync;
+    sync.set_option( SYNCHRONIZED );
+    sync.mutable_synchronize()->set_username( name );
+    sync.mutable_synchronize()->set_batch( true );
+    if( !token.empty() ) {
+        sync.mutable_synchronize()->set_resumetoken( token );
+        sync.mutable_synchronize()->set_lastsequence( after );
+    }
+    ServerMessage res;
+    if( send_msg( s->fd, sync ) < 0 || read_msg( s, &res ) < 0 || res.option() != MYINFORESPONSE )
+        return -1;
+    s->token = res.myinforesponse().resumetoken();
+    s->sequence = res.myinforesponse().sequence();
+    if( !token.empty() )
+        return 0;
+
+    ClientMessage ack;
+    ack.set_option( ACKNOWLEDGE );
+    ack.mutable_acknowledge()->set_userid( res.myinforesponse().userid() );
+    return send_msg( s->fd, ack );
+}
+
+static void * run_server( void * context ) {
+    ( ( Server * )context )->start();
+    return NULL;
+}
+
+/*
+* Read the writer responses until the history response that follows its broadcasts
+*/
+static void * drain_writer( void * context ) {
+    session *s = ( session * )context;
+    ServerMessage msg;
+    while( read_msg( s, &msg ) == 0 && msg.option() != HISTORYRESPONSE );
+    return NULL;
+}
+
+/*
+* Current monotonic time in seconds
+*/
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main( int argc, char *argv[] ) {
+    int n_messages = argc > 1 ? atoi( argv[1] ) : 100000;
+    int port = argc > 2 ? atoi( argv[2] ) : 9600;
+    const char *mode_name = argc > 3 ? argv[3] : "epoll";
+    server_mode mode = EVENT_LOOP;
+    if( strcmp( mode_name, "threaded" ) == 0 ) {
+        mode = THREADED;
+    } else if( strcmp( mode_name, "workers" ) == 0 ) {
+        mode = WORKERS;
+    }
+    FILE *log_file = fopen( "/dev/null", "w" );
+    signal( SIGPIPE, SIG_IGN );
+
+    char dir[] = "/tmp/bench_historyXXXXXX";
+    if( mkdtemp( dir ) == NULL ) {
+        perror( "mkdtemp" );
+        return 1;
+    }
+
+    const char *names[] = { "ring", "disk" };
+    for( int k = 0; k < 2; k++ ) {
+        /* Servers are left running idle, every run gets its own port */
+        Server *server = new Server( port + k, log_file, mode );
+        server->set_workers( 2 );
+        server->set_backend( strcmp( mode_name, "uring" ) == 0 ? URING_BACKEND : EPOLL_BACKEND );
+        if( k == 0 ) {
+            server->set_history( max( HISTORY_SIZE, n_messages ), NULL );
+        } else {
+            server->set_history( SMALL_RING, dir );
+        }
+        if( server->initiate() < 0 ) {
+            printf( "Unable to start server on port %d\n", port + k );
+            return 1;
+        }
+        pthread_t thread;
+        pthread_create( &thread, NULL, &run_server, server );
+
+        struct sockaddr_in serv;
+        memset( &serv, 0, sizeof( serv ) );
+        serv.sin_family = AF_INET;
+        serv.sin_port = htons( port + k );
+        inet_pton( AF_INET, "127.0.0.1", &serv.sin_addr );
+
+        session reader, writer;
+        if( log_in( &serv, 1, "reader", "", 0, &reader ) < 0 || log_in( &serv, 2, "writer", "", 0, &writer ) < 0 ) {
+            printf( "Unable to log in\n" );
+            return 1;
+        }
+        close( reader.fd );
+        usleep( 100000 );
+
+        /* The history request after the broadcasts answers once they all have a sequence */
+        pthread_t drainer;
+        pthread_create( &drainer, NULL, &drain_writer, &writer );
+        string text( 64, 'x' );
+        ClientMessage br;
+        br.set_option( BROADCASTC );
+        br.mutable_broadcast()->set_message( text );
+        for( int i = 0; i < n_messages; i++ ) {
+            if( send_msg( writer.fd, br ) < 0 ) {
+                printf( "Unable to send broadcast %d\n", i );
+                return 1;
+            }
+        }
+        ClientMessage done;
+        done.set_option( HISTORYREQUEST );
+        done.mutable_history()->set_after( 0 );
+        done.mutable_history()->set_until( 0 );
+        send_msg( writer.fd, done );
+        pthread_join( drainer, NULL );
+
+        double start = now_sec();
+        session back;
+        if( log_in( &serv, 3, "reader", reader.token, reader.sequence, &back ) < 0 ) {
+            printf( "Unable to resume\n" );
+            return 1;
+        }
+        long messages = 0, pages = 0, truncated = 0;
+        unsigned long last = reader.sequence;
+        ServerMessage msg;
+        while( read_msg( &back, &msg ) == 0 ) {
+            if( msg.option() == BATCH ) {
+                messages += msg.batch().messages_size();
+            } else if( msg.option() == BROADCASTS ) {
+                messages++;
+            } else if( msg.option() == HISTORYRESPONSE ) {
+                pages++;
+                last = msg.history().last();
+                truncated += msg.history().truncated();
+                if( !msg.history().more() )
+                    break;
+                ClientMessage next;
+                next.set_option( HISTORYREQUEST );
+                next.mutable_history()->set_after( last );
+                next.mutable_history()->set_until( back.sequence );
+                send_msg( back.fd, next );
+            }
+        }
+        double elapsed = now_sec() - start;
+
+        printf( "mode=%s source=%s missed=%d replayed=%ld pages=%ld truncated=%ld catch_up_ms=%.1f messages_per_sec=%.0f\n",
+            mode_name, names[ k ], n_messages, messages, pages, truncated, elapsed * 1e3, messages / elapsed );
+        close( back.fd );
+        close( writer.fd );
+    }
+
+    char cmd[ 64 ];
+    snprintf( cmd, sizeof( cmd ), "rm -rf %s", dir );
+    if( system( cmd ) != 0 )
+        printf( "Unable to remove %s\n", dir );
+    log_close();
+    return 0;
+}
@@ -0,0 +1,559 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include "Chat.h"
+
+/*
+* Load generator for a server running on loopback. Logs in N sessions at a fixed rate, then runs a
+* weighted mix of broadcasts, direct messages, status changes and connected user requests from
+* random sessions at a fixed total rate. Broadcasts and direct messages carry their send time so
+* the receivers record the end to end latency, every request records the time to its response.
+* All sessions share one epoll loop with non blocking sockets, what a socket does not take waits
+* for it to be writable. A session with more than LOAD_MAX_BACKLOG bytes waiting skips its turn.
+* The summary has one key=value line per operation, latencies in microseconds.
+* Every session binds to its own 127.5.x.y address because the server rejects repeated ips.
+*
+* usage: ./bench <port> [--clients n] [--login-rate n/s] [--seconds s] [--rate ops/s]
+*                       [--mix broadcast,dm,status,users] [--payload min[-max]] [--no-batch]
+*/
+
+#define LOAD_MAX_BACKLOG ( 1024 * 1024 )
+#define LOAD_DRAIN_US 2000000
+
+/* Latency histogram, 32 buckets per power of two above 64 us, about 3% precision */
+#define HIST_SUB 32
+#define HIST_MAX_SHIFT 40
+#define HIST_BUCKETS ( HIST_SUB * ( HIST_MAX_SHIFT + 2 ) )
+
+struct histogram {
+    unsigned long counts[ HIST_BUCKETS ];
+    unsigned long total;
+    long max;
+};
+
+enum load_op {
+    OP_BROADCAST,
+    OP_DM,
+    OP_STATUS,
+    OP_USERS,
+    OP_COUNT
+};
+
+static const char *op_names[] = { "broadcast", "dm", "status", "users" };
+
+struct op_stats {
+    long sent;
+    long responses;
+    long errors;
+    histogram latency;
+};
+
+struct pending_request {
+    load_op op;
+    long sent_us;
+};
+
+enum session_state {
+    CONNECTING,
+    SYNC_SENT,
+    ACTIVE,
+    CLOSED
+};
+
+struct session {
+    int fd;
+    int idx;
+    session_state state;
+    long login_us;
+    FrameBuffer in;
+    string out;
+    size_t out_off;
+    int want_out;
+    deque<pending_request> pending;
+};
+
+struct load_stats {
+    op_stats ops[ OP_COUNT ];
+    histogram login;
+    histogram delivery[ 2 ];
+    long logged_in;
+    long login_errors;
+    long disconnects;
+    long backlogged;
+};
+
+/*
+* Bucket of v microseconds
+*/
+static int hist_index( long v ) {
+    if( v < 2 * HIST_SUB )
+        return v < 0 ? 0 : v;
+    if( v >= ( 1L << ( HIST_MAX_SHIFT + 5 ) ) )
+        v = ( 1L << ( HIST_MAX_SHIFT + 5 ) ) - 1;
+    int shift = 63 - __builtin_clzl( v ) - 5;
+    return HIST_SUB * ( shift + 1 ) + ( int )( ( v >> shift ) - HIST_SUB );
+}
+
+/*
+* Largest value that falls in bucket idx
+*/
+static long hist_value( int idx ) {
+    if( idx < 2 * HIST_SUB )
+        return idx;
+    int shift = idx / HIST_SUB - 1;
+    long mantissa = idx % HIST_SUB + HIST_SUB;
+    return ( ( mantissa + 1 ) << shift ) - 1;
+}
+
+static void hist_record( histogram *h, long v ) {
+    h->counts[ hist_index( v ) ]++;
+    h->total++;
+    if( v > h->max )
+        h->max = v;
+}
+
+/*
+* Value below which a fraction p of the recorded values are
+*/
+static long hist_percentile( const histogram *h, double p ) {
+    if( h->total == 0 )
+        return 0;
+    unsigned long rank = ( unsigned long )( p * h->total );
+    if( rank >= h->total )
+        rank = h->total - 1;
+    unsigned long seen = 0;
+    for( int i = 0; i < HIST_BUCKETS; i++ ) {
+        seen += h->counts[ i ];
+        if( seen > rank )
+            return min( hist_value( i ), h->max );
+    }
+    return h->max;
+}
+
+/*
+* Print p50, p99, p999 and max of h after prefix
+*/
+static void print_latency( const char *prefix, const histogram *h ) {
+    printf( "%s p50_us=%ld p99_us=%ld p999_us=%ld max_us=%ld\n", prefix,
+        hist_percentile( h, 0.5 ), hist_percentile( h, 0.99 ), hist_percentile( h, 0.999 ), h->max );
+}
+
+/*
+* Write what s has queued until the socket is full, waiting for EPOLLOUT if anything is left
+* returns 0 on succes -1 if the connection failed
+*/
+static int flush_session( int ep, session *s ) {
+    while( s->out_off < s->out.size() ) {
+        ssize_t n = send( s->fd, s->out.data() + s->out_off, s->out.size() - s->out_off, MSG_NOSIGNAL );
+        if( n < 0 && errno == EINTR )
+            continue;
+        if( n < 0 && errno == EAGAIN )
+            break;
+        if( n < 0 )
+            return -1;
+        s->out_off += n;
+    }
+    if( s->out_off == s->out.size() ) {
+        s->out.clear();
+        s->out_off = 0;
+    }
+
+    int want_out = !s->out.empty();
+    if( want_out != s->want_out ) {
+        struct epoll_event ev;
+        ev.events = EPOLLIN | ( want_out ? ( uint32_t )EPOLLOUT : ( uint32_t )0 );
+        ev.data.ptr = s;
+        epoll_ctl( ep, EPOLL_CTL_MOD, s->fd, &ev );
+        s->want_out = want_out;
+    }
+    return 0;
+}
+
+/*
+* Queue a client message on s and send what the socket takes
+* returns 0 on succes -1 if the connection failed
+*/
+static int send_msg( int ep, session *s, const ClientMessage &msg ) {
+    string srl, frame;
+    msg.SerializeToString( &srl );
+    encode_frame( srl, &frame );
+    s->out.append( frame );
+    return flush_session( ep, s );
+}
+
+/*
+* Start the non blocking connection of session idx
+* returns 0 on succes -1 on error
+*/
+static int open_session( int ep, struct sockaddr_in *serv, session *s ) {
+    s->fd = socket( AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0 );
+    if( s->fd < 0 )
+        return -1;
+
+    struct sockaddr_in local;
+    memset( &local, 0, sizeof( local ) );
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl( ( 127 << 24 ) | ( 5 << 16 ) | ( s->idx + 1 ) );
+    int one = 1;
+    setsockopt( s->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof( one ) );
+    if( bind( s->fd, (struct sockaddr *)&local, sizeof( local ) ) < 0 ||
+        ( connect( s->fd, (struct sockaddr *)serv, sizeof( *serv ) ) < 0 && errno != EINPROGRESS ) ) {
+        close( s->fd );
+        s->fd = -1;
+        return -1;
+    }
+
+    s->state = CONNECTING;
+    s->login_us = monotonic_us();
+    s->want_out = 1;
+    struct epoll_event ev;
+    ev.events = EPOLLIN | EPOLLOUT;
+    ev.data.ptr = s;
+    epoll_ctl( ep, EPOLL_CTL_ADD, s->fd, &ev );
+    return 0;
+}
+
+static void close_session( session *s ) {
+    if( s->state == CLOSED )
+        return;
+    close( s->fd );
+    s->state = CLOSED;
+    s->pending.clear();
+}
+
+/*
+* Send the log in request once the connection is up
+* returns 0 on succes -1 on error
+*/
+static int send_sync( int ep, session *s, int batch ) {
+    int err = 0;
+    socklen_t len = sizeof( err );
+    if( getsockopt( s->fd, SOL_SOCKET, SO_ERROR, &err, &len ) < 0 || err != 0 )
+        return -1;
+
+    char name[ 32 ];
+    snprintf( name, sizeof( name ), "load%d", s->idx );
+    ClientMessage sync;
+    sync.set_option( SYNCHRONIZED );
+    sync.mutable_synchronize()->set_username( name );
+    sync.mutable_synchronize()->set_batch( batch );
+    s->state = SYNC_SENT;
+    return send_msg( ep, s, sync );
+}
+
+/*
+* Record the latency of a delivered broadcast or direct message, its text starts with the send time
+*/
+static void record_delivery( const ServerMessage &msg, long now, load_stats *stats ) {
+    if( msg.option() == BROADCASTS ) {
+        hist_record( &stats->delivery[ 0 ], now - atol( msg.broadcast().message().c_str() ) );
+    } else if( msg.option() == MESSAGE ) {
+        hist_record( &stats->delivery[ 1 ], now - atol( msg.message().message().c_str() ) );
+    }
+}
+
+/*
+* Handle one server message of s
+* returns 0 on succes -1 if the session has to be closed
+*/
+static int handle_frame( int ep, session *s, const ServerMessage &msg, long now, vector<session *> *active, load_stats *stats ) {
+    if( s->state == SYNC_SENT ) {
+        if( msg.option() != MYINFORESPONSE )
+            return -1;
+        hist_record( &stats->login, now - s->login_us );
+        stats->logged_in++;
+        ClientMessage ack;
+        ack.set_option( ACKNOWLEDGE );
+        ack.mutable_acknowledge()->set_userid( msg.myinforesponse().userid() );
+        s->state = ACTIVE;
+        active->push_back( s );
+        return send_msg( ep, s, ack );
+    }
+
+    switch( msg.option() ) {
+        case BATCH:
+            for( int i = 0; i < msg.batch().messages_size(); i++ )
+                record_delivery( msg.batch().messages( i ), now, stats );
+            break;
+        case BROADCASTS:
+        case MESSAGE:
+            record_delivery( msg, now, stats );
+            break;
+        case BROADCASTRESPONSE:
+        case DIRECTMESSAGERESPONSE:
+        case CHANGESTATUSRESPONSE:
+        case CONNECTEDUSERRESPONSE:
+        case ERROR:
+            if( !s->pending.empty() ) {
+                op_stats *op = &stats->ops[ s->pending.front().op ];
+                op->responses++;
+                if( msg.option() == ERROR )
+                    op->errors++;
+                hist_record( &op->latency, now - s->pending.front().sent_us );
+                s->pending.pop_front();
+            }
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
+
+/*
+* Run operation op from s, peer is the recipient of a direct message
+* returns 0 on succes -1 if the connection failed
+*/
+static int run_op( int ep, session *s, load_op op, session *peer, size_t payload, load_stats *stats ) {
+    long now = monotonic_us();
+    char head[ 48 ];
+    snprintf( head, sizeof( head ), "%ld %d ", now, s->idx );
+    string text( head );
+    if( text.size() < payload )
+        text.append( payload - text.size(), 'x' );
+
+    ClientMessage req;
+    switch( op ) {
+        case OP_BROADCAST:
+            req.set_option( BROADCASTC );
+            req.mutable_broadcast()->set_message( text );
+            break;
+        case OP_DM: {
+            char name[ 32 ];
+            snprintf( name, sizeof( name ), "load%d", peer->idx );
+            req.set_option( DIRECTMESSAGE );
+            req.mutable_directmessage()->set_message( text );
+            req.mutable_directmessage()->set_username( name );
+            break;
+        }
+        case OP_STATUS:
+            req.set_option( CHANGESTATUS );
+            req.mutable_changestatus()->set_status( stats->ops[ OP_STATUS ].sent % 2 ? "ocupado" : "activo" );
+            break;
+        default:
+            req.set_option( CONNECTEDUSER );
+            req.mutable_connectedusers()->set_userid( 0 );
+            break;
+    }
+
+    pending_request p;
+    p.op = op;
+    p.sent_us = now;
+    s->pending.push_back( p );
+    stats->ops[ op ].sent++;
+    return send_msg( ep, s, req );
+}
+
+/*
+* Read everything s received and handle its frames
+* returns 0 on succes -1 if the session was closed
+*/
+static int read_session( int ep, session *s, vector<session *> *active, load_stats *stats ) {
+    int n;
+    while( ( n = s->in.read_from( s->fd ) ) > 0 );
+    if( n == 0 || ( n < 0 && errno != EAGAIN && errno != EINTR ) )
+        return -1;
+
+    long now = monotonic_us();
+    string frame;
+    ServerMessage msg;
+    int res;
+    while( ( res = s->in.next_frame( &frame ) ) > 0 ) {
+        if( !msg.ParseFromString( frame ) || handle_frame( ep, s, msg, now, active, stats ) < 0 )
+            return -1;
+    }
+    return res < 0 ? -1 : 0;
+}
+
+/*
+* Parse the weights of --mix, at least one must be positive
+* returns 0 on succes -1 on error
+*/
+static int parse_mix( const char *arg, int *weights ) {
+    if( sscanf( arg, "%d,%d,%d,%d", &weights[0], &weights[1], &weights[2], &weights[3] ) != OP_COUNT )
+        return -1;
+    int total = 0;
+    for( int i = 0; i < OP_COUNT; i++ ) {
+        if( weights[ i ] < 0 )
+            return -1;
+        total += weights[ i ];
+    }
+    return total > 0 ? 0 : -1;
+}
+
+int main( int argc, char *argv[] ) {
+    if( argc < 2 ) {
+        printf( "usage: %s <port> [--clients n] [--login-rate n/s] [--seconds s] [--rate ops/s] [--mix broadcast,dm,status,users] [--payload min[-max]] [--no-batch]\n", argv[0] );
+        return 1;
+    }
+    int port = atoi( argv[1] );
+    int n_clients = 1000;
+    double login_rate = 1000, seconds = 10, rate = 2000;
+    int weights[ OP_COUNT ] = { 70, 20, 5, 5 };
+    size_t payload_min = 64, payload_max = 64;
+    int batch = 1;
+    for( int opt = 2; opt < argc; opt++ ) {
+        if( strcmp( argv[opt], "--no-batch" ) == 0 ) {
+            batch = 0;
+            continue;
+        }
+        if( opt + 1 >= argc ) {
+            printf( "Missing value for %s\n", argv[opt] );
+            return 1;
+        }
+        if( strcmp( argv[opt], "--clients" ) == 0 ) {
+            n_clients = atoi( argv[opt + 1] );
+        } else if( strcmp( argv[opt], "--login-rate" ) == 0 ) {
+            login_rate = atof( argv[opt + 1] );
+        } else if( strcmp( argv[opt], "--seconds" ) == 0 ) {
+            seconds = atof( argv[opt + 1] );
+        } else if( strcmp( argv[opt], "--rate" ) == 0 ) {
+            rate = atof( argv[opt + 1] );
+        } else if( strcmp( argv[opt], "--mix" ) == 0 ) {
+            if( parse_mix( argv[opt + 1], weights ) < 0 ) {
+                printf( "Invalid mix %s\n", argv[opt + 1] );
+                return 1;
+            }
+        } else if( strcmp( argv[opt], "--payload" ) == 0 ) {
+            payload_min = payload_max = atol( argv[opt + 1] );
+            const char *dash = strchr( argv[opt + 1], '-' );
+            if( dash != NULL )
+                payload_max = atol( dash + 1 );
+        } else {
+            printf( "Unknown option %s\n", argv[opt] );
+            return 1;
+        }
+        opt++;
+    }
+    if( n_clients < 2 || n_clients > 65000 || login_rate <= 0 || rate <= 0 || payload_max < payload_min || payload_max > MESSAGE_SIZE / 2 ) {
+        printf( "Invalid arguments\n" );
+        return 1;
+    }
+    signal( SIGPIPE, SIG_IGN );
+
+    struct sockaddr_in serv;
+    memset( &serv, 0, sizeof( serv ) );
+    serv.sin_family = AF_INET;
+    serv.sin_port = htons( port );
+    inet_pton( AF_INET, "127.0.0.1", &serv.sin_addr );
+
+    load_stats *stats = new load_stats();
+    vector<session> sessions( n_clients );
+    for( int i = 0; i < n_clients; i++ )
+        sessions[ i ].state = CLOSED;
+    vector<session *> active;
+    int ep = epoll_create1( 0 );
+    int opened = 0, settled = 0, total_weight = 0;
+    for( int i = 0; i < OP_COUNT; i++ )
+        total_weight += weights[ i ];
+    unsigned int seed = 1;
+
+    /* Logins first, the operations run for seconds once every session is in or failed */
+    long start = monotonic_us(), next_login = start;
+    long ops_start = -1, ops_end = -1, next_op = -1;
+    struct epoll_event events[ MAX_EVENTS ];
+    while( 1 ) {
+        long now = monotonic_us();
+        while( opened < n_clients && now >= next_login ) {
+            session *s = &sessions[ opened ];
+            s->idx = opened++;
+            s->out_off = 0;
+            if( open_session( ep, &serv, s ) < 0 ) {
+                stats->login_errors++;
+                settled++;
+            }
+            next_login += ( long )( 1e6 / login_rate );
+        }
+
+        if( ops_start < 0 && settled == n_clients ) {
+            ops_start = next_op = now;
+            ops_end = now + ( long )( seconds * 1e6 );
+        }
+        if( ops_start >= 0 && now < ops_end && !active.empty() ) {
+            while( now >= next_op ) {
+                next_op += ( long )( 1e6 / rate );
+                session *s = active[ rand_r( &seed ) % active.size() ];
+                if( s->state != ACTIVE )
+                    continue;
+                if( s->out.size() > LOAD_MAX_BACKLOG ) {
+                    stats->backlogged++;
+                    continue;
+                }
+                int pick = rand_r( &seed ) % total_weight, op = 0;
+                while( pick >= weights[ op ] )
+                    pick -= weights[ op++ ];
+                size_t to = rand_r( &seed ) % active.size();
+                session *peer = active[ to ] != s ? active[ to ] : active[ ( to + 1 ) % active.size() ];
+                size_t payload = payload_min + ( payload_max > payload_min ? rand_r( &seed ) % ( payload_max - payload_min + 1 ) : 0 );
+                if( run_op( ep, s, ( load_op )op, peer, payload, stats ) < 0 ) {
+                    stats->disconnects++;
+                    close_session( s );
+                }
+            }
+        }
+
+        /* Past the end wait for the responses still on their way */
+        if( ops_start >= 0 && now >= ops_end ) {
+            size_t waiting = 0;
+            for( size_t i = 0; i < active.size(); i++ )
+                waiting += active[ i ]->pending.size();
+            if( waiting == 0 || now >= ops_end + LOAD_DRAIN_US )
+                break;
+        }
+
+        long wake = ops_start < 0 ? next_login : ( now < ops_end ? next_op : now + 1000 );
+        int timeout = wake > now ? ( int )( ( wake - now + 999 ) / 1000 ) : 0;
+        int n_ev = epoll_wait( ep, events, MAX_EVENTS, timeout );
+        for( int i = 0; i < n_ev; i++ ) {
+            session *s = ( session * )events[ i ].data.ptr;
+            if( s->state == CLOSED )
+                continue;
+            int was_login = s->state != ACTIVE;
+            int failed = 0;
+            if( s->state == CONNECTING && ( events[ i ].events & ( EPOLLOUT | EPOLLERR | EPOLLHUP ) ) ) {
+                failed = send_sync( ep, s, batch ) < 0;
+            } else if( events[ i ].events & EPOLLOUT ) {
+                failed = flush_session( ep, s ) < 0;
+            }
+            if( !failed && ( events[ i ].events & ( EPOLLIN | EPOLLERR | EPOLLHUP ) ) )
+                failed = read_session( ep, s, &active, stats ) < 0;
+
+            if( failed ) {
+                if( s->state == ACTIVE ) {
+                    stats->disconnects++;
+                } else {
+                    stats->login_errors++;
+                }
+                close_session( s );
+            }
+            if( was_login && ( failed || s->state == ACTIVE ) )
+                settled++;
+        }
+    }
+
+    double elapsed = ( min( monotonic_us(), ops_end ) - ops_start ) / 1e6;
+    long sent = 0, errors = stats->login_errors + stats->disconnects;
+    for( int i = 0; i < OP_COUNT; i++ ) {
+        sent += stats->ops[ i ].sent;
+        errors += stats->ops[ i ].errors + stats->ops[ i ].sent - stats->ops[ i ].responses;
+    }
+    printf( "summary clients=%d logged_in=%ld login_errors=%ld disconnects=%ld seconds=%.2f ops=%ld ops_per_sec=%.0f backlogged=%ld errors=%ld\n",
+        n_clients, stats->logged_in, stats->login_errors, stats->disconnects, elapsed, sent, sent / elapsed, stats->backlogged, errors );
+    char prefix[ 128 ];
+    snprintf( prefix, sizeof( prefix ), "login count=%lu rate=%.0f", stats->login.total, login_rate );
+    print_latency( prefix, &stats->login );
+    for( int i = 0; i < OP_COUNT; i++ ) {
+        op_stats *op = &stats->ops[ i ];
+        snprintf( prefix, sizeof( prefix ), "op=%s sent=%ld responses=%ld errors=%ld", op_names[ i ], op->sent, op->responses, op->errors );
+        print_latency( prefix, &op->latency );
+    }
+    for( int i = 0; i < 2; i++ ) {
+        snprintf( prefix, sizeof( prefix ), "delivery=%s received=%lu per_sec=%.0f", op_names[ i ], stats->delivery[ i ].total, stats->delivery[ i ].total / elapsed );
+        print_latency( prefix, &stats->delivery[ i ] );
+    }
+
+    for( size_t i = 0; i < sessions.size(); i++ )
+        close_session( &sessions[ i ] );
+    close( ep );
+    delete stats;
+    return errors > 0 ? 2 : 0;
+}
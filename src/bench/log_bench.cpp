@@ -0,0 +1,343 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "Chat.h"
+
+/*
+* Message log benchmark. Reports appends/sec of direct messages to offline users without
+* waiting for the disk, appends/sec of threads that each wait for their message to be durable
+* (and how many appends every group commit covered), and messages/sec delivered to users logging
+* in on an in-process Server. The log is created in dir, remove it between runs.
+*
+* The crash mode forks a writer that appends and reports what the flusher made durable, kills it
+* with SIGKILL in the middle of its appends and checks the log it left: every durable message is
+* recovered in order, a torn record is dropped and its space reused, and delivered messages are
+* not replayed.
+*
+* usage: ./bench_log [dir] [messages] [threads] [recipients]
+*        ./bench_log [dir] crash [seconds]
+*/
+
+/*
+* Current monotonic time in seconds
+*/
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+* Stored form of a direct message, what Server::direct_message appends
+*/
+static string stored_message( const char *text ) {
+    ServerMessage msg;
+    msg.set_option( MESSAGE );
+    msg.mutable_message()->set_userid( 1 );
+    msg.mutable_message()->set_username( "sender" );
+    msg.mutable_message()->set_message( text );
+    return msg.SerializeAsString();
+}
+
+static int count_segments( const string &dir ) {
+    DIR *d = opendir( dir.c_str() );
+    int count = 0;
+    struct dirent *entry;
+    while( d != NULL && ( entry = readdir( d ) ) != NULL ) {
+        if( strstr( entry->d_name, ".log" ) != NULL )
+            count++;
+    }
+    if( d != NULL )
+        closedir( d );
+    return count;
+}
+
+struct durable_args {
+    MessageLog *log;
+    int id;
+    int messages;
+};
+
+/*
+* Append and wait for every message to be on disk, like a sender that needs the guarantee
+*/
+static void * durable_writer( void * context ) {
+    durable_args *args = ( durable_args * )context;
+    char name[ 32 ];
+    snprintf( name, sizeof( name ), "user%d", args->id );
+    string msg = stored_message( "a durable direct message to an offline user, about the size of a chat line" );
+    for( int i = 0; i < args->messages; i++ )
+        args->log->wait_durable( args->log->append( name, msg ) );
+    return NULL;
+}
+
+static void bench_append( const string &dir, int messages, int recipients ) {
+    MessageLog log;
+    if( log.initiate( dir ) < 0 ) {
+        printf( "Unable to open message log in %s\n", dir.c_str() );
+        exit( 1 );
+    }
+    string msg = stored_message( "a direct message to an offline user, about the size of a line of chat text" );
+    char name[ 32 ];
+    double start = now_sec();
+    long last = 0;
+    for( int i = 0; i < messages; i++ ) {
+        snprintf( name, sizeof( name ), "user%d", i % recipients );
+        last = log.append( name, msg );
+    }
+    double appended = now_sec() - start;
+    log.wait_durable( last );
+    double durable = now_sec() - start;
+    printf( "append messages=%d bytes_per_message=%zu appends_per_sec=%.0f MB_per_sec=%.1f durable_after_secs=%.3f syncs=%ld segments=%d\n",
+        messages, msg.size(), messages / appended, messages * ( double )msg.size() / appended / 1e6, durable, log.syncs(), count_segments( dir ) );
+}
+
+static void bench_durable( const string &dir, int messages, int threads ) {
+    MessageLog log;
+    if( log.initiate( dir ) < 0 ) {
+        printf( "Unable to open message log in %s\n", dir.c_str() );
+        exit( 1 );
+    }
+    vector<pthread_t> ids( threads );
+    vector<durable_args> args( threads );
+    long syncs = log.syncs();
+    double start = now_sec();
+    for( int t = 0; t < threads; t++ ) {
+        args[ t ].log = &log;
+        args[ t ].id = t;
+        args[ t ].messages = messages / threads;
+        pthread_create( &ids[ t ], NULL, &durable_writer, &args[ t ] );
+    }
+    for( int t = 0; t < threads; t++ )
+        pthread_join( ids[ t ], NULL );
+    double elapsed = now_sec() - start;
+    long total = ( long )( messages / threads ) * threads;
+    syncs = log.syncs() - syncs;
+    printf( "durable_append threads=%d messages=%ld appends_per_sec=%.0f syncs=%ld appends_per_sync=%.1f\n",
+        threads, total, total / elapsed, syncs, syncs > 0 ? ( double )total / syncs : 0 );
+}
+
+/*
+* Log the recipients in one at a time on a socket pair and read until all their stored
+* messages arrived
+*/
+static void bench_delivery( const string &dir, int messages, int recipients ) {
+    FILE *log_file = fopen( "/dev/null", "w" );
+    Server server( 0, log_file, EVENT_LOOP );
+    server.set_outbound_limits( 64 * 1024 * 1024, 1 << 20, DROP_OLDEST_BROADCAST );
+    server.set_batching( 1, BATCH_MAX_BYTES );
+    if( server.set_message_log( dir.c_str() ) < 0 ) {
+        printf( "Unable to open message log in %s\n", dir.c_str() );
+        exit( 1 );
+    }
+
+    request_arena arena;
+    client_info sender = server.new_client( -1, sockaddr_in() );
+    sender.name = "sender";
+    int per_user = messages / recipients;
+    ClientMessage dm;
+    dm.set_option( DIRECTMESSAGE );
+    dm.mutable_directmessage()->set_message( "a direct message to an offline user, about the size of a line of chat text" );
+    char name[ 32 ];
+    double start = now_sec();
+    for( int i = 0; i < per_user * recipients; i++ ) {
+        snprintf( name, sizeof( name ), "user%d", i % recipients );
+        dm.mutable_directmessage()->set_username( name );
+        server.process_request( dm, sender, &arena.arena );
+        arena.arena.Reset();
+    }
+    double stored = now_sec() - start;
+
+    long delivered = 0, frames = 0;
+    FrameBuffer in;
+    string res;
+    ServerMessage msg;
+    start = now_sec();
+    for( int r = 0; r < recipients; r++ ) {
+        int sv[2];
+        socketpair( AF_UNIX, SOCK_STREAM, 0, sv );
+        fcntl( sv[0], F_SETFL, fcntl( sv[0], F_GETFL, 0 ) | O_NONBLOCK );
+        fcntl( sv[1], F_SETFL, fcntl( sv[1], F_GETFL, 0 ) | O_NONBLOCK );
+        struct sockaddr_in addr;
+        memset( &addr, 0, sizeof( addr ) );
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl( ( 10 << 24 ) + r + 1 );
+        client_info cl = server.new_client( sv[0], addr );
+        snprintf( name, sizeof( name ), "user%d", r );
+        MyInfoSynchronize sync;
+        sync.set_username( name );
+        sync.set_batch( true );
+        server.begin_registration( sync, cl, &arena.arena );
+        arena.arena.Reset();
+        cl.name = name;
+        server.deliver_offline( cl );
+
+        long got = 0;
+        while( got < per_user ) {
+            send_queue *q = cl.out.get();
+            pthread_mutex_lock( &q->mutex );
+            flush_send_queue( q );
+            pthread_mutex_unlock( &q->mutex );
+            in.read_from( sv[1] );
+            while( in.next_frame( &res ) > 0 ) {
+                frames++;
+                msg.ParseFromString( res );
+                if( msg.option() == BATCH ) {
+                    got += msg.batch().messages_size();
+                } else if( msg.option() == MESSAGE ) {
+                    got++;
+                }
+            }
+        }
+        delivered += got;
+        server.delete_user( name );
+        close( sv[0] );
+        close( sv[1] );
+    }
+    double elapsed = now_sec() - start;
+    printf( "delivery recipients=%d messages=%ld stored_per_sec=%.0f delivered_per_sec=%.0f frames=%ld\n",
+        recipients, delivered, per_user * recipients / stored, delivered / elapsed, frames );
+    log_close();
+    fclose( log_file );
+}
+
+/*
+* Writer killed by the crash test: appends to 16 recipients in bursts of 64 and writes how many
+* messages are durable to fd after every burst. Message i goes to recipient i % 16 and says i.
+*/
+static void crash_writer( const string &dir, int fd ) {
+    MessageLog log;
+    if( log.initiate( dir, 1024 * 1024 ) < 0 )
+        exit( 1 );
+    char name[ 32 ], text[ 32 ];
+    for( long i = 0; ; i++ ) {
+        snprintf( name, sizeof( name ), "crash%ld", i % 16 );
+        snprintf( text, sizeof( text ), "%ld", i );
+        long offset = log.append( name, stored_message( text ) );
+        if( i % 64 == 63 ) {
+            log.wait_durable( offset );
+            long durable = i + 1;
+            write_all( fd, ( const char * )&durable, sizeof( durable ) );
+        }
+    }
+}
+
+static int check( int ok, const char *what ) {
+    printf( "%s %s\n", ok ? "ok" : "FAILED", what );
+    return ok ? 0 : 1;
+}
+
+static int crash_test( const string &dir, double seconds ) {
+    int pipe_fds[2];
+    if( socketpair( AF_UNIX, SOCK_STREAM, 0, pipe_fds ) < 0 )
+        return 1;
+    pid_t pid = fork();
+    if( pid == 0 ) {
+        close( pipe_fds[0] );
+        crash_writer( dir, pipe_fds[1] );
+    }
+    close( pipe_fds[1] );
+
+    /* Kill the writer at a random point of its appends */
+    long durable = 0, value;
+    double end = now_sec() + seconds;
+    struct pollfd pfd;
+    pfd.fd = pipe_fds[0];
+    pfd.events = POLLIN;
+    while( now_sec() < end ) {
+        if( poll( &pfd, 1, 100 ) > 0 && read( pipe_fds[0], &value, sizeof( value ) ) == sizeof( value ) )
+            durable = value;
+    }
+    /* The writer may only run while this waits, on few cores it would always die after a report */
+    srand( getpid() );
+    usleep( rand() % 500 );
+    kill( pid, SIGKILL );
+    waitpid( pid, NULL, 0 );
+    while( read( pipe_fds[0], &value, sizeof( value ) ) == sizeof( value ) )
+        durable = value;
+    close( pipe_fds[0] );
+
+    int failed = 0;
+    size_t recovered;
+    {
+        MessageLog log;
+        failed |= check( log.initiate( dir, 1024 * 1024 ) == 0, "log reopened after SIGKILL" );
+        recovered = log.pending_total();
+    }
+    printf( "durable_before_kill=%ld recovered=%zu segments=%d\n", durable, recovered, count_segments( dir ) );
+    failed |= check( recovered >= ( size_t )durable, "every durable message recovered" );
+
+    /* Tear the last record like a power loss in the middle of its write would */
+    long offset;
+    string torn = "torn";
+    {
+        MessageLog log;
+        log.initiate( dir, 1024 * 1024 );
+        offset = log.append( torn, stored_message( "half written" ) );
+        log.wait_durable( offset );
+    }
+    char path[ 256 ];
+    long base = offset - offset % ( 1024 * 1024 );
+    snprintf( path, sizeof( path ), "%s/%016lx.log", dir.c_str(), base );
+    int fd = open( path, O_RDWR );
+    char byte = 'X';
+    pwrite( fd, &byte, 1, offset - base + 16 + torn.size() + 4 );
+    close( fd );
+    {
+        MessageLog log;
+        log.initiate( dir, 1024 * 1024 );
+        failed |= check( log.pending_total() == recovered && log.pending( torn ) == 0, "torn record dropped" );
+        log.wait_durable( log.append( "after", stored_message( "after the tear" ) ) );
+    }
+    {
+        MessageLog log;
+        log.initiate( dir, 1024 * 1024 );
+        failed |= check( log.pending_total() == recovered + 1 && log.pending( "after" ) == 1, "record written over the torn one recovered" );
+
+        /* Every recipient gets its messages in order and without gaps */
+        int in_order = 1;
+        size_t total = 0;
+        char name[ 32 ];
+        for( int r = 0; r < 16; r++ ) {
+            snprintf( name, sizeof( name ), "crash%d", r );
+            vector<string> msgs;
+            log.take( name, ( size_t )-1, ( size_t )-1, &msgs );
+            ServerMessage msg;
+            for( size_t i = 0; i < msgs.size(); i++ ) {
+                in_order &= msg.ParseFromString( msgs[ i ] ) && atol( msg.message().message().c_str() ) == ( long )( r + 16 * i );
+            }
+            total += msgs.size();
+        }
+        vector<string> msgs;
+        log.take( "after", 1, 1, &msgs );
+        failed |= check( in_order && total == recovered, "recovered messages in order without gaps" );
+        failed |= check( log.pending_bytes() == 0, "pending bytes back to zero" );
+    }
+    {
+        MessageLog log;
+        log.initiate( dir, 1024 * 1024 );
+        failed |= check( log.pending_total() == 0 && log.pending_bytes() == 0, "delivered messages not replayed" );
+    }
+    failed |= check( count_segments( dir ) == 1, "delivered segments deleted" );
+    return failed;
+}
+
+int main( int argc, char *argv[] ) {
+    string dir = argc > 1 ? argv[1] : "bench_log.d";
+    signal( SIGPIPE, SIG_IGN );
+    mkdir( dir.c_str(), 0755 );
+    if( argc > 2 && strcmp( argv[2], "crash" ) == 0 )
+        return crash_test( dir + "/crash", argc > 3 ? atof( argv[3] ) : 1 );
+
+    int messages = argc > 2 ? atoi( argv[2] ) : 1000000;
+    int threads = argc > 3 ? atoi( argv[3] ) : 16;
+    int recipients = argc > 4 ? atoi( argv[4] ) : 1000;
+    bench_append( dir + "/append", messages, recipients );
+    bench_durable( dir + "/durable_1", messages / 100, 1 );
+    bench_durable( dir + "/durable_n", messages / 100, threads );
+    bench_delivery( dir + "/delivery", messages / 10, recipients );
+    return 0;
+}
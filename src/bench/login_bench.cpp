@@ -0,0 +1,244 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include "Chat.h"
+
+/*
+* Login benchmark against an in-process server. First N clients log in with at most
+* LOGIN_WINDOW handshakes in flight, the sustained rate a server keeps up while its user table
+* grows. Then a second server gets a reconnect storm: N clients connect at the same time, like
+* after a deploy, and the time until the last one is logged in is measured. A login is connect,
+* sync, id response and ACK, its latency runs from the connect to the id response. Clients that
+* are refused or disconnected during the handshake count as failed.
+* Every client binds to its own 127.6.x.y address because the server rejects repeated ips, the
+* open file limit must fit N clients and their server side sockets.
+*
+* usage: ./bench_logins [clients] [first port] [epoll|threaded|workers|uring] [backlog]
+*/
+
+#define LOGIN_WINDOW 64
+#define LOGIN_DEADLINE_US 120000000L
+
+enum login_state {
+    CONNECTING,
+    SYNC_SENT,
+    LOGGED_IN,
+    FAILED
+};
+
+struct login {
+    int fd;
+    int idx;
+    login_state state;
+    long start_us;
+    FrameBuffer in;
+};
+
+struct login_stats {
+    long ok;
+    long failed;
+    vector<long> latency;
+};
+
+static void * run_server( void * context ) {
+    ( ( Server * )context )->start();
+    return NULL;
+}
+
+/*
+* Connect l from 127.6.x.y without waiting, the connection completes on the epoll loop
+* returns 0 on succes -1 on error
+*/
+static int start_login( int ep, struct sockaddr_in *serv, login *l ) {
+    l->fd = socket( AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0 );
+    if( l->fd < 0 )
+        return -1;
+    struct sockaddr_in local;
+    memset( &local, 0, sizeof( local ) );
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl( ( 127 << 24 ) | ( 6 << 16 ) | ( l->idx + 1 ) );
+    l->start_us = monotonic_us();
+    l->state = CONNECTING;
+    if( bind( l->fd, (struct sockaddr *)&local, sizeof( local ) ) < 0 ||
+        ( connect( l->fd, (struct sockaddr *)serv, sizeof( *serv ) ) < 0 && errno != EINPROGRESS ) )
+        return -1;
+    struct epoll_event ev;
+    ev.events = EPOLLOUT;
+    ev.data.ptr = l;
+    return epoll_ctl( ep, EPOLL_CTL_ADD, l->fd, &ev );
+}
+
+/*
+* Send msg on the fd of a login
+* returns 0 on succes -1 on error
+*/
+static int send_msg( login *l, ClientMessage &msg ) {
+    string srl, frame;
+    msg.SerializeToString( &srl );
+    encode_frame( srl, &frame );
+    return write_all( l->fd, frame.data(), frame.size() );
+}
+
+/*
+* Move a login one step on an event of its socket
+*/
+static void step( int ep, login *l, login_stats *stats ) {
+    if( l->state == CONNECTING ) {
+        int err = 0;
+        socklen_t len = sizeof( err );
+        getsockopt( l->fd, SOL_SOCKET, SO_ERROR, &err, &len );
+        char name[ 32 ];
+        snprintf( name, sizeof( name ), "user%d", l->idx );
+        ClientMessage sync;
+        sync.set_option( SYNCHRONIZED );
+        sync.mutable_synchronize()->set_username( name );
+        if( err != 0 || send_msg( l, sync ) < 0 ) {
+            l->state = FAILED;
+            return;
+        }
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = l;
+        epoll_ctl( ep, EPOLL_CTL_MOD, l->fd, &ev );
+        l->state = SYNC_SENT;
+        return;
+    }
+
+    int read_sz = l->in.read_from( l->fd );
+    if( read_sz < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) )
+        return;
+    string res;
+    if( read_sz <= 0 || l->in.next_frame( &res ) < 0 ) {
+        l->state = FAILED;
+        return;
+    }
+    if( res.empty() )
+        return;
+    ServerMessage msg;
+    if( !msg.ParseFromString( res ) || msg.option() != MYINFORESPONSE ) {
+        l->state = FAILED;
+        return;
+    }
+    stats->latency.push_back( monotonic_us() - l->start_us );
+    ClientMessage ack;
+    ack.set_option( ACKNOWLEDGE );
+    ack.mutable_acknowledge()->set_userid( msg.myinforesponse().userid() );
+    send_msg( l, ack );
+    epoll_ctl( ep, EPOLL_CTL_DEL, l->fd, NULL );
+    l->state = LOGGED_IN;
+}
+
+/*
+* Log in logins with at most window handshakes in flight
+* returns the seconds until the last one finished
+*/
+static double run_logins( struct sockaddr_in *serv, vector<login> &logins, size_t window, login_stats *stats ) {
+    int ep = epoll_create1( 0 );
+    struct epoll_event events[ 256 ];
+    size_t started = 0, done = 0;
+    long start = monotonic_us();
+    while( done < logins.size() && monotonic_us() - start < LOGIN_DEADLINE_US ) {
+        while( started < logins.size() && started - done < window ) {
+            login *l = &logins[ started++ ];
+            if( start_login( ep, serv, l ) < 0 ) {
+                l->state = FAILED;
+                stats->failed++;
+                done++;
+            }
+        }
+        int n_ev = epoll_wait( ep, events, 256, 100 );
+        for( int i = 0; i < n_ev; i++ ) {
+            login *l = ( login * )events[ i ].data.ptr;
+            step( ep, l, stats );
+            if( l->state == LOGGED_IN ) {
+                stats->ok++;
+                done++;
+            } else if( l->state == FAILED ) {
+                epoll_ctl( ep, EPOLL_CTL_DEL, l->fd, NULL );
+                stats->failed++;
+                done++;
+            }
+        }
+    }
+    double elapsed = ( monotonic_us() - start ) / 1e6;
+    stats->failed += logins.size() - done;
+    close( ep );
+    return elapsed;
+}
+
+static long percentile( vector<long> &v, double p ) {
+    if( v.empty() )
+        return 0;
+    sort( v.begin(), v.end() );
+    return v[ min( v.size() - 1, ( size_t )( p * v.size() ) ) ];
+}
+
+int main( int argc, char *argv[] ) {
+    int n_clients = argc > 1 ? atoi( argv[1] ) : 20000;
+    int port = argc > 2 ? atoi( argv[2] ) : 9700;
+    const char *mode_name = argc > 3 ? argv[3] : "epoll";
+    int backlog = argc > 4 ? atoi( argv[4] ) : MAX_QUEUE;
+    server_mode mode = EVENT_LOOP;
+    if( strcmp( mode_name, "threaded" ) == 0 ) {
+        mode = THREADED;
+    } else if( strcmp( mode_name, "workers" ) == 0 ) {
+        mode = WORKERS;
+    }
+    FILE *log_file = fopen( "/dev/null", "w" );
+    signal( SIGPIPE, SIG_IGN );
+
+    /* Clients and server sockets of one run share the process */
+    struct rlimit lim;
+    getrlimit( RLIMIT_NOFILE, &lim );
+    lim.rlim_cur = lim.rlim_max;
+    setrlimit( RLIMIT_NOFILE, &lim );
+    if( ( rlim_t )n_clients * 2 + 64 > lim.rlim_cur ) {
+        n_clients = ( lim.rlim_cur - 64 ) / 2;
+        printf( "Open file limit %lu, running %d clients\n", ( unsigned long )lim.rlim_cur, n_clients );
+    }
+
+    const char *names[] = { "sustained", "storm" };
+    for( int k = 0; k < 2; k++ ) {
+        /* Servers are left running idle, every run gets its own port */
+        Server *server = new Server( port + k, log_file, mode );
+        server->set_workers( 2 );
+        server->set_backlog( backlog );
+        server->set_backend( strcmp( mode_name, "uring" ) == 0 ? URING_BACKEND : EPOLL_BACKEND );
+        if( server->initiate() < 0 ) {
+            printf( "Unable to start server on port %d\n", port + k );
+            return 1;
+        }
+        pthread_t thread;
+        pthread_create( &thread, NULL, &run_server, server );
+
+        struct sockaddr_in serv;
+        memset( &serv, 0, sizeof( serv ) );
+        serv.sin_family = AF_INET;
+        serv.sin_port = htons( port + k );
+        inet_pton( AF_INET, "127.0.0.1", &serv.sin_addr );
+
+        vector<login> logins( n_clients );
+        for( int i = 0; i < n_clients; i++ ) {
+            logins[ i ].fd = -1;
+            logins[ i ].idx = i;
+        }
+        login_stats stats;
+        stats.ok = 0;
+        stats.failed = 0;
+        double elapsed = run_logins( &serv, logins, k == 0 ? LOGIN_WINDOW : n_clients, &stats );
+
+        printf( "mode=%s run=%s clients=%d backlog=%d logged_in=%ld failed=%ld seconds=%.2f logins_per_sec=%.0f p50_us=%ld p99_us=%ld max_us=%ld\n",
+            mode_name, names[ k ], n_clients, backlog, stats.ok, stats.failed, elapsed, stats.ok / elapsed,
+            percentile( stats.latency, 0.5 ), percentile( stats.latency, 0.99 ), percentile( stats.latency, 1.0 ) );
+
+        for( int i = 0; i < n_clients; i++ ) {
+            if( logins[ i ].fd >= 0 )
+                close( logins[ i ].fd );
+        }
+        /* Let the first server see its clients leave before the storm */
+        sleep( 1 );
+    }
+    log_close();
+    return 0;
+}
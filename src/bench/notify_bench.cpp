@@ -0,0 +1,225 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include "Chat.h"
+
+/*
+* Client notification benchmark. A reader Client and a writer Client log in to an in-process
+* server, the writer broadcasts messages carrying their send time and a consumer thread of the
+* reader displays them (formats them to /dev/null). Runs with the consumer waiting on the
+* notify fd and with it polling the rings every interval like the old menu loop did after each
+* command (sleep(2)). Each run has three phases:
+*   paced: rate messages/sec for the given seconds, receive to display latency
+*   idle:  nothing sent for the given seconds, CPU time and wakeups of the consumer
+*   flood: the writer sends as fast as it can, displayed messages/sec and dropped messages
+*
+* usage: ./bench_notify [rate] [seconds] [first port] [poll interval ms]
+*/
+
+#define FLOOD_MESSAGES 200000
+
+struct consumer {
+    Client *client;
+    long poll_ms;
+    atomic<int> stop;
+    atomic<long> shown;
+    atomic<long> wakeups;
+    vector<long> latency;
+    atomic<int> record;
+    FILE *out;
+};
+
+static void * run_server( void * context ) {
+    ( ( Server * )context )->start();
+    return NULL;
+}
+
+/*
+* Display every message waiting in the rings of c
+*/
+static void display( consumer *c ) {
+    vector<message_received> batch;
+    message_type types[] = { BROADCAST, DIRECT, CHANNEL };
+    for( int t = 0; t < 3; t++ ) {
+        batch.clear();
+        while( c->client->pop_batch( types[ t ], &batch, 256 ) > 0 ) {
+            long now = monotonic_us();
+            for( size_t i = 0; i < batch.size(); i++ ) {
+                fprintf( c->out, "ID from: %d\nMessage: %s\n", batch[ i ].from_id, batch[ i ].message.c_str() );
+                if( c->record.load() )
+                    c->latency.push_back( now - atol( batch[ i ].message.c_str() ) );
+            }
+            c->shown.fetch_add( batch.size() );
+            batch.clear();
+        }
+    }
+}
+
+/*
+* Consumer thread: wait on the notify fd, or sleep poll_ms between passes over the rings
+*/
+static void * run_consumer( void * context ) {
+    consumer *c = ( consumer * )context;
+    struct pollfd pfd;
+    pfd.fd = c->client->notify_fd();
+    pfd.events = POLLIN;
+    while( !c->stop.load() ) {
+        if( c->poll_ms > 0 ) {
+            usleep( c->poll_ms * 1000 );
+        } else {
+            if( poll( &pfd, 1, -1 ) <= 0 )
+                continue;
+            uint64_t count;
+            if( read( pfd.fd, &count, sizeof( count ) ) < 0 )
+                continue;
+        }
+        c->wakeups.fetch_add( 1 );
+        display( c );
+    }
+    return NULL;
+}
+
+/*
+* Connect client from 127.8.0.idx and log in
+* returns 0 on succes -1 on error
+*/
+static int log_in( Client *client, struct sockaddr_in *serv, int idx ) {
+    client->_sock = socket( AF_INET, SOCK_STREAM, 0 );
+    struct sockaddr_in local;
+    memset( &local, 0, sizeof( local ) );
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl( ( 127 << 24 ) | ( 8 << 16 ) | idx );
+    if( client->_sock < 0 || bind( client->_sock, (struct sockaddr *)&local, sizeof( local ) ) < 0 ||
+        connect( client->_sock, (struct sockaddr *)serv, sizeof( *serv ) ) < 0 )
+        return -1;
+    if( client->log_in() < 0 || client->start_listener() < 0 )
+        return -1;
+    return 0;
+}
+
+static long percentile( vector<long> &v, double p ) {
+    if( v.empty() )
+        return 0;
+    sort( v.begin(), v.end() );
+    return v[ min( v.size() - 1, ( size_t )( p * v.size() ) ) ];
+}
+
+/*
+* Broadcast a message stamped with the send time
+*/
+static void send_stamped( Client *writer, const string &payload ) {
+    char stamp[ 32 ];
+    snprintf( stamp, sizeof( stamp ), "%ld ", monotonic_us() );
+    writer->broadcast_message( string( stamp ) + payload );
+}
+
+/*
+* Run the three phases with one consumer, a poll_ms of 0 waits on the notify fd
+*/
+static int run( int port, long poll_ms, int rate, int seconds, FILE *log_file ) {
+    Server *server = new Server( port, log_file, EVENT_LOOP );
+    if( server->initiate() < 0 ) {
+        printf( "Unable to start server on port %d\n", port );
+        return -1;
+    }
+    pthread_t server_thread;
+    pthread_create( &server_thread, NULL, &run_server, server );
+
+    struct sockaddr_in serv;
+    memset( &serv, 0, sizeof( serv ) );
+    serv.sin_family = AF_INET;
+    serv.sin_port = htons( port );
+    inet_pton( AF_INET, "127.0.0.1", &serv.sin_addr );
+
+    Client *reader = new Client( ( char * )"reader", log_file );
+    Client *writer = new Client( ( char * )"writer", log_file );
+    if( log_in( reader, &serv, 1 ) < 0 || log_in( writer, &serv, 2 ) < 0 ) {
+        printf( "Unable to log in on port %d\n", port );
+        return -1;
+    }
+
+    consumer c;
+    c.client = reader;
+    c.poll_ms = poll_ms;
+    c.stop.store( 0 );
+    c.shown.store( 0 );
+    c.wakeups.store( 0 );
+    c.record.store( 1 );
+    c.out = fopen( "/dev/null", "w" );
+    pthread_t consumer_thread;
+    pthread_create( &consumer_thread, NULL, &run_consumer, &c );
+
+    const char *mode = poll_ms > 0 ? "poll" : "eventfd";
+    string payload( 64, 'x' );
+
+    /* Paced */
+    long total = ( long )rate * seconds;
+    long start = monotonic_us();
+    for( long i = 0; i < total; i++ ) {
+        long due = start + i * 1000000L / rate;
+        long now = monotonic_us();
+        if( due > now )
+            usleep( due - now );
+        send_stamped( writer, payload );
+    }
+    long deadline = monotonic_us() + 5000000L + poll_ms * 1000;
+    while( c.shown.load() < total && monotonic_us() < deadline )
+        usleep( 1000 );
+    c.record.store( 0 );
+    printf( "mode=%s poll_ms=%ld phase=paced rate=%d sent=%ld shown=%ld p50_us=%ld p99_us=%ld max_us=%ld\n",
+        mode, poll_ms, rate, total, c.shown.load(), percentile( c.latency, 0.5 ),
+        percentile( c.latency, 0.99 ), percentile( c.latency, 1.0 ) );
+
+    /* Idle, the CPU of the whole process covers the listener, server and consumer threads */
+    struct rusage before, after;
+    getrusage( RUSAGE_SELF, &before );
+    long wakeups = c.wakeups.load();
+    sleep( seconds );
+    getrusage( RUSAGE_SELF, &after );
+    long cpu_us = ( after.ru_utime.tv_sec - before.ru_utime.tv_sec ) * 1000000L + ( after.ru_utime.tv_usec - before.ru_utime.tv_usec ) +
+        ( after.ru_stime.tv_sec - before.ru_stime.tv_sec ) * 1000000L + ( after.ru_stime.tv_usec - before.ru_stime.tv_usec );
+    printf( "mode=%s poll_ms=%ld phase=idle seconds=%d process_cpu_ms_per_sec=%.3f consumer_wakeups_per_sec=%.1f\n",
+        mode, poll_ms, seconds, cpu_us / 1000.0 / seconds, ( c.wakeups.load() - wakeups ) / ( double )seconds );
+
+    /* Flood */
+    long shown = c.shown.load();
+    unsigned long dropped = reader->dropped_messages();
+    start = monotonic_us();
+    for( long i = 0; i < FLOOD_MESSAGES; i++ )
+        send_stamped( writer, payload );
+    long last = -1, end = start;
+    while( c.shown.load() != last ) {
+        last = c.shown.load();
+        end = monotonic_us();
+        usleep( 200000 + poll_ms * 1000 );
+    }
+    double elapsed = ( end - start ) / 1e6;
+    printf( "mode=%s poll_ms=%ld phase=flood sent=%d shown=%ld dropped=%lu seconds=%.2f shown_per_sec=%.0f\n",
+        mode, poll_ms, FLOOD_MESSAGES, c.shown.load() - shown, reader->dropped_messages() - dropped,
+        elapsed, ( c.shown.load() - shown ) / elapsed );
+
+    /* Wake the consumer so it sees the stop */
+    c.stop.store( 1 );
+    uint64_t one = 1;
+    if( write( reader->notify_fd(), &one, sizeof( one ) ) < 0 )
+        return -1;
+    pthread_join( consumer_thread, NULL );
+    fclose( c.out );
+    /* Server and clients are left running idle, every run gets its own port */
+    return 0;
+}
+
+int main( int argc, char *argv[] ) {
+    int rate = argc > 1 ? atoi( argv[1] ) : 200;
+    int seconds = argc > 2 ? atoi( argv[2] ) : 5;
+    int port = argc > 3 ? atoi( argv[3] ) : 9750;
+    long poll_ms = argc > 4 ? atol( argv[4] ) : 2000;
+    FILE *log_file = fopen( "/dev/null", "w" );
+    signal( SIGPIPE, SIG_IGN );
+
+    if( run( port, 0, rate, seconds, log_file ) < 0 || run( port + 1, poll_ms, rate, seconds, log_file ) < 0 )
+        return 1;
+    log_close();
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include "Chat.h"
+
+/*
+* Request pipelining benchmark. One Client logs in to an in-process server and sends broadcasts
+* with a completion callback, keeping at most depth of them without a response. Runs at depths
+* 1, 16 and 256 and reports completed requests/sec and the p50/p99 time from send to completion.
+* The client is the only user, so the server does no fan-out and the numbers are the request
+* round trip of one connection.
+*
+* usage: ./bench_pipeline [requests] [port] [epoll|threaded|workers|uring] [payload bytes]
+*/
+
+#define PIPELINE_SLOTS 512
+
+struct pipeline;
+
+struct inflight {
+    pipeline *p;
+    long start_us;
+};
+
+struct pipeline {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    long in_flight;
+    long errors;
+    vector<long> latency;
+    inflight slots[ PIPELINE_SLOTS ];
+};
+
+static void * run_server( void * context ) {
+    ( ( Server * )context )->start();
+    return NULL;
+}
+
+/*
+* Completion of one broadcast, on the listener thread
+*/
+static void on_response( void *context, const ServerMessage &res ) {
+    inflight *slot = ( inflight * )context;
+    pipeline *p = slot->p;
+    long now = monotonic_us();
+    pthread_mutex_lock( &p->mutex );
+    if( res.option() != BROADCASTRESPONSE )
+        p->errors++;
+    p->latency.push_back( now - slot->start_us );
+    p->in_flight--;
+    pthread_cond_signal( &p->cond );
+    pthread_mutex_unlock( &p->mutex );
+}
+
+static long percentile( vector<long> &v, double p ) {
+    if( v.empty() )
+        return 0;
+    sort( v.begin(), v.end() );
+    return v[ min( v.size() - 1, ( size_t )( p * v.size() ) ) ];
+}
+
+/*
+* Send requests broadcasts with at most depth in flight and print the results
+*/
+static void run_depth( Client *client, const char *mode, long requests, long depth, const string &payload ) {
+    pipeline p;
+    pthread_mutex_init( &p.mutex, NULL );
+    pthread_cond_init( &p.cond, NULL );
+    p.in_flight = 0;
+    p.errors = 0;
+    p.latency.reserve( requests );
+
+    long send_errors = 0;
+    long start = monotonic_us();
+    for( long i = 0; i < requests; i++ ) {
+        pthread_mutex_lock( &p.mutex );
+        while( p.in_flight >= depth )
+            pthread_cond_wait( &p.cond, &p.mutex );
+        p.in_flight++;
+        pthread_mutex_unlock( &p.mutex );
+
+        /* Responses come in order, a slot is free again long before it comes around */
+        inflight *slot = &p.slots[ i % PIPELINE_SLOTS ];
+        slot->p = &p;
+        slot->start_us = monotonic_us();
+        if( client->broadcast_message( payload, &on_response, slot ) < 0 ) {
+            send_errors++;
+            pthread_mutex_lock( &p.mutex );
+            p.in_flight--;
+            pthread_mutex_unlock( &p.mutex );
+        }
+    }
+    pthread_mutex_lock( &p.mutex );
+    while( p.in_flight > 0 )
+        pthread_cond_wait( &p.cond, &p.mutex );
+    pthread_mutex_unlock( &p.mutex );
+    double elapsed = ( monotonic_us() - start ) / 1e6;
+
+    printf( "mode=%s depth=%ld requests=%ld errors=%ld seconds=%.2f requests_per_sec=%.0f p50_us=%ld p99_us=%ld\n",
+        mode, depth, requests, p.errors + send_errors, elapsed, requests / elapsed,
+        percentile( p.latency, 0.5 ), percentile( p.latency, 0.99 ) );
+}
+
+int main( int argc, char *argv[] ) {
+    long requests = argc > 1 ? atol( argv[1] ) : 100000;
+    int port = argc > 2 ? atoi( argv[2] ) : 9770;
+    const char *mode_name = argc > 3 ? argv[3] : "epoll";
+    int payload_size = argc > 4 ? atoi( argv[4] ) : 64;
+    server_mode mode = EVENT_LOOP;
+    if( strcmp( mode_name, "threaded" ) == 0 ) {
+        mode = THREADED;
+    } else if( strcmp( mode_name, "workers" ) == 0 ) {
+        mode = WORKERS;
+    }
+    FILE *log_file = fopen( "/dev/null", "w" );
+    signal( SIGPIPE, SIG_IGN );
+
+    Server *server = new Server( port, log_file, mode );
+    server->set_workers( 2 );
+    server->set_backend( strcmp( mode_name, "uring" ) == 0 ? URING_BACKEND : EPOLL_BACKEND );
+    if( server->initiate() < 0 ) {
+        printf( "Unable to start server on port %d\n", port );
+        return 1;
+    }
+    pthread_t thread;
+    pthread_create( &thread, NULL, &run_server, server );
+
+    Client client( ( char * )"pipeline", log_file );
+    if( client.connect_server( ( char * )"127.0.0.1", port ) < 0 || client.log_in() < 0 || client.start_listener() < 0 ) {
+        printf( "Unable to log in on port %d\n", port );
+        return 1;
+    }
+
+    string payload( payload_size, 'x' );
+    long depths[] = { 1, 16, 256 };
+    for( int i = 0; i < 3; i++ )
+        run_depth( &client, mode_name, requests, depths[ i ], payload );
+
+    client.stop_session();
+    log_close();
+    return 0;
+}
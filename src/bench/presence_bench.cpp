@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include "Chat.h"
+
+/*
+* Presence benchmark. Registers N users on an in-process Server, all subscribed to the presence
+* stream, then makes churn% of them leave and join again, like one minute of churn would.
+* Reports the bytes the presence stream wrote against what every client paging through the
+* connected users once per minute would write. The users share a few socket pairs
+* drained by a background thread so 10k users fit in the fd limit.
+*
+* usage: ./bench_presence [users] [churn %] [polls per minute]
+*/
+
+#define SHARED_SOCKETS 64
+
+struct drain_args {
+    int epoll_fd;
+    volatile int running;
+    atomic<long> bytes;
+};
+
+/*
+* Read and count everything written to the clients
+*/
+static void * drainer( void * context ) {
+    drain_args *args = ( drain_args * )context;
+    struct epoll_event events[ MAX_EVENTS ];
+    char buf[ 65536 ];
+    while( args->running ) {
+        int n_ev = epoll_wait( args->epoll_fd, events, MAX_EVENTS, 10 );
+        for( int i = 0; i < n_ev; i++ ) {
+            ssize_t n;
+            while( ( n = recv( events[ i ].data.fd, buf, sizeof( buf ), MSG_DONTWAIT ) ) > 0 )
+                args->bytes.fetch_add( n, memory_order_relaxed );
+        }
+    }
+    return NULL;
+}
+
+/*
+* Flush what the sockets did not take until every queue is empty and the drainer caught up
+* returns the bytes drained so far
+*/
+static long settle( vector<client_info> &clients, drain_args &args ) {
+    int pending = 1;
+    while( pending ) {
+        pending = 0;
+        for( size_t i = 0; i < clients.size(); i++ ) {
+            send_queue *q = clients[ i ].out.get();
+            pthread_mutex_lock( &q->mutex );
+            flush_send_queue( q );
+            pending |= !q->frames.empty();
+            pthread_mutex_unlock( &q->mutex );
+        }
+        if( pending )
+            usleep( 1000 );
+    }
+    long seen = -1;
+    while( seen != args.bytes.load() ) {
+        seen = args.bytes.load();
+        usleep( 20000 );
+    }
+    return seen;
+}
+
+/*
+* Register user idx on fd, subscribed to presence if presence is set
+*/
+static client_info join( Server &server, int fd, int idx, int presence, request_arena *arena ) {
+    struct sockaddr_in addr;
+    memset( &addr, 0, sizeof( addr ) );
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl( ( 10 << 24 ) + idx + 1 );
+    client_info cl = server.new_client( fd, addr );
+
+    char name[ 32 ];
+    snprintf( name, sizeof( name ), "user%d", idx );
+    MyInfoSynchronize sync;
+    sync.set_username( name );
+    sync.set_presence( presence );
+    server.begin_registration( sync, cl, &arena->arena );
+    arena->arena.Reset();
+    cl.name = name;
+    return cl;
+}
+
+int main( int argc, char *argv[] ) {
+    int n_users = argc > 1 ? atoi( argv[1] ) : 10000;
+    double churn = argc > 2 ? atof( argv[2] ) : 1;
+    double polls = argc > 3 ? atof( argv[3] ) : 1;
+    FILE *log_file = fopen( "/dev/null", "w" );
+    signal( SIGPIPE, SIG_IGN );
+    Server server( 0, log_file, EVENT_LOOP );
+    server.set_outbound_limits( 64 * 1024 * 1024, 1 << 20, DROP_OLDEST_BROADCAST );
+
+    drain_args args;
+    args.epoll_fd = epoll_create1( 0 );
+    args.running = 1;
+    args.bytes = 0;
+    pthread_t thread;
+    pthread_create( &thread, NULL, &drainer, &args );
+
+    int fds[ SHARED_SOCKETS ];
+    for( int i = 0; i < SHARED_SOCKETS; i++ ) {
+        int sv[2];
+        if( socketpair( AF_UNIX, SOCK_STREAM, 0, sv ) < 0 ) {
+            perror( "socketpair" );
+            return 1;
+        }
+        fcntl( sv[0], F_SETFL, fcntl( sv[0], F_GETFL, 0 ) | O_NONBLOCK );
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.fd = sv[1];
+        epoll_ctl( args.epoll_fd, EPOLL_CTL_ADD, sv[1], &ev );
+        fds[ i ] = sv[0];
+    }
+
+    /* Users join unsubscribed, the stream is turned on once everybody is in */
+    request_arena arena;
+    vector<client_info> clients;
+    for( int i = 0; i < n_users; i++ )
+        clients.push_back( join( server, fds[ i % SHARED_SOCKETS ], i, 0, &arena ) );
+
+    ServerMessage *snapshot = server.presence_snapshot( clients[ 0 ], &arena.arena );
+    size_t snapshot_bytes = encode_message( *snapshot )->size();
+    arena.arena.Reset();
+
+    /* A poll pages through the whole list */
+    size_t poll_bytes = 0;
+    connectedUserRequest page;
+    int more = 1;
+    while( more ) {
+        ServerMessage *poll = server.get_connected_users( page, &arena.arena );
+        poll_bytes += encode_message( *poll )->size();
+        more = poll->connecteduserresponse().has_nextcursor();
+        page.set_cursor( poll->connecteduserresponse().nextcursor() );
+        arena.arena.Reset();
+    }
+    for( size_t i = 0; i < clients.size(); i++ )
+        clients[ i ].out->presence.store( 1 );
+    long start_bytes = settle( clients, args );
+
+    /* One minute of churn, every leaving user joins again and gets its snapshot */
+    int churners = ( int )( n_users * churn / 100 );
+    struct timespec t0, t1;
+    clock_gettime( CLOCK_MONOTONIC, &t0 );
+    for( int i = 0; i < churners; i++ ) {
+        int idx = ( int )( ( long )i * n_users / churners );
+        server.delete_user( clients[ idx ].name );
+        clients[ idx ] = join( server, fds[ idx % SHARED_SOCKETS ], idx, 1, &arena );
+    }
+    long churn_bytes = settle( clients, args ) - start_bytes;
+    clock_gettime( CLOCK_MONOTONIC, &t1 );
+    double elapsed = ( t1.tv_sec - t0.tv_sec ) + ( t1.tv_nsec - t0.tv_nsec ) / 1e9;
+    long snapshot_total = ( long )snapshot_bytes * churners;
+
+    double poll_per_min = ( double )poll_bytes * n_users * polls;
+    printf( "users=%d churn_per_min=%d snapshot_bytes=%zu poll_response_bytes=%zu\n",
+        n_users, churners, snapshot_bytes, poll_bytes );
+    printf( "presence_bytes_per_min=%ld (deltas=%ld rejoin_snapshots=%ld) poll_bytes_per_min=%.0f ratio=%.1fx churn_secs=%.2f\n",
+        churn_bytes, churn_bytes - snapshot_total, snapshot_total, poll_per_min,
+        churn_bytes > 0 ? poll_per_min / churn_bytes : 0, elapsed );
+
+    args.running = 0;
+    pthread_join( thread, NULL );
+    log_close();
+    fclose( log_file );
+    return 0;
+}
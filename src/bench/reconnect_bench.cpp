@@ -0,0 +1,292 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "Chat.h"
+
+/*
+* Server restart benchmark. Starts the server binary, logs in N non-blocking Clients served by
+* one epoll loop, each one sets its status and joins a channel (at most SETUP_WINDOW sessions at
+* a time, every status change copies the user table of the server). Then the server is killed and
+* started again after down milliseconds. While it is down every session sends a request that is
+* held until it is back. Measures the time from the restart until every session is logged in
+* again and until every held request got its response, then checks the channel subscriptions
+* came back by posting to the channel. Every client binds to its own 127.10.x.y address because
+* the server rejects repeated ips.
+*
+* usage: ./bench_reconnect [sessions] [port] [server binary] [down ms] [backoff base ms] [backoff max ms]
+*/
+
+#define SETUP_WINDOW 256
+#define RECONNECT_DEADLINE_US 120000000L
+#define DELIVERY_IDLE_US 2000000L
+#define RECONNECT_CHANNEL "bots"
+
+struct session {
+    Client *client;
+    int fd;
+    uint32_t events;
+    client_state last;
+    long restored_us;
+};
+
+struct counters {
+    long ok;
+    long failed;
+    long delivered;
+};
+
+/*
+* Completion of a tracked request, context is the counters of its phase
+*/
+static void on_response( void *context, const ServerMessage &res ) {
+    counters *c = ( counters * )context;
+    if( res.option() == ERROR ) {
+        c->failed++;
+    } else {
+        c->ok++;
+    }
+}
+
+/*
+* Message handler of every session, counts the posts to the channel
+*/
+static void on_message( void *context, const message_received &msg ) {
+    if( msg.type == CHANNEL )
+        ( ( counters * )context )->delivered++;
+}
+
+/*
+* Run the server binary on port with its output discarded
+* returns the pid or -1 on error
+*/
+static pid_t start_server( const char *path, int port ) {
+    char port_str[ 16 ];
+    snprintf( port_str, sizeof( port_str ), "%d", port );
+    pid_t pid = fork();
+    if( pid == 0 ) {
+        int null_fd = open( "/dev/null", O_WRONLY );
+        dup2( null_fd, STDOUT_FILENO );
+        dup2( null_fd, STDERR_FILENO );
+        execl( path, path, port_str, "epoll", ( char * )NULL );
+        _exit( 127 );
+    }
+    return pid;
+}
+
+/*
+* Wait until something accepts connections on serv
+* returns 0 on succes -1 after 5 seconds
+*/
+static int wait_listening( struct sockaddr_in *serv ) {
+    long deadline = monotonic_us() + 5000000L;
+    while( monotonic_us() < deadline ) {
+        int fd = socket( AF_INET, SOCK_STREAM, 0 );
+        int res = connect( fd, (struct sockaddr *)serv, sizeof( *serv ) );
+        close( fd );
+        if( res == 0 )
+            return 0;
+        usleep( 10000 );
+    }
+    return -1;
+}
+
+/*
+* Keep the epoll registration of s in line with what its client waits for, a new socket after
+* a reconnect is added again
+*/
+static void watch( int ep, session *s ) {
+    int fd = s->client->fd();
+    if( fd != s->fd ) {
+        /* Closed sockets left the epoll set by themselves */
+        s->fd = fd;
+        s->events = 0;
+    }
+    if( fd < 0 )
+        return;
+    short wanted = s->client->poll_events();
+    uint32_t events = ( wanted & POLLIN ? ( uint32_t )EPOLLIN : ( uint32_t )0 ) | ( wanted & POLLOUT ? ( uint32_t )EPOLLOUT : ( uint32_t )0 );
+    if( events == s->events )
+        return;
+    struct epoll_event ev;
+    ev.events = events;
+    ev.data.ptr = s;
+    epoll_ctl( ep, s->events == 0 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, fd, &ev );
+    s->events = events;
+}
+
+/*
+* Serve the events of one epoll_wait, then start the reconnections that are due
+* returns the reconnection attempts started
+*/
+static long serve( int ep, vector<session> &sessions, int timeout_ms ) {
+    struct epoll_event events[ 256 ];
+    int n_ev = epoll_wait( ep, events, 256, timeout_ms );
+    for( int i = 0; i < n_ev; i++ ) {
+        session *s = ( session * )events[ i ].data.ptr;
+        uint32_t ev = events[ i ].events;
+        if( ev & ( EPOLLOUT | EPOLLERR | EPOLLHUP ) )
+            s->client->on_writable();
+        if( ( ev & ( EPOLLIN | EPOLLERR | EPOLLHUP ) ) && s->client->fd() >= 0 )
+            s->client->on_readable();
+        watch( ep, s );
+    }
+    long attempts = 0;
+    for( size_t i = 0; i < sessions.size(); i++ ) {
+        session *s = &sessions[ i ];
+        if( s->client->state() != CLIENT_RECONNECTING )
+            continue;
+        s->client->on_timeout();
+        if( s->client->state() != CLIENT_RECONNECTING )
+            attempts++;
+        watch( ep, s );
+    }
+    return attempts;
+}
+
+static int count_state( vector<session> &sessions, client_state st ) {
+    int n = 0;
+    for( size_t i = 0; i < sessions.size(); i++ ) {
+        if( sessions[ i ].client->state() == st )
+            n++;
+    }
+    return n;
+}
+
+static long percentile( vector<long> &v, double p ) {
+    if( v.empty() )
+        return 0;
+    sort( v.begin(), v.end() );
+    return v[ min( v.size() - 1, ( size_t )( p * v.size() ) ) ];
+}
+
+int main( int argc, char *argv[] ) {
+    int n_sessions = argc > 1 ? atoi( argv[1] ) : 5000;
+    int port = argc > 2 ? atoi( argv[2] ) : 9790;
+    const char *server_path = argc > 3 ? argv[3] : "./server";
+    long down_ms = argc > 4 ? atol( argv[4] ) : 1000;
+    long base_ms = argc > 5 ? atol( argv[5] ) : 100;
+    long max_ms = argc > 6 ? atol( argv[6] ) : 2000;
+    FILE *log_file = fopen( "/dev/null", "w" );
+    signal( SIGPIPE, SIG_IGN );
+
+    /* Clients and the server child share the open file limit */
+    struct rlimit lim;
+    getrlimit( RLIMIT_NOFILE, &lim );
+    lim.rlim_cur = lim.rlim_max;
+    setrlimit( RLIMIT_NOFILE, &lim );
+    if( ( rlim_t )n_sessions + 64 > lim.rlim_cur ) {
+        n_sessions = lim.rlim_cur - 64;
+        printf( "Open file limit %lu, running %d sessions\n", ( unsigned long )lim.rlim_cur, n_sessions );
+    }
+
+    struct sockaddr_in serv;
+    memset( &serv, 0, sizeof( serv ) );
+    serv.sin_family = AF_INET;
+    serv.sin_port = htons( port );
+    inet_pton( AF_INET, "127.0.0.1", &serv.sin_addr );
+    pid_t server = start_server( server_path, port );
+    if( server < 0 || wait_listening( &serv ) < 0 ) {
+        printf( "Unable to start %s on port %d\n", server_path, port );
+        return 1;
+    }
+
+    /* Log in, the status and join are held until each log in ends */
+    counters joined = { 0, 0, 0 }, held = { 0, 0, 0 }, posts = { 0, 0, 0 };
+    int ep = epoll_create1( EPOLL_CLOEXEC );
+    vector<session> sessions( n_sessions );
+    /* Clients keep a pointer to their username */
+    vector<string> names( n_sessions );
+    for( int i = 0; i < n_sessions; i++ ) {
+        names[ i ] = "bot" + to_string( i );
+        session *s = &sessions[ i ];
+        s->client = new Client( ( char * )names[ i ].c_str(), log_file );
+        s->fd = -1;
+        s->events = 0;
+        s->restored_us = 0;
+        s->client->set_presence( 0 );
+        s->client->set_reconnect( base_ms, max_ms );
+        s->client->set_message_handler( &on_message, &posts );
+    }
+    long start = monotonic_us();
+    int started = 0;
+    while( joined.ok + joined.failed < n_sessions && monotonic_us() - start < RECONNECT_DEADLINE_US ) {
+        while( started < n_sessions && started - joined.ok - joined.failed < SETUP_WINDOW ) {
+            struct sockaddr_in local;
+            memset( &local, 0, sizeof( local ) );
+            local.sin_family = AF_INET;
+            local.sin_addr.s_addr = htonl( ( 127 << 24 ) | ( 10 << 16 ) | ( started + 1 ) );
+            session *s = &sessions[ started++ ];
+            if( s->client->connect_async( &serv, &local ) < 0 ) {
+                joined.failed++;
+                continue;
+            }
+            s->client->change_status( "ocupado" );
+            s->client->channel_request( JOINCHANNEL, RECONNECT_CHANNEL, &on_response, &joined );
+            watch( ep, s );
+        }
+        serve( ep, sessions, 10 );
+    }
+    printf( "sessions=%d logged_in=%d joined=%ld seconds=%.2f\n", n_sessions,
+        count_state( sessions, CLIENT_ESTABLISHED ), joined.ok, ( monotonic_us() - start ) / 1e6 );
+
+    /* Kill the server, every session sends a request while it is down */
+    long kill_us = monotonic_us();
+    kill( server, SIGKILL );
+    waitpid( server, NULL, 0 );
+    while( count_state( sessions, CLIENT_ESTABLISHED ) > 0 && monotonic_us() - kill_us < RECONNECT_DEADLINE_US )
+        serve( ep, sessions, 10 );
+    long lost_us = monotonic_us() - kill_us;
+    long held_errors = 0;
+    for( int i = 0; i < n_sessions; i++ ) {
+        if( sessions[ i ].client->channel_request( JOINCHANNEL, "held", &on_response, &held ) < 0 )
+            held_errors++;
+    }
+    long attempts = 0;
+    while( monotonic_us() - kill_us < down_ms * 1000 )
+        attempts += serve( ep, sessions, 10 );
+
+    /* Restart and wait for every session and held request */
+    server = start_server( server_path, port );
+    long restart_us = monotonic_us();
+    vector<long> restore;
+    int restored = 0;
+    while( ( restored < n_sessions || held.ok + held.failed + held_errors < n_sessions ) &&
+        monotonic_us() - restart_us < RECONNECT_DEADLINE_US ) {
+        attempts += serve( ep, sessions, 10 );
+        for( int i = 0; i < n_sessions; i++ ) {
+            session *s = &sessions[ i ];
+            if( s->restored_us == 0 && s->client->state() == CLIENT_ESTABLISHED ) {
+                s->restored_us = monotonic_us();
+                restore.push_back( s->restored_us - restart_us );
+                restored++;
+            }
+        }
+    }
+    long all_restored_us = restore.empty() ? 0 : percentile( restore, 1.0 );
+    double held_s = ( monotonic_us() - restart_us ) / 1e6;
+
+    /* Restored subscriptions: a post reaches every other session */
+    long expected = restored - 1;
+    sessions[ 0 ].client->channel_message( "back", RECONNECT_CHANNEL, &on_response, &joined );
+    watch( ep, &sessions[ 0 ] );
+    long last = -1, idle_since = monotonic_us();
+    while( posts.delivered < expected && monotonic_us() - idle_since < DELIVERY_IDLE_US ) {
+        serve( ep, sessions, 10 );
+        if( posts.delivered != last ) {
+            last = posts.delivered;
+            idle_since = monotonic_us();
+        }
+    }
+
+    printf( "sessions=%d down_ms=%ld backoff_base_ms=%ld backoff_max_ms=%ld lost_detected_ms=%.1f attempts=%ld restored=%d restore_p50_ms=%.1f restore_p99_ms=%.1f all_restored_ms=%.1f held=%d held_ok=%ld held_failed=%ld held_seconds=%.2f channel_delivered=%ld expected=%ld\n",
+        n_sessions, down_ms, base_ms, max_ms, lost_us / 1000.0, attempts, restored, percentile( restore, 0.5 ) / 1000.0,
+        percentile( restore, 0.99 ) / 1000.0, all_restored_us / 1000.0, n_sessions, held.ok, held.failed + held_errors,
+        held_s, posts.delivered, expected );
+
+    kill( server, SIGKILL );
+    waitpid( server, NULL, 0 );
+    log_close();
+    return 0;
+}
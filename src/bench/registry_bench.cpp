@@ -0,0 +1,213 @@
+#include <stdio.h>
+#include <time.h>
+#include "Chat.h"
+
+/*
+* User registry contention benchmark. N threads "broadcast" (walk every connected user) while
+* one thread keeps joining and leaving users. Compares the copy on write UserRegistry against the
+* previous mutex protected map that was copied on every read.
+* Then measures single user lookups by id, username and ip against the previous linear scan.
+*
+* usage: ./bench_registry [threads] [users] [seconds] [lookup users]
+*/
+
+struct bench_args {
+    int users;
+    volatile int running;
+    atomic<long> broadcasts;
+    atomic<long> churn;
+};
+
+/* Previous registry: one mutex and a full copy per read */
+static pthread_mutex_t locked_mutex = PTHREAD_MUTEX_INITIALIZER;
+static map<string, client_info> locked_users;
+static UserRegistry registry;
+static int use_registry = 1;
+
+/*
+* Current monotonic time in seconds
+*/
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static client_info make_user( int idx ) {
+    char name[ 32 ];
+    snprintf( name, sizeof( name ), "user%d", idx );
+    client_info cl;
+    cl.id = idx;
+    cl.req_fd = -1;
+    cl.name = name;
+    cl.status = "activo";
+    char ip[ INET_ADDRSTRLEN ];
+    struct in_addr addr;
+    addr.s_addr = htonl( ( 10 << 24 ) + idx + 1 );
+    inet_ntop( AF_INET, &addr, ip, sizeof( ip ) );
+    cl.ip = ip;
+    return cl;
+}
+
+static void add_user( const client_info &cl ) {
+    if( use_registry ) {
+        registry.add( cl );
+    } else {
+        pthread_mutex_lock( &locked_mutex );
+        locked_users[ cl.name ] = cl;
+        pthread_mutex_unlock( &locked_mutex );
+    }
+}
+
+static void remove_user( const string &name ) {
+    if( use_registry ) {
+        registry.remove( name );
+    } else {
+        pthread_mutex_lock( &locked_mutex );
+        locked_users.erase( name );
+        pthread_mutex_unlock( &locked_mutex );
+    }
+}
+
+/*
+* Walk every user like send_all does
+*/
+static void * broadcaster( void * context ) {
+    bench_args *args = ( bench_args * )context;
+    long broadcasts = 0;
+    volatile long sum = 0;
+    while( args->running ) {
+        if( use_registry ) {
+            user_snapshot users = registry.snapshot();
+            for( user_map::const_iterator it = users->users.begin(); it != users->users.end(); it++ )
+                sum += it->second.id;
+        } else {
+            pthread_mutex_lock( &locked_mutex );
+            map<string, client_info> users = locked_users;
+            pthread_mutex_unlock( &locked_mutex );
+            for( map<string, client_info>::const_iterator it = users.begin(); it != users.end(); it++ )
+                sum += it->second.id;
+        }
+        broadcasts++;
+    }
+    args->broadcasts += broadcasts;
+    return NULL;
+}
+
+/*
+* Join and leave users continuously
+*/
+static void * churner( void * context ) {
+    bench_args *args = ( bench_args * )context;
+    long ops = 0;
+    int next = args->users;
+    while( args->running ) {
+        client_info cl = make_user( next );
+        add_user( cl );
+        remove_user( cl.name );
+        next++;
+        ops += 2;
+    }
+    args->churn += ops;
+    return NULL;
+}
+
+static void run( int n_threads, int users, double seconds ) {
+    for( int i = 0; i < users; i++ )
+        add_user( make_user( i ) );
+
+    bench_args args;
+    args.users = users;
+    args.running = 1;
+    args.broadcasts = 0;
+    args.churn = 0;
+
+    vector<pthread_t> threads( n_threads + 1 );
+    double start = now_sec();
+    for( int i = 0; i < n_threads; i++ )
+        pthread_create( &threads[ i ], NULL, &broadcaster, &args );
+    pthread_create( &threads[ n_threads ], NULL, &churner, &args );
+    while( now_sec() - start < seconds )
+        usleep( 10000 );
+    args.running = 0;
+    for( size_t i = 0; i < threads.size(); i++ )
+        pthread_join( threads[ i ], NULL );
+    double elapsed = now_sec() - start;
+
+    printf( "registry=%s threads=%d users=%d broadcasts_per_sec=%.0f churn_ops_per_sec=%.0f\n",
+        use_registry ? "copy_on_write" : "locked_copy", n_threads, users,
+        args.broadcasts / elapsed, args.churn / elapsed );
+}
+
+/*
+* Lookup cost with users registered, ns per lookup
+*/
+static void run_lookups( int users ) {
+    UserRegistry lookup_registry;
+    vector<client_info> all;
+    for( int i = 0; i < users; i++ )
+        all.push_back( make_user( i ) );
+    lookup_registry.add_all( all );
+    user_snapshot snap = lookup_registry.snapshot();
+
+    map<string, client_info> by_name_map;
+    for( int i = 0; i < users; i++ )
+        by_name_map[ all[ i ].name ] = all[ i ];
+
+    int rounds = 200000;
+    unsigned int seed = 42;
+    volatile long sink = 0;
+    double start, linear_ns, id_ns, name_ns, ip_ns;
+
+    /* Previous get_user( int ): linear scan */
+    int linear_rounds = 2000;
+    start = now_sec();
+    for( int r = 0; r < linear_rounds; r++ ) {
+        int id = rand_r( &seed ) % users;
+        for( map<string, client_info>::const_iterator it = by_name_map.begin(); it != by_name_map.end(); it++ ) {
+            if( it->second.id == id ) {
+                sink += it->second.id;
+                break;
+            }
+        }
+    }
+    linear_ns = ( now_sec() - start ) * 1e9 / linear_rounds;
+
+    start = now_sec();
+    for( int r = 0; r < rounds; r++ ) {
+        const client_info *usr = snap->find( ( int )( rand_r( &seed ) % users ) );
+        sink += usr != NULL ? usr->id : 0;
+    }
+    id_ns = ( now_sec() - start ) * 1e9 / rounds;
+
+    start = now_sec();
+    for( int r = 0; r < rounds; r++ ) {
+        const client_info *usr = snap->find( all[ rand_r( &seed ) % users ].name );
+        sink += usr != NULL ? usr->id : 0;
+    }
+    name_ns = ( now_sec() - start ) * 1e9 / rounds;
+
+    start = now_sec();
+    for( int r = 0; r < rounds; r++ ) {
+        const client_info *usr = snap->find_ip( all[ rand_r( &seed ) % users ].ip );
+        sink += usr != NULL ? usr->id : 0;
+    }
+    ip_ns = ( now_sec() - start ) * 1e9 / rounds;
+
+    printf( "lookup users=%d linear_scan_by_id_ns=%.0f index_by_id_ns=%.0f index_by_name_ns=%.0f index_by_ip_ns=%.0f\n",
+        users, linear_ns, id_ns, name_ns, ip_ns );
+}
+
+int main( int argc, char *argv[] ) {
+    int n_threads = argc > 1 ? atoi( argv[1] ) : 16;
+    int users = argc > 2 ? atoi( argv[2] ) : 1000;
+    double seconds = argc > 3 ? atof( argv[3] ) : 3;
+    int lookup_users = argc > 4 ? atoi( argv[4] ) : 100000;
+
+    use_registry = 0;
+    run( n_threads, users, seconds );
+    use_registry = 1;
+    run( n_threads, users, seconds );
+    run_lookups( lookup_users );
+    return 0;
+}
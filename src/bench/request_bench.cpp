@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <time.h>
+#include "Chat.h"
+
+/*
+* Request processing microbenchmark. Runs every kind of request through parse, process and send
+* on an in-process Server whose connections are socket pairs drained by a background thread.
+* Reports heap allocations per request (global operator new) and ns per request.
+*
+* usage: ./bench_request [requests per kind] [recipients]
+*/
+
+/* Counted by the global operator new of alloc_count.cpp */
+long allocation_count();
+
+struct drain_args {
+    int epoll_fd;
+    volatile int running;
+};
+
+/*
+* Current monotonic time in seconds
+*/
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+* Read and discard everything written to the clients
+*/
+static void * drainer( void * context ) {
+    drain_args *args = ( drain_args * )context;
+    struct epoll_event events[ MAX_EVENTS ];
+    char buf[ 65536 ];
+    while( args->running ) {
+        int n_ev = epoll_wait( args->epoll_fd, events, MAX_EVENTS, 10 );
+        for( int i = 0; i < n_ev; i++ ) {
+            while( recv( events[ i ].data.fd, buf, sizeof( buf ), MSG_DONTWAIT ) > 0 );
+        }
+    }
+    return NULL;
+}
+
+/*
+* Flush what the sockets did not take, like the connection owners do
+*/
+static void flush_all( vector<client_info> &clients ) {
+    for( size_t i = 0; i < clients.size(); i++ ) {
+        send_queue *q = clients[ i ].out.get();
+        pthread_mutex_lock( &q->mutex );
+        flush_send_queue( q );
+        pthread_mutex_unlock( &q->mutex );
+    }
+}
+
+/*
+* Register size users whose peer sockets are read by the drainer
+*/
+static void add_clients( Server &server, drain_args &args, vector<client_info> &clients, int size ) {
+    request_arena arena;
+    for( int i = 0; i < size; i++ ) {
+        int sv[2];
+        if( socketpair( AF_UNIX, SOCK_STREAM, 0, sv ) < 0 ) {
+            perror( "socketpair" );
+            exit( 1 );
+        }
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.fd = sv[1];
+        epoll_ctl( args.epoll_fd, EPOLL_CTL_ADD, sv[1], &ev );
+
+        struct sockaddr_in addr;
+        memset( &addr, 0, sizeof( addr ) );
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl( ( 10 << 24 ) + i + 1 );
+        client_info cl = server.new_client( sv[0], addr );
+
+        char name[ 32 ];
+        snprintf( name, sizeof( name ), "user%d", i );
+        MyInfoSynchronize sync;
+        sync.set_username( name );
+        server.begin_registration( sync, cl, &arena.arena );
+        arena.arena.Reset();
+        cl.name = name;
+        clients.push_back( cl );
+    }
+}
+
+/*
+* Serialized ClientMessage of the given option
+*/
+static string make_request( int option ) {
+    ClientMessage msg;
+    msg.set_option( option );
+    switch( option ) {
+        case CONNECTEDUSER:
+            msg.mutable_connectedusers()->set_userid( 0 );
+            break;
+        case CHANGESTATUS:
+            msg.mutable_changestatus()->set_status( "ocupado" );
+            break;
+        case BROADCASTC:
+            msg.mutable_broadcast()->set_message( string( 64, 'x' ) );
+            break;
+        case DIRECTMESSAGE:
+            msg.mutable_directmessage()->set_message( string( 64, 'x' ) );
+            msg.mutable_directmessage()->set_username( "user1" );
+            break;
+    }
+    string out;
+    msg.SerializeToString( &out );
+    return out;
+}
+
+/*
+* Parse, process and answer one request the way a connection owner does
+*/
+static void run_request( Server &server, const client_info &sender, const string &req, request_arena *arena ) {
+    Arena *a = &arena->arena;
+    server.send_response( sender, *server.process_request( *server.parse_request( req, a ), sender, a ) );
+    a->Reset();
+}
+
+int main( int argc, char *argv[] ) {
+    int rounds = argc > 1 ? atoi( argv[1] ) : 200000;
+    int recipients = argc > 2 ? atoi( argv[2] ) : 16;
+    FILE *log_file = fopen( "/dev/null", "w" );
+    Server server( 0, log_file );
+
+    drain_args args;
+    args.epoll_fd = epoll_create1( 0 );
+    args.running = 1;
+    pthread_t thread;
+    pthread_create( &thread, NULL, &drainer, &args );
+
+    request_arena arena;
+    vector<client_info> clients;
+    add_clients( server, args, clients, recipients );
+
+    const char *names[] = { "connected_users", "change_status", "broadcast", "direct_message", "invalid" };
+    int options[] = { CONNECTEDUSER, CHANGESTATUS, BROADCASTC, DIRECTMESSAGE, 99 };
+    for( int k = 0; k < 5; k++ ) {
+        string req = make_request( options[ k ] );
+        /* Warm up so lazily built state is not counted */
+        for( int r = 0; r < 100; r++ )
+            run_request( server, clients[ 0 ], req, &arena );
+        flush_all( clients );
+
+        long before = allocation_count();
+        double start = now_sec();
+        for( int r = 0; r < rounds; r++ ) {
+            run_request( server, clients[ 0 ], req, &arena );
+            if( r % 64 == 63 )
+                flush_all( clients );
+        }
+        flush_all( clients );
+        double elapsed = now_sec() - start;
+        long allocs = allocation_count() - before;
+        printf( "request=%s recipients=%d allocations_per_request=%.1f ns_per_request=%.0f\n",
+            names[ k ], recipients, ( double )allocs / rounds, elapsed * 1e9 / rounds );
+    }
+
+    args.running = 0;
+    pthread_join( thread, NULL );
+    log_close();
+    fclose( log_file );
+    return 0;
+}
@@ -0,0 +1,275 @@
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include "Chat.h"
+
+/*
+* Client sessions benchmark. N non-blocking Clients log in to an in-process server and are all
+* served by one epoll loop on the main thread, then one of them sends broadcasts and the loop
+* counts the messages its message handler gets. The same is done with thread per session Clients
+* (blocking log in and a listener thread each) on a second server. Reports the log in time, the
+* process threads and RSS per session (client and server side of it) and broadcast deliveries/sec.
+* Sessions skip the presence stream unless presence is 1: with it every session gets every join,
+* which costs N^2 deltas and N copies of the user list for N sessions in one process.
+* Every client binds to its own 127.9.x.y address because the server rejects repeated ips.
+*
+* usage: ./bench_sessions [sessions] [first port] [broadcasts] [thread per session sessions] [presence]
+*/
+
+#define SESSIONS_DEADLINE_US 120000000L
+#define DELIVERY_IDLE_US 2000000L
+
+struct session {
+    Client *client;
+    uint32_t events;
+};
+
+static void * run_server( void * context ) {
+    ( ( Server * )context )->start();
+    return NULL;
+}
+
+/*
+* Message handler of every session, context is the shared delivery counter
+*/
+static void on_message( void *context, const message_received & ) {
+    ( ( atomic<long> * )context )->fetch_add( 1 );
+}
+
+/*
+* Read a value in kB or a count from /proc/self/status
+*/
+static long proc_status( const char *key ) {
+    FILE *f = fopen( "/proc/self/status", "r" );
+    char line[ 256 ];
+    long value = 0;
+    size_t len = strlen( key );
+    while( f != NULL && fgets( line, sizeof( line ), f ) != NULL ) {
+        if( strncmp( line, key, len ) == 0 && line[ len ] == ':' )
+            value = atol( line + len + 1 );
+    }
+    if( f != NULL )
+        fclose( f );
+    return value;
+}
+
+static struct sockaddr_in local_address( int idx ) {
+    struct sockaddr_in local;
+    memset( &local, 0, sizeof( local ) );
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl( ( 127 << 24 ) | ( 9 << 16 ) | ( idx + 1 ) );
+    return local;
+}
+
+/*
+* Keep the epoll registration of s in line with what its client waits for
+*/
+static void watch( int ep, session *s ) {
+    if( s->client->fd() < 0 )
+        return;
+    short wanted = s->client->poll_events();
+    uint32_t events = ( wanted & POLLIN ? ( uint32_t )EPOLLIN : ( uint32_t )0 ) | ( wanted & POLLOUT ? ( uint32_t )EPOLLOUT : ( uint32_t )0 );
+    if( events == s->events )
+        return;
+    struct epoll_event ev;
+    ev.events = events;
+    ev.data.ptr = s;
+    epoll_ctl( ep, s->events == 0 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, s->client->fd(), &ev );
+    s->events = events;
+}
+
+/*
+* Serve the events of one epoll_wait
+*/
+static void serve( int ep, int timeout_ms ) {
+    struct epoll_event events[ 256 ];
+    int n_ev = epoll_wait( ep, events, 256, timeout_ms );
+    for( int i = 0; i < n_ev; i++ ) {
+        session *s = ( session * )events[ i ].data.ptr;
+        uint32_t ev = events[ i ].events;
+        if( ( ev & ( EPOLLOUT | EPOLLERR | EPOLLHUP ) ) && s->client->on_writable() < 0 )
+            continue;
+        if( ( ev & ( EPOLLIN | EPOLLERR | EPOLLHUP ) ) && s->client->fd() >= 0 && s->client->on_readable() < 0 )
+            continue;
+        watch( ep, s );
+    }
+}
+
+static int established( vector<session> &sessions ) {
+    int n = 0;
+    for( size_t i = 0; i < sessions.size(); i++ ) {
+        if( sessions[ i ].client->state() == CLIENT_ESTABLISHED )
+            n++;
+    }
+    return n;
+}
+
+static Server * start_server( int port, FILE *log_file ) {
+    Server *server = new Server( port, log_file, EVENT_LOOP );
+    if( server->initiate() < 0 ) {
+        printf( "Unable to start server on port %d\n", port );
+        return NULL;
+    }
+    pthread_t thread;
+    pthread_create( &thread, NULL, &run_server, server );
+    return server;
+}
+
+/*
+* Sessions served by one epoll loop
+*/
+static int run_event_loop( int port, int n_sessions, int broadcasts, int presence, FILE *log_file ) {
+    if( start_server( port, log_file ) == NULL )
+        return -1;
+    struct sockaddr_in serv;
+    memset( &serv, 0, sizeof( serv ) );
+    serv.sin_family = AF_INET;
+    serv.sin_port = htons( port );
+    inet_pton( AF_INET, "127.0.0.1", &serv.sin_addr );
+
+    long rss_before = proc_status( "VmRSS" );
+    atomic<long> delivered( 0 );
+    int ep = epoll_create1( 0 );
+    vector<session> sessions( n_sessions );
+    /* Clients keep a pointer to their username */
+    vector<string> names( n_sessions );
+    long start = monotonic_us();
+    for( int i = 0; i < n_sessions; i++ ) {
+        names[ i ] = "session" + to_string( i );
+        struct sockaddr_in local = local_address( i );
+        sessions[ i ].client = new Client( ( char * )names[ i ].c_str(), log_file );
+        sessions[ i ].events = 0;
+        sessions[ i ].client->set_message_handler( &on_message, &delivered );
+        sessions[ i ].client->set_presence( presence );
+        if( sessions[ i ].client->connect_async( &serv, &local ) == 0 )
+            watch( ep, &sessions[ i ] );
+    }
+    int logged_in = 0;
+    while( ( logged_in = established( sessions ) ) < n_sessions && monotonic_us() - start < SESSIONS_DEADLINE_US )
+        serve( ep, 100 );
+    double login_s = ( monotonic_us() - start ) / 1e6;
+    long rss_kb = proc_status( "VmRSS" ) - rss_before;
+
+    /* Let the last logins settle before counting deliveries */
+    long settle = monotonic_us() + 500000;
+    while( monotonic_us() < settle )
+        serve( ep, 50 );
+
+    session *sender = &sessions[ 0 ];
+    string payload( 64, 'x' );
+    delivered.store( 0 );
+    start = monotonic_us();
+    for( int i = 0; i < broadcasts; i++ ) {
+        sender->client->broadcast_message( payload );
+        watch( ep, sender );
+        serve( ep, 0 );
+    }
+    long expected = ( long )broadcasts * ( logged_in - 1 );
+    long last = -1, end = monotonic_us(), idle_since = end;
+    while( delivered.load() < expected && monotonic_us() - idle_since < DELIVERY_IDLE_US ) {
+        serve( ep, 50 );
+        if( delivered.load() != last ) {
+            last = delivered.load();
+            end = idle_since = monotonic_us();
+        }
+    }
+    double deliver_s = ( end - start ) / 1e6;
+
+    printf( "mode=event_loop sessions=%d presence=%d logged_in=%d login_seconds=%.2f threads=%ld rss_kb_per_session=%.1f broadcasts=%d delivered=%ld expected=%ld seconds=%.2f deliveries_per_sec=%.0f\n",
+        n_sessions, presence, logged_in, login_s, proc_status( "Threads" ), rss_kb / ( double )n_sessions, broadcasts,
+        delivered.load(), expected, deliver_s, delivered.load() / deliver_s );
+
+    for( int i = 0; i < n_sessions; i++ )
+        delete sessions[ i ].client;
+    close( ep );
+    return 0;
+}
+
+/*
+* Sessions with a blocking log in and a listener thread each
+*/
+static int run_threaded( int port, int n_sessions, int broadcasts, int presence, FILE *log_file ) {
+    if( start_server( port, log_file ) == NULL )
+        return -1;
+    struct sockaddr_in serv;
+    memset( &serv, 0, sizeof( serv ) );
+    serv.sin_family = AF_INET;
+    serv.sin_port = htons( port );
+    inet_pton( AF_INET, "127.0.0.1", &serv.sin_addr );
+
+    long rss_before = proc_status( "VmRSS" );
+    atomic<long> delivered( 0 );
+    vector<Client *> clients( n_sessions );
+    vector<string> names( n_sessions );
+    int logged_in = 0;
+    long start = monotonic_us();
+    for( int i = 0; i < n_sessions; i++ ) {
+        names[ i ] = "thread" + to_string( i );
+        struct sockaddr_in local = local_address( i );
+        Client *client = clients[ i ] = new Client( ( char * )names[ i ].c_str(), log_file );
+        client->set_message_handler( &on_message, &delivered );
+        client->set_presence( presence );
+        client->_sock = socket( AF_INET, SOCK_STREAM, 0 );
+        if( client->_sock < 0 || bind( client->_sock, (struct sockaddr *)&local, sizeof( local ) ) < 0 ||
+            connect( client->_sock, (struct sockaddr *)&serv, sizeof( serv ) ) < 0 ||
+            client->log_in() < 0 || client->start_listener() < 0 )
+            continue;
+        logged_in++;
+    }
+    double login_s = ( monotonic_us() - start ) / 1e6;
+    long rss_kb = proc_status( "VmRSS" ) - rss_before;
+    usleep( 500000 );
+
+    string payload( 64, 'x' );
+    delivered.store( 0 );
+    start = monotonic_us();
+    for( int i = 0; i < broadcasts; i++ )
+        clients[ 0 ]->broadcast_message( payload );
+    long expected = ( long )broadcasts * ( logged_in - 1 );
+    long last = -1, end = monotonic_us(), idle_since = end;
+    while( delivered.load() < expected && monotonic_us() - idle_since < DELIVERY_IDLE_US ) {
+        usleep( 10000 );
+        if( delivered.load() != last ) {
+            last = delivered.load();
+            end = idle_since = monotonic_us();
+        }
+    }
+    double deliver_s = ( end - start ) / 1e6;
+
+    printf( "mode=thread_per_session sessions=%d presence=%d logged_in=%d login_seconds=%.2f threads=%ld rss_kb_per_session=%.1f broadcasts=%d delivered=%ld expected=%ld seconds=%.2f deliveries_per_sec=%.0f\n",
+        n_sessions, presence, logged_in, login_s, proc_status( "Threads" ), rss_kb / ( double )n_sessions, broadcasts,
+        delivered.load(), expected, deliver_s, delivered.load() / deliver_s );
+
+    for( int i = 0; i < n_sessions; i++ )
+        delete clients[ i ];
+    return 0;
+}
+
+int main( int argc, char *argv[] ) {
+    int n_sessions = argc > 1 ? atoi( argv[1] ) : 5000;
+    int port = argc > 2 ? atoi( argv[2] ) : 9780;
+    int broadcasts = argc > 3 ? atoi( argv[3] ) : 200;
+    int n_threaded = argc > 4 ? atoi( argv[4] ) : 500;
+    int presence = argc > 5 ? atoi( argv[5] ) : 0;
+    FILE *log_file = fopen( "/dev/null", "w" );
+    signal( SIGPIPE, SIG_IGN );
+
+    /* Clients and server sockets share the process */
+    struct rlimit lim;
+    getrlimit( RLIMIT_NOFILE, &lim );
+    lim.rlim_cur = lim.rlim_max;
+    setrlimit( RLIMIT_NOFILE, &lim );
+    if( ( rlim_t )n_sessions * 2 + 64 > lim.rlim_cur ) {
+        n_sessions = ( lim.rlim_cur - 64 ) / 2;
+        printf( "Open file limit %lu, running %d sessions\n", ( unsigned long )lim.rlim_cur, n_sessions );
+    }
+
+    /* Servers are left running idle, every run gets its own port */
+    if( run_event_loop( port, n_sessions, broadcasts, presence, log_file ) < 0 )
+        return 1;
+    if( n_threaded > 0 && run_threaded( port + 1, n_threaded, broadcasts, presence, log_file ) < 0 )
+        return 1;
+    log_close();
+    return 0;
+}
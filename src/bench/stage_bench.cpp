@@ -0,0 +1,301 @@
+#include <stdio.h>
+#include <time.h>
+#include "Chat.h"
+
+/*
+* Request pipeline stage microbenchmarks, in process and one stage at a time: parse_request,
+* process_request for every option, the ServerMessage built by broadcast_message and
+* direct_message, the serialization done by send_response and the client parse_response and
+* push_res path. Reports ns and heap allocations (global operator new) per operation.
+* Operations run in blocks of STAGE_BLOCK, only the blocks are timed: the queued frames are
+* written and drained and the client queues emptied between them. Recipients ask for batches so
+* a fan-out only queues its frames. Payloads are fixed and direct message recipients come from
+* a fixed seed, two runs do the same work.
+*
+* usage: ./bench_stages [rounds] [payload bytes] [recipients]
+*/
+
+#define STAGE_BLOCK 64
+
+/* Counted by the global operator new of alloc_count.cpp */
+long allocation_count();
+
+struct stage_ctx {
+    Server *server;
+    vector<client_info> *clients;
+    vector<int> *peers;
+    request_arena *arena;
+    string request;
+    ClientMessage parsed;
+    vector<ClientMessage> direct;
+    size_t next_direct;
+    ServerMessage response;
+    string frame;
+    Client *client;
+};
+
+typedef void ( *stage_op )( stage_ctx *ctx );
+
+/*
+* Current monotonic time in nanoseconds
+*/
+static long now_ns() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+static void op_parse( stage_ctx *ctx ) {
+    ctx->server->parse_request( ctx->request, &ctx->arena->arena );
+    ctx->arena->arena.Reset();
+}
+
+static void op_process( stage_ctx *ctx ) {
+    ctx->server->process_request( ctx->parsed, ( *ctx->clients )[ 0 ], &ctx->arena->arena );
+    ctx->arena->arena.Reset();
+}
+
+static void op_build_broadcast( stage_ctx *ctx ) {
+    ctx->server->broadcast_message( ctx->parsed.broadcast(), ( *ctx->clients )[ 0 ], &ctx->arena->arena );
+    ctx->arena->arena.Reset();
+}
+
+static void op_build_direct( stage_ctx *ctx ) {
+    const ClientMessage &req = ctx->direct[ ctx->next_direct++ % ctx->direct.size() ];
+    ctx->server->direct_message( req.directmessage(), ( *ctx->clients )[ 0 ], &ctx->arena->arena );
+    ctx->arena->arena.Reset();
+}
+
+static void op_encode( stage_ctx *ctx ) {
+    encode_message( ctx->response );
+}
+
+static void op_client( stage_ctx *ctx ) {
+    ctx->client->push_res( ctx->client->parse_response( ctx->frame ) );
+}
+
+/*
+* Write everything the server queued and read it back from the peer sockets, then empty the
+* client queues
+*/
+static void drain( stage_ctx *ctx ) {
+    vector<client_info> &clients = *ctx->clients;
+    for( size_t i = 0; i < clients.size(); i++ ) {
+        send_queue *q = clients[ i ].out.get();
+        pthread_mutex_lock( &q->mutex );
+        release_batch( q );
+        flush_send_queue( q );
+        pthread_mutex_unlock( &q->mutex );
+    }
+    char buf[ 65536 ];
+    for( size_t i = 0; i < ctx->peers->size(); i++ ) {
+        while( recv( ( *ctx->peers )[ i ], buf, sizeof( buf ), MSG_DONTWAIT ) > 0 );
+    }
+
+    message_received msg;
+    message_type types[] = { BROADCAST, DIRECT, CHANNEL };
+    for( int t = 0; t < 3; t++ ) {
+        while( ctx->client->pop_to_buffer( types[ t ], &msg ) == 0 );
+    }
+}
+
+/*
+* Run op rounds times after a warm up and print its ns and allocations per operation
+*/
+static void run_stage( const char *stage, const char *name, stage_ctx *ctx, stage_op op, int rounds ) {
+    for( int r = 0; r < 2 * STAGE_BLOCK; r++ )
+        op( ctx );
+    drain( ctx );
+
+    long elapsed = 0, allocs = 0;
+    for( int done = 0; done < rounds; done += STAGE_BLOCK ) {
+        long before = allocation_count();
+        long start = now_ns();
+        for( int r = 0; r < STAGE_BLOCK; r++ )
+            op( ctx );
+        elapsed += now_ns() - start;
+        allocs += allocation_count() - before;
+        drain( ctx );
+    }
+    int ops = ( ( rounds + STAGE_BLOCK - 1 ) / STAGE_BLOCK ) * STAGE_BLOCK;
+    printf( "stage=%s op=%s allocations_per_op=%.1f ns_per_op=%.0f\n", stage, name, ( double )allocs / ops, ( double )elapsed / ops );
+}
+
+/*
+* Register size batching users named user<i> whose peer sockets are added to peers
+*/
+static void add_clients( Server &server, vector<client_info> &clients, vector<int> &peers, int size ) {
+    request_arena arena;
+    for( int i = 0; i < size; i++ ) {
+        int sv[2];
+        if( socketpair( AF_UNIX, SOCK_STREAM, 0, sv ) < 0 ) {
+            perror( "socketpair" );
+            exit( 1 );
+        }
+        fcntl( sv[0], F_SETFL, fcntl( sv[0], F_GETFL, 0 ) | O_NONBLOCK );
+        peers.push_back( sv[1] );
+
+        struct sockaddr_in addr;
+        memset( &addr, 0, sizeof( addr ) );
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl( ( 10 << 24 ) + i + 1 );
+        client_info cl = server.new_client( sv[0], addr );
+
+        char name[ 32 ];
+        snprintf( name, sizeof( name ), "user%d", i );
+        MyInfoSynchronize sync;
+        sync.set_username( name );
+        sync.set_batch( true );
+        server.begin_registration( sync, cl, &arena.arena );
+        arena.arena.Reset();
+        cl.name = name;
+        clients.push_back( cl );
+    }
+}
+
+/*
+* Client request of the given option with a payload of size bytes
+*/
+static void make_request( int option, size_t size, ClientMessage *msg ) {
+    msg->Clear();
+    msg->set_option( option );
+    switch( option ) {
+        case CONNECTEDUSER:
+            msg->mutable_connectedusers()->set_userid( 0 );
+            break;
+        case CHANGESTATUS:
+            msg->mutable_changestatus()->set_status( "ocupado" );
+            break;
+        case BROADCASTC:
+            msg->mutable_broadcast()->set_message( string( size, 'x' ) );
+            break;
+        case DIRECTMESSAGE:
+            msg->mutable_directmessage()->set_message( string( size, 'x' ) );
+            msg->mutable_directmessage()->set_username( "user1" );
+            break;
+        case JOINCHANNEL:
+            msg->mutable_channel()->set_channel( "room" );
+            break;
+        case CHANNELMESSAGE:
+            msg->mutable_channelmessage()->set_channel( "room" );
+            msg->mutable_channelmessage()->set_message( string( size, 'x' ) );
+            break;
+        case HISTORYREQUEST:
+            msg->mutable_history()->set_after( 0 );
+            msg->mutable_history()->set_until( 0 );
+            break;
+    }
+}
+
+int main( int argc, char *argv[] ) {
+    int rounds = argc > 1 ? atoi( argv[1] ) : 200000;
+    size_t payload = argc > 2 ? atol( argv[2] ) : 64;
+    int recipients = argc > 3 ? atoi( argv[3] ) : 16;
+    if( rounds <= 0 || recipients < 2 || payload > MESSAGE_SIZE / 2 ) {
+        printf( "Invalid arguments\n" );
+        return 1;
+    }
+    FILE *log_file = fopen( "/dev/null", "w" );
+    Server server( 0, log_file, EVENT_LOOP );
+    server.set_batching( 1, BATCH_MAX_BYTES );
+    printf( "rounds=%d payload=%lu recipients=%d\n", rounds, payload, recipients );
+
+    request_arena arena;
+    vector<client_info> clients;
+    vector<int> peers;
+    add_clients( server, clients, peers, recipients );
+    Client client( ( char * )"stages", log_file );
+
+    stage_ctx ctx;
+    ctx.server = &server;
+    ctx.clients = &clients;
+    ctx.peers = &peers;
+    ctx.arena = &arena;
+    ctx.next_direct = 0;
+    ctx.client = &client;
+
+    /* Half the users share a channel with the sender so channel posts fan out too */
+    ClientMessage join;
+    make_request( JOINCHANNEL, payload, &join );
+    for( int i = 0; i < recipients; i += 2 ) {
+        server.process_request( join, clients[ i ], &arena.arena );
+        arena.arena.Reset();
+    }
+
+    const char *names[] = { "connected_users", "change_status", "broadcast", "direct_message", "channel_message", "history", "invalid" };
+    int options[] = { CONNECTEDUSER, CHANGESTATUS, BROADCASTC, DIRECTMESSAGE, CHANNELMESSAGE, HISTORYREQUEST, 99 };
+    int n_options = sizeof( options ) / sizeof( options[0] );
+    for( int k = 0; k < n_options; k++ ) {
+        make_request( options[ k ], payload, &ctx.parsed );
+        ctx.parsed.SerializeToString( &ctx.request );
+        run_stage( "parse_request", names[ k ], &ctx, op_parse, rounds );
+    }
+    for( int k = 0; k < n_options; k++ ) {
+        make_request( options[ k ], payload, &ctx.parsed );
+        run_stage( "process_request", names[ k ], &ctx, op_process, rounds );
+    }
+
+    /* The message builders alone, on a server where the sender is the only other user */
+    Server lone( 0, log_file, EVENT_LOOP );
+    lone.set_batching( 1, BATCH_MAX_BYTES );
+    vector<client_info> pair;
+    vector<int> pair_peers;
+    add_clients( lone, pair, pair_peers, 2 );
+    stage_ctx build = ctx;
+    build.server = &lone;
+    build.clients = &pair;
+    build.peers = &pair_peers;
+    make_request( BROADCASTC, payload, &build.parsed );
+    run_stage( "build", "broadcast_message", &build, op_build_broadcast, rounds );
+
+    /* Direct messages go to users picked with a fixed seed on the full server */
+    unsigned int seed = 1;
+    char name[ 32 ];
+    ctx.direct.resize( 1024 );
+    for( size_t i = 0; i < ctx.direct.size(); i++ ) {
+        make_request( DIRECTMESSAGE, payload, &ctx.direct[ i ] );
+        snprintf( name, sizeof( name ), "user%d", 1 + rand_r( &seed ) % ( recipients - 1 ) );
+        ctx.direct[ i ].mutable_directmessage()->set_username( name );
+    }
+    run_stage( "build", "direct_message", &ctx, op_build_direct, rounds );
+
+    /* What send_response serializes: a delivery, a short response and a users page */
+    ServerMessage delivery;
+    delivery.set_option( BROADCASTS );
+    delivery.mutable_broadcast()->set_message( string( payload, 'x' ) );
+    delivery.mutable_broadcast()->set_userid( 1 );
+    delivery.mutable_broadcast()->set_username( "user1" );
+    delivery.mutable_broadcast()->set_sequence( 123456 );
+    ctx.response.CopyFrom( delivery );
+    run_stage( "send_response", "broadcast", &ctx, op_encode, rounds );
+    make_request( CHANGESTATUS, payload, &ctx.parsed );
+    ctx.response.CopyFrom( *server.process_request( ctx.parsed, clients[ 0 ], &arena.arena ) );
+    arena.arena.Reset();
+    run_stage( "send_response", "change_status", &ctx, op_encode, rounds );
+    make_request( CONNECTEDUSER, payload, &ctx.parsed );
+    ctx.response.CopyFrom( *server.process_request( ctx.parsed, clients[ 0 ], &arena.arena ) );
+    arena.arena.Reset();
+    run_stage( "send_response", "connected_users", &ctx, op_encode, rounds );
+
+    /* Client side: a delivery, a direct message and a batch of 16 deliveries */
+    delivery.SerializeToString( &ctx.frame );
+    run_stage( "client", "broadcast", &ctx, op_client, rounds );
+    ServerMessage dm;
+    dm.set_option( MESSAGE );
+    dm.mutable_message()->set_message( string( payload, 'x' ) );
+    dm.mutable_message()->set_userid( 1 );
+    dm.mutable_message()->set_username( "user1" );
+    dm.mutable_message()->set_sequence( 123456 );
+    dm.SerializeToString( &ctx.frame );
+    run_stage( "client", "direct_message", &ctx, op_client, rounds );
+    ServerMessage batch;
+    batch.set_option( BATCH );
+    for( int i = 0; i < 16; i++ )
+        batch.mutable_batch()->add_messages()->CopyFrom( delivery );
+    batch.SerializeToString( &ctx.frame );
+    run_stage( "client", "batch16", &ctx, op_client, rounds / 16 );
+
+    log_close();
+    fclose( log_file );
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include <stdio.h>
+#include <time.h>
+#include "Chat.h"
+
+/*
+* Client user cache benchmark. Loads a presence snapshot of N users, then measures lookups by id
+* and by username (hits and misses), status deltas, join plus leave deltas, resolving the sender
+* of a message and a whole new snapshot. Compares the UserCache against the previous map by
+* username that was scanned for ids, grew a blank entry on every missed name lookup and was
+* cleared and filled again on every snapshot. Reports ns per operation.
+*
+* usage: ./bench_user_cache [users] [operations] [scan lookups]
+*/
+
+typedef map<string, connected_user> name_map;
+
+/*
+* Current monotonic time in seconds
+*/
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void make_user( int idx, const char *status, ConnectedUser *out ) {
+    char name[ 32 ];
+    snprintf( name, sizeof( name ), "user%d", idx );
+    out->set_username( name );
+    out->set_userid( idx + 1 );
+    out->set_status( status );
+}
+
+static void make_snapshot( int users, const char *status, ConnectedUserResponse *out ) {
+    out->mutable_connectedusers()->Reserve( users );
+    for( int i = 0; i < users; i++ )
+        make_user( i, status, out->add_connectedusers() );
+}
+
+/* Previous client: the map is cleared and refilled, every user keeps a copy of its status as ip */
+static void map_snapshot( const ConnectedUserResponse &snap, name_map *users ) {
+    users->clear();
+    for( int i = 0; i < snap.connectedusers_size(); i++ ) {
+        const ConnectedUser &rec_user = snap.connectedusers( i );
+        connected_user &lst_users = ( *users )[ rec_user.username() ];
+        lst_users.name = rec_user.username();
+        lst_users.id = rec_user.userid();
+        lst_users.status = rec_user.status();
+        lst_users.ip = rec_user.status();
+    }
+}
+
+static void map_put( const ConnectedUser &rec_user, name_map *users ) {
+    connected_user &lst_users = ( *users )[ rec_user.username() ];
+    lst_users.name = rec_user.username();
+    lst_users.id = rec_user.userid();
+    lst_users.status = rec_user.status();
+}
+
+static const connected_user * map_find( const name_map &users, int id ) {
+    const connected_user *found = NULL;
+    for( name_map::const_iterator it = users.begin(); it != users.end(); it++ ) {
+        if( it->second.id == id )
+            found = &it->second;
+    }
+    return found;
+}
+
+static void cache_snapshot( const ConnectedUserResponse &snap, UserCache *cache ) {
+    cache->begin_refresh();
+    for( int i = 0; i < snap.connectedusers_size(); i++ )
+        cache->put( snap.connectedusers( i ) );
+    cache->end_refresh();
+}
+
+static void report( const char *op, const char *impl, int users, long ops, double secs ) {
+    printf( "op=%s impl=%s users=%d ops=%ld ns_per_op=%.1f\n", op, impl, users, ops, secs * 1e9 / ops );
+}
+
+int main( int argc, char *argv[] ) {
+    int users = argc > 1 ? atoi( argv[1] ) : 50000;
+    long ops = argc > 2 ? atol( argv[2] ) : 1000000;
+    long scans = argc > 3 ? atol( argv[3] ) : 200;
+
+    ConnectedUserResponse snap, busy;
+    make_snapshot( users, "activo", &snap );
+    make_snapshot( users, "ocupado", &busy );
+    vector<string> names( users );
+    for( int i = 0; i < users; i++ )
+        names[ i ] = snap.connectedusers( i ).username();
+
+    name_map old_users;
+    UserCache cache;
+    map_snapshot( snap, &old_users );
+    cache_snapshot( snap, &cache );
+    volatile long sum = 0;
+    unsigned seed = 1;
+    double start;
+
+    /* Sender of a message by id, the previous map has to be scanned */
+    start = now_sec();
+    for( long i = 0; i < scans; i++ ) {
+        const connected_user *usr = map_find( old_users, rand_r( &seed ) % users + 1 );
+        sum += usr != NULL ? usr->name.size() : 0;
+    }
+    report( "find_id", "map", users, scans, now_sec() - start );
+    start = now_sec();
+    for( long i = 0; i < ops; i++ ) {
+        const connected_user *usr = cache.find( rand_r( &seed ) % users + 1 );
+        sum += usr != NULL ? usr->name.size() : 0;
+    }
+    report( "find_id", "cache", users, ops, now_sec() - start );
+
+    start = now_sec();
+    for( long i = 0; i < ops; i++ )
+        sum += old_users[ names[ rand_r( &seed ) % users ] ].id;
+    report( "find_name", "map", users, ops, now_sec() - start );
+    start = now_sec();
+    for( long i = 0; i < ops; i++ ) {
+        const connected_user *usr = cache.find( names[ rand_r( &seed ) % users ] );
+        sum += usr != NULL ? usr->id : 0;
+    }
+    report( "find_name", "cache", users, ops, now_sec() - start );
+
+    /* Unknown names, operator[] leaves a blank user behind for every one of them */
+    size_t before = old_users.size();
+    start = now_sec();
+    for( long i = 0; i < ops; i++ )
+        sum += old_users[ "nobody" + to_string( i ) ].id;
+    report( "find_missing", "map", users, ops, now_sec() - start );
+    printf( "op=find_missing impl=map blank_entries_added=%lu\n", ( unsigned long )( old_users.size() - before ) );
+    start = now_sec();
+    for( long i = 0; i < ops; i++ )
+        sum += cache.find( "nobody" + to_string( i ) ) != NULL;
+    report( "find_missing", "cache", users, ops, now_sec() - start );
+    map_snapshot( snap, &old_users );
+
+    /* Status deltas */
+    ConnectedUser delta;
+    start = now_sec();
+    for( long i = 0; i < ops; i++ ) {
+        make_user( rand_r( &seed ) % users, i & 1 ? "ocupado" : "activo", &delta );
+        map_put( delta, &old_users );
+    }
+    report( "status", "map", users, ops, now_sec() - start );
+    start = now_sec();
+    for( long i = 0; i < ops; i++ ) {
+        make_user( rand_r( &seed ) % users, i & 1 ? "ocupado" : "activo", &delta );
+        cache.put( delta );
+    }
+    report( "status", "cache", users, ops, now_sec() - start );
+
+    /* A user joins and leaves */
+    start = now_sec();
+    for( long i = 0; i < ops; i++ ) {
+        make_user( users + i, "activo", &delta );
+        map_put( delta, &old_users );
+        old_users.erase( delta.username() );
+    }
+    report( "join_leave", "map", users, ops, now_sec() - start );
+    start = now_sec();
+    for( long i = 0; i < ops; i++ ) {
+        make_user( users + i, "activo", &delta );
+        cache.put( delta );
+        cache.remove( delta.username() );
+    }
+    report( "join_leave", "cache", users, ops, now_sec() - start );
+
+    /* Whole snapshots, the cache keeps its entries and only changes their status */
+    int rounds = 20;
+    start = now_sec();
+    for( int i = 0; i < rounds; i++ )
+        map_snapshot( i & 1 ? snap : busy, &old_users );
+    report( "snapshot", "map", users, rounds, now_sec() - start );
+    start = now_sec();
+    for( int i = 0; i < rounds; i++ )
+        cache_snapshot( i & 1 ? snap : busy, &cache );
+    report( "snapshot", "cache", users, rounds, now_sec() - start );
+
+    printf( "users_map=%lu users_cache=%lu checksum=%ld\n", ( unsigned long )old_users.size(),
+        ( unsigned long )cache.size(), ( long )sum );
+    return 0;
+}
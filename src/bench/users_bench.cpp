@@ -0,0 +1,138 @@
+#include <stdio.h>
+#include <time.h>
+#include "Chat.h"
+
+/*
+* Connected users listing benchmark. Builds the ConnectedUserResponse for every kind of
+* connectedUserRequest at 1k, 10k and 100k users, the way the server handler does on a request
+* arena, and reports ns per request and response bytes. "full" is the previous behaviour of
+* answering every request with all the users, "walk" pages through the whole list.
+*
+* usage: ./bench_users [max users] [rounds]
+*/
+
+/*
+* Current monotonic time in seconds
+*/
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static client_info make_user( int idx ) {
+    char name[ 32 ];
+    snprintf( name, sizeof( name ), "user%d", idx );
+    client_info cl;
+    cl.id = idx + 1;
+    cl.req_fd = -1;
+    cl.name = name;
+    cl.status = "activo";
+    char ip[ INET_ADDRSTRLEN ];
+    struct in_addr addr;
+    addr.s_addr = htonl( ( 10 << 24 ) + idx + 1 );
+    inet_ntop( AF_INET, &addr, ip, sizeof( ip ) );
+    cl.ip = ip;
+    return cl;
+}
+
+/*
+* Previous handler: every connected user in one response
+*/
+static void list_all( const user_table &table, ConnectedUserResponse *out ) {
+    out->mutable_connectedusers()->Reserve( table.users.size() );
+    for( user_map::const_iterator it = table.users.begin(); it != table.users.end(); it++ ) {
+        ConnectedUser *c_user = out->add_connectedusers();
+        c_user->set_username( it->second.name );
+        c_user->set_status( it->second.status );
+        c_user->set_userid( it->second.id );
+    }
+}
+
+/*
+* Single user lookup like the server handler
+*/
+static void lookup( const user_table &table, const connectedUserRequest &req, ConnectedUserResponse *out ) {
+    const client_info *usr = req.has_username() ? table.find( req.username() ) : table.find( req.userid() );
+    if( usr == NULL )
+        return;
+    ConnectedUser *c_user = out->add_connectedusers();
+    c_user->set_username( usr->name );
+    c_user->set_status( usr->status );
+    c_user->set_userid( usr->id );
+}
+
+/*
+* Answer req rounds times on a reset arena, walk follows nextCursor to the end of the list
+*/
+static void run_case( const char *name, const user_table &table, const connectedUserRequest &req, int rounds ) {
+    request_arena arena;
+    size_t bytes = 0, returned = 0, pages = 0;
+    double start = now_sec();
+    for( int r = 0; r < rounds; r++ ) {
+        connectedUserRequest page = req;
+        bytes = returned = pages = 0;
+        int more = 1;
+        while( more ) {
+            ConnectedUserResponse *res = Arena::CreateMessage<ConnectedUserResponse>( &arena.arena );
+            if( strcmp( name, "full" ) == 0 ) {
+                list_all( table, res );
+            } else if( page.has_username() || page.userid() > 0 ) {
+                lookup( table, page, res );
+            } else {
+                table.list( page, res );
+            }
+            /* Option tag and length of the ServerMessage, plus the frame header */
+            bytes += res->ByteSizeLong() + 4 + 6;
+            returned += res->connectedusers_size();
+            pages++;
+            more = strcmp( name, "walk" ) == 0 && res->has_nextcursor();
+            if( more )
+                page.set_cursor( res->nextcursor() );
+            arena.arena.Reset();
+        }
+    }
+    double elapsed = now_sec() - start;
+    printf( "users=%zu request=%s ns_per_request=%.0f response_bytes=%zu users_returned=%zu pages=%zu\n",
+        table.users.size(), name, elapsed * 1e9 / rounds, bytes, returned, pages );
+}
+
+int main( int argc, char *argv[] ) {
+    int max_users = argc > 1 ? atoi( argv[1] ) : 100000;
+    int rounds = argc > 2 ? atoi( argv[2] ) : 20000;
+
+    for( int users = 1000; users <= max_users; users *= 10 ) {
+        UserRegistry registry;
+        vector<client_info> all;
+        for( int i = 0; i < users; i++ )
+            all.push_back( make_user( i ) );
+        registry.add_all( all );
+        user_snapshot snap = registry.snapshot();
+
+        /* Whole list requests scale with the users, fewer rounds keep the run short */
+        int list_rounds = max( 1, rounds * 100 / users );
+        connectedUserRequest req;
+        req.set_userid( 0 );
+        run_case( "full", *snap, req, list_rounds );
+        run_case( "walk", *snap, req, list_rounds );
+        run_case( "first_page", *snap, req, rounds );
+
+        map<string, int>::const_iterator middle = snap->ordered_names.begin();
+        advance( middle, users / 2 );
+        req.set_cursor( middle->first );
+        run_case( "middle_page", *snap, req, rounds );
+
+        req.Clear();
+        req.set_prefix( "user123" );
+        run_case( "prefix", *snap, req, rounds );
+
+        req.Clear();
+        req.set_userid( users / 2 );
+        run_case( "by_id", *snap, req, rounds );
+
+        req.Clear();
+        req.set_username( all[ users / 3 ].name );
+        run_case( "by_name", *snap, req, rounds );
+    }
+    return 0;
+}
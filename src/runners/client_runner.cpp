@@ -2,12 +2,335 @@
 #include <signal.h>
 #include "Chat.h"
 
+/*
+* Command line chat client. Runs on one thread: stdin and the non-blocking Client socket are
+* waited on together, received messages are shown by the message handler as soon as they arrive.
+* A lost connection is retried in the background, what is sent meanwhile goes out once it is back.
+*
+* usage: ./client <username> <server address> <port>
+*/
+
+#define CLI_RECONNECT_BASE_MS 250
+#define CLI_RECONNECT_MAX_MS 8000
+
 int running = 1;
 
-void handle_shutdown( int signal ) {
+void handle_shutdown( int ) {
     running = 0;
 }
 
+/* Interface state kept between menu options */
+struct cli {
+    Client *client;
+    string stdin_buf;
+    deque <message_received> shown[ 3 ];
+    int show_users;
+    unsigned long users_seen;
+    int reconnecting;
+};
+
+/*
+* Let the client handle the events poll returned for its socket
+* returns 0 on succes -1 if the connection closed
+*/
+static int pump( Client *client, short revents ) {
+    if( ( revents & ( POLLOUT | POLLERR | POLLHUP ) ) && client->on_writable() < 0 )
+        return -1;
+    if( ( revents & ( POLLIN | POLLERR | POLLHUP ) ) && client->fd() >= 0 && client->on_readable() < 0 )
+        return -1;
+    return 0;
+}
+
+/*
+* Print a received message
+*/
+static void show_message( const message_received &msg ) {
+    cout << "--------- Mensages ---------" << endl;
+    cout << "ID from: " << msg.from_id << endl;
+    cout << "User name from: " << msg.from_username << endl;
+    if( msg.type == CHANNEL )
+        cout << "Channel: " << msg.channel << endl;
+    cout << "Message: " << msg.message << endl;
+    cout << "----------------------------" << endl;
+}
+
+/*
+* Print the connected users known locally
+*/
+static void show_connected_users( Client *client ) {
+    map <string, connected_user> tmp = client->get_connected_users();
+    map<string, connected_user>::iterator it;
+    cout << "--------- Usuarios conetados ---------" << endl;
+    for( it = tmp.begin(); it != tmp.end(); it++ ) {
+        cout << "User id: " << it->second.id << endl;
+        cout << "User name: " << it->first << endl;
+        cout << "User status: " << it->second.status << endl;
+        cout << "--------------------------------------" << endl;
+    }
+}
+
+/*
+* Message handler, received messages are shown right away and kept to show again
+*/
+static void on_message( void *context, const message_received &msg ) {
+    cli *c = ( cli * )context;
+    show_message( msg );
+    deque<message_received> &shown = c->shown[ msg.type ];
+    shown.push_back( msg );
+    if( shown.size() > SHOWN_MESSAGES )
+        shown.pop_front();
+}
+
+/*
+* Show the errors that arrived, the connection going and coming back and the connected users
+* once a requested list arrived
+*/
+static void render( cli *c ) {
+    string err;
+    while( c->client->pop_error_message( &err ) == 0 ) {
+        cout << "Error: " << err << endl;
+    }
+    client_state st = c->client->state();
+    if( !c->reconnecting && st == CLIENT_RECONNECTING ) {
+        cout << "Connection lost, reconnecting..." << endl;
+        c->reconnecting = 1;
+    } else if( c->reconnecting && st == CLIENT_ESTABLISHED ) {
+        cout << "Reconnected" << endl;
+        c->reconnecting = 0;
+    }
+    if( c->show_users && c->client->users_updates() != c->users_seen ) {
+        c->show_users = 0;
+        show_connected_users( c->client );
+    }
+    cout << flush;
+}
+
+/*
+* Wait for the next line typed on stdin, the connection is served while waiting
+* returns 0 on succes -1 if stdin was closed, the connection closed or the user pressed ctrl-c
+*/
+static int wait_line( cli *c, string *line ) {
+    while( 1 ) {
+        size_t end = c->stdin_buf.find( '\n' );
+        if( end != string::npos ) {
+            line->assign( c->stdin_buf, 0, end );
+            c->stdin_buf.erase( 0, end + 1 );
+            return 0;
+        }
+        if( !running )
+            return -1;
+
+        /* Without a connection fd() is -1 and poll skips it until the next attempt */
+        struct pollfd fds[ 2 ];
+        fds[ 0 ].fd = STDIN_FILENO;
+        fds[ 0 ].events = POLLIN;
+        fds[ 1 ].fd = c->client->fd();
+        fds[ 1 ].events = c->client->poll_events();
+        fds[ 1 ].revents = 0;
+        if( poll( fds, 2, c->client->next_timeout() ) < 0 ) {
+            if( errno == EINTR )
+                continue;
+            return -1;
+        }
+        if( fds[ 1 ].revents )
+            pump( c->client, fds[ 1 ].revents );
+        c->client->on_timeout();
+        render( c );
+        if( c->client->state() == CLIENT_CLOSED ) {
+            cout << "Server disconnected" << endl;
+            return -1;
+        }
+        if( fds[ 0 ].revents & ( POLLIN | POLLHUP ) ) {
+            char buf[ 1024 ];
+            ssize_t n = read( STDIN_FILENO, buf, sizeof( buf ) );
+            if( n < 0 && errno == EINTR )
+                continue;
+            if( n <= 0 )
+                return -1;
+            c->stdin_buf.append( buf, n );
+        }
+    }
+}
+
+/*
+* Read a menu option from stdin
+* returns the option, 0 if it is not a number or -1 if the session ended
+*/
+static int read_option( cli *c ) {
+    string line;
+    if( wait_line( c, &line ) < 0 )
+        return -1;
+    return atoi( line.c_str() );
+}
+
+/*
+* Serve the connection until the log in is answered
+* returns 0 on succes -1 on error
+*/
+static int wait_login( Client *client ) {
+    while( running && client->state() != CLIENT_ESTABLISHED ) {
+        struct pollfd pfd;
+        pfd.fd = client->fd();
+        pfd.events = client->poll_events();
+        if( poll( &pfd, 1, -1 ) < 0 ) {
+            if( errno == EINTR )
+                continue;
+            return -1;
+        }
+        if( pump( client, pfd.revents ) < 0 )
+            return -1;
+    }
+    return client->state() == CLIENT_ESTABLISHED ? 0 : -1;
+}
+
+/*
+* Menu loop. Options 6, 7 and 9-4 show the last SHOWN_MESSAGES of their type again
+*/
+static void run_menu( cli *c, const char *username ) {
+    Client *client = c->client;
+    int input = 0;
+    while( input != 8 ) {
+        printf("\n\n------ Bienvenido al chat %s ------\n", username);
+        printf("Seleccione una opcion:\n");
+        printf("\t1. Enviar mensaje al canal publico\n");
+        printf("\t2. Enviar mensaje directo \n");
+        printf("\t3. Cambiar de estado \n");
+        printf("\t4. Ver usuarios conectados \n");
+        printf("\t5. Ver informacion de usuario \n");
+        printf("\t6. Ver canal general \n");
+        printf("\t7. Ver mensajes directos \n");
+        printf("\t8. Salir \n");
+        printf("\t9. Canales \n");
+        fflush( stdout );
+        input = read_option( c );
+
+        string br_msg = "";
+        string dm = "";
+        string dest_nm = "";
+        int res_cd = 0;
+        int show = -1;
+        int st;
+        string n_sts = "activo";
+        int mm_ui, usr_id;
+        string usr;
+        string channel;
+        connected_user c_usr;
+        switch ( input ) {
+            case 1:
+                cout << "Ingrese mensaje a enviar:\n";
+                res_cd = wait_line( c, &br_msg );
+                if( res_cd == 0 )
+                    res_cd = client->broadcast_message( br_msg );
+                break;
+            case 2:
+                printf("Ingrese nombre de usuario del destinatario:\n");
+                res_cd = wait_line( c, &dest_nm );
+                printf("Ingrese el mensaje a enviar: \n");
+                if( res_cd == 0 )
+                    res_cd = wait_line( c, &dm );
+                if( res_cd == 0 )
+                    res_cd = client->direct_message( dm, -1, dest_nm );
+                break;
+            case 3:
+                printf("Seleccione un estado: \n");
+                printf("1. Activo\n");
+                printf("2. Inctivo\n");
+                printf("3. Ocupado\n");
+                st = read_option( c );
+                if(st == 1)
+                    n_sts = "activo";
+                else if( st == 2 )
+                    n_sts = "inactivo";
+                else if( st == 3 )
+                    n_sts = "ocupado";
+                res_cd = st < 0 ? -1 : client->change_status( n_sts );
+                break;
+            case 4:
+                /* A list requested from the server is shown when it arrives */
+                c->users_seen = client->users_updates();
+                res_cd = client->get_connected_request();
+                if( res_cd == 0 )
+                    show_connected_users( client );
+                c->show_users = res_cd > 0;
+                break;
+            case 5:
+                printf("Buscar usuario por:\n");
+                printf("1. ID de usuario\n");
+                printf("2. Nombre de usuario\n");
+                mm_ui = read_option( c );
+                switch ( mm_ui ){
+                    case 1:
+                        printf("Ingresa el id de usuario:\n");
+                        usr_id = read_option( c );
+                        c_usr = client->get_connected_user( usr_id );
+                        break;
+                    case 2:
+                        printf("Ingresa el nombre de usuario:\n");
+                        if( wait_line( c, &usr ) == 0 )
+                            c_usr = client->get_connected_user( usr );
+                        break;
+                    default:
+                        printf("Opcion invalida!");
+                        break;
+                }
+                cout << "--------------------------------------" << endl;
+                cout << "User id: " << c_usr.id << endl;
+                cout << "User name: " << c_usr.name << endl;
+                cout << "User status: " << c_usr.status << endl;
+                cout << "User IP: " << c_usr.ip << endl;
+                cout << "--------------------------------------" << endl;
+                break;
+            case 6:
+                show = BROADCAST;
+                break;
+            case 7:
+                show = DIRECT;
+                break;
+            case 8:
+                break;
+            case 9:
+                printf("1. Unirse a un canal\n");
+                printf("2. Salir de un canal\n");
+                printf("3. Enviar mensaje a un canal\n");
+                printf("4. Ver mensajes de canales\n");
+                mm_ui = read_option( c );
+                if( mm_ui >= 1 && mm_ui <= 3 ) {
+                    printf("Ingrese el nombre del canal:\n");
+                    res_cd = wait_line( c, &channel );
+                }
+                if( res_cd < 0 ) {
+                    break;
+                } else if( mm_ui == 1 ) {
+                    res_cd = client->channel_request( JOINCHANNEL, channel );
+                } else if( mm_ui == 2 ) {
+                    res_cd = client->channel_request( LEAVECHANNEL, channel );
+                } else if( mm_ui == 3 ) {
+                    printf("Ingrese el mensaje a enviar: \n");
+                    res_cd = wait_line( c, &br_msg );
+                    if( res_cd == 0 )
+                        res_cd = client->channel_message( br_msg, channel );
+                } else if( mm_ui == 4 ) {
+                    show = CHANNEL;
+                } else {
+                    printf("Opcion invalida!");
+                }
+                break;
+            default:
+                printf("Opcion invalida\n");
+                break;
+        }
+        if( show >= 0 ) {
+            deque<message_received> &shown = c->shown[ show ];
+            for( size_t i = 0; i < shown.size(); i++ ) {
+                show_message( shown[ i ] );
+            }
+        }
+        /* Stdin closed, ctrl-c or the server went away */
+        if( input < 0 || ( res_cd < 0 && client->state() == CLIENT_CLOSED ) || !running )
+            break;
+    }
+}
+
 int main(int argc, char *argv[]) {
 
     signal(SIGINT, handle_shutdown);
@@ -21,33 +344,42 @@ int main(int argc, char *argv[]) {
 
     /* Create client with username */
     Client client( argv[1], log_file );
+    cli c;
+    c.client = &client;
+    c.show_users = 0;
+    c.users_seen = 0;
+    c.reconnecting = 0;
+    client.set_message_handler( &on_message, &c );
+    client.set_reconnect( CLI_RECONNECT_BASE_MS, CLI_RECONNECT_MAX_MS );
 
     /* Connect to server on address:port*/
     int port = atoi(argv[3]);
     char *address = argv[2];
-
-    if( client.connect_server(address, port) < 0 ) {
+    struct sockaddr_in serv;
+    memset( &serv, 0, sizeof( serv ) );
+    serv.sin_family = AF_INET;
+    serv.sin_port = htons( port );
+    if( inet_pton( AF_INET, address, &serv.sin_addr ) <= 0 || client.connect_async( &serv ) < 0 ) {
         printf("Connection error!\n");
         return -1;
     }
 
-    printf("Connected to server at %s:%d\n", address, port);
-
     /* Log in to server */
-    printf("Logging in to server username: %s...\n", argv[1]);
-    if( client.log_in() < 0 ) {
+    printf("Logging in to server at %s:%d username: %s...\n", address, port, argv[1]);
+    if( wait_login( &client ) < 0 ) {
+        string err;
+        if( client.pop_error_message( &err ) == 0 )
+            printf("Error: %s\n", err.c_str());
         printf("Unable to log in\n");
         return -1;
     }
 
-    client.start_session();
-
-    if( !running ) {
-        client.stop_session();
-        fclose( log_file );
-    }
+    run_menu( &c, argv[1] );
 
+    client.stop_session();
+    log_close();
+    fclose( log_file );
 
     return 0;
 
-}
\ No newline at end of file
+}
@@ -1,6 +1,25 @@
 #include <stdio.h>
+#include <signal.h>
 #include "Chat.h"
 
+/*
+* usage: ./server <port> [threaded|epoll|workers [n]] [options]
+* workers starts n event loops (default: one per core) sharing the port with SO_REUSEPORT
+* options:
+*   --out-bytes <n>     max bytes queued per connection
+*   --out-frames <n>    max frames queued per connection
+*   --out-policy <p>    drop-oldest | drop-newest | disconnect
+*   --io <backend>      epoll | uring, I/O of the epoll and workers modes (uring falls back to epoll)
+*   --batch-window <us> how long deliveries to batching clients are coalesced, 0 turns it off
+*   --batch-bytes <n>   held delivery bytes that send a batch before its window ends
+*   --log-dir <dir>     keep direct messages to offline users in a message log in dir, and the
+*                       history that does not fit in memory in dir/history
+*   --history <n>       broadcasts and direct messages kept in memory for reconnecting clients
+*   --admin <addr>      serve the metrics in the Prometheus text format on a localhost port or
+*                       the path of a Unix socket
+*   --backlog <n>       pending connections the listening socket holds, capped by somaxconn
+*   --handshake-timeout <ms> close connections that have not logged in after ms
+*/
 int main(int argc, char *argv[]) {
 
     GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -11,13 +30,100 @@ int main(int argc, char *argv[]) {
     }
 
     int port = atoi(argv[1]);
-    Server server(port);
+
+    /* Optional server mode: threaded (default), epoll or workers */
+    server_mode mode = THREADED;
+    int n_workers = sysconf( _SC_NPROCESSORS_ONLN );
+    int opt = 2;
+    if( argc > 2 && strncmp( argv[2], "--", 2 ) != 0 ) {
+        if( strcmp( argv[2], "epoll" ) == 0 ) {
+            mode = EVENT_LOOP;
+        } else if( strcmp( argv[2], "workers" ) == 0 ) {
+            mode = WORKERS;
+        }
+        opt = 3;
+        if( mode == WORKERS && argc > 3 && strncmp( argv[3], "--", 2 ) != 0 ) {
+            n_workers = atoi( argv[3] );
+            opt = 4;
+        }
+    }
+
+    /* Outbound queue limits */
+    size_t out_bytes = OUT_MAX_BYTES;
+    size_t out_frames = OUT_MAX_FRAMES;
+    overflow_policy out_policy = DROP_OLDEST_BROADCAST;
+    io_backend backend = EPOLL_BACKEND;
+    long batch_window = BATCH_WINDOW_US;
+    size_t batch_bytes = BATCH_MAX_BYTES;
+    const char *log_dir = NULL;
+    size_t history = HISTORY_SIZE;
+    const char *admin = NULL;
+    int backlog = MAX_QUEUE;
+    long handshake_timeout = HANDSHAKE_TIMEOUT_MS;
+    for( ; opt + 1 < argc; opt += 2 ) {
+        if( strcmp( argv[opt], "--out-bytes" ) == 0 ) {
+            out_bytes = atol( argv[opt + 1] );
+        } else if( strcmp( argv[opt], "--out-frames" ) == 0 ) {
+            out_frames = atol( argv[opt + 1] );
+        } else if( strcmp( argv[opt], "--out-policy" ) == 0 ) {
+            if( strcmp( argv[opt + 1], "drop-newest" ) == 0 ) {
+                out_policy = DROP_NEWEST;
+            } else if( strcmp( argv[opt + 1], "disconnect" ) == 0 ) {
+                out_policy = DISCONNECT;
+            } else {
+                out_policy = DROP_OLDEST_BROADCAST;
+            }
+        } else if( strcmp( argv[opt], "--io" ) == 0 ) {
+            backend = strcmp( argv[opt + 1], "uring" ) == 0 ? URING_BACKEND : EPOLL_BACKEND;
+        } else if( strcmp( argv[opt], "--batch-window" ) == 0 ) {
+            batch_window = atol( argv[opt + 1] );
+        } else if( strcmp( argv[opt], "--batch-bytes" ) == 0 ) {
+            batch_bytes = atol( argv[opt + 1] );
+        } else if( strcmp( argv[opt], "--log-dir" ) == 0 ) {
+            log_dir = argv[opt + 1];
+        } else if( strcmp( argv[opt], "--history" ) == 0 ) {
+            history = atol( argv[opt + 1] );
+        } else if( strcmp( argv[opt], "--admin" ) == 0 ) {
+            admin = argv[opt + 1];
+        } else if( strcmp( argv[opt], "--backlog" ) == 0 ) {
+            backlog = atoi( argv[opt + 1] );
+        } else if( strcmp( argv[opt], "--handshake-timeout" ) == 0 ) {
+            handshake_timeout = atol( argv[opt + 1] );
+        } else {
+            printf("Unknown option %s\n", argv[opt]);
+            return -1;
+        }
+    }
+
+    /* Closed clients must not kill the server */
+    signal( SIGPIPE, SIG_IGN );
+
+    Server server( port, stdout, mode );
+    server.set_outbound_limits( out_bytes, out_frames, out_policy );
+    server.set_workers( n_workers );
+    server.set_backend( backend );
+    server.set_batching( batch_window, batch_bytes );
+    server.set_backlog( backlog );
+    server.set_handshake_timeout( handshake_timeout );
+    if( log_dir != NULL && server.set_message_log( log_dir ) < 0 ) {
+        perror("Unable to open message log");
+        return -1;
+    }
+    string history_dir = log_dir != NULL ? string( log_dir ) + "/history" : "";
+    if( server.set_history( history, log_dir != NULL ? history_dir.c_str() : NULL ) < 0 ) {
+        perror("Unable to open history");
+        return -1;
+    }
 
     if( server.initiate() < 0 ) {
         perror("Unable to initiate server");
         return -1;
     }
+    if( admin != NULL && server.set_admin( admin ) < 0 ) {
+        perror("Unable to serve metrics");
+        return -1;
+    }
 
     server.start();
 
-}
\ No newline at end of file
+}